@@ -0,0 +1,389 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstring>
+
+#include "CoinCompressedMatrix.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinIndexedVector.hpp"
+#include "CoinMatrixTimes.hpp"
+#include "CoinPackedMatrix.hpp"
+
+namespace {
+// Most distinct values that can be coded
+const int maximumValues = 65536;
+
+// Element values got through codes
+struct CoinByteValues {
+  const unsigned char *code;
+  const double *value;
+  inline double operator[](CoinBigIndex j) const
+  {
+    return value[code[j]];
+  }
+};
+struct CoinShortValues {
+  const unsigned short *code;
+  const double *value;
+  inline double operator[](CoinBigIndex j) const
+  {
+    return value[code[j]];
+  }
+};
+// or kept as they are
+struct CoinPlainValues {
+  const double *value;
+  inline double operator[](CoinBigIndex j) const
+  {
+    return value[j];
+  }
+};
+
+// Major vectors for CoinTimesPieces with one sort of values
+template < class Values >
+struct CoinCompressedVectors {
+  const CoinBigIndex *start;
+  const int *index;
+  Values values;
+  inline CoinBigIndex size(int i) const
+  {
+    return start[i + 1] - start[i];
+  }
+  inline void scatter(int i, double x_i, double *COIN_RESTRICT y) const
+  {
+    const int *COIN_RESTRICT index2 = index;
+    const CoinBigIndex last = start[i + 1];
+    for (CoinBigIndex j = start[i]; j < last; ++j)
+      y[index2[j]] += x_i * values[j];
+  }
+  inline double dot(int i, const double *COIN_RESTRICT x) const
+  {
+    const int *COIN_RESTRICT index2 = index;
+    double y_i = 0.0;
+    const CoinBigIndex last = start[i + 1];
+    for (CoinBigIndex j = start[i]; j < last; ++j)
+      y_i += x[index2[j]] * values[j];
+    return y_i;
+  }
+};
+
+// Scatter if major, otherwise dot products, with one sort of values
+template < class Values >
+void timesValues(const CoinBigIndex *start, const int *index,
+  const Values &values, bool major, const double *x, const int *which,
+  bool packed, int number, CoinBigIndex total, double *y, int sizeY,
+  int numberThreads)
+{
+  CoinCompressedVectors< Values > vectors = { start, index, values };
+  CoinTimesPieces< CoinCompressedVectors< Values > > pieces(vectors);
+  if (major)
+    pieces.scatter(x, which, packed, number, total, y, sizeY, numberThreads);
+  else
+    pieces.dot(x, number, total, y, numberThreads);
+}
+
+// Hash of the bits of a value for a table of 1 << bits slots
+inline int hashValue(double value, int bits)
+{
+  CoinUInt64 bits64;
+  memcpy(&bits64, &value, sizeof(double));
+  return static_cast< int >((bits64 * 0x9e3779b97f4a7c15ULL) >> (64 - bits));
+}
+} // end file-local namespace
+
+//#############################################################################
+
+CoinCompressedMatrix::CoinCompressedMatrix()
+  : colOrdered_(true)
+  , majorDim_(0)
+  , minorDim_(0)
+  , numberValues_(0)
+  , start_(NULL)
+  , index_(NULL)
+  , byteCode_(NULL)
+  , shortCode_(NULL)
+  , values_(NULL)
+{
+}
+
+CoinCompressedMatrix::CoinCompressedMatrix(const CoinPackedMatrix &matrix)
+  : colOrdered_(true)
+  , majorDim_(0)
+  , minorDim_(0)
+  , numberValues_(0)
+  , start_(NULL)
+  , index_(NULL)
+  , byteCode_(NULL)
+  , shortCode_(NULL)
+  , values_(NULL)
+{
+  compress(matrix);
+}
+
+CoinCompressedMatrix::CoinCompressedMatrix(const CoinCompressedMatrix &rhs)
+  : colOrdered_(true)
+  , majorDim_(0)
+  , minorDim_(0)
+  , numberValues_(0)
+  , start_(NULL)
+  , index_(NULL)
+  , byteCode_(NULL)
+  , shortCode_(NULL)
+  , values_(NULL)
+{
+  gutsOfCopy(rhs);
+}
+
+CoinCompressedMatrix &
+CoinCompressedMatrix::operator=(const CoinCompressedMatrix &rhs)
+{
+  if (this != &rhs) {
+    gutsOfDestructor();
+    gutsOfCopy(rhs);
+  }
+  return *this;
+}
+
+CoinCompressedMatrix::~CoinCompressedMatrix()
+{
+  gutsOfDestructor();
+}
+
+void CoinCompressedMatrix::gutsOfDestructor()
+{
+  delete[] start_;
+  delete[] index_;
+  delete[] byteCode_;
+  delete[] shortCode_;
+  delete[] values_;
+  start_ = NULL;
+  index_ = NULL;
+  byteCode_ = NULL;
+  shortCode_ = NULL;
+  values_ = NULL;
+  majorDim_ = 0;
+  minorDim_ = 0;
+  numberValues_ = 0;
+}
+
+void CoinCompressedMatrix::gutsOfCopy(const CoinCompressedMatrix &rhs)
+{
+  colOrdered_ = rhs.colOrdered_;
+  majorDim_ = rhs.majorDim_;
+  minorDim_ = rhs.minorDim_;
+  numberValues_ = rhs.numberValues_;
+  if (rhs.start_) {
+    CoinBigIndex numberElements = rhs.getNumElements();
+    start_ = CoinCopyOfArray(rhs.start_, majorDim_ + 1);
+    index_ = CoinCopyOfArray(rhs.index_, numberElements);
+    byteCode_ = CoinCopyOfArray(rhs.byteCode_, numberElements);
+    shortCode_ = CoinCopyOfArray(rhs.shortCode_, numberElements);
+    values_ = CoinCopyOfArray(rhs.values_,
+      rhs.codeSize() ? static_cast< CoinBigIndex >(numberValues_) : numberElements);
+  }
+}
+
+//#############################################################################
+
+void CoinCompressedMatrix::compress(const CoinPackedMatrix &matrix)
+{
+  gutsOfDestructor();
+  colOrdered_ = matrix.isColOrdered();
+  majorDim_ = matrix.getMajorDim();
+  minorDim_ = matrix.getMinorDim();
+  const CoinBigIndex *start = matrix.getVectorStarts();
+  const int *length = matrix.getVectorLengths();
+  const int *index = matrix.getIndices();
+  const double *element = matrix.getElements();
+  const CoinBigIndex numberElements = matrix.getNumElements();
+  start_ = new CoinBigIndex[majorDim_ + 1];
+  index_ = new int[numberElements];
+  // code as shorts while there are few enough values
+  unsigned short *code = new unsigned short[numberElements];
+  // tables need be no bigger than the number of elements
+  const int mostValues = static_cast< int >(CoinMin(numberElements,
+    static_cast< CoinBigIndex >(maximumValues)));
+  double *values = new double[CoinMax(mostValues, 1)];
+  // hash at most half full
+  int hashBits = 4;
+  while ((1 << hashBits) < 2 * mostValues)
+    hashBits++;
+  const int hashMask = (1 << hashBits) - 1;
+  int *hash = new int[hashMask + 1];
+  CoinFillN(hash, hashMask + 1, -1);
+  int numberValues = 0;
+  bool coded = true;
+  CoinBigIndex put = 0;
+  start_[0] = 0;
+  for (int i = 0; i < majorDim_; i++) {
+    const CoinBigIndex last = start[i] + length[i];
+    for (CoinBigIndex j = start[i]; j < last; j++) {
+      index_[put] = index[j];
+      if (coded) {
+        const double value = element[j];
+        int iHash = hashValue(value, hashBits);
+        while (hash[iHash] >= 0 && memcmp(values + hash[iHash], &value, sizeof(double)))
+          iHash = (iHash + 1) & hashMask;
+        if (hash[iHash] < 0) {
+          if (numberValues == mostValues) {
+            coded = false;
+          } else {
+            hash[iHash] = numberValues;
+            values[numberValues++] = value;
+          }
+        }
+        code[put] = static_cast< unsigned short >(hash[iHash]);
+      }
+      put++;
+    }
+    start_[i + 1] = put;
+  }
+  delete[] hash;
+  if (!coded) {
+    // keep doubles
+    delete[] code;
+    values_ = new double[numberElements];
+    put = 0;
+    for (int i = 0; i < majorDim_; i++) {
+      CoinMemcpyN(element + start[i], length[i], values_ + put);
+      put += length[i];
+    }
+  } else {
+    numberValues_ = numberValues;
+    values_ = CoinCopyOfArray(values, numberValues);
+    if (numberValues <= 256) {
+      byteCode_ = new unsigned char[numberElements];
+      for (CoinBigIndex j = 0; j < numberElements; j++)
+        byteCode_[j] = static_cast< unsigned char >(code[j]);
+      delete[] code;
+    } else {
+      shortCode_ = code;
+    }
+  }
+  delete[] values;
+}
+
+void CoinCompressedMatrix::expand(CoinPackedMatrix &matrix) const
+{
+  const CoinBigIndex numberElements = getNumElements();
+  CoinBigIndex *start = new CoinBigIndex[majorDim_ + 1];
+  int *index = CoinCopyOfArray(index_, numberElements);
+  double *element = new double[numberElements];
+  start[0] = 0;
+  if (start_)
+    CoinMemcpyN(start_, majorDim_ + 1, start);
+  for (CoinBigIndex j = 0; j < numberElements; j++)
+    element[j] = value(j);
+  int *length = NULL;
+  matrix.assignMatrix(colOrdered_, minorDim_, majorDim_, numberElements,
+    element, index, start, length);
+}
+
+size_t CoinCompressedMatrix::memoryUsed() const
+{
+  size_t numberElements = static_cast< size_t >(getNumElements());
+  size_t size = sizeof(CoinCompressedMatrix);
+  if (start_) {
+    size += (majorDim_ + 1) * sizeof(CoinBigIndex);
+    size += numberElements * (sizeof(int) + codeSize());
+    size += (codeSize() ? numberValues_ : numberElements) * sizeof(double);
+  }
+  return size;
+}
+
+//#############################################################################
+
+void CoinCompressedMatrix::times(const double *x, double *y,
+  int numberThreads) const
+{
+  if (colOrdered_)
+    timesMajor(x, y, numberThreads);
+  else
+    timesMinor(x, y, numberThreads);
+}
+
+void CoinCompressedMatrix::times(const CoinIndexedVector &x, double *y,
+  int numberThreads) const
+{
+  if (colOrdered_)
+    timesMajor(x, y, numberThreads);
+  else
+    timesMinor(x, y, numberThreads);
+}
+
+void CoinCompressedMatrix::transposeTimes(const double *x, double *y,
+  int numberThreads) const
+{
+  if (colOrdered_)
+    timesMinor(x, y, numberThreads);
+  else
+    timesMajor(x, y, numberThreads);
+}
+
+void CoinCompressedMatrix::transposeTimes(const CoinIndexedVector &x, double *y,
+  int numberThreads) const
+{
+  if (colOrdered_)
+    timesMinor(x, y, numberThreads);
+  else
+    timesMajor(x, y, numberThreads);
+}
+
+//-----------------------------------------------------------------------------
+
+void CoinCompressedMatrix::timesPieces(bool major, const double *x,
+  const int *which, bool packed, int number, CoinBigIndex total, double *y,
+  int numberThreads) const
+{
+  if (byteCode_) {
+    CoinByteValues values = { byteCode_, values_ };
+    timesValues(start_, index_, values, major, x, which, packed, number,
+      total, y, minorDim_, numberThreads);
+  } else if (shortCode_) {
+    CoinShortValues values = { shortCode_, values_ };
+    timesValues(start_, index_, values, major, x, which, packed, number,
+      total, y, minorDim_, numberThreads);
+  } else {
+    CoinPlainValues values = { values_ };
+    timesValues(start_, index_, values, major, x, which, packed, number,
+      total, y, minorDim_, numberThreads);
+  }
+}
+
+void CoinCompressedMatrix::timesMajor(const double *x, double *y,
+  int numberThreads) const
+{
+  timesPieces(true, x, NULL, false, majorDim_, getNumElements(), y,
+    numberThreads);
+}
+
+void CoinCompressedMatrix::timesMajor(const CoinIndexedVector &x, double *y,
+  int numberThreads) const
+{
+  int number = x.getNumElements();
+  const int *which = x.getIndices();
+  CoinBigIndex total = 0;
+  for (int k = 0; k < number; k++)
+    total += start_[which[k] + 1] - start_[which[k]];
+  timesPieces(true, x.denseVector(), which, x.packedMode(), number, total, y,
+    numberThreads);
+}
+
+void CoinCompressedMatrix::timesMinor(const double *x, double *y,
+  int numberThreads) const
+{
+  timesPieces(false, x, NULL, false, majorDim_, getNumElements(), y,
+    numberThreads);
+}
+
+void CoinCompressedMatrix::timesMinor(const CoinIndexedVector &x, double *y,
+  int numberThreads) const
+{
+  double *scratch;
+  timesMinor(CoinTimesDense(x, minorDim_, scratch), y, numberThreads);
+  delete[] scratch;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,185 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CoinCompressedMatrix_H
+#define CoinCompressedMatrix_H
+
+#include <cstddef>
+
+#include "CoinTypes.hpp"
+
+class CoinIndexedVector;
+class CoinPackedMatrix;
+
+/** Read only copy of a CoinPackedMatrix with element values kept as codes.
+
+    Many models have only a few distinct coefficients (often mostly +1 and
+    -1).  The layout is as in CoinPackedMatrix - CoinBigIndex starts and an
+    int index for each element, with no gaps - but instead of a double for
+    each element there is a one byte code (up to 256 distinct values) or a
+    two byte code (up to 65536) into a table of the values.  So times and
+    transposeTimes read 5 or 6 bytes for each element instead of 12.  With
+    more distinct values than that the doubles are kept as they are.
+
+    Products add up the same terms in the same order as CoinPackedMatrix,
+    so the results are exactly the same.  To change the matrix change the
+    CoinPackedMatrix and make a new copy.
+*/
+class CoinCompressedMatrix {
+
+public:
+  /**@name Constructors and destructor */
+  //@{
+  /// Default constructor - empty matrix
+  CoinCompressedMatrix();
+  /// Copy of matrix (see compress)
+  explicit CoinCompressedMatrix(const CoinPackedMatrix &matrix);
+  /// Copy constructor
+  CoinCompressedMatrix(const CoinCompressedMatrix &rhs);
+  /// Assignment operator
+  CoinCompressedMatrix &operator=(const CoinCompressedMatrix &rhs);
+  /// Destructor
+  ~CoinCompressedMatrix();
+  //@}
+
+  /**@name Building */
+  //@{
+  /** Replaces this by a copy of matrix.
+
+      Values are told apart by their bits, so 0.0 and -0.0 get different
+      codes and every value comes back exactly.
+  */
+  void compress(const CoinPackedMatrix &matrix);
+  /// Puts an ordinary copy (same ordering, no gaps) in matrix
+  void expand(CoinPackedMatrix &matrix) const;
+  //@}
+
+  /**@name Queries */
+  //@{
+  /// Whether the matrix is column ordered
+  inline bool isColOrdered() const
+  {
+    return colOrdered_;
+  }
+  /// Number of elements
+  inline CoinBigIndex getNumElements() const
+  {
+    return majorDim_ ? start_[majorDim_] : 0;
+  }
+  /// Number of columns
+  inline int getNumCols() const
+  {
+    return colOrdered_ ? majorDim_ : minorDim_;
+  }
+  /// Number of rows
+  inline int getNumRows() const
+  {
+    return colOrdered_ ? minorDim_ : majorDim_;
+  }
+  /// Number of major vectors (columns if column ordered)
+  inline int getMajorDim() const
+  {
+    return majorDim_;
+  }
+  /// Number of minor vectors
+  inline int getMinorDim() const
+  {
+    return minorDim_;
+  }
+  /// Starts of major vectors (getMajorDim()+1 of them)
+  inline const CoinBigIndex *getVectorStarts() const
+  {
+    return start_;
+  }
+  /// Minor indices
+  inline const int *getIndices() const
+  {
+    return index_;
+  }
+  /// Bytes in each code (1 or 2), or 0 if doubles are kept
+  inline int codeSize() const
+  {
+    return byteCode_ ? 1 : (shortCode_ ? 2 : 0);
+  }
+  /// Number of distinct values (when coded)
+  inline int numberValues() const
+  {
+    return numberValues_;
+  }
+  /// Value of element j
+  inline double value(CoinBigIndex j) const
+  {
+    if (byteCode_)
+      return values_[byteCode_[j]];
+    else if (shortCode_)
+      return values_[shortCode_[j]];
+    else
+      return values_[j];
+  }
+  /// Bytes of storage used
+  size_t memoryUsed() const;
+  //@}
+
+  /**@name Matrix times vector methods
+
+     As the methods of the same name in CoinPackedMatrix, including how
+     work is split between up to \p numberThreads threads.
+  */
+  //@{
+  /// Return <code>A * x</code> in <code>y</code>
+  void times(const double *x, double *y, int numberThreads = 1) const;
+  /// Return <code>A * x</code> in <code>y</code> (x an indexed vector)
+  void times(const CoinIndexedVector &x, double *y, int numberThreads = 1) const;
+  /// Return <code>x * A</code> in <code>y</code>
+  void transposeTimes(const double *x, double *y, int numberThreads = 1) const;
+  /// Return <code>x * A</code> in <code>y</code> (x an indexed vector)
+  void transposeTimes(const CoinIndexedVector &x, double *y,
+    int numberThreads = 1) const;
+  /// Scatters each major vector times x (x of size majorDim)
+  void timesMajor(const double *x, double *y, int numberThreads = 1) const;
+  /// As previous but only the nonzeros of x are looked at
+  void timesMajor(const CoinIndexedVector &x, double *y,
+    int numberThreads = 1) const;
+  /// Dot product of each major vector with x (x of size minorDim)
+  void timesMinor(const double *x, double *y, int numberThreads = 1) const;
+  /// As previous with x an indexed vector
+  void timesMinor(const CoinIndexedVector &x, double *y,
+    int numberThreads = 1) const;
+  //@}
+
+private:
+  /// Frees arrays
+  void gutsOfDestructor();
+  /// Copies from rhs (arrays freed)
+  void gutsOfCopy(const CoinCompressedMatrix &rhs);
+  /** Does timesMajor (major true) for all of x (which NULL) or number
+      nonzeros of x, or timesMinor for all number major vectors */
+  void timesPieces(bool major, const double *x, const int *which,
+    bool packed, int number, CoinBigIndex total, double *y,
+    int numberThreads) const;
+
+  /// Column ordered
+  bool colOrdered_;
+  /// Number of major vectors
+  int majorDim_;
+  /// Number of minor vectors
+  int minorDim_;
+  /// Number of distinct values (0 if not coded)
+  int numberValues_;
+  /// Starts
+  CoinBigIndex *start_;
+  /// Minor indices
+  int *index_;
+  /// One byte codes (or NULL)
+  unsigned char *byteCode_;
+  /// Two byte codes (or NULL)
+  unsigned short *shortCode_;
+  /// Table of values, or element values if not coded
+  double *values_;
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
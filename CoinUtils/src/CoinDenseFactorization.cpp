@@ -146,8 +146,8 @@ void CoinDenseFactorization::gutsOfCopy(const CoinDenseFactorization &other)
 //called by constructors
 void CoinDenseFactorization::getAreas(int numberOfRows,
   int numberOfColumns,
-  int,
-  int)
+  CoinBigIndex,
+  CoinBigIndex)
 {
 
   numberRows_ = numberOfRows;
@@ -1019,9 +1019,9 @@ int *CoinOtherFactorization::numberInColumn() const
   return (reinterpret_cast< int * >(workArea_)) + numberRows_;
 }
 // Returns array to put basis starts in
-int *CoinOtherFactorization::starts() const
+CoinBigIndex *CoinOtherFactorization::starts() const
 {
-  return reinterpret_cast< int * >(pivotRow_);
+  return reinterpret_cast< CoinBigIndex * >(pivotRow_);
 }
 // Returns array to put basis elements in
 CoinFactorizationDouble *
@@ -18,7 +18,7 @@
 #include "CoinTypes.hpp"
 #include "CoinIndexedVector.hpp"
 #include "CoinFactorization.hpp"
-#if COIN_FACTORIZATION_DENSE_CODE == 2
+#if COIN_FACTORIZATION_DENSE_CODE == 2 || COIN_FACTORIZATION_DENSE_CODE == 4
 #undef COIN_FACTORIZATION_DENSE_CODE
 #endif
 class CoinPackedMatrix;
@@ -134,7 +134,7 @@ public:
   /// Number of entries in each column
   virtual int *numberInColumn() const;
   /// Returns array to put basis starts in
-  virtual int *starts() const;
+  virtual CoinBigIndex *starts() const;
   /// Returns permute back
   virtual int *permuteBack() const;
   /** Get solve mode e.g. 0 C++ code, 1 Lapack, 2 choose
@@ -170,15 +170,15 @@ public:
   /// Returns permute in
   virtual int *permute() const = 0;
   /// Total number of elements in factorization
-  virtual int numberElements() const = 0;
+  virtual CoinBigIndex numberElements() const = 0;
   //@}
   /**@name Do factorization - public */
   //@{
   /// Gets space for a factorization
   virtual void getAreas(int numberRows,
     int numberColumns,
-    int maximumL,
-    int maximumU)
+    CoinBigIndex maximumL,
+    CoinBigIndex maximumU)
     = 0;
 
   /// PreProcesses column ordered copy of basis
@@ -280,7 +280,7 @@ protected:
   /// Maximum rows ever (i.e. use to copy arrays etc)
   int maximumRows_;
   /// Maximum length of iterating area
-  int maximumSpace_;
+  CoinBigIndex maximumSpace_;
   /// Pivot row
   int *pivotRow_;
   /** Elements of factorization and updates
@@ -328,8 +328,8 @@ public:
   /// Gets space for a factorization
   virtual void getAreas(int numberRows,
     int numberColumns,
-    int maximumL,
-    int maximumU);
+    CoinBigIndex maximumL,
+    CoinBigIndex maximumU);
 
   /// PreProcesses column ordered copy of basis
   virtual void preProcess();
@@ -348,9 +348,9 @@ public:
   /**@name general stuff such as number of elements */
   //@{
   /// Total number of elements in factorization
-  virtual inline int numberElements() const
+  virtual inline CoinBigIndex numberElements() const
   {
-    return numberRows_ * (numberColumns_ + numberPivots_);
+    return static_cast< CoinBigIndex >(numberRows_) * (numberColumns_ + numberPivots_);
   }
   /// Returns maximum absolute value in factorization
   double maximumCoefficient() const;
@@ -0,0 +1,147 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cmath>
+
+#include "CoinDenseLU.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinSimd.hpp"
+
+namespace {
+// Swaps rows for pivots first..last-1 in columns firstColumn..lastColumn-1
+void swapRows(double *a, int lda, const int *pivot, int first, int last,
+  int firstColumn, int lastColumn)
+{
+  for (int iColumn = firstColumn; iColumn < lastColumn; iColumn++) {
+    double *column = a + iColumn * lda;
+    for (int j = first; j < last; j++) {
+      int iRow = pivot[j] - 1;
+      if (iRow != j) {
+        double value = column[j];
+        column[j] = column[iRow];
+        column[iRow] = value;
+      }
+    }
+  }
+}
+} // end file-local namespace
+
+int CoinDenseLUFactor(int n, double *a, int lda, int *pivot)
+{
+  int info = 0;
+  for (int first = 0; first < n; first += COIN_DENSE_LU_BLOCK) {
+    int last = CoinMin(first + COIN_DENSE_LU_BLOCK, n);
+    // factorize panel one column at a time
+    for (int j = first; j < last; j++) {
+      double *column = a + j * lda;
+      int iRow = j;
+      double largest = fabs(column[j]);
+      for (int i = j + 1; i < n; i++) {
+        if (fabs(column[i]) > largest) {
+          largest = fabs(column[i]);
+          iRow = i;
+        }
+      }
+      pivot[j] = iRow + 1;
+      if (!largest) {
+        if (!info)
+          info = j + 1;
+        continue;
+      }
+      if (iRow != j)
+        swapRows(a, lda, pivot, j, j + 1, first, last);
+      double multiplier = 1.0 / column[j];
+      for (int i = j + 1; i < n; i++)
+        column[i] *= multiplier;
+      for (int k = j + 1; k < last; k++) {
+        double *column2 = a + k * lda;
+        CoinSimdSubtract(column2 + j + 1, column + j + 1, n - j - 1, column2[j]);
+      }
+    }
+    // same swaps to left and right of panel
+    swapRows(a, lda, pivot, first, last, 0, first);
+    swapRows(a, lda, pivot, first, last, last, n);
+    // rows of U to right of panel
+    for (int k = last; k < n; k++) {
+      double *column2 = a + k * lda;
+      for (int j = first; j < last; j++)
+        CoinSimdSubtract(column2 + j + 1, a + j * lda + j + 1, last - j - 1,
+          column2[j]);
+    }
+    // update rest a tile of rows at a time so panel stays in cache
+    for (int firstRow = last; firstRow < n; firstRow += COIN_DENSE_LU_TILE) {
+      int number = CoinMin(COIN_DENSE_LU_TILE, n - firstRow);
+      for (int k = last; k < n; k++) {
+        double *column2 = a + k * lda;
+        for (int j = first; j < last; j++) {
+          double value = column2[j];
+          if (value)
+            CoinSimdSubtract(column2 + firstRow, a + j * lda + firstRow,
+              number, value);
+        }
+      }
+    }
+  }
+  return info;
+}
+
+void CoinDenseLUSolve(bool transpose, int n, const double *a, int lda,
+  const int *pivot, double *b)
+{
+  int j;
+  if (!transpose) {
+    for (j = 0; j < n; j++) {
+      int iRow = pivot[j] - 1;
+      if (iRow != j) {
+        double value = b[j];
+        b[j] = b[iRow];
+        b[iRow] = value;
+      }
+    }
+    // L
+    for (j = 0; j < n - 1; j++) {
+      double value = b[j];
+      if (value)
+        CoinSimdSubtract(b + j + 1, a + j * lda + j + 1, n - j - 1, value);
+    }
+    // U
+    for (j = n - 1; j >= 0; j--) {
+      const double *column = a + j * lda;
+      double value = b[j];
+      if (value) {
+        value /= column[j];
+        b[j] = value;
+        CoinSimdSubtract(b, column, j, value);
+      }
+    }
+  } else {
+    // U transpose
+    for (j = 0; j < n; j++) {
+      const double *column = a + j * lda;
+      double value = b[j];
+      for (int i = 0; i < j; i++)
+        value -= column[i] * b[i];
+      b[j] = value / column[j];
+    }
+    // L transpose
+    for (j = n - 2; j >= 0; j--) {
+      const double *column = a + j * lda;
+      double value = b[j];
+      for (int i = j + 1; i < n; i++)
+        value -= column[i] * b[i];
+      b[j] = value;
+    }
+    for (j = n - 1; j >= 0; j--) {
+      int iRow = pivot[j] - 1;
+      if (iRow != j) {
+        double value = b[j];
+        b[j] = b[iRow];
+        b[iRow] = value;
+      }
+    }
+  }
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,45 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CoinDenseLU_H
+#define CoinDenseLU_H
+
+/** \file CoinDenseLU.hpp
+    \brief Blocked dense LU with partial pivoting.
+
+    Used for the dense part of CoinFactorization in builds without LAPACK
+    made with -DCOIN_FACTORIZATION_DENSE_CODE=4 (it changes when
+    factorizations go dense, so it is not the default).  Matrices and pivots are as for
+    LAPACK dgetrf and dgetrs - column ordered and pivots counting from 1 -
+    so either can be used on the same data.  Columns are done a panel at a
+    time and the rest of the matrix is then updated in tiles of rows which
+    stay in cache, with the loops done by the kernels of CoinSimd.hpp.
+*/
+
+/// Number of columns in a panel
+#ifndef COIN_DENSE_LU_BLOCK
+#define COIN_DENSE_LU_BLOCK 32
+#endif
+/// Number of rows in a tile of the update
+#ifndef COIN_DENSE_LU_TILE
+#define COIN_DENSE_LU_TILE 256
+#endif
+
+/** Factorizes n by n matrix a (leading dimension lda) in place as
+    P * a = L * U with L unit lower triangular.  pivot[i] is row swapped
+    with row i.  Returns 0 or k if U(k-1,k-1) is exactly zero (as dgetrf
+    the factorization is still finished).
+*/
+int CoinDenseLUFactor(int n, double *a, int lda, int *pivot);
+
+/** Solves a * x = b (or a' * x = b if transpose) in place using
+    factorization from CoinDenseLUFactor.
+*/
+void CoinDenseLUSolve(bool transpose, int n, const double *a, int lda,
+  const int *pivot, double *b);
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
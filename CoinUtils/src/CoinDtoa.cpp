@@ -0,0 +1,937 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinUtilsConfig.h"
+#include "CoinDtoa.hpp"
+
+#include <cstring>
+
+/*
+  Shortest digits are found as in R. Giulietti, "The Schubfach way to render
+  doubles" (2020).  The rounding interval of the double is scaled by a 128
+  bit approximation of a power of ten chosen so that at most one or two
+  candidates have to be looked at.  Like Ryu this needs no loops over
+  digits and no big integers.
+*/
+
+namespace {
+
+typedef unsigned long long CoinUInt64Bits;
+
+#define COIN_U64(x) x##ULL
+
+// floor(10^k * 2^(127 - floor(log2(10^k)))) + 1 for k = -292 ... 325 (high word first)
+const CoinUInt64Bits powerOfTen128[] = {
+  COIN_U64(0xFF77B1FCBEBCDC4F), COIN_U64(0x25E8E89C13BB0F7B),
+  COIN_U64(0x9FAACF3DF73609B1), COIN_U64(0x77B191618C54E9AD),
+  COIN_U64(0xC795830D75038C1D), COIN_U64(0xD59DF5B9EF6A2418),
+  COIN_U64(0xF97AE3D0D2446F25), COIN_U64(0x4B0573286B44AD1E),
+  COIN_U64(0x9BECCE62836AC577), COIN_U64(0x4EE367F9430AEC33),
+  COIN_U64(0xC2E801FB244576D5), COIN_U64(0x229C41F793CDA740),
+  COIN_U64(0xF3A20279ED56D48A), COIN_U64(0x6B43527578C11110),
+  COIN_U64(0x9845418C345644D6), COIN_U64(0x830A13896B78AAAA),
+  COIN_U64(0xBE5691EF416BD60C), COIN_U64(0x23CC986BC656D554),
+  COIN_U64(0xEDEC366B11C6CB8F), COIN_U64(0x2CBFBE86B7EC8AA9),
+  COIN_U64(0x94B3A202EB1C3F39), COIN_U64(0x7BF7D71432F3D6AA),
+  COIN_U64(0xB9E08A83A5E34F07), COIN_U64(0xDAF5CCD93FB0CC54),
+  COIN_U64(0xE858AD248F5C22C9), COIN_U64(0xD1B3400F8F9CFF69),
+  COIN_U64(0x91376C36D99995BE), COIN_U64(0x23100809B9C21FA2),
+  COIN_U64(0xB58547448FFFFB2D), COIN_U64(0xABD40A0C2832A78B),
+  COIN_U64(0xE2E69915B3FFF9F9), COIN_U64(0x16C90C8F323F516D),
+  COIN_U64(0x8DD01FAD907FFC3B), COIN_U64(0xAE3DA7D97F6792E4),
+  COIN_U64(0xB1442798F49FFB4A), COIN_U64(0x99CD11CFDF41779D),
+  COIN_U64(0xDD95317F31C7FA1D), COIN_U64(0x40405643D711D584),
+  COIN_U64(0x8A7D3EEF7F1CFC52), COIN_U64(0x482835EA666B2573),
+  COIN_U64(0xAD1C8EAB5EE43B66), COIN_U64(0xDA3243650005EED0),
+  COIN_U64(0xD863B256369D4A40), COIN_U64(0x90BED43E40076A83),
+  COIN_U64(0x873E4F75E2224E68), COIN_U64(0x5A7744A6E804A292),
+  COIN_U64(0xA90DE3535AAAE202), COIN_U64(0x711515D0A205CB37),
+  COIN_U64(0xD3515C2831559A83), COIN_U64(0x0D5A5B44CA873E04),
+  COIN_U64(0x8412D9991ED58091), COIN_U64(0xE858790AFE9486C3),
+  COIN_U64(0xA5178FFF668AE0B6), COIN_U64(0x626E974DBE39A873),
+  COIN_U64(0xCE5D73FF402D98E3), COIN_U64(0xFB0A3D212DC81290),
+  COIN_U64(0x80FA687F881C7F8E), COIN_U64(0x7CE66634BC9D0B9A),
+  COIN_U64(0xA139029F6A239F72), COIN_U64(0x1C1FFFC1EBC44E81),
+  COIN_U64(0xC987434744AC874E), COIN_U64(0xA327FFB266B56221),
+  COIN_U64(0xFBE9141915D7A922), COIN_U64(0x4BF1FF9F0062BAA9),
+  COIN_U64(0x9D71AC8FADA6C9B5), COIN_U64(0x6F773FC3603DB4AA),
+  COIN_U64(0xC4CE17B399107C22), COIN_U64(0xCB550FB4384D21D4),
+  COIN_U64(0xF6019DA07F549B2B), COIN_U64(0x7E2A53A146606A49),
+  COIN_U64(0x99C102844F94E0FB), COIN_U64(0x2EDA7444CBFC426E),
+  COIN_U64(0xC0314325637A1939), COIN_U64(0xFA911155FEFB5309),
+  COIN_U64(0xF03D93EEBC589F88), COIN_U64(0x793555AB7EBA27CB),
+  COIN_U64(0x96267C7535B763B5), COIN_U64(0x4BC1558B2F3458DF),
+  COIN_U64(0xBBB01B9283253CA2), COIN_U64(0x9EB1AAEDFB016F17),
+  COIN_U64(0xEA9C227723EE8BCB), COIN_U64(0x465E15A979C1CADD),
+  COIN_U64(0x92A1958A7675175F), COIN_U64(0x0BFACD89EC191ECA),
+  COIN_U64(0xB749FAED14125D36), COIN_U64(0xCEF980EC671F667C),
+  COIN_U64(0xE51C79A85916F484), COIN_U64(0x82B7E12780E7401B),
+  COIN_U64(0x8F31CC0937AE58D2), COIN_U64(0xD1B2ECB8B0908811),
+  COIN_U64(0xB2FE3F0B8599EF07), COIN_U64(0x861FA7E6DCB4AA16),
+  COIN_U64(0xDFBDCECE67006AC9), COIN_U64(0x67A791E093E1D49B),
+  COIN_U64(0x8BD6A141006042BD), COIN_U64(0xE0C8BB2C5C6D24E1),
+  COIN_U64(0xAECC49914078536D), COIN_U64(0x58FAE9F773886E19),
+  COIN_U64(0xDA7F5BF590966848), COIN_U64(0xAF39A475506A899F),
+  COIN_U64(0x888F99797A5E012D), COIN_U64(0x6D8406C952429604),
+  COIN_U64(0xAAB37FD7D8F58178), COIN_U64(0xC8E5087BA6D33B84),
+  COIN_U64(0xD5605FCDCF32E1D6), COIN_U64(0xFB1E4A9A90880A65),
+  COIN_U64(0x855C3BE0A17FCD26), COIN_U64(0x5CF2EEA09A550680),
+  COIN_U64(0xA6B34AD8C9DFC06F), COIN_U64(0xF42FAA48C0EA481F),
+  COIN_U64(0xD0601D8EFC57B08B), COIN_U64(0xF13B94DAF124DA27),
+  COIN_U64(0x823C12795DB6CE57), COIN_U64(0x76C53D08D6B70859),
+  COIN_U64(0xA2CB1717B52481ED), COIN_U64(0x54768C4B0C64CA6F),
+  COIN_U64(0xCB7DDCDDA26DA268), COIN_U64(0xA9942F5DCF7DFD0A),
+  COIN_U64(0xFE5D54150B090B02), COIN_U64(0xD3F93B35435D7C4D),
+  COIN_U64(0x9EFA548D26E5A6E1), COIN_U64(0xC47BC5014A1A6DB0),
+  COIN_U64(0xC6B8E9B0709F109A), COIN_U64(0x359AB6419CA1091C),
+  COIN_U64(0xF867241C8CC6D4C0), COIN_U64(0xC30163D203C94B63),
+  COIN_U64(0x9B407691D7FC44F8), COIN_U64(0x79E0DE63425DCF1E),
+  COIN_U64(0xC21094364DFB5636), COIN_U64(0x985915FC12F542E5),
+  COIN_U64(0xF294B943E17A2BC4), COIN_U64(0x3E6F5B7B17B2939E),
+  COIN_U64(0x979CF3CA6CEC5B5A), COIN_U64(0xA705992CEECF9C43),
+  COIN_U64(0xBD8430BD08277231), COIN_U64(0x50C6FF782A838354),
+  COIN_U64(0xECE53CEC4A314EBD), COIN_U64(0xA4F8BF5635246429),
+  COIN_U64(0x940F4613AE5ED136), COIN_U64(0x871B7795E136BE9A),
+  COIN_U64(0xB913179899F68584), COIN_U64(0x28E2557B59846E40),
+  COIN_U64(0xE757DD7EC07426E5), COIN_U64(0x331AEADA2FE589D0),
+  COIN_U64(0x9096EA6F3848984F), COIN_U64(0x3FF0D2C85DEF7622),
+  COIN_U64(0xB4BCA50B065ABE63), COIN_U64(0x0FED077A756B53AA),
+  COIN_U64(0xE1EBCE4DC7F16DFB), COIN_U64(0xD3E8495912C62895),
+  COIN_U64(0x8D3360F09CF6E4BD), COIN_U64(0x64712DD7ABBBD95D),
+  COIN_U64(0xB080392CC4349DEC), COIN_U64(0xBD8D794D96AACFB4),
+  COIN_U64(0xDCA04777F541C567), COIN_U64(0xECF0D7A0FC5583A1),
+  COIN_U64(0x89E42CAAF9491B60), COIN_U64(0xF41686C49DB57245),
+  COIN_U64(0xAC5D37D5B79B6239), COIN_U64(0x311C2875C522CED6),
+  COIN_U64(0xD77485CB25823AC7), COIN_U64(0x7D633293366B828C),
+  COIN_U64(0x86A8D39EF77164BC), COIN_U64(0xAE5DFF9C02033198),
+  COIN_U64(0xA8530886B54DBDEB), COIN_U64(0xD9F57F830283FDFD),
+  COIN_U64(0xD267CAA862A12D66), COIN_U64(0xD072DF63C324FD7C),
+  COIN_U64(0x8380DEA93DA4BC60), COIN_U64(0x4247CB9E59F71E6E),
+  COIN_U64(0xA46116538D0DEB78), COIN_U64(0x52D9BE85F074E609),
+  COIN_U64(0xCD795BE870516656), COIN_U64(0x67902E276C921F8C),
+  COIN_U64(0x806BD9714632DFF6), COIN_U64(0x00BA1CD8A3DB53B7),
+  COIN_U64(0xA086CFCD97BF97F3), COIN_U64(0x80E8A40ECCD228A5),
+  COIN_U64(0xC8A883C0FDAF7DF0), COIN_U64(0x6122CD128006B2CE),
+  COIN_U64(0xFAD2A4B13D1B5D6C), COIN_U64(0x796B805720085F82),
+  COIN_U64(0x9CC3A6EEC6311A63), COIN_U64(0xCBE3303674053BB1),
+  COIN_U64(0xC3F490AA77BD60FC), COIN_U64(0xBEDBFC4411068A9D),
+  COIN_U64(0xF4F1B4D515ACB93B), COIN_U64(0xEE92FB5515482D45),
+  COIN_U64(0x991711052D8BF3C5), COIN_U64(0x751BDD152D4D1C4B),
+  COIN_U64(0xBF5CD54678EEF0B6), COIN_U64(0xD262D45A78A0635E),
+  COIN_U64(0xEF340A98172AACE4), COIN_U64(0x86FB897116C87C35),
+  COIN_U64(0x9580869F0E7AAC0E), COIN_U64(0xD45D35E6AE3D4DA1),
+  COIN_U64(0xBAE0A846D2195712), COIN_U64(0x8974836059CCA10A),
+  COIN_U64(0xE998D258869FACD7), COIN_U64(0x2BD1A438703FC94C),
+  COIN_U64(0x91FF83775423CC06), COIN_U64(0x7B6306A34627DDD0),
+  COIN_U64(0xB67F6455292CBF08), COIN_U64(0x1A3BC84C17B1D543),
+  COIN_U64(0xE41F3D6A7377EECA), COIN_U64(0x20CABA5F1D9E4A94),
+  COIN_U64(0x8E938662882AF53E), COIN_U64(0x547EB47B7282EE9D),
+  COIN_U64(0xB23867FB2A35B28D), COIN_U64(0xE99E619A4F23AA44),
+  COIN_U64(0xDEC681F9F4C31F31), COIN_U64(0x6405FA00E2EC94D5),
+  COIN_U64(0x8B3C113C38F9F37E), COIN_U64(0xDE83BC408DD3DD05),
+  COIN_U64(0xAE0B158B4738705E), COIN_U64(0x9624AB50B148D446),
+  COIN_U64(0xD98DDAEE19068C76), COIN_U64(0x3BADD624DD9B0958),
+  COIN_U64(0x87F8A8D4CFA417C9), COIN_U64(0xE54CA5D70A80E5D7),
+  COIN_U64(0xA9F6D30A038D1DBC), COIN_U64(0x5E9FCF4CCD211F4D),
+  COIN_U64(0xD47487CC8470652B), COIN_U64(0x7647C32000696720),
+  COIN_U64(0x84C8D4DFD2C63F3B), COIN_U64(0x29ECD9F40041E074),
+  COIN_U64(0xA5FB0A17C777CF09), COIN_U64(0xF468107100525891),
+  COIN_U64(0xCF79CC9DB955C2CC), COIN_U64(0x7182148D4066EEB5),
+  COIN_U64(0x81AC1FE293D599BF), COIN_U64(0xC6F14CD848405531),
+  COIN_U64(0xA21727DB38CB002F), COIN_U64(0xB8ADA00E5A506A7D),
+  COIN_U64(0xCA9CF1D206FDC03B), COIN_U64(0xA6D90811F0E4851D),
+  COIN_U64(0xFD442E4688BD304A), COIN_U64(0x908F4A166D1DA664),
+  COIN_U64(0x9E4A9CEC15763E2E), COIN_U64(0x9A598E4E043287FF),
+  COIN_U64(0xC5DD44271AD3CDBA), COIN_U64(0x40EFF1E1853F29FE),
+  COIN_U64(0xF7549530E188C128), COIN_U64(0xD12BEE59E68EF47D),
+  COIN_U64(0x9A94DD3E8CF578B9), COIN_U64(0x82BB74F8301958CF),
+  COIN_U64(0xC13A148E3032D6E7), COIN_U64(0xE36A52363C1FAF02),
+  COIN_U64(0xF18899B1BC3F8CA1), COIN_U64(0xDC44E6C3CB279AC2),
+  COIN_U64(0x96F5600F15A7B7E5), COIN_U64(0x29AB103A5EF8C0BA),
+  COIN_U64(0xBCB2B812DB11A5DE), COIN_U64(0x7415D448F6B6F0E8),
+  COIN_U64(0xEBDF661791D60F56), COIN_U64(0x111B495B3464AD22),
+  COIN_U64(0x936B9FCEBB25C995), COIN_U64(0xCAB10DD900BEEC35),
+  COIN_U64(0xB84687C269EF3BFB), COIN_U64(0x3D5D514F40EEA743),
+  COIN_U64(0xE65829B3046B0AFA), COIN_U64(0x0CB4A5A3112A5113),
+  COIN_U64(0x8FF71A0FE2C2E6DC), COIN_U64(0x47F0E785EABA72AC),
+  COIN_U64(0xB3F4E093DB73A093), COIN_U64(0x59ED216765690F57),
+  COIN_U64(0xE0F218B8D25088B8), COIN_U64(0x306869C13EC3532D),
+  COIN_U64(0x8C974F7383725573), COIN_U64(0x1E414218C73A13FC),
+  COIN_U64(0xAFBD2350644EEACF), COIN_U64(0xE5D1929EF90898FB),
+  COIN_U64(0xDBAC6C247D62A583), COIN_U64(0xDF45F746B74ABF3A),
+  COIN_U64(0x894BC396CE5DA772), COIN_U64(0x6B8BBA8C328EB784),
+  COIN_U64(0xAB9EB47C81F5114F), COIN_U64(0x066EA92F3F326565),
+  COIN_U64(0xD686619BA27255A2), COIN_U64(0xC80A537B0EFEFEBE),
+  COIN_U64(0x8613FD0145877585), COIN_U64(0xBD06742CE95F5F37),
+  COIN_U64(0xA798FC4196E952E7), COIN_U64(0x2C48113823B73705),
+  COIN_U64(0xD17F3B51FCA3A7A0), COIN_U64(0xF75A15862CA504C6),
+  COIN_U64(0x82EF85133DE648C4), COIN_U64(0x9A984D73DBE722FC),
+  COIN_U64(0xA3AB66580D5FDAF5), COIN_U64(0xC13E60D0D2E0EBBB),
+  COIN_U64(0xCC963FEE10B7D1B3), COIN_U64(0x318DF905079926A9),
+  COIN_U64(0xFFBBCFE994E5C61F), COIN_U64(0xFDF17746497F7053),
+  COIN_U64(0x9FD561F1FD0F9BD3), COIN_U64(0xFEB6EA8BEDEFA634),
+  COIN_U64(0xC7CABA6E7C5382C8), COIN_U64(0xFE64A52EE96B8FC1),
+  COIN_U64(0xF9BD690A1B68637B), COIN_U64(0x3DFDCE7AA3C673B1),
+  COIN_U64(0x9C1661A651213E2D), COIN_U64(0x06BEA10CA65C084F),
+  COIN_U64(0xC31BFA0FE5698DB8), COIN_U64(0x486E494FCFF30A63),
+  COIN_U64(0xF3E2F893DEC3F126), COIN_U64(0x5A89DBA3C3EFCCFB),
+  COIN_U64(0x986DDB5C6B3A76B7), COIN_U64(0xF89629465A75E01D),
+  COIN_U64(0xBE89523386091465), COIN_U64(0xF6BBB397F1135824),
+  COIN_U64(0xEE2BA6C0678B597F), COIN_U64(0x746AA07DED582E2D),
+  COIN_U64(0x94DB483840B717EF), COIN_U64(0xA8C2A44EB4571CDD),
+  COIN_U64(0xBA121A4650E4DDEB), COIN_U64(0x92F34D62616CE414),
+  COIN_U64(0xE896A0D7E51E1566), COIN_U64(0x77B020BAF9C81D18),
+  COIN_U64(0x915E2486EF32CD60), COIN_U64(0x0ACE1474DC1D122F),
+  COIN_U64(0xB5B5ADA8AAFF80B8), COIN_U64(0x0D819992132456BB),
+  COIN_U64(0xE3231912D5BF60E6), COIN_U64(0x10E1FFF697ED6C6A),
+  COIN_U64(0x8DF5EFABC5979C8F), COIN_U64(0xCA8D3FFA1EF463C2),
+  COIN_U64(0xB1736B96B6FD83B3), COIN_U64(0xBD308FF8A6B17CB3),
+  COIN_U64(0xDDD0467C64BCE4A0), COIN_U64(0xAC7CB3F6D05DDBDF),
+  COIN_U64(0x8AA22C0DBEF60EE4), COIN_U64(0x6BCDF07A423AA96C),
+  COIN_U64(0xAD4AB7112EB3929D), COIN_U64(0x86C16C98D2C953C7),
+  COIN_U64(0xD89D64D57A607744), COIN_U64(0xE871C7BF077BA8B8),
+  COIN_U64(0x87625F056C7C4A8B), COIN_U64(0x11471CD764AD4973),
+  COIN_U64(0xA93AF6C6C79B5D2D), COIN_U64(0xD598E40D3DD89BD0),
+  COIN_U64(0xD389B47879823479), COIN_U64(0x4AFF1D108D4EC2C4),
+  COIN_U64(0x843610CB4BF160CB), COIN_U64(0xCEDF722A585139BB),
+  COIN_U64(0xA54394FE1EEDB8FE), COIN_U64(0xC2974EB4EE658829),
+  COIN_U64(0xCE947A3DA6A9273E), COIN_U64(0x733D226229FEEA33),
+  COIN_U64(0x811CCC668829B887), COIN_U64(0x0806357D5A3F5260),
+  COIN_U64(0xA163FF802A3426A8), COIN_U64(0xCA07C2DCB0CF26F8),
+  COIN_U64(0xC9BCFF6034C13052), COIN_U64(0xFC89B393DD02F0B6),
+  COIN_U64(0xFC2C3F3841F17C67), COIN_U64(0xBBAC2078D443ACE3),
+  COIN_U64(0x9D9BA7832936EDC0), COIN_U64(0xD54B944B84AA4C0E),
+  COIN_U64(0xC5029163F384A931), COIN_U64(0x0A9E795E65D4DF12),
+  COIN_U64(0xF64335BCF065D37D), COIN_U64(0x4D4617B5FF4A16D6),
+  COIN_U64(0x99EA0196163FA42E), COIN_U64(0x504BCED1BF8E4E46),
+  COIN_U64(0xC06481FB9BCF8D39), COIN_U64(0xE45EC2862F71E1D7),
+  COIN_U64(0xF07DA27A82C37088), COIN_U64(0x5D767327BB4E5A4D),
+  COIN_U64(0x964E858C91BA2655), COIN_U64(0x3A6A07F8D510F870),
+  COIN_U64(0xBBE226EFB628AFEA), COIN_U64(0x890489F70A55368C),
+  COIN_U64(0xEADAB0ABA3B2DBE5), COIN_U64(0x2B45AC74CCEA842F),
+  COIN_U64(0x92C8AE6B464FC96F), COIN_U64(0x3B0B8BC90012929E),
+  COIN_U64(0xB77ADA0617E3BBCB), COIN_U64(0x09CE6EBB40173745),
+  COIN_U64(0xE55990879DDCAABD), COIN_U64(0xCC420A6A101D0516),
+  COIN_U64(0x8F57FA54C2A9EAB6), COIN_U64(0x9FA946824A12232E),
+  COIN_U64(0xB32DF8E9F3546564), COIN_U64(0x47939822DC96ABFA),
+  COIN_U64(0xDFF9772470297EBD), COIN_U64(0x59787E2B93BC56F8),
+  COIN_U64(0x8BFBEA76C619EF36), COIN_U64(0x57EB4EDB3C55B65B),
+  COIN_U64(0xAEFAE51477A06B03), COIN_U64(0xEDE622920B6B23F2),
+  COIN_U64(0xDAB99E59958885C4), COIN_U64(0xE95FAB368E45ECEE),
+  COIN_U64(0x88B402F7FD75539B), COIN_U64(0x11DBCB0218EBB415),
+  COIN_U64(0xAAE103B5FCD2A881), COIN_U64(0xD652BDC29F26A11A),
+  COIN_U64(0xD59944A37C0752A2), COIN_U64(0x4BE76D3346F04960),
+  COIN_U64(0x857FCAE62D8493A5), COIN_U64(0x6F70A4400C562DDC),
+  COIN_U64(0xA6DFBD9FB8E5B88E), COIN_U64(0xCB4CCD500F6BB953),
+  COIN_U64(0xD097AD07A71F26B2), COIN_U64(0x7E2000A41346A7A8),
+  COIN_U64(0x825ECC24C873782F), COIN_U64(0x8ED400668C0C28C9),
+  COIN_U64(0xA2F67F2DFA90563B), COIN_U64(0x728900802F0F32FB),
+  COIN_U64(0xCBB41EF979346BCA), COIN_U64(0x4F2B40A03AD2FFBA),
+  COIN_U64(0xFEA126B7D78186BC), COIN_U64(0xE2F610C84987BFA9),
+  COIN_U64(0x9F24B832E6B0F436), COIN_U64(0x0DD9CA7D2DF4D7CA),
+  COIN_U64(0xC6EDE63FA05D3143), COIN_U64(0x91503D1C79720DBC),
+  COIN_U64(0xF8A95FCF88747D94), COIN_U64(0x75A44C6397CE912B),
+  COIN_U64(0x9B69DBE1B548CE7C), COIN_U64(0xC986AFBE3EE11ABB),
+  COIN_U64(0xC24452DA229B021B), COIN_U64(0xFBE85BADCE996169),
+  COIN_U64(0xF2D56790AB41C2A2), COIN_U64(0xFAE27299423FB9C4),
+  COIN_U64(0x97C560BA6B0919A5), COIN_U64(0xDCCD879FC967D41B),
+  COIN_U64(0xBDB6B8E905CB600F), COIN_U64(0x5400E987BBC1C921),
+  COIN_U64(0xED246723473E3813), COIN_U64(0x290123E9AAB23B69),
+  COIN_U64(0x9436C0760C86E30B), COIN_U64(0xF9A0B6720AAF6522),
+  COIN_U64(0xB94470938FA89BCE), COIN_U64(0xF808E40E8D5B3E6A),
+  COIN_U64(0xE7958CB87392C2C2), COIN_U64(0xB60B1D1230B20E05),
+  COIN_U64(0x90BD77F3483BB9B9), COIN_U64(0xB1C6F22B5E6F48C3),
+  COIN_U64(0xB4ECD5F01A4AA828), COIN_U64(0x1E38AEB6360B1AF4),
+  COIN_U64(0xE2280B6C20DD5232), COIN_U64(0x25C6DA63C38DE1B1),
+  COIN_U64(0x8D590723948A535F), COIN_U64(0x579C487E5A38AD0F),
+  COIN_U64(0xB0AF48EC79ACE837), COIN_U64(0x2D835A9DF0C6D852),
+  COIN_U64(0xDCDB1B2798182244), COIN_U64(0xF8E431456CF88E66),
+  COIN_U64(0x8A08F0F8BF0F156B), COIN_U64(0x1B8E9ECB641B5900),
+  COIN_U64(0xAC8B2D36EED2DAC5), COIN_U64(0xE272467E3D222F40),
+  COIN_U64(0xD7ADF884AA879177), COIN_U64(0x5B0ED81DCC6ABB10),
+  COIN_U64(0x86CCBB52EA94BAEA), COIN_U64(0x98E947129FC2B4EA),
+  COIN_U64(0xA87FEA27A539E9A5), COIN_U64(0x3F2398D747B36225),
+  COIN_U64(0xD29FE4B18E88640E), COIN_U64(0x8EEC7F0D19A03AAE),
+  COIN_U64(0x83A3EEEEF9153E89), COIN_U64(0x1953CF68300424AD),
+  COIN_U64(0xA48CEAAAB75A8E2B), COIN_U64(0x5FA8C3423C052DD8),
+  COIN_U64(0xCDB02555653131B6), COIN_U64(0x3792F412CB06794E),
+  COIN_U64(0x808E17555F3EBF11), COIN_U64(0xE2BBD88BBEE40BD1),
+  COIN_U64(0xA0B19D2AB70E6ED6), COIN_U64(0x5B6ACEAEAE9D0EC5),
+  COIN_U64(0xC8DE047564D20A8B), COIN_U64(0xF245825A5A445276),
+  COIN_U64(0xFB158592BE068D2E), COIN_U64(0xEED6E2F0F0D56713),
+  COIN_U64(0x9CED737BB6C4183D), COIN_U64(0x55464DD69685606C),
+  COIN_U64(0xC428D05AA4751E4C), COIN_U64(0xAA97E14C3C26B887),
+  COIN_U64(0xF53304714D9265DF), COIN_U64(0xD53DD99F4B3066A9),
+  COIN_U64(0x993FE2C6D07B7FAB), COIN_U64(0xE546A8038EFE402A),
+  COIN_U64(0xBF8FDB78849A5F96), COIN_U64(0xDE98520472BDD034),
+  COIN_U64(0xEF73D256A5C0F77C), COIN_U64(0x963E66858F6D4441),
+  COIN_U64(0x95A8637627989AAD), COIN_U64(0xDDE7001379A44AA9),
+  COIN_U64(0xBB127C53B17EC159), COIN_U64(0x5560C018580D5D53),
+  COIN_U64(0xE9D71B689DDE71AF), COIN_U64(0xAAB8F01E6E10B4A7),
+  COIN_U64(0x9226712162AB070D), COIN_U64(0xCAB3961304CA70E9),
+  COIN_U64(0xB6B00D69BB55C8D1), COIN_U64(0x3D607B97C5FD0D23),
+  COIN_U64(0xE45C10C42A2B3B05), COIN_U64(0x8CB89A7DB77C506B),
+  COIN_U64(0x8EB98A7A9A5B04E3), COIN_U64(0x77F3608E92ADB243),
+  COIN_U64(0xB267ED1940F1C61C), COIN_U64(0x55F038B237591ED4),
+  COIN_U64(0xDF01E85F912E37A3), COIN_U64(0x6B6C46DEC52F6689),
+  COIN_U64(0x8B61313BBABCE2C6), COIN_U64(0x2323AC4B3B3DA016),
+  COIN_U64(0xAE397D8AA96C1B77), COIN_U64(0xABEC975E0A0D081B),
+  COIN_U64(0xD9C7DCED53C72255), COIN_U64(0x96E7BD358C904A22),
+  COIN_U64(0x881CEA14545C7575), COIN_U64(0x7E50D64177DA2E55),
+  COIN_U64(0xAA242499697392D2), COIN_U64(0xDDE50BD1D5D0B9EA),
+  COIN_U64(0xD4AD2DBFC3D07787), COIN_U64(0x955E4EC64B44E865),
+  COIN_U64(0x84EC3C97DA624AB4), COIN_U64(0xBD5AF13BEF0B113F),
+  COIN_U64(0xA6274BBDD0FADD61), COIN_U64(0xECB1AD8AEACDD58F),
+  COIN_U64(0xCFB11EAD453994BA), COIN_U64(0x67DE18EDA5814AF3),
+  COIN_U64(0x81CEB32C4B43FCF4), COIN_U64(0x80EACF948770CED8),
+  COIN_U64(0xA2425FF75E14FC31), COIN_U64(0xA1258379A94D028E),
+  COIN_U64(0xCAD2F7F5359A3B3E), COIN_U64(0x096EE45813A04331),
+  COIN_U64(0xFD87B5F28300CA0D), COIN_U64(0x8BCA9D6E188853FD),
+  COIN_U64(0x9E74D1B791E07E48), COIN_U64(0x775EA264CF55347E),
+  COIN_U64(0xC612062576589DDA), COIN_U64(0x95364AFE032A819E),
+  COIN_U64(0xF79687AED3EEC551), COIN_U64(0x3A83DDBD83F52205),
+  COIN_U64(0x9ABE14CD44753B52), COIN_U64(0xC4926A9672793543),
+  COIN_U64(0xC16D9A0095928A27), COIN_U64(0x75B7053C0F178294),
+  COIN_U64(0xF1C90080BAF72CB1), COIN_U64(0x5324C68B12DD6339),
+  COIN_U64(0x971DA05074DA7BEE), COIN_U64(0xD3F6FC16EBCA5E04),
+  COIN_U64(0xBCE5086492111AEA), COIN_U64(0x88F4BB1CA6BCF585),
+  COIN_U64(0xEC1E4A7DB69561A5), COIN_U64(0x2B31E9E3D06C32E6),
+  COIN_U64(0x9392EE8E921D5D07), COIN_U64(0x3AFF322E62439FD0),
+  COIN_U64(0xB877AA3236A4B449), COIN_U64(0x09BEFEB9FAD487C3),
+  COIN_U64(0xE69594BEC44DE15B), COIN_U64(0x4C2EBE687989A9B4),
+  COIN_U64(0x901D7CF73AB0ACD9), COIN_U64(0x0F9D37014BF60A11),
+  COIN_U64(0xB424DC35095CD80F), COIN_U64(0x538484C19EF38C95),
+  COIN_U64(0xE12E13424BB40E13), COIN_U64(0x2865A5F206B06FBA),
+  COIN_U64(0x8CBCCC096F5088CB), COIN_U64(0xF93F87B7442E45D4),
+  COIN_U64(0xAFEBFF0BCB24AAFE), COIN_U64(0xF78F69A51539D749),
+  COIN_U64(0xDBE6FECEBDEDD5BE), COIN_U64(0xB573440E5A884D1C),
+  COIN_U64(0x89705F4136B4A597), COIN_U64(0x31680A88F8953031),
+  COIN_U64(0xABCC77118461CEFC), COIN_U64(0xFDC20D2B36BA7C3E),
+  COIN_U64(0xD6BF94D5E57A42BC), COIN_U64(0x3D32907604691B4D),
+  COIN_U64(0x8637BD05AF6C69B5), COIN_U64(0xA63F9A49C2C1B110),
+  COIN_U64(0xA7C5AC471B478423), COIN_U64(0x0FCF80DC33721D54),
+  COIN_U64(0xD1B71758E219652B), COIN_U64(0xD3C36113404EA4A9),
+  COIN_U64(0x83126E978D4FDF3B), COIN_U64(0x645A1CAC083126EA),
+  COIN_U64(0xA3D70A3D70A3D70A), COIN_U64(0x3D70A3D70A3D70A4),
+  COIN_U64(0xCCCCCCCCCCCCCCCC), COIN_U64(0xCCCCCCCCCCCCCCCD),
+  COIN_U64(0x8000000000000000), COIN_U64(0x0000000000000001),
+  COIN_U64(0xA000000000000000), COIN_U64(0x0000000000000001),
+  COIN_U64(0xC800000000000000), COIN_U64(0x0000000000000001),
+  COIN_U64(0xFA00000000000000), COIN_U64(0x0000000000000001),
+  COIN_U64(0x9C40000000000000), COIN_U64(0x0000000000000001),
+  COIN_U64(0xC350000000000000), COIN_U64(0x0000000000000001),
+  COIN_U64(0xF424000000000000), COIN_U64(0x0000000000000001),
+  COIN_U64(0x9896800000000000), COIN_U64(0x0000000000000001),
+  COIN_U64(0xBEBC200000000000), COIN_U64(0x0000000000000001),
+  COIN_U64(0xEE6B280000000000), COIN_U64(0x0000000000000001),
+  COIN_U64(0x9502F90000000000), COIN_U64(0x0000000000000001),
+  COIN_U64(0xBA43B74000000000), COIN_U64(0x0000000000000001),
+  COIN_U64(0xE8D4A51000000000), COIN_U64(0x0000000000000001),
+  COIN_U64(0x9184E72A00000000), COIN_U64(0x0000000000000001),
+  COIN_U64(0xB5E620F480000000), COIN_U64(0x0000000000000001),
+  COIN_U64(0xE35FA931A0000000), COIN_U64(0x0000000000000001),
+  COIN_U64(0x8E1BC9BF04000000), COIN_U64(0x0000000000000001),
+  COIN_U64(0xB1A2BC2EC5000000), COIN_U64(0x0000000000000001),
+  COIN_U64(0xDE0B6B3A76400000), COIN_U64(0x0000000000000001),
+  COIN_U64(0x8AC7230489E80000), COIN_U64(0x0000000000000001),
+  COIN_U64(0xAD78EBC5AC620000), COIN_U64(0x0000000000000001),
+  COIN_U64(0xD8D726B7177A8000), COIN_U64(0x0000000000000001),
+  COIN_U64(0x878678326EAC9000), COIN_U64(0x0000000000000001),
+  COIN_U64(0xA968163F0A57B400), COIN_U64(0x0000000000000001),
+  COIN_U64(0xD3C21BCECCEDA100), COIN_U64(0x0000000000000001),
+  COIN_U64(0x84595161401484A0), COIN_U64(0x0000000000000001),
+  COIN_U64(0xA56FA5B99019A5C8), COIN_U64(0x0000000000000001),
+  COIN_U64(0xCECB8F27F4200F3A), COIN_U64(0x0000000000000001),
+  COIN_U64(0x813F3978F8940984), COIN_U64(0x4000000000000001),
+  COIN_U64(0xA18F07D736B90BE5), COIN_U64(0x5000000000000001),
+  COIN_U64(0xC9F2C9CD04674EDE), COIN_U64(0xA400000000000001),
+  COIN_U64(0xFC6F7C4045812296), COIN_U64(0x4D00000000000001),
+  COIN_U64(0x9DC5ADA82B70B59D), COIN_U64(0xF020000000000001),
+  COIN_U64(0xC5371912364CE305), COIN_U64(0x6C28000000000001),
+  COIN_U64(0xF684DF56C3E01BC6), COIN_U64(0xC732000000000001),
+  COIN_U64(0x9A130B963A6C115C), COIN_U64(0x3C7F400000000001),
+  COIN_U64(0xC097CE7BC90715B3), COIN_U64(0x4B9F100000000001),
+  COIN_U64(0xF0BDC21ABB48DB20), COIN_U64(0x1E86D40000000001),
+  COIN_U64(0x96769950B50D88F4), COIN_U64(0x1314448000000001),
+  COIN_U64(0xBC143FA4E250EB31), COIN_U64(0x17D955A000000001),
+  COIN_U64(0xEB194F8E1AE525FD), COIN_U64(0x5DCFAB0800000001),
+  COIN_U64(0x92EFD1B8D0CF37BE), COIN_U64(0x5AA1CAE500000001),
+  COIN_U64(0xB7ABC627050305AD), COIN_U64(0xF14A3D9E40000001),
+  COIN_U64(0xE596B7B0C643C719), COIN_U64(0x6D9CCD05D0000001),
+  COIN_U64(0x8F7E32CE7BEA5C6F), COIN_U64(0xE4820023A2000001),
+  COIN_U64(0xB35DBF821AE4F38B), COIN_U64(0xDDA2802C8A800001),
+  COIN_U64(0xE0352F62A19E306E), COIN_U64(0xD50B2037AD200001),
+  COIN_U64(0x8C213D9DA502DE45), COIN_U64(0x4526F422CC340001),
+  COIN_U64(0xAF298D050E4395D6), COIN_U64(0x9670B12B7F410001),
+  COIN_U64(0xDAF3F04651D47B4C), COIN_U64(0x3C0CDD765F114001),
+  COIN_U64(0x88D8762BF324CD0F), COIN_U64(0xA5880A69FB6AC801),
+  COIN_U64(0xAB0E93B6EFEE0053), COIN_U64(0x8EEA0D047A457A01),
+  COIN_U64(0xD5D238A4ABE98068), COIN_U64(0x72A4904598D6D881),
+  COIN_U64(0x85A36366EB71F041), COIN_U64(0x47A6DA2B7F864751),
+  COIN_U64(0xA70C3C40A64E6C51), COIN_U64(0x999090B65F67D925),
+  COIN_U64(0xD0CF4B50CFE20765), COIN_U64(0xFFF4B4E3F741CF6E),
+  COIN_U64(0x82818F1281ED449F), COIN_U64(0xBFF8F10E7A8921A5),
+  COIN_U64(0xA321F2D7226895C7), COIN_U64(0xAFF72D52192B6A0E),
+  COIN_U64(0xCBEA6F8CEB02BB39), COIN_U64(0x9BF4F8A69F764491),
+  COIN_U64(0xFEE50B7025C36A08), COIN_U64(0x02F236D04753D5B5),
+  COIN_U64(0x9F4F2726179A2245), COIN_U64(0x01D762422C946591),
+  COIN_U64(0xC722F0EF9D80AAD6), COIN_U64(0x424D3AD2B7B97EF6),
+  COIN_U64(0xF8EBAD2B84E0D58B), COIN_U64(0xD2E0898765A7DEB3),
+  COIN_U64(0x9B934C3B330C8577), COIN_U64(0x63CC55F49F88EB30),
+  COIN_U64(0xC2781F49FFCFA6D5), COIN_U64(0x3CBF6B71C76B25FC),
+  COIN_U64(0xF316271C7FC3908A), COIN_U64(0x8BEF464E3945EF7B),
+  COIN_U64(0x97EDD871CFDA3A56), COIN_U64(0x97758BF0E3CBB5AD),
+  COIN_U64(0xBDE94E8E43D0C8EC), COIN_U64(0x3D52EEED1CBEA318),
+  COIN_U64(0xED63A231D4C4FB27), COIN_U64(0x4CA7AAA863EE4BDE),
+  COIN_U64(0x945E455F24FB1CF8), COIN_U64(0x8FE8CAA93E74EF6B),
+  COIN_U64(0xB975D6B6EE39E436), COIN_U64(0xB3E2FD538E122B45),
+  COIN_U64(0xE7D34C64A9C85D44), COIN_U64(0x60DBBCA87196B617),
+  COIN_U64(0x90E40FBEEA1D3A4A), COIN_U64(0xBC8955E946FE31CE),
+  COIN_U64(0xB51D13AEA4A488DD), COIN_U64(0x6BABAB6398BDBE42),
+  COIN_U64(0xE264589A4DCDAB14), COIN_U64(0xC696963C7EED2DD2),
+  COIN_U64(0x8D7EB76070A08AEC), COIN_U64(0xFC1E1DE5CF543CA3),
+  COIN_U64(0xB0DE65388CC8ADA8), COIN_U64(0x3B25A55F43294BCC),
+  COIN_U64(0xDD15FE86AFFAD912), COIN_U64(0x49EF0EB713F39EBF),
+  COIN_U64(0x8A2DBF142DFCC7AB), COIN_U64(0x6E3569326C784338),
+  COIN_U64(0xACB92ED9397BF996), COIN_U64(0x49C2C37F07965405),
+  COIN_U64(0xD7E77A8F87DAF7FB), COIN_U64(0xDC33745EC97BE907),
+  COIN_U64(0x86F0AC99B4E8DAFD), COIN_U64(0x69A028BB3DED71A4),
+  COIN_U64(0xA8ACD7C0222311BC), COIN_U64(0xC40832EA0D68CE0D),
+  COIN_U64(0xD2D80DB02AABD62B), COIN_U64(0xF50A3FA490C30191),
+  COIN_U64(0x83C7088E1AAB65DB), COIN_U64(0x792667C6DA79E0FB),
+  COIN_U64(0xA4B8CAB1A1563F52), COIN_U64(0x577001B891185939),
+  COIN_U64(0xCDE6FD5E09ABCF26), COIN_U64(0xED4C0226B55E6F87),
+  COIN_U64(0x80B05E5AC60B6178), COIN_U64(0x544F8158315B05B5),
+  COIN_U64(0xA0DC75F1778E39D6), COIN_U64(0x696361AE3DB1C722),
+  COIN_U64(0xC913936DD571C84C), COIN_U64(0x03BC3A19CD1E38EA),
+  COIN_U64(0xFB5878494ACE3A5F), COIN_U64(0x04AB48A04065C724),
+  COIN_U64(0x9D174B2DCEC0E47B), COIN_U64(0x62EB0D64283F9C77),
+  COIN_U64(0xC45D1DF942711D9A), COIN_U64(0x3BA5D0BD324F8395),
+  COIN_U64(0xF5746577930D6500), COIN_U64(0xCA8F44EC7EE3647A),
+  COIN_U64(0x9968BF6ABBE85F20), COIN_U64(0x7E998B13CF4E1ECC),
+  COIN_U64(0xBFC2EF456AE276E8), COIN_U64(0x9E3FEDD8C321A67F),
+  COIN_U64(0xEFB3AB16C59B14A2), COIN_U64(0xC5CFE94EF3EA101F),
+  COIN_U64(0x95D04AEE3B80ECE5), COIN_U64(0xBBA1F1D158724A13),
+  COIN_U64(0xBB445DA9CA61281F), COIN_U64(0x2A8A6E45AE8EDC98),
+  COIN_U64(0xEA1575143CF97226), COIN_U64(0xF52D09D71A3293BE),
+  COIN_U64(0x924D692CA61BE758), COIN_U64(0x593C2626705F9C57),
+  COIN_U64(0xB6E0C377CFA2E12E), COIN_U64(0x6F8B2FB00C77836D),
+  COIN_U64(0xE498F455C38B997A), COIN_U64(0x0B6DFB9C0F956448),
+  COIN_U64(0x8EDF98B59A373FEC), COIN_U64(0x4724BD4189BD5EAD),
+  COIN_U64(0xB2977EE300C50FE7), COIN_U64(0x58EDEC91EC2CB658),
+  COIN_U64(0xDF3D5E9BC0F653E1), COIN_U64(0x2F2967B66737E3EE),
+  COIN_U64(0x8B865B215899F46C), COIN_U64(0xBD79E0D20082EE75),
+  COIN_U64(0xAE67F1E9AEC07187), COIN_U64(0xECD8590680A3AA12),
+  COIN_U64(0xDA01EE641A708DE9), COIN_U64(0xE80E6F4820CC9496),
+  COIN_U64(0x884134FE908658B2), COIN_U64(0x3109058D147FDCDE),
+  COIN_U64(0xAA51823E34A7EEDE), COIN_U64(0xBD4B46F0599FD416),
+  COIN_U64(0xD4E5E2CDC1D1EA96), COIN_U64(0x6C9E18AC7007C91B),
+  COIN_U64(0x850FADC09923329E), COIN_U64(0x03E2CF6BC604DDB1),
+  COIN_U64(0xA6539930BF6BFF45), COIN_U64(0x84DB8346B786151D),
+  COIN_U64(0xCFE87F7CEF46FF16), COIN_U64(0xE612641865679A64),
+  COIN_U64(0x81F14FAE158C5F6E), COIN_U64(0x4FCB7E8F3F60C07F),
+  COIN_U64(0xA26DA3999AEF7749), COIN_U64(0xE3BE5E330F38F09E),
+  COIN_U64(0xCB090C8001AB551C), COIN_U64(0x5CADF5BFD3072CC6),
+  COIN_U64(0xFDCB4FA002162A63), COIN_U64(0x73D9732FC7C8F7F7),
+  COIN_U64(0x9E9F11C4014DDA7E), COIN_U64(0x2867E7FDDCDD9AFB),
+  COIN_U64(0xC646D63501A1511D), COIN_U64(0xB281E1FD541501B9),
+  COIN_U64(0xF7D88BC24209A565), COIN_U64(0x1F225A7CA91A4227),
+  COIN_U64(0x9AE757596946075F), COIN_U64(0x3375788DE9B06959),
+  COIN_U64(0xC1A12D2FC3978937), COIN_U64(0x0052D6B1641C83AF),
+  COIN_U64(0xF209787BB47D6B84), COIN_U64(0xC0678C5DBD23A49B),
+  COIN_U64(0x9745EB4D50CE6332), COIN_U64(0xF840B7BA963646E1),
+  COIN_U64(0xBD176620A501FBFF), COIN_U64(0xB650E5A93BC3D899),
+  COIN_U64(0xEC5D3FA8CE427AFF), COIN_U64(0xA3E51F138AB4CEBF),
+  COIN_U64(0x93BA47C980E98CDF), COIN_U64(0xC66F336C36B10138),
+  COIN_U64(0xB8A8D9BBE123F017), COIN_U64(0xB80B0047445D4185),
+  COIN_U64(0xE6D3102AD96CEC1D), COIN_U64(0xA60DC059157491E6),
+  COIN_U64(0x9043EA1AC7E41392), COIN_U64(0x87C89837AD68DB30),
+  COIN_U64(0xB454E4A179DD1877), COIN_U64(0x29BABE4598C311FC),
+  COIN_U64(0xE16A1DC9D8545E94), COIN_U64(0xF4296DD6FEF3D67B),
+  COIN_U64(0x8CE2529E2734BB1D), COIN_U64(0x1899E4A65F58660D),
+  COIN_U64(0xB01AE745B101E9E4), COIN_U64(0x5EC05DCFF72E7F90),
+  COIN_U64(0xDC21A1171D42645D), COIN_U64(0x76707543F4FA1F74),
+  COIN_U64(0x899504AE72497EBA), COIN_U64(0x6A06494A791C53A9),
+  COIN_U64(0xABFA45DA0EDBDE69), COIN_U64(0x0487DB9D17636893),
+  COIN_U64(0xD6F8D7509292D603), COIN_U64(0x45A9D2845D3C42B7),
+  COIN_U64(0x865B86925B9BC5C2), COIN_U64(0x0B8A2392BA45A9B3),
+  COIN_U64(0xA7F26836F282B732), COIN_U64(0x8E6CAC7768D7141F),
+  COIN_U64(0xD1EF0244AF2364FF), COIN_U64(0x3207D795430CD927),
+  COIN_U64(0x8335616AED761F1F), COIN_U64(0x7F44E6BD49E807B9),
+  COIN_U64(0xA402B9C5A8D3A6E7), COIN_U64(0x5F16206C9C6209A7),
+  COIN_U64(0xCD036837130890A1), COIN_U64(0x36DBA887C37A8C10),
+  COIN_U64(0x802221226BE55A64), COIN_U64(0xC2494954DA2C978A),
+  COIN_U64(0xA02AA96B06DEB0FD), COIN_U64(0xF2DB9BAA10B7BD6D),
+  COIN_U64(0xC83553C5C8965D3D), COIN_U64(0x6F92829494E5ACC8),
+  COIN_U64(0xFA42A8B73ABBF48C), COIN_U64(0xCB772339BA1F17FA),
+  COIN_U64(0x9C69A97284B578D7), COIN_U64(0xFF2A760414536EFC),
+  COIN_U64(0xC38413CF25E2D70D), COIN_U64(0xFEF5138519684ABB),
+  COIN_U64(0xF46518C2EF5B8CD1), COIN_U64(0x7EB258665FC25D6A),
+  COIN_U64(0x98BF2F79D5993802), COIN_U64(0xEF2F773FFBD97A62),
+  COIN_U64(0xBEEEFB584AFF8603), COIN_U64(0xAAFB550FFACFD8FB),
+  COIN_U64(0xEEAABA2E5DBF6784), COIN_U64(0x95BA2A53F983CF39),
+  COIN_U64(0x952AB45CFA97A0B2), COIN_U64(0xDD945A747BF26184),
+  COIN_U64(0xBA756174393D88DF), COIN_U64(0x94F971119AEEF9E5),
+  COIN_U64(0xE912B9D1478CEB17), COIN_U64(0x7A37CD5601AAB85E),
+  COIN_U64(0x91ABB422CCB812EE), COIN_U64(0xAC62E055C10AB33B),
+  COIN_U64(0xB616A12B7FE617AA), COIN_U64(0x577B986B314D600A),
+  COIN_U64(0xE39C49765FDF9D94), COIN_U64(0xED5A7E85FDA0B80C),
+  COIN_U64(0x8E41ADE9FBEBC27D), COIN_U64(0x14588F13BE847308),
+  COIN_U64(0xB1D219647AE6B31C), COIN_U64(0x596EB2D8AE258FC9),
+  COIN_U64(0xDE469FBD99A05FE3), COIN_U64(0x6FCA5F8ED9AEF3BC),
+  COIN_U64(0x8AEC23D680043BEE), COIN_U64(0x25DE7BB9480D5855),
+  COIN_U64(0xADA72CCC20054AE9), COIN_U64(0xAF561AA79A10AE6B),
+  COIN_U64(0xD910F7FF28069DA4), COIN_U64(0x1B2BA1518094DA05),
+  COIN_U64(0x87AA9AFF79042286), COIN_U64(0x90FB44D2F05D0843),
+  COIN_U64(0xA99541BF57452B28), COIN_U64(0x353A1607AC744A54),
+  COIN_U64(0xD3FA922F2D1675F2), COIN_U64(0x42889B8997915CE9),
+  COIN_U64(0x847C9B5D7C2E09B7), COIN_U64(0x69956135FEBADA12),
+  COIN_U64(0xA59BC234DB398C25), COIN_U64(0x43FAB9837E699096),
+  COIN_U64(0xCF02B2C21207EF2E), COIN_U64(0x94F967E45E03F4BC),
+  COIN_U64(0x8161AFB94B44F57D), COIN_U64(0x1D1BE0EEBAC278F6),
+  COIN_U64(0xA1BA1BA79E1632DC), COIN_U64(0x6462D92A69731733),
+  COIN_U64(0xCA28A291859BBF93), COIN_U64(0x7D7B8F7503CFDCFF),
+  COIN_U64(0xFCB2CB35E702AF78), COIN_U64(0x5CDA735244C3D43F),
+  COIN_U64(0x9DEFBF01B061ADAB), COIN_U64(0x3A0888136AFA64A8),
+  COIN_U64(0xC56BAEC21C7A1916), COIN_U64(0x088AAA1845B8FDD1),
+  COIN_U64(0xF6C69A72A3989F5B), COIN_U64(0x8AAD549E57273D46),
+  COIN_U64(0x9A3C2087A63F6399), COIN_U64(0x36AC54E2F678864C),
+  COIN_U64(0xC0CB28A98FCF3C7F), COIN_U64(0x84576A1BB416A7DE),
+  COIN_U64(0xF0FDF2D3F3C30B9F), COIN_U64(0x656D44A2A11C51D6),
+  COIN_U64(0x969EB7C47859E743), COIN_U64(0x9F644AE5A4B1B326),
+  COIN_U64(0xBC4665B596706114), COIN_U64(0x873D5D9F0DDE1FEF),
+  COIN_U64(0xEB57FF22FC0C7959), COIN_U64(0xA90CB506D155A7EB),
+  COIN_U64(0x9316FF75DD87CBD8), COIN_U64(0x09A7F12442D588F3),
+  COIN_U64(0xB7DCBF5354E9BECE), COIN_U64(0x0C11ED6D538AEB30),
+  COIN_U64(0xE5D3EF282A242E81), COIN_U64(0x8F1668C8A86DA5FB),
+  COIN_U64(0x8FA475791A569D10), COIN_U64(0xF96E017D694487BD),
+  COIN_U64(0xB38D92D760EC4455), COIN_U64(0x37C981DCC395A9AD),
+  COIN_U64(0xE070F78D3927556A), COIN_U64(0x85BBE253F47B1418),
+  COIN_U64(0x8C469AB843B89562), COIN_U64(0x93956D7478CCEC8F),
+  COIN_U64(0xAF58416654A6BABB), COIN_U64(0x387AC8D1970027B3),
+  COIN_U64(0xDB2E51BFE9D0696A), COIN_U64(0x06997B05FCC0319F),
+  COIN_U64(0x88FCF317F22241E2), COIN_U64(0x441FECE3BDF81F04),
+  COIN_U64(0xAB3C2FDDEEAAD25A), COIN_U64(0xD527E81CAD7626C4),
+  COIN_U64(0xD60B3BD56A5586F1), COIN_U64(0x8A71E223D8D3B075),
+  COIN_U64(0x85C7056562757456), COIN_U64(0xF6872D5667844E4A),
+  COIN_U64(0xA738C6BEBB12D16C), COIN_U64(0xB428F8AC016561DC),
+  COIN_U64(0xD106F86E69D785C7), COIN_U64(0xE13336D701BEBA53),
+  COIN_U64(0x82A45B450226B39C), COIN_U64(0xECC0024661173474),
+  COIN_U64(0xA34D721642B06084), COIN_U64(0x27F002D7F95D0191),
+  COIN_U64(0xCC20CE9BD35C78A5), COIN_U64(0x31EC038DF7B441F5),
+  COIN_U64(0xFF290242C83396CE), COIN_U64(0x7E67047175A15272),
+  COIN_U64(0x9F79A169BD203E41), COIN_U64(0x0F0062C6E984D387),
+  COIN_U64(0xC75809C42C684DD1), COIN_U64(0x52C07B78A3E60869),
+  COIN_U64(0xF92E0C3537826145), COIN_U64(0xA7709A56CCDF8A83),
+  COIN_U64(0x9BBCC7A142B17CCB), COIN_U64(0x88A66076400BB692),
+  COIN_U64(0xC2ABF989935DDBFE), COIN_U64(0x6ACFF893D00EA436),
+  COIN_U64(0xF356F7EBF83552FE), COIN_U64(0x0583F6B8C4124D44),
+  COIN_U64(0x98165AF37B2153DE), COIN_U64(0xC3727A337A8B704B),
+  COIN_U64(0xBE1BF1B059E9A8D6), COIN_U64(0x744F18C0592E4C5D),
+  COIN_U64(0xEDA2EE1C7064130C), COIN_U64(0x1162DEF06F79DF74),
+  COIN_U64(0x9485D4D1C63E8BE7), COIN_U64(0x8ADDCB5645AC2BA9),
+  COIN_U64(0xB9A74A0637CE2EE1), COIN_U64(0x6D953E2BD7173693),
+  COIN_U64(0xE8111C87C5C1BA99), COIN_U64(0xC8FA8DB6CCDD0438),
+  COIN_U64(0x910AB1D4DB9914A0), COIN_U64(0x1D9C9892400A22A3),
+  COIN_U64(0xB54D5E4A127F59C8), COIN_U64(0x2503BEB6D00CAB4C),
+  COIN_U64(0xE2A0B5DC971F303A), COIN_U64(0x2E44AE64840FD61E),
+  COIN_U64(0x8DA471A9DE737E24), COIN_U64(0x5CEAECFED289E5D3),
+  COIN_U64(0xB10D8E1456105DAD), COIN_U64(0x7425A83E872C5F48),
+  COIN_U64(0xDD50F1996B947518), COIN_U64(0xD12F124E28F7771A),
+  COIN_U64(0x8A5296FFE33CC92F), COIN_U64(0x82BD6B70D99AAA70),
+  COIN_U64(0xACE73CBFDC0BFB7B), COIN_U64(0x636CC64D1001550C),
+  COIN_U64(0xD8210BEFD30EFA5A), COIN_U64(0x3C47F7E05401AA4F),
+  COIN_U64(0x8714A775E3E95C78), COIN_U64(0x65ACFAEC34810A72),
+  COIN_U64(0xA8D9D1535CE3B396), COIN_U64(0x7F1839A741A14D0E),
+  COIN_U64(0xD31045A8341CA07C), COIN_U64(0x1EDE48111209A051),
+  COIN_U64(0x83EA2B892091E44D), COIN_U64(0x934AED0AAB460433),
+  COIN_U64(0xA4E4B66B68B65D60), COIN_U64(0xF81DA84D56178540),
+  COIN_U64(0xCE1DE40642E3F4B9), COIN_U64(0x36251260AB9D668F),
+  COIN_U64(0x80D2AE83E9CE78F3), COIN_U64(0xC1D72B7C6B42601A),
+  COIN_U64(0xA1075A24E4421730), COIN_U64(0xB24CF65B8612F820),
+  COIN_U64(0xC94930AE1D529CFC), COIN_U64(0xDEE033F26797B628),
+  COIN_U64(0xFB9B7CD9A4A7443C), COIN_U64(0x169840EF017DA3B2),
+  COIN_U64(0x9D412E0806E88AA5), COIN_U64(0x8E1F289560EE864F),
+  COIN_U64(0xC491798A08A2AD4E), COIN_U64(0xF1A6F2BAB92A27E3),
+  COIN_U64(0xF5B5D7EC8ACB58A2), COIN_U64(0xAE10AF696774B1DC),
+  COIN_U64(0x9991A6F3D6BF1765), COIN_U64(0xACCA6DA1E0A8EF2A),
+  COIN_U64(0xBFF610B0CC6EDD3F), COIN_U64(0x17FD090A58D32AF4),
+  COIN_U64(0xEFF394DCFF8A948E), COIN_U64(0xDDFC4B4CEF07F5B1),
+  COIN_U64(0x95F83D0A1FB69CD9), COIN_U64(0x4ABDAF101564F98F),
+  COIN_U64(0xBB764C4CA7A4440F), COIN_U64(0x9D6D1AD41ABE37F2),
+  COIN_U64(0xEA53DF5FD18D5513), COIN_U64(0x84C86189216DC5EE),
+  COIN_U64(0x92746B9BE2F8552C), COIN_U64(0x32FD3CF5B4E49BB5),
+  COIN_U64(0xB7118682DBB66A77), COIN_U64(0x3FBC8C33221DC2A2),
+  COIN_U64(0xE4D5E82392A40515), COIN_U64(0x0FABAF3FEAA5334B),
+  COIN_U64(0x8F05B1163BA6832D), COIN_U64(0x29CB4D87F2A7400F),
+  COIN_U64(0xB2C71D5BCA9023F8), COIN_U64(0x743E20E9EF511013),
+  COIN_U64(0xDF78E4B2BD342CF6), COIN_U64(0x914DA9246B255417),
+  COIN_U64(0x8BAB8EEFB6409C1A), COIN_U64(0x1AD089B6C2F7548F),
+  COIN_U64(0xAE9672ABA3D0C320), COIN_U64(0xA184AC2473B529B2),
+  COIN_U64(0xDA3C0F568CC4F3E8), COIN_U64(0xC9E5D72D90A2741F),
+  COIN_U64(0x8865899617FB1871), COIN_U64(0x7E2FA67C7A658893),
+  COIN_U64(0xAA7EEBFB9DF9DE8D), COIN_U64(0xDDBB901B98FEEAB8),
+  COIN_U64(0xD51EA6FA85785631), COIN_U64(0x552A74227F3EA566),
+  COIN_U64(0x8533285C936B35DE), COIN_U64(0xD53A88958F872760),
+  COIN_U64(0xA67FF273B8460356), COIN_U64(0x8A892ABAF368F138),
+  COIN_U64(0xD01FEF10A657842C), COIN_U64(0x2D2B7569B0432D86),
+  COIN_U64(0x8213F56A67F6B29B), COIN_U64(0x9C3B29620E29FC74),
+  COIN_U64(0xA298F2C501F45F42), COIN_U64(0x8349F3BA91B47B90),
+  COIN_U64(0xCB3F2F7642717713), COIN_U64(0x241C70A936219A74),
+  COIN_U64(0xFE0EFB53D30DD4D7), COIN_U64(0xED238CD383AA0111),
+  COIN_U64(0x9EC95D1463E8A506), COIN_U64(0xF4363804324A40AB),
+  COIN_U64(0xC67BB4597CE2CE48), COIN_U64(0xB143C6053EDCD0D6),
+  COIN_U64(0xF81AA16FDC1B81DA), COIN_U64(0xDD94B7868E94050B),
+  COIN_U64(0x9B10A4E5E9913128), COIN_U64(0xCA7CF2B4191C8327),
+  COIN_U64(0xC1D4CE1F63F57D72), COIN_U64(0xFD1C2F611F63A3F1),
+  COIN_U64(0xF24A01A73CF2DCCF), COIN_U64(0xBC633B39673C8CED),
+  COIN_U64(0x976E41088617CA01), COIN_U64(0xD5BE0503E085D814),
+  COIN_U64(0xBD49D14AA79DBC82), COIN_U64(0x4B2D8644D8A74E19),
+  COIN_U64(0xEC9C459D51852BA2), COIN_U64(0xDDF8E7D60ED1219F),
+  COIN_U64(0x93E1AB8252F33B45), COIN_U64(0xCABB90E5C942B504),
+  COIN_U64(0xB8DA1662E7B00A17), COIN_U64(0x3D6A751F3B936244),
+  COIN_U64(0xE7109BFBA19C0C9D), COIN_U64(0x0CC512670A783AD5),
+  COIN_U64(0x906A617D450187E2), COIN_U64(0x27FB2B80668B24C6),
+  COIN_U64(0xB484F9DC9641E9DA), COIN_U64(0xB1F9F660802DEDF7),
+  COIN_U64(0xE1A63853BBD26451), COIN_U64(0x5E7873F8A0396974),
+  COIN_U64(0x8D07E33455637EB2), COIN_U64(0xDB0B487B6423E1E9),
+  COIN_U64(0xB049DC016ABC5E5F), COIN_U64(0x91CE1A9A3D2CDA63),
+  COIN_U64(0xDC5C5301C56B75F7), COIN_U64(0x7641A140CC7810FC),
+  COIN_U64(0x89B9B3E11B6329BA), COIN_U64(0xA9E904C87FCB0A9E),
+  COIN_U64(0xAC2820D9623BF429), COIN_U64(0x546345FA9FBDCD45),
+  COIN_U64(0xD732290FBACAF133), COIN_U64(0xA97C177947AD4096),
+  COIN_U64(0x867F59A9D4BED6C0), COIN_U64(0x49ED8EABCCCC485E),
+  COIN_U64(0xA81F301449EE8C70), COIN_U64(0x5C68F256BFFF5A75),
+  COIN_U64(0xD226FC195C6A2F8C), COIN_U64(0x73832EEC6FFF3112),
+  COIN_U64(0x83585D8FD9C25DB7), COIN_U64(0xC831FD53C5FF7EAC),
+  COIN_U64(0xA42E74F3D032F525), COIN_U64(0xBA3E7CA8B77F5E56),
+  COIN_U64(0xCD3A1230C43FB26F), COIN_U64(0x28CE1BD2E55F35EC),
+  COIN_U64(0x80444B5E7AA7CF85), COIN_U64(0x7980D163CF5B81B4),
+  COIN_U64(0xA0555E361951C366), COIN_U64(0xD7E105BCC3326220),
+  COIN_U64(0xC86AB5C39FA63440), COIN_U64(0x8DD9472BF3FEFAA8),
+  COIN_U64(0xFA856334878FC150), COIN_U64(0xB14F98F6F0FEB952),
+  COIN_U64(0x9C935E00D4B9D8D2), COIN_U64(0x6ED1BF9A569F33D4),
+  COIN_U64(0xC3B8358109E84F07), COIN_U64(0x0A862F80EC4700C9),
+  COIN_U64(0xF4A642E14C6262C8), COIN_U64(0xCD27BB612758C0FB),
+  COIN_U64(0x98E7E9CCCFBD7DBD), COIN_U64(0x8038D51CB897789D),
+  COIN_U64(0xBF21E44003ACDD2C), COIN_U64(0xE0470A63E6BD56C4),
+  COIN_U64(0xEEEA5D5004981478), COIN_U64(0x1858CCFCE06CAC75),
+  COIN_U64(0x95527A5202DF0CCB), COIN_U64(0x0F37801E0C43EBC9),
+  COIN_U64(0xBAA718E68396CFFD), COIN_U64(0xD30560258F54E6BB),
+  COIN_U64(0xE950DF20247C83FD), COIN_U64(0x47C6B82EF32A206A),
+  COIN_U64(0x91D28B7416CDD27E), COIN_U64(0x4CDC331D57FA5442),
+  COIN_U64(0xB6472E511C81471D), COIN_U64(0xE0133FE4ADF8E953),
+  COIN_U64(0xE3D8F9E563A198E5), COIN_U64(0x58180FDDD97723A7),
+  COIN_U64(0x8E679C2F5E44FF8F), COIN_U64(0x570F09EAA7EA7649),
+  COIN_U64(0xB201833B35D63F73), COIN_U64(0x2CD2CC6551E513DB),
+  COIN_U64(0xDE81E40A034BCF4F), COIN_U64(0xF8077F7EA65E58D2),
+  COIN_U64(0x8B112E86420F6191), COIN_U64(0xFB04AFAF27FAF783),
+  COIN_U64(0xADD57A27D29339F6), COIN_U64(0x79C5DB9AF1F9B564),
+  COIN_U64(0xD94AD8B1C7380874), COIN_U64(0x18375281AE7822BD),
+  COIN_U64(0x87CEC76F1C830548), COIN_U64(0x8F2293910D0B15B6),
+  COIN_U64(0xA9C2794AE3A3C69A), COIN_U64(0xB2EB3875504DDB23),
+  COIN_U64(0xD433179D9C8CB841), COIN_U64(0x5FA60692A46151EC),
+  COIN_U64(0x849FEEC281D7F328), COIN_U64(0xDBC7C41BA6BCD334),
+  COIN_U64(0xA5C7EA73224DEFF3), COIN_U64(0x12B9B522906C0801),
+  COIN_U64(0xCF39E50FEAE16BEF), COIN_U64(0xD768226B34870A01),
+  COIN_U64(0x81842F29F2CCE375), COIN_U64(0xE6A1158300D46641),
+  COIN_U64(0xA1E53AF46F801C53), COIN_U64(0x60495AE3C1097FD1),
+  COIN_U64(0xCA5E89B18B602368), COIN_U64(0x385BB19CB14BDFC5),
+  COIN_U64(0xFCF62C1DEE382C42), COIN_U64(0x46729E03DD9ED7B6),
+  COIN_U64(0x9E19DB92B4E31BA9), COIN_U64(0x6C07A2C26A8346D2),
+  COIN_U64(0xC5A05277621BE293), COIN_U64(0xC7098B7305241886),
+};
+
+const int smallestPowerOfTen = -292;
+const int mantissaBits = 52;
+
+// High 64 bits of product and low 64 bits in low
+inline CoinUInt64Bits multiplyHigh(CoinUInt64Bits a, CoinUInt64Bits b,
+  CoinUInt64Bits &low)
+{
+#ifdef __SIZEOF_INT128__
+  unsigned __int128 product = static_cast< unsigned __int128 >(a) * b;
+  low = static_cast< CoinUInt64Bits >(product);
+  return static_cast< CoinUInt64Bits >(product >> 64);
+#else
+  CoinUInt64Bits aLow = a & 0xffffffff;
+  CoinUInt64Bits aHigh = a >> 32;
+  CoinUInt64Bits bLow = b & 0xffffffff;
+  CoinUInt64Bits bHigh = b >> 32;
+  CoinUInt64Bits lowLow = aLow * bLow;
+  CoinUInt64Bits lowHigh = aLow * bHigh;
+  CoinUInt64Bits highLow = aHigh * bLow;
+  CoinUInt64Bits highHigh = aHigh * bHigh;
+  CoinUInt64Bits middle = (lowLow >> 32) + (lowHigh & 0xffffffff) + (highLow & 0xffffffff);
+  low = (middle << 32) | (lowLow & 0xffffffff);
+  return highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+#endif
+}
+
+/* g * cp / 2^128 rounded to odd.  As g is slightly too large the fraction
+   is only known to be nonzero if more than 1 in top word.
+*/
+inline CoinUInt64Bits roundToOdd(const CoinUInt64Bits *g, CoinUInt64Bits cp)
+{
+  CoinUInt64Bits x0;
+  CoinUInt64Bits x1 = multiplyHigh(g[1], cp, x0);
+  CoinUInt64Bits y0;
+  CoinUInt64Bits y1 = multiplyHigh(g[0], cp, y0);
+  CoinUInt64Bits z = y0 + x1;
+  if (z < y0)
+    y1++;
+  return y1 | (z > 1 ? 1 : 0);
+}
+
+/* Shortest decimal c * 10^exponent10 which reads back as double with
+   these bits (sign bit clear, finite and nonzero).  If several are
+   equally short the nearest is returned.  May have trailing zeros.
+*/
+CoinUInt64Bits shortestDecimal(CoinUInt64Bits bits, int &exponent10)
+{
+  CoinUInt64Bits fraction = bits & ((COIN_U64(1) << mantissaBits) - 1);
+  int biased = static_cast< int >(bits >> mantissaBits);
+  CoinUInt64Bits c;
+  int q;
+  if (biased) {
+    c = fraction | (COIN_U64(1) << mantissaBits);
+    q = biased - 1075;
+    // small integers are exact
+    if (q <= 0 && q > -53 && !(c & ((COIN_U64(1) << -q) - 1))) {
+      exponent10 = 0;
+      return c >> -q;
+    }
+  } else {
+    c = fraction;
+    q = -1074;
+  }
+  bool even = !(c & 1);
+  // at a power of two the double below is nearer
+  bool lowerCloser = !fraction && biased > 1;
+  // rounding interval and value times 4
+  CoinUInt64Bits cbl = 4 * c - 2 + (lowerCloser ? 1 : 0);
+  CoinUInt64Bits cb = 4 * c;
+  CoinUInt64Bits cbr = 4 * c + 2;
+  // floor(log10(2^q)) or floor(log10(3/4 2^q))
+  int k = (q * 1262611 - (lowerCloser ? 524031 : 0)) >> 22;
+  // q + floor(log2(10^-k)) + 1 - is between 1 and 4
+  int h = q + ((-k * 1741647) >> 19) + 1;
+  const CoinUInt64Bits *g = powerOfTen128 + 2 * (-k - smallestPowerOfTen);
+  CoinUInt64Bits vbl = roundToOdd(g, cbl << h);
+  CoinUInt64Bits vb = roundToOdd(g, cb << h);
+  CoinUInt64Bits vbr = roundToOdd(g, cbr << h);
+  CoinUInt64Bits lower = vbl + (even ? 0 : 1);
+  CoinUInt64Bits upper = vbr - (even ? 0 : 1);
+  CoinUInt64Bits s = vb / 4;
+  if (s >= 10) {
+    // see if one digit less will do
+    CoinUInt64Bits sp = s / 10;
+    bool upInside = lower <= 40 * sp;
+    bool wpInside = 40 * sp + 40 <= upper;
+    if (upInside != wpInside) {
+      exponent10 = k + 1;
+      return sp + (wpInside ? 1 : 0);
+    }
+  }
+  bool uInside = lower <= 4 * s;
+  bool wInside = 4 * s + 4 <= upper;
+  exponent10 = k;
+  if (uInside != wInside)
+    return s + (wInside ? 1 : 0);
+  // both in - take nearer
+  CoinUInt64Bits mid = 4 * s + 2;
+  bool roundUp = vb > mid || (vb == mid && (s & 1) != 0);
+  return s + (roundUp ? 1 : 0);
+}
+
+// Digits (without trailing zeros) of positive finite nonzero bits
+int shortestDigits(CoinUInt64Bits bits, char digits[20], int &exponent10)
+{
+  CoinUInt64Bits decimal = shortestDecimal(bits, exponent10);
+  while (decimal % 10 == 0) {
+    decimal /= 10;
+    exponent10++;
+  }
+  char reversed[20];
+  int n = 0;
+  while (decimal) {
+    reversed[n++] = static_cast< char >('0' + decimal % 10);
+    decimal /= 10;
+  }
+  for (int i = 0; i < n; i++)
+    digits[i] = reversed[n - 1 - i];
+  return n;
+}
+
+// Length of digits * 10^exponent10 written without exponent
+inline int fixedLength(int n, int exponent10)
+{
+  int scientific = exponent10 + n - 1;
+  if (exponent10 >= 0)
+    return n + exponent10;
+  else if (scientific >= 0)
+    return n + 1;
+  else
+    return n + 1 - scientific;
+}
+
+// Writes digits * 10^exponent10 without exponent, returns end
+char *writeFixed(char *put, const char *digits, int n, int exponent10)
+{
+  int scientific = exponent10 + n - 1;
+  if (exponent10 >= 0) {
+    memcpy(put, digits, n);
+    put += n;
+    memset(put, '0', exponent10);
+    put += exponent10;
+  } else if (scientific >= 0) {
+    int integerDigits = scientific + 1;
+    memcpy(put, digits, integerDigits);
+    put += integerDigits;
+    *put++ = '.';
+    memcpy(put, digits + integerDigits, n - integerDigits);
+    put += n - integerDigits;
+  } else {
+    *put++ = '0';
+    *put++ = '.';
+    memset(put, '0', -scientific - 1);
+    put += -scientific - 1;
+    memcpy(put, digits, n);
+    put += n;
+  }
+  return put;
+}
+
+// Returns sign and absolute value bits
+inline bool splitDouble(double value, CoinUInt64Bits &bits)
+{
+  memcpy(&bits, &value, sizeof(double));
+  bool negative = (bits >> 63) != 0;
+  bits &= ~(COIN_U64(1) << 63);
+  return negative;
+}
+} // end file-local namespace
+
+int CoinDtoaDigits(double value, char digits[20], int &exponent10)
+{
+  CoinUInt64Bits bits;
+  splitDouble(value, bits);
+  if (!bits || bits >= (COIN_U64(0x7ff) << mantissaBits)) {
+    exponent10 = 0;
+    return 0;
+  }
+  return shortestDigits(bits, digits, exponent10);
+}
+
+int CoinDtoa(double value, char *output)
+{
+  CoinUInt64Bits bits;
+  char *put = output;
+  if (splitDouble(value, bits))
+    *put++ = '-';
+  if (bits >= (COIN_U64(0x7ff) << mantissaBits)) {
+    if (bits == (COIN_U64(0x7ff) << mantissaBits)) {
+      strcpy(put, "inf");
+      put += 3;
+    } else {
+      put = output;
+      strcpy(put, "nan");
+      put += 3;
+    }
+    return static_cast< int >(put - output);
+  }
+  if (!bits) {
+    *put++ = '0';
+    *put = '\0';
+    return static_cast< int >(put - output);
+  }
+  char digits[20];
+  int exponent10;
+  int n = shortestDigits(bits, digits, exponent10);
+  int scientific = exponent10 + n - 1;
+  int absScientific = scientific >= 0 ? scientific : -scientific;
+  int scientificLength = n + (n > 1 ? 1 : 0) + 1 + (scientific < 0 ? 1 : 0)
+    + (absScientific >= 100 ? 3 : (absScientific >= 10 ? 2 : 1));
+  if (fixedLength(n, exponent10) <= scientificLength) {
+    put = writeFixed(put, digits, n, exponent10);
+  } else {
+    *put++ = digits[0];
+    if (n > 1) {
+      *put++ = '.';
+      memcpy(put, digits + 1, n - 1);
+      put += n - 1;
+    }
+    *put++ = 'e';
+    if (scientific < 0)
+      *put++ = '-';
+    if (absScientific >= 100)
+      *put++ = static_cast< char >('0' + absScientific / 100);
+    if (absScientific >= 10)
+      *put++ = static_cast< char >('0' + (absScientific / 10) % 10);
+    *put++ = static_cast< char >('0' + absScientific % 10);
+  }
+  *put = '\0';
+  return static_cast< int >(put - output);
+}
+
+int CoinDtoaFixed(double value, int decimals, char *output, int size)
+{
+  CoinUInt64Bits bits;
+  bool negative = splitDouble(value, bits);
+  if (bits >= (COIN_U64(0x7ff) << mantissaBits))
+    return -1;
+  char digits[21];
+  int exponent10 = 0;
+  int n = 0;
+  if (bits)
+    n = shortestDigits(bits, digits, exponent10);
+  if (-exponent10 > decimals) {
+    /* Round shortest digits.  This gives the same answer as rounding the
+       exact value unless the digits end in a 5 just after the last one
+       kept - then there is no way to tell which way to go. */
+    int keep = n + exponent10 + decimals;
+    bool up = false;
+    if (keep >= 0) {
+      if (digits[keep] == '5' && keep + 1 == n)
+        return -1;
+      up = digits[keep] >= '5';
+    }
+    n = keep > 0 ? keep : 0;
+    exponent10 = -decimals;
+    if (up) {
+      int i = n - 1;
+      while (i >= 0 && digits[i] == '9')
+        digits[i--] = '0';
+      if (i >= 0) {
+        digits[i]++;
+      } else {
+        memmove(digits + 1, digits, n);
+        digits[0] = '1';
+        n++;
+      }
+    }
+    while (n && digits[n - 1] == '0') {
+      n--;
+      exponent10++;
+    }
+  }
+  if (!n) {
+    if (size < 2)
+      return -1;
+    strcpy(output, "0");
+    return 1;
+  }
+  int length = fixedLength(n, exponent10) + (negative ? 1 : 0);
+  if (length >= size)
+    return -1;
+  char *put = output;
+  if (negative)
+    *put++ = '-';
+  put = writeFixed(put, digits, n, exponent10);
+  *put = '\0';
+  return length;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
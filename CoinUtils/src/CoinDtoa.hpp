@@ -0,0 +1,52 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CoinDtoa_H
+#define CoinDtoa_H
+
+/** \file CoinDtoa.hpp
+    \brief Fast, locale independent conversion of double to text.
+
+    Numbers are written with the fewest digits which read back (with
+    strtod or CoinStrtod) as exactly the same double.  If several
+    strings of that length do, the one nearest the double is used.
+*/
+
+/** Shortest decimal digits of a double.
+
+    Puts the digits (no sign, point or trailing zeros, at most 17 of them,
+    not null terminated) in \p digits and sets \p exponent10 so that |value|
+    is digits * 10^exponent10.  Returns the number of digits, or 0 for zero,
+    infinity and NaN.
+*/
+int CoinDtoaDigits(double value, char digits[20], int &exponent10);
+
+/** Writes the shortest representation of value which reads back exactly.
+
+    Uses plain notation (e.g. 0.25 or 1500) unless an exponent is shorter
+    (e.g. 1e-05 is written as 1e-5).  Infinity and NaN are written as inf,
+    -inf and nan.  At most 24 characters are written plus the terminating
+    null.  Returns the length.
+*/
+int CoinDtoa(double value, char *output);
+
+/** Writes value with at most \p decimals digits after the decimal point
+    and no exponent, without trailing zeros.
+
+    If the shortest digits which read back exactly need no more decimals
+    they are used (so 0.1 is written as 0.1 and not 0.100000000).
+    Otherwise the value is rounded to \p decimals places, as printf's "%.*f"
+    would, and trailing zeros taken off.  Zero is written as 0 whatever its
+    sign.  Returns the length, or -1 if \p size characters
+    (including the null) are not enough, for infinity and NaN, and in the
+    rare case where the shortest digits end in a 5 just after the last
+    decimal wanted so the rounding direction is not known - the caller
+    should then use printf.
+*/
+int CoinDtoaFixed(double value, int decimals, char *output, int size);
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
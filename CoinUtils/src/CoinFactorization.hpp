@@ -19,10 +19,75 @@
 #include <cassert>
 #include <cstdio>
 #include <cmath>
+#include <vector>
 #include "CoinTypes.hpp"
 #include "CoinIndexedVector.hpp"
+#include "CoinParallel.hpp"
 
 class CoinPackedMatrix;
+class CoinFactorization;
+
+/** One reach set kept by CoinFactorization for sparse FTRAN
+    (see CoinFactorization::setReachCache) */
+struct CoinFactorizationReachSet {
+  /// 0 for L, 1 for U, -1 if not in use
+  int type;
+  /// Generation of L or U when found
+  int generation;
+  /// When last used (for least recently used)
+  int lastUsed;
+  /// Hash of key
+  unsigned int hash;
+  /// Input pattern in order
+  std::vector< int > key;
+  /// Pivots in order they are done (for U slacks at end)
+  std::vector< int > list;
+  /// Number in list before slacks
+  int numberList;
+};
+
+/** Scratch space for solves with a CoinFactorization which only read it.
+    Each thread solving at same time should have its own
+    (see CoinFactorization::updateColumn).  Sized on first use. */
+class CoinFactorizationWorkspace {
+  friend class CoinFactorization;
+
+public:
+  CoinFactorizationWorkspace()
+    : maximumRows_(-1)
+  {
+  }
+
+private:
+  /// Stack, list, next and mark for sparse solves (mark kept zero)
+  CoinIntArrayWithLength sparse_;
+  /// maximumRowsExtra of factorization sparse_ was set up for
+  int maximumRows_;
+};
+
+/// Passed to threads doing one pivot (see CoinFactorization::setNumberThreads)
+template < class T >
+struct CoinFactorizationPivotInfo {
+  CoinFactorization *factorization;
+  int pivotRow;
+  int numberInPivotRow;
+  int numberInPivotColumn;
+  const int *saveColumn;
+  const int *indexL;
+  const CoinFactorizationDouble *multipliersL;
+  unsigned int *workArea2;
+  int increment2;
+  const T *markRow;
+  int largeInteger;
+  int numberTasks;
+  /// Work region for each task
+  CoinFactorizationDouble *work;
+  /// Bits for entries to take out of row lists
+  unsigned int *remove;
+  /// Change in number of elements for each task
+  int *added;
+};
+
 /** This deals with Factorization and Updates
 
     This class started with a parallel simplex code I was writing in the
@@ -308,6 +373,20 @@ public:
   {
     denseThreshold_ = value;
   }
+  /** Multiplier on how dense what is left must be before going dense.
+      What is left goes dense when it has more than full/(ratio*multiplier)
+      elements where ratio is between 1.5 and 3.5 depending on size.  So
+      larger goes dense sooner.  Default 1.0.
+  */
+  inline double denseMultiplier() const
+  {
+    return denseMultiplier_;
+  }
+  /// Sets multiplier on density for going dense
+  inline void setDenseMultiplier(double value)
+  {
+    denseMultiplier_ = value;
+  }
   /// Pivot tolerance
   inline double pivotTolerance() const
   {
@@ -602,6 +681,13 @@ public:
   int updateColumn(CoinIndexedVector *regionSparse,
     CoinIndexedVector *regionSparse2,
     bool noPermute = false) const;
+  /** As above but all scratch space is in workspace so several threads
+      may use same factorization at once - each with own workspace and
+      regions.  Statistics and reach sets are not updated */
+  int updateColumn(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *regionSparse2,
+    CoinFactorizationWorkspace &workspace,
+    bool noPermute = false) const;
   /** Updates one column (FTRAN) from region2
       Tries to do FT update
       number returned is negative if no room.
@@ -617,6 +703,11 @@ public:
   */
   int updateColumnTranspose(CoinIndexedVector *regionSparse,
     CoinIndexedVector *regionSparse2) const;
+  /** As above but all scratch space is in workspace so several threads
+      may use same factorization at once */
+  int updateColumnTranspose(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *regionSparse2,
+    CoinFactorizationWorkspace &workspace) const;
   /// Part of twocolumnsTranspose
   void updateOneColumnTranspose(CoinIndexedVector *regionWork, int &statistics) const;
   /** Updates two columns (BTRAN) from regionSparse2 and 3
@@ -627,6 +718,29 @@ public:
     CoinIndexedVector *regionSparse2,
     CoinIndexedVector *regionSparse3,
     int type) const;
+  /** Updates several columns (FTRAN) from regions[0 .. numberRegions-1]
+      Each region is as regionSparse2 in updateColumn (if packed on input
+      will be packed on output).
+      strategy 0 - choose for each column from its number of elements,
+      1 - one at a time with the usual sparse code,
+      2 - all together with dense code so L, R and U are only gone
+      through once for all the columns.
+      Columns done together are split between up to numberThreads threads
+      (see CoinParallel.hpp) and are not counted in statistics.  They are
+      done in place so need capacity of at least numberRows plus number of
+      pivots - any smaller are done one at a time.
+      regionSparse starts as zero and is zero at end
+  */
+  void updateColumns(CoinIndexedVector *regionSparse,
+    CoinIndexedVector **regions, int numberRegions,
+    int strategy = 0, int numberThreads = 1) const;
+  /** Updates several columns (BTRAN) from regions[0 .. numberRegions-1]
+      As updateColumns but each region is as regionSparse2 in
+      updateColumnTranspose
+  */
+  void updateColumnsTranspose(CoinIndexedVector *regionSparse,
+    CoinIndexedVector **regions, int numberRegions,
+    int strategy = 0, int numberThreads = 1) const;
   /** makes a row copy of L for speed and to allow very sparse problems */
   void goSparse();
   /**  get sparse threshold */
@@ -636,6 +750,67 @@ public:
   }
   /**  set sparse threshold */
   void sparseThreshold(int value);
+  /** Keeps up to numberEntries reach sets from the sparse L and U parts
+      of FTRAN so a later FTRAN with exactly the same pattern of input
+      indices (in the same order) skips the depth first search and gives
+      exactly the same answer.  Sets for L stay valid until the next
+      factorization, those for U until the next replaceColumn.
+      0 (the default) switches off and frees the sets.
+      The cache is part of the sparse work area so is not thread safe.
+  */
+  void setReachCache(int numberEntries);
+  /// Number of reach sets kept
+  inline int reachCache() const
+  {
+    return reachCacheSize_;
+  }
+  /// Number of sparse L or U FTRANs which found a reach set in the cache
+  inline int reachCacheHits() const
+  {
+    return reachCacheHits_;
+  }
+  /// Number of sparse L or U FTRANs which had to do the search
+  inline int reachCacheMisses() const
+  {
+    return reachCacheMisses_;
+  }
+  /** Number of threads used to eliminate each large pivot during
+      factorization (see CoinParallel.hpp).  Pivots are still chosen one at a
+      time and the columns they change split between threads, so the
+      factorization is exactly the same as with one thread (the default).
+  */
+  inline int numberThreads() const
+  {
+    return numberThreads_;
+  }
+  /// Sets number of threads used in factorization
+  inline void setNumberThreads(int value)
+  {
+    numberThreads_ = CoinMax(value, 1);
+  }
+  /** If 1 the part of the basis left after slacks are taken out is put
+      into block triangular form (a maximum matching and then the strong
+      components of its graph) and pivots are only chosen inside the
+      diagonal blocks.  Then no fill is ever created below the blocks and
+      each block is factorized as if on its own.  If the blocks stop a
+      pivot being found they are dropped for the rest of that
+      factorization.  0 (the default) pivots anywhere.
+  */
+  inline int blockTriangular() const
+  {
+    return blockTriangular_;
+  }
+  /// Sets whether to use block triangular form (see blockTriangular)
+  inline void setBlockTriangular(int value)
+  {
+    blockTriangular_ = value;
+  }
+  /** Number of diagonal blocks found in last factorization (0 if not
+      looked for or the basis is structurally singular) */
+  inline int numberDiagonalBlocks() const
+  {
+    return numberDiagonalBlocks_;
+  }
   //@}
   /// *** Below this user may not want to know about
 
@@ -756,6 +931,24 @@ protected:
    extraNeeded is over and above present */
   bool getColumnSpace(int iColumn,
     int extraNeeded);
+  /** Gets space for extraNeeded more elements in each of columns
+      which[0..number-1] without moving any while they are updated.
+      Returns 1 if all have space, 0 if not (a compression got in the way)
+      and -1 if no memory */
+  int getColumnSpaces(const int *which, int number, int extraNeeded);
+  /** Finds diagonal blocks of what is left to factorize.  block gets
+      block of each row and then of each column (numberRows_ +
+      iColumn) or -1 if not left.  blockMember gets rows and columns of
+      block i in blockStart[i] to blockStart[i+1]-1.  Columns of a block
+      only have elements in rows of that block or earlier ones.  Returns
+      number of blocks (0 if structurally singular).
+  */
+  int findDiagonalBlocks(std::vector< int > &block,
+    std::vector< int > &blockStart, std::vector< int > &blockMember);
+  /** Puts rows and columns (numberRows_ + iColumn) in member which are
+      still to do in chain of their counts or if park after the largest
+      count (so not looked at) */
+  void linkDiagonalBlock(const int *member, int number, bool park);
 
   /** Reorders U so contiguous and in order (if there is space)
       Returns true if it could */
@@ -829,30 +1022,67 @@ protected:
   /// Cleans up at end of factorization
   void cleanup();
 
+  /// Does work of updateColumn - workspace may be NULL
+  int gutsOfUpdateColumn(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *regionSparse2,
+    bool noPermute,
+    CoinFactorizationWorkspace *workspace) const;
+  /// Does work of updateColumnTranspose - workspace may be NULL
+  int gutsOfUpdateColumnTranspose(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *regionSparse2,
+    CoinFactorizationWorkspace *workspace) const;
+  /// Makes workspace big enough for sparse solves
+  void prepareWorkspace(CoinFactorizationWorkspace &workspace) const;
+  /// Sparse regions - from workspace if given
+  inline int *sparseArea(CoinFactorizationWorkspace *workspace) const
+  {
+    return workspace ? workspace->sparse_.array() : sparse_.array();
+  }
+
   /// Updates part of column (FTRANL)
-  void updateColumnL(CoinIndexedVector *region, int *indexIn) const;
+  void updateColumnL(CoinIndexedVector *region, int *indexIn,
+    CoinFactorizationWorkspace *workspace = NULL) const;
   /// Updates part of column (FTRANL) when densish
   void updateColumnLDensish(CoinIndexedVector *region, int *indexIn) const;
   /// Updates part of column (FTRANL) when sparse
-  void updateColumnLSparse(CoinIndexedVector *region, int *indexIn) const;
+  void updateColumnLSparse(CoinIndexedVector *region, int *indexIn,
+    CoinFactorizationWorkspace *workspace = NULL) const;
   /// Updates part of column (FTRANL) when sparsish
-  void updateColumnLSparsish(CoinIndexedVector *region, int *indexIn) const;
+  void updateColumnLSparsish(CoinIndexedVector *region, int *indexIn,
+    CoinFactorizationWorkspace *workspace = NULL) const;
 
   /// Updates part of column (FTRANR) without FT update
-  void updateColumnR(CoinIndexedVector *region) const;
+  void updateColumnR(CoinIndexedVector *region,
+    CoinFactorizationWorkspace *workspace = NULL) const;
   /** Updates part of column (FTRANR) with FT update.
       Also stores update after L and R */
   void updateColumnRFT(CoinIndexedVector *region, int *indexIn);
 
   /// Updates part of column (FTRANU)
-  void updateColumnU(CoinIndexedVector *region, int *indexIn) const;
+  void updateColumnU(CoinIndexedVector *region, int *indexIn,
+    CoinFactorizationWorkspace *workspace = NULL) const;
 
   /// Updates part of column (FTRANU) when sparse
   void updateColumnUSparse(CoinIndexedVector *regionSparse,
-    int *indexIn) const;
+    int *indexIn, CoinFactorizationWorkspace *workspace = NULL) const;
+  /** Looks for reach set of type 0 (L) or 1 (U) whose key is the
+      entries of index[0..number-1] which are >= first.  Returns the set or
+      NULL, in which case key is saved ready for saveReachSet */
+  const CoinFactorizationReachSet *findReachSet(int type, const int *index,
+    int number, int first) const;
+  /// Saves reach set of type for last key not found (slacks are for U)
+  void saveReachSet(int type, const int *list, int numberList,
+    const int *slacks, int numberSlacks) const;
+  /// Reach sets for U (and L if alsoL) are no longer valid
+  inline void invalidateReachSets(bool alsoL)
+  {
+    reachGeneration_[1]++;
+    if (alsoL)
+      reachGeneration_[0]++;
+  }
   /// Updates part of column (FTRANU) when sparsish
   void updateColumnUSparsish(CoinIndexedVector *regionSparse,
-    int *indexIn) const;
+    int *indexIn, CoinFactorizationWorkspace *workspace = NULL) const;
   /// Updates part of column (FTRANU)
   int updateColumnUDensish(double *COIN_RESTRICT region,
     int *COIN_RESTRICT regionIndex) const;
@@ -875,40 +1105,64 @@ protected:
   /** Updates part of column transpose (BTRANU),
       assumes index is sorted i.e. region is correct */
   void updateColumnTransposeU(CoinIndexedVector *region,
-    int smallestIndex) const;
+    int smallestIndex, CoinFactorizationWorkspace *workspace = NULL) const;
   /** Updates part of column transpose (BTRANU) when sparsish,
       assumes index is sorted i.e. region is correct */
   void updateColumnTransposeUSparsish(CoinIndexedVector *region,
-    int smallestIndex) const;
+    int smallestIndex, CoinFactorizationWorkspace *workspace = NULL) const;
   /** Updates part of column transpose (BTRANU) when densish,
       assumes index is sorted i.e. region is correct */
   void updateColumnTransposeUDensish(CoinIndexedVector *region,
     int smallestIndex) const;
   /** Updates part of column transpose (BTRANU) when sparse,
       assumes index is sorted i.e. region is correct */
-  void updateColumnTransposeUSparse(CoinIndexedVector *region) const;
+  void updateColumnTransposeUSparse(CoinIndexedVector *region,
+    CoinFactorizationWorkspace *workspace = NULL) const;
   /** Updates part of column transpose (BTRANU) by column
       assumes index is sorted i.e. region is correct */
   void updateColumnTransposeUByColumn(CoinIndexedVector *region,
     int smallestIndex) const;
 
   /// Updates part of column transpose (BTRANR)
-  void updateColumnTransposeR(CoinIndexedVector *region) const;
+  void updateColumnTransposeR(CoinIndexedVector *region,
+    CoinFactorizationWorkspace *workspace = NULL) const;
   /// Updates part of column transpose (BTRANR) when dense
   void updateColumnTransposeRDensish(CoinIndexedVector *region) const;
   /// Updates part of column transpose (BTRANR) when sparse
-  void updateColumnTransposeRSparse(CoinIndexedVector *region) const;
+  void updateColumnTransposeRSparse(CoinIndexedVector *region,
+    CoinFactorizationWorkspace *workspace = NULL) const;
 
   /// Updates part of column transpose (BTRANL)
-  void updateColumnTransposeL(CoinIndexedVector *region) const;
+  void updateColumnTransposeL(CoinIndexedVector *region,
+    CoinFactorizationWorkspace *workspace = NULL) const;
   /// Updates part of column transpose (BTRANL) when densish by column
   void updateColumnTransposeLDensish(CoinIndexedVector *region) const;
   /// Updates part of column transpose (BTRANL) when densish by row
   void updateColumnTransposeLByRow(CoinIndexedVector *region) const;
   /// Updates part of column transpose (BTRANL) when sparsish by row
-  void updateColumnTransposeLSparsish(CoinIndexedVector *region) const;
+  void updateColumnTransposeLSparsish(CoinIndexedVector *region,
+    CoinFactorizationWorkspace *workspace = NULL) const;
   /// Updates part of column transpose (BTRANL) when sparse (by Row)
-  void updateColumnTransposeLSparse(CoinIndexedVector *region) const;
+  void updateColumnTransposeLSparse(CoinIndexedVector *region,
+    CoinFactorizationWorkspace *workspace = NULL) const;
+  /** Solves with dense part of factorization (LAPACK) in place.
+      Region is whole region (not just dense part) */
+  void updateColumnDense(double *region, bool transpose) const;
+
+  /// Does updateColumns (or Transpose)
+  void updateManyColumns(CoinIndexedVector *regionSparse,
+    CoinIndexedVector **regions, int numberRegions,
+    int strategy, int numberThreads, bool transpose) const;
+  /** Updates several columns (FTRAN) together with dense code.
+      Regions have entries in place and are not permuted.
+      No statistics are changed so can be done by several threads at once */
+  void updateColumnsDense(double **region, int **regionIndex,
+    int *numberNonZero, int numberRegions) const;
+  /// Updates several columns (BTRAN) together with dense code - as above
+  void updateColumnsTransposeDense(double **region, int **regionIndex,
+    int *numberNonZero, int numberRegions) const;
+  /// Task for CoinParallelRun - does one share of updateManyColumns
+  static void updateManyColumnsTask(void *info, int whichTask);
 
 public:
   /** Replaces one Column to basis for PFI
@@ -932,6 +1186,8 @@ protected:
 #define COINFACTORIZATION_SHIFT_PER_INT 5
 #define COINFACTORIZATION_MASK_PER_INT 0x1f
 #endif
+/// Pivots with less work than this are always done on one thread
+#define COIN_FACTORIZATION_PARALLEL_PIVOT 100000.0
   template < class T >
   inline bool
   pivot(int pivotRow,
@@ -1119,175 +1375,87 @@ protected:
     }
     int added = numberInPivotRow * numberInPivotColumn;
     unsigned int *temp2 = workArea2;
-    int *nextColumn = nextColumn_.array();
 
     //pack down and move to work
-    int jColumn;
-    for (jColumn = 0; jColumn < numberInPivotRow; jColumn++) {
-      int iColumn = saveColumn[jColumn];
-      int startColumn = startColumnU[iColumn];
-      int endColumn = startColumn + numberInColumn[iColumn];
-      int iRow = indexRowU[startColumn];
-      CoinFactorizationDouble value = elementU[startColumn];
-      double largest;
-      int put = startColumn;
-      int positionLargest = -1;
-      CoinFactorizationDouble thisPivotValue = 0.0;
-
-      //compress column and find largest not updated
-      bool checkLargest;
-      int mark = markRow[iRow];
-
-      if (mark == largeInteger + 1) {
-        largest = fabs(value);
-        positionLargest = put;
-        put++;
-        checkLargest = false;
-      } else {
-        //need to find largest
-        largest = 0.0;
-        checkLargest = true;
-        if (mark != largeInteger) {
-          //will be updated
-          work[mark] = value;
-          int word = mark >> COINFACTORIZATION_SHIFT_PER_INT;
-          int bit = mark & COINFACTORIZATION_MASK_PER_INT;
-
-          temp2[word] = temp2[word] | (1 << bit); //say already in counts
-          added--;
-        } else {
-          thisPivotValue = value;
-        }
-      }
-      int i;
-      for (i = startColumn + 1; i < endColumn; i++) {
-        iRow = indexRowU[i];
-        value = elementU[i];
-        int mark = markRow[iRow];
-
-        if (mark == largeInteger + 1) {
-          //keep
-          indexRowU[put] = iRow;
-          elementU[put] = value;
-          if (checkLargest) {
-            double absValue = fabs(value);
-
-            if (absValue > largest) {
-              largest = absValue;
-              positionLargest = put;
-            }
-          }
-          put++;
-        } else if (mark != largeInteger) {
-          //will be updated
-          work[mark] = value;
-          int word = mark >> COINFACTORIZATION_SHIFT_PER_INT;
-          int bit = mark & COINFACTORIZATION_MASK_PER_INT;
-
-          temp2[word] = temp2[word] | (1 << bit); //say already in counts
-          added--;
-        } else {
-          thisPivotValue = value;
-        }
-      }
-      //slot in pivot
-      elementU[put] = elementU[startColumn];
-      indexRowU[put] = indexRowU[startColumn];
-      if (positionLargest == startColumn) {
-        positionLargest = put; //follow if was largest
-      }
-      put++;
-      elementU[startColumn] = thisPivotValue;
-      indexRowU[startColumn] = pivotRow;
-      //clean up counts
-      startColumn++;
-      numberInColumn[iColumn] = put - startColumn;
-      int *numberInColumnPlus = numberInColumnPlus_.array();
-      numberInColumnPlus[iColumn]++;
-      startColumnU[iColumn]++;
-      //how much space have we got
-      int next = nextColumn[iColumn];
-      int space;
-
-      space = startColumnU[next] - put - numberInColumnPlus[next];
-      //assume no zero elements
-      if (numberInPivotColumn > space) {
-        //getColumnSpace also moves fixed part
-        if (!getColumnSpace(iColumn, numberInPivotColumn)) {
-          return false;
-        }
-        //redo starts
-        if (positionLargest >= 0)
-          positionLargest = positionLargest + startColumnU[iColumn] - startColumn;
-        startColumn = startColumnU[iColumn];
-        put = startColumn + numberInColumn[iColumn];
-      }
-      double tolerance = zeroTolerance_;
-
-      int *nextCount = nextCount_.array();
-      for (j = 0; j < numberInPivotColumn; j++) {
-        value = work[j] - thisPivotValue * multipliersL[j];
-        double absValue = fabs(value);
-
-        if (absValue > tolerance) {
-          work[j] = 0.0;
-          assert(put < lengthAreaU_);
-          elementU[put] = value;
-          indexRowU[put] = indexL[j];
-          if (absValue > largest) {
-            largest = absValue;
-            positionLargest = put;
-          }
-          put++;
-        } else {
-          work[j] = 0.0;
-          added--;
+    int *nextCount = nextCount_.array();
+    int numberTasks = 0;
+    if (numberThreads_ > 1 && numberInPivotRow >= 2 * numberThreads_
+      && static_cast< double >(numberInPivotRow) * numberInPivotColumn
+        >= COIN_FACTORIZATION_PARALLEL_PIVOT) {
+      // if every column has room then can split columns between threads
+      int status = getColumnSpaces(saveColumn, numberInPivotRow,
+        numberInPivotColumn);
+      if (status < 0)
+        return false;
+      if (status > 0)
+        numberTasks = CoinMin(4 * numberThreads_, numberInPivotRow);
+    }
+    if (numberTasks) {
+      CoinFactorizationPivotInfo< T > info;
+      info.factorization = this;
+      info.pivotRow = pivotRow;
+      info.numberInPivotRow = numberInPivotRow;
+      info.numberInPivotColumn = numberInPivotColumn;
+      info.saveColumn = saveColumn;
+      info.indexL = indexL;
+      info.multipliersL = multipliersL;
+      info.workArea2 = workArea2;
+      info.increment2 = increment2;
+      info.markRow = markRow;
+      info.largeInteger = largeInteger;
+      info.numberTasks = numberTasks;
+      info.work = new CoinFactorizationDouble[numberTasks * numberInPivotColumn];
+      CoinZeroN(info.work, numberTasks * numberInPivotColumn);
+      info.remove = new unsigned int[increment2 * numberInPivotRow];
+      CoinZeroN(info.remove, increment2 * numberInPivotRow);
+      info.added = new int[numberTasks];
+      CoinParallelRun(numberTasks, numberThreads_,
+        pivotColumnsTask< T >, &info);
+      for (int iTask = 0; iTask < numberTasks; iTask++)
+        added += info.added[iTask];
+      // take zeros out of row lists in same order as if one at a time
+      unsigned int *remove = info.remove;
+      for (int jColumn = 0; jColumn < numberInPivotRow; jColumn++) {
+        int iColumn = saveColumn[jColumn];
+        for (j = 0; j < numberInPivotColumn; j++) {
           int word = j >> COINFACTORIZATION_SHIFT_PER_INT;
           int bit = j & COINFACTORIZATION_MASK_PER_INT;
-
-          if (temp2[word] & (1 << bit)) {
-            //take out of row list
-            iRow = indexL[j];
-            int start = startRowU[iRow];
-            int end = start + numberInRow[iRow];
-            int where = start;
-
+          if (remove[word] & (1 << bit)) {
+            int iRow = indexL[j];
+            int where = startRowU[iRow];
             while (indexColumnU[where] != iColumn) {
               where++;
             } /* endwhile */
-#if DEBUG_COIN
-            if (where >= end) {
-              abort();
-            }
-#endif
-            indexColumnU[where] = indexColumnU[end - 1];
+            indexColumnU[where] = indexColumnU[startRowU[iRow] + numberInRow[iRow] - 1];
             numberInRow[iRow]--;
-          } else {
-            //make sure won't be added
-            int word = j >> COINFACTORIZATION_SHIFT_PER_INT;
-            int bit = j & COINFACTORIZATION_MASK_PER_INT;
-
-            temp2[word] = temp2[word] | (1 << bit); //say already in counts
           }
         }
+        remove += increment2;
+        //linked list for column
+        if (nextCount[iColumn + numberRows_] != -2) {
+          //modify linked list
+          deleteLink(iColumn + numberRows_);
+          addLink(iColumn + numberRows_, numberInColumn[iColumn]);
+        }
       }
-      numberInColumn[iColumn] = put - startColumn;
-      //move largest
-      if (positionLargest >= 0) {
-        value = elementU[positionLargest];
-        iRow = indexRowU[positionLargest];
-        elementU[positionLargest] = elementU[startColumn];
-        indexRowU[positionLargest] = indexRowU[startColumn];
-        elementU[startColumn] = value;
-        indexRowU[startColumn] = iRow;
-      }
-      //linked list for column
-      if (nextCount[iColumn + numberRows_] != -2) {
-        //modify linked list
-        deleteLink(iColumn + numberRows_);
-        addLink(iColumn + numberRows_, numberInColumn[iColumn]);
+      delete[] info.work;
+      delete[] info.remove;
+      delete[] info.added;
+    } else {
+      for (int jColumn = 0; jColumn < numberInPivotRow; jColumn++) {
+        int iColumn = saveColumn[jColumn];
+        if (!pivotOneColumn(iColumn, pivotRow, numberInPivotColumn, indexL,
+              multipliersL, work, temp2, static_cast< unsigned int * >(NULL),
+              markRow, largeInteger, added))
+          return false;
+        //linked list for column
+        if (nextCount[iColumn + numberRows_] != -2) {
+          //modify linked list
+          deleteLink(iColumn + numberRows_);
+          addLink(iColumn + numberRows_, numberInColumn[iColumn]);
+        }
+        temp2 += increment2;
       }
-      temp2 += increment2;
     }
     //get space for row list
     unsigned int *putBase = workArea2;
@@ -1410,6 +1578,223 @@ protected:
     return true;
   }
 
+  /** Does one column (iColumn) of pivot - see pivot.
+      If remove is NULL then entries which become zero are taken out of row
+      lists at once, otherwise they are marked in remove for the caller.
+      In that case column must already have room for numberInPivotColumn
+      more so that several columns can be done at once.
+      Returns false if no room */
+  template < class T >
+  inline bool
+  pivotOneColumn(int iColumn,
+    int pivotRow,
+    int numberInPivotColumn,
+    const int indexL[],
+    const CoinFactorizationDouble multipliersL[],
+    CoinFactorizationDouble work[],
+    unsigned int temp2[],
+    unsigned int remove[],
+    const T markRow[],
+    int largeInteger,
+    int &added)
+  {
+    int *indexColumnU = indexColumnU_.array();
+    int *startColumnU = startColumnU_.array();
+    int *numberInColumn = numberInColumn_.array();
+    int *numberInColumnPlus = numberInColumnPlus_.array();
+    CoinFactorizationDouble *elementU = elementU_.array();
+    int *indexRowU = indexRowU_.array();
+    int *startRowU = startRowU_.array();
+    int *numberInRow = numberInRow_.array();
+    int *nextColumn = nextColumn_.array();
+
+    int startColumn = startColumnU[iColumn];
+    int endColumn = startColumn + numberInColumn[iColumn];
+    int iRow = indexRowU[startColumn];
+    CoinFactorizationDouble value = elementU[startColumn];
+    double largest;
+    int put = startColumn;
+    int positionLargest = -1;
+    CoinFactorizationDouble thisPivotValue = 0.0;
+
+    //compress column and find largest not updated
+    bool checkLargest;
+    int mark = markRow[iRow];
+
+    if (mark == largeInteger + 1) {
+      largest = fabs(value);
+      positionLargest = put;
+      put++;
+      checkLargest = false;
+    } else {
+      //need to find largest
+      largest = 0.0;
+      checkLargest = true;
+      if (mark != largeInteger) {
+        //will be updated
+        work[mark] = value;
+        int word = mark >> COINFACTORIZATION_SHIFT_PER_INT;
+        int bit = mark & COINFACTORIZATION_MASK_PER_INT;
+
+        temp2[word] = temp2[word] | (1 << bit); //say already in counts
+        added--;
+      } else {
+        thisPivotValue = value;
+      }
+    }
+    int i;
+    for (i = startColumn + 1; i < endColumn; i++) {
+      iRow = indexRowU[i];
+      value = elementU[i];
+      int mark = markRow[iRow];
+
+      if (mark == largeInteger + 1) {
+        //keep
+        indexRowU[put] = iRow;
+        elementU[put] = value;
+        if (checkLargest) {
+          double absValue = fabs(value);
+
+          if (absValue > largest) {
+            largest = absValue;
+            positionLargest = put;
+          }
+        }
+        put++;
+      } else if (mark != largeInteger) {
+        //will be updated
+        work[mark] = value;
+        int word = mark >> COINFACTORIZATION_SHIFT_PER_INT;
+        int bit = mark & COINFACTORIZATION_MASK_PER_INT;
+
+        temp2[word] = temp2[word] | (1 << bit); //say already in counts
+        added--;
+      } else {
+        thisPivotValue = value;
+      }
+    }
+    //slot in pivot
+    elementU[put] = elementU[startColumn];
+    indexRowU[put] = indexRowU[startColumn];
+    if (positionLargest == startColumn) {
+      positionLargest = put; //follow if was largest
+    }
+    put++;
+    elementU[startColumn] = thisPivotValue;
+    indexRowU[startColumn] = pivotRow;
+    //clean up counts
+    startColumn++;
+    numberInColumn[iColumn] = put - startColumn;
+    numberInColumnPlus[iColumn]++;
+    startColumnU[iColumn]++;
+    //how much space have we got (if remove then already there)
+    if (!remove) {
+      int next = nextColumn[iColumn];
+      int space;
+
+      space = startColumnU[next] - put - numberInColumnPlus[next];
+      //assume no zero elements
+      if (numberInPivotColumn > space) {
+        //getColumnSpace also moves fixed part
+        if (!getColumnSpace(iColumn, numberInPivotColumn)) {
+          return false;
+        }
+        //redo starts
+        if (positionLargest >= 0)
+          positionLargest = positionLargest + startColumnU[iColumn] - startColumn;
+        startColumn = startColumnU[iColumn];
+        put = startColumn + numberInColumn[iColumn];
+      }
+    }
+    double tolerance = zeroTolerance_;
+
+    for (int j = 0; j < numberInPivotColumn; j++) {
+      value = work[j] - thisPivotValue * multipliersL[j];
+      double absValue = fabs(value);
+
+      if (absValue > tolerance) {
+        work[j] = 0.0;
+        assert(put < lengthAreaU_);
+        elementU[put] = value;
+        indexRowU[put] = indexL[j];
+        if (absValue > largest) {
+          largest = absValue;
+          positionLargest = put;
+        }
+        put++;
+      } else {
+        work[j] = 0.0;
+        added--;
+        int word = j >> COINFACTORIZATION_SHIFT_PER_INT;
+        int bit = j & COINFACTORIZATION_MASK_PER_INT;
+
+        if (remove && (temp2[word] & (1 << bit))) {
+          //take out of row list later
+          remove[word] = remove[word] | (1 << bit);
+        } else if (temp2[word] & (1 << bit)) {
+          //take out of row list
+          iRow = indexL[j];
+          int start = startRowU[iRow];
+          int end = start + numberInRow[iRow];
+          int where = start;
+
+          while (indexColumnU[where] != iColumn) {
+            where++;
+          } /* endwhile */
+#if DEBUG_COIN
+          if (where >= end) {
+            abort();
+          }
+#endif
+          indexColumnU[where] = indexColumnU[end - 1];
+          numberInRow[iRow]--;
+        } else {
+          //make sure won't be added
+          int word = j >> COINFACTORIZATION_SHIFT_PER_INT;
+          int bit = j & COINFACTORIZATION_MASK_PER_INT;
+
+          temp2[word] = temp2[word] | (1 << bit); //say already in counts
+        }
+      }
+    }
+    numberInColumn[iColumn] = put - startColumn;
+    //move largest
+    if (positionLargest >= 0) {
+      value = elementU[positionLargest];
+      iRow = indexRowU[positionLargest];
+      elementU[positionLargest] = elementU[startColumn];
+      indexRowU[positionLargest] = indexRowU[startColumn];
+      elementU[startColumn] = value;
+      indexRowU[startColumn] = iRow;
+    }
+    return true;
+  }
+  /// Task for CoinParallelRun - does a share of the columns of pivot
+  template < class T >
+  static void pivotColumnsTask(void *info, int whichTask)
+  {
+    CoinFactorizationPivotInfo< T > *pivotInfo = reinterpret_cast< CoinFactorizationPivotInfo< T > * >(info);
+    int numberInPivotRow = pivotInfo->numberInPivotRow;
+    int numberInPivotColumn = pivotInfo->numberInPivotColumn;
+    int increment2 = pivotInfo->increment2;
+    int first = static_cast< int >((static_cast< double >(numberInPivotRow) * whichTask) / pivotInfo->numberTasks);
+    int last = static_cast< int >((static_cast< double >(numberInPivotRow) * (whichTask + 1)) / pivotInfo->numberTasks);
+    CoinFactorizationDouble *work = pivotInfo->work + whichTask * numberInPivotColumn;
+    int added = 0;
+    for (int jColumn = first; jColumn < last; jColumn++) {
+#ifndef NDEBUG
+      bool goodColumn =
+#endif
+        pivotInfo->factorization->pivotOneColumn(pivotInfo->saveColumn[jColumn],
+          pivotInfo->pivotRow, numberInPivotColumn, pivotInfo->indexL,
+          pivotInfo->multipliersL, work,
+          pivotInfo->workArea2 + jColumn * increment2,
+          pivotInfo->remove + jColumn * increment2, pivotInfo->markRow,
+          pivotInfo->largeInteger, added);
+      assert(goodColumn);
+    }
+    pivotInfo->added[whichTask] = added;
+  }
   /********************************* END LARGE TEMPLATE ********/
   //@}
   ////////////////// data //////////////////
@@ -1693,8 +2078,33 @@ protected:
   /// Says if parallel
   int parallelMode_;
 #endif
+  /// Number of reach sets to keep (0 - none)
+  int reachCacheSize_;
+  /// Reach sets
+  mutable std::vector< CoinFactorizationReachSet > reachCache_;
+  /// Set where key of last not found is (-1 if none)
+  mutable int reachCacheSlot_;
+  /// Counts of changes to L and U (so reach sets can be invalidated)
+  int reachGeneration_[2];
+  /// Incremented on each look up (for least recently used)
+  mutable int reachCacheClock_;
+  /// Number of look ups which found a reach set
+  mutable int reachCacheHits_;
+  /// Number of look ups which did not
+  mutable int reachCacheMisses_;
+  /// Number of threads for large pivots
+  int numberThreads_;
+  /// Whether to pivot inside diagonal blocks
+  int blockTriangular_;
+  /// Number of diagonal blocks last time
+  int numberDiagonalBlocks_;
+  /// Multiplier on density for going dense
+  double denseMultiplier_;
   //@}
 };
+
+void CoinFactorizationUnitTest(const std::string &mpsDir);
+
 // Dense coding
 #ifdef INTEL_COMPILER
 #define COIN_FACTORIZATION_DENSE_CODE 3
@@ -1704,6 +2114,8 @@ protected:
 #define COIN_FACTORIZATION_DENSE_CODE 1
 #endif
 #endif
+/* Without LAPACK there is no dense code unless asked for with
+   -DCOIN_FACTORIZATION_DENSE_CODE=4 (built in code of CoinDenseLU.hpp) */
 #ifdef COIN_FACTORIZATION_DENSE_CODE
 /* Type of Fortran integer translated into C */
 #ifndef ipfint
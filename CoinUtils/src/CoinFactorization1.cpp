@@ -226,6 +226,18 @@ void CoinFactorization::gutsOfInitialize(int type)
     biasLU_ = 2;
     doForrestTomlin_ = true;
     persistenceFlag_ = 0;
+    reachCacheSize_ = 0;
+    reachCache_.clear();
+    reachCacheSlot_ = -1;
+    reachGeneration_[0] = 0;
+    reachGeneration_[1] = 0;
+    reachCacheClock_ = 0;
+    reachCacheHits_ = 0;
+    reachCacheMisses_ = 0;
+    numberThreads_ = 1;
+    blockTriangular_ = 0;
+    numberDiagonalBlocks_ = 0;
+    denseMultiplier_ = 1.0;
   }
   if ((type & 4) != 0) {
     // we need to get 1 element arrays for any with length n+1 !!
@@ -1089,6 +1101,7 @@ int CoinFactorization::factor()
 #endif
   int *lastColumn = lastColumn_.array();
   int *lastRow = lastRow_.array();
+  invalidateReachSets(true);
   //sparse
   status_ = factorSparse();
   switch (status_) {
@@ -1543,6 +1556,33 @@ bool CoinFactorization::getColumnSpace(int iColumn,
   return true;
 }
 
+//  getColumnSpaces.  Gets space in several columns before they are updated
+int CoinFactorization::getColumnSpaces(const int *which, int number,
+  int extraNeeded)
+{
+  const int *numberInColumn = numberInColumn_.array();
+  const int *numberInColumnPlus = numberInColumnPlus_.array();
+  const int *nextColumn = nextColumn_.array();
+  const int *startColumnU = startColumnU_.array();
+  // a compression takes away space found so try again once
+  for (int tries = 0; tries < 2; tries++) {
+    int numberCompressions = numberCompressions_;
+    for (int i = 0; i < number; i++) {
+      int iColumn = which[i];
+      int next = nextColumn[iColumn];
+      int space = startColumnU[next] - numberInColumnPlus[next]
+        - startColumnU[iColumn] - numberInColumn[iColumn];
+      if (space < extraNeeded) {
+        if (!getColumnSpace(iColumn, extraNeeded))
+          return -1;
+      }
+    }
+    if (numberCompressions == numberCompressions_)
+      return 1;
+  }
+  return 0;
+}
+
 //  getRowSpace.  Gets space for one Row with given length
 //may have to do compression  (returns true)
 //also moves existing vector
@@ -17,6 +17,7 @@
 #include "CoinIndexedVector.hpp"
 #include "CoinHelperFunctions.hpp"
 #include "CoinFinite.hpp"
+#include "CoinSimd.hpp"
 #if COIN_FACTORIZATION_DENSE_CODE == 1
 // using simple lapack interface
 extern "C" {
@@ -35,6 +36,9 @@ int clapack_dgetrf(const enum CBLAS_ORDER Order, const int M, const int N, doubl
 #elif COIN_FACTORIZATION_DENSE_CODE == 3
 // Intel compiler
 #include "mkl_lapacke.h"
+#elif COIN_FACTORIZATION_DENSE_CODE == 4
+// built in
+#include "CoinDenseLU.hpp"
 #endif
 #ifndef NDEBUG
 static int counter1 = 0;
@@ -56,12 +60,183 @@ int CoinFactorization::factorSparse()
 #define SMALL_UNSET (SMALL_SET + 1)
 #define LARGE_SET COIN_INT_MAX - 10
 #define LARGE_UNSET (LARGE_SET + 1)
+  numberDiagonalBlocks_ = 0;
   if (larger < LARGELIMIT)
     returnCode = factorSparseSmall();
   else
     returnCode = factorSparseLarge();
   return returnCode;
 }
+/* Finds diagonal blocks of active part of U.  First a maximum matching
+   (depth first search for augmenting paths as in MC21) and then the strong
+   components (Tarjan) of the graph which has an arc from column j to the
+   column matched with row i whenever element (i,j) is there.  Blocks come
+   out of Tarjan's method with all arcs from a block going to earlier ones.
+*/
+int CoinFactorization::findDiagonalBlocks(std::vector< int > &block,
+  std::vector< int > &blockStart, std::vector< int > &blockMember)
+{
+  const int *indexRow = indexRowU_.array();
+  const int *numberInRow = numberInRow_.array();
+  const int *numberInColumn = numberInColumn_.array();
+  const int *startColumnU = startColumnU_.array();
+  block.assign(numberRows_ + numberColumns_, -1);
+  blockStart.clear();
+  blockMember.clear();
+  if (numberRows_ != numberColumns_)
+    return 0;
+  int numberLeft = 0;
+  int iRow;
+  int iColumn;
+  for (iRow = 0; iRow < numberRows_; iRow++) {
+    if (numberInRow[iRow] > 0)
+      numberLeft++;
+  }
+  for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    if (numberInColumn[iColumn] > 0)
+      numberLeft--;
+  }
+  if (numberLeft)
+    return 0;
+  std::vector< int > columnOfRow(numberRows_, -1);
+  std::vector< int > rowOfColumn(numberColumns_, -1);
+  // cheap matching first
+  for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    int start = startColumnU[iColumn];
+    int end = start + numberInColumn[iColumn];
+    for (int j = start; j < end; j++) {
+      iRow = indexRow[j];
+      if (columnOfRow[iRow] < 0) {
+        columnOfRow[iRow] = iColumn;
+        rowOfColumn[iColumn] = iRow;
+        break;
+      }
+    }
+  }
+  // then augmenting paths (stack holds column and where got to in it)
+  std::vector< int > visited(numberRows_, -1);
+  std::vector< int > stackColumn(numberColumns_);
+  std::vector< int > stackPosition(numberColumns_);
+  std::vector< int > stackRow(numberColumns_);
+  for (int rootColumn = 0; rootColumn < numberColumns_; rootColumn++) {
+    if (numberInColumn[rootColumn] <= 0 || rowOfColumn[rootColumn] >= 0)
+      continue;
+    int depth = 0;
+    stackColumn[0] = rootColumn;
+    stackPosition[0] = startColumnU[rootColumn];
+    bool found = false;
+    while (depth >= 0) {
+      iColumn = stackColumn[depth];
+      int end = startColumnU[iColumn] + numberInColumn[iColumn];
+      int j = stackPosition[depth];
+      for (; j < end; j++) {
+        iRow = indexRow[j];
+        if (visited[iRow] != rootColumn)
+          break;
+      }
+      if (j == end) {
+        depth--;
+        continue;
+      }
+      stackPosition[depth] = j + 1;
+      visited[iRow] = rootColumn;
+      stackRow[depth] = iRow;
+      if (columnOfRow[iRow] < 0) {
+        found = true;
+        break;
+      }
+      depth++;
+      stackColumn[depth] = columnOfRow[iRow];
+      stackPosition[depth] = startColumnU[columnOfRow[iRow]];
+    }
+    if (!found)
+      return 0; // structurally singular
+    for (; depth >= 0; depth--) {
+      iColumn = stackColumn[depth];
+      iRow = stackRow[depth];
+      columnOfRow[iRow] = iColumn;
+      rowOfColumn[iColumn] = iRow;
+    }
+  }
+  // strong components - order is number when first seen
+  std::vector< int > order(numberColumns_, -1);
+  std::vector< int > lowest(numberColumns_);
+  std::vector< int > component;
+  int numberSeen = 0;
+  int numberBlocks = 0;
+  for (int rootColumn = 0; rootColumn < numberColumns_; rootColumn++) {
+    if (numberInColumn[rootColumn] <= 0 || order[rootColumn] >= 0)
+      continue;
+    int depth = 0;
+    stackColumn[0] = rootColumn;
+    stackPosition[0] = startColumnU[rootColumn];
+    order[rootColumn] = numberSeen;
+    lowest[rootColumn] = numberSeen++;
+    component.push_back(rootColumn);
+    while (depth >= 0) {
+      iColumn = stackColumn[depth];
+      int end = startColumnU[iColumn] + numberInColumn[iColumn];
+      int j = stackPosition[depth];
+      int jColumn = -1;
+      for (; j < end; j++) {
+        jColumn = columnOfRow[indexRow[j]];
+        if (order[jColumn] < 0)
+          break;
+        // still on component stack if no block yet
+        if (block[numberRows_ + jColumn] < 0)
+          lowest[iColumn] = CoinMin(lowest[iColumn], order[jColumn]);
+      }
+      if (j < end) {
+        stackPosition[depth] = j + 1;
+        depth++;
+        stackColumn[depth] = jColumn;
+        stackPosition[depth] = startColumnU[jColumn];
+        order[jColumn] = numberSeen;
+        lowest[jColumn] = numberSeen++;
+        component.push_back(jColumn);
+        continue;
+      }
+      if (lowest[iColumn] == order[iColumn]) {
+        // root of block
+        blockStart.push_back(static_cast< int >(blockMember.size()));
+        int kColumn;
+        do {
+          kColumn = component.back();
+          component.pop_back();
+          block[numberRows_ + kColumn] = numberBlocks;
+          block[rowOfColumn[kColumn]] = numberBlocks;
+          blockMember.push_back(rowOfColumn[kColumn]);
+          blockMember.push_back(numberRows_ + kColumn);
+        } while (kColumn != iColumn);
+        numberBlocks++;
+      }
+      depth--;
+      if (depth >= 0) {
+        int parent = stackColumn[depth];
+        lowest[parent] = CoinMin(lowest[parent], lowest[iColumn]);
+      }
+    }
+  }
+  blockStart.push_back(static_cast< int >(blockMember.size()));
+  return numberBlocks;
+}
+// Puts rows and columns (numberRows_ + iColumn) still to do back in count chains
+void CoinFactorization::linkDiagonalBlock(const int *member, int number,
+  bool park)
+{
+  const int *numberInRow = numberInRow_.array();
+  const int *numberInColumn = numberInColumn_.array();
+  const int *nextCount = nextCount_.array();
+  for (int i = 0; i < number; i++) {
+    int look = member[i];
+    int count = (look < numberRows_) ? numberInRow[look]
+                                     : numberInColumn[look - numberRows_];
+    if (count > 0 && nextCount[look] != -2) {
+      deleteLink(look);
+      addLink(look, park ? biggerDimension_ + 1 : count);
+    }
+  }
+}
 //  factorSparse.  Does sparse phase of factorization
 //return code is <0 error, 0= finished
 int CoinFactorization::factorSparseSmall()
@@ -135,6 +310,24 @@ int CoinFactorization::factorSparseSmall()
     CoinFillN(markRow, numberRows_, static_cast< unsigned short >(SMALL_UNSET));
   }
   numberSlacks_ = numberGoodU_;
+  // pivot inside one diagonal block at a time if wanted
+  std::vector< int > diagonalBlock;
+  std::vector< int > blockStart;
+  std::vector< int > blockMember;
+  const int *block = NULL;
+  int currentBlock = 0;
+  int leftInBlock = 0;
+  if (blockTriangular_) {
+    numberDiagonalBlocks_ = findDiagonalBlocks(diagonalBlock, blockStart,
+      blockMember);
+    if (numberDiagonalBlocks_ > 1) {
+      block = &diagonalBlock[0];
+      // take others out of count chains until wanted
+      linkDiagonalBlock(&blockMember[blockStart[1]],
+        blockStart[numberDiagonalBlocks_] - blockStart[1], true);
+      leftInBlock = blockStart[1] >> 1;
+    }
+  }
   int *nextCount = nextCount_.array();
   int *firstCount = firstCount_.array();
   int *startRow = startRowU_.array();
@@ -211,6 +404,14 @@ int CoinFactorization::factorSparseSmall()
           assert(numberInColumn[iColumn] == count);
           int start = startColumnU[iColumn];
           int iRow = indexRow[start];
+          if (block && (block[iRow] != currentBlock || block[look] != currentBlock)) {
+            // not in this block
+            int next = nextCount[look];
+            deleteLink(look);
+            addLink(look, biggerDimension_ + 1);
+            look = next;
+            continue;
+          }
 
           iPivotRow = iRow;
           pivotRowPosition = start;
@@ -238,6 +439,11 @@ int CoinFactorization::factorSparseSmall()
         }
 #endif
         look = nextCount[look];
+        if (block && block[iRow] != currentBlock) {
+          deleteLink(iRow);
+          addLink(iRow, biggerDimension_ + 1);
+          continue;
+        }
         bool rejected = false;
         int start = startRow[iRow];
         int end = start + count;
@@ -246,6 +452,8 @@ int CoinFactorization::factorSparseSmall()
         for (i = start; i < end; i++) {
           int iColumn = indexColumn[i];
           assert(numberInColumn[iColumn] > 0);
+          if (block && block[numberRows + iColumn] != currentBlock)
+            continue;
           double cost = (count - 1) * numberInColumn[iColumn];
 
           if (cost < minimumCost) {
@@ -294,6 +502,12 @@ int CoinFactorization::factorSparseSmall()
 
         assert(numberInColumn[iColumn] == count);
         look = nextCount[look];
+        if (block && block[numberRows + iColumn] != currentBlock) {
+          // not in this block - out until wanted
+          deleteLink(numberRows + iColumn);
+          addLink(numberRows + iColumn, biggerDimension_ + 1);
+          continue;
+        }
         int start = startColumn[iColumn];
         int end = start + numberInColumn[iColumn];
         CoinFactorizationDouble minimumValue = element[start];
@@ -306,6 +520,8 @@ int CoinFactorization::factorSparseSmall()
           value = fabs(value);
           if (value >= minimumValue) {
             int iRow = indexRow[i];
+            if (block && block[iRow] != currentBlock)
+              continue;
             int nInRow = numberInRow[iRow];
             assert(nInRow > 0);
             double cost = (count - 1) * nInRow;
@@ -405,6 +621,14 @@ int CoinFactorization::factorSparseSmall()
       assert(nextRow_.array()[iPivotRow] == numberGoodU_);
       pivotColumn[numberGoodU_] = iPivotColumn;
       numberGoodU_++;
+      if (block && !--leftInBlock && ++currentBlock < numberDiagonalBlocks_) {
+        // on to next block
+        int start = blockStart[currentBlock];
+        int number = blockStart[currentBlock + 1] - start;
+        linkDiagonalBlock(&blockMember[start], number, false);
+        leftInBlock = number >> 1;
+        separateLinks(1, (biasLU_ > 1));
+      }
       // This should not need to be trapped here - but be safe
       if (numberGoodU_ == numberRows_)
         count = biggerDimension_ + 1;
@@ -461,7 +685,7 @@ int CoinFactorization::factorSparseSmall()
 #if COIN_DENSE_MULTIPLIER2 > 10
         ratio = 10000;
 #endif
-        ratio *= COIN_DENSE_MULTIPLIER;
+        ratio *= COIN_DENSE_MULTIPLIER * denseMultiplier_;
         if ((ratio * leftElements > full && leftRows > denseThreshold)) {
 #define COIN_ALIGN_DENSE 2
 #if COIN_ALIGN_DENSE == 2
@@ -496,6 +720,13 @@ int CoinFactorization::factorSparseSmall()
     } else {
       //end of this - onto next
       count++;
+      if (count > biggerDimension_ && block) {
+        // blocks got in the way - go on without them
+        linkDiagonalBlock(&blockMember[0],
+          blockStart[numberDiagonalBlocks_], false);
+        block = NULL;
+        count = 1;
+      }
     }
   } /* endwhile */
   workArea_.conditionalDelete();
@@ -619,6 +850,10 @@ int CoinFactorization::factorDense()
 #elif COIN_FACTORIZATION_DENSE_CODE == 3
     status = LAPACKE_dgetrf(LAPACK_COL_MAJOR, numberDense_, numberDense_,
       denseAreaAddress_, numberDense_, densePermute_);
+#elif COIN_FACTORIZATION_DENSE_CODE == 4
+    if (CoinDenseLUFactor(numberDense_, denseAreaAddress_, numberDense_,
+          densePermute_))
+      status = -1;
 #endif
     return status;
   }
@@ -727,15 +962,8 @@ int CoinFactorization::factorDense()
       double *element2 = element + numberDense_;
       for (jDense = iDense + 1; jDense < numberToDo; jDense++) {
         CoinFactorizationDouble value = element2[iDense];
-        for (iRow = iDense + 1; iRow < numberDense_; iRow++) {
-          //double oldValue=element2[iRow];
-          element2[iRow] -= value * element[iRow];
-          //if (oldValue&&!element2[iRow]) {
-          //printf("Updated element for column %d, row %d old %g",
-          //   pivotColumnConst[base+jDense],densePermute_[iRow],oldValue);
-          //printf(" new %g\n",element2[iRow]);
-          //}
-        }
+        CoinSimdSubtract(element2 + iDense + 1, element + iDense + 1,
+          numberDense_ - iDense - 1, value);
         element2 += numberDense_;
       }
       numberGoodU_++;
@@ -894,6 +1122,7 @@ int CoinFactorization::restoreFactorization(const char *file, bool factorIt)
   if (fp) {
     // Get rid of current
     gutsOfDestructor();
+    invalidateReachSets(true);
     int newSize = 0; // for checking - should be same
     // Restore so we can pick up scalars
     char *first = reinterpret_cast< char * >(&pivotTolerance_);
@@ -1122,6 +1351,24 @@ int CoinFactorization::factorSparseLarge()
     CoinFillN(markRow, numberRows_, COIN_INT_MAX - 10 + 1);
   }
   numberSlacks_ = numberGoodU_;
+  // pivot inside one diagonal block at a time if wanted
+  std::vector< int > diagonalBlock;
+  std::vector< int > blockStart;
+  std::vector< int > blockMember;
+  const int *block = NULL;
+  int currentBlock = 0;
+  int leftInBlock = 0;
+  if (blockTriangular_) {
+    numberDiagonalBlocks_ = findDiagonalBlocks(diagonalBlock, blockStart,
+      blockMember);
+    if (numberDiagonalBlocks_ > 1) {
+      block = &diagonalBlock[0];
+      // take others out of count chains until wanted
+      linkDiagonalBlock(&blockMember[blockStart[1]],
+        blockStart[numberDiagonalBlocks_] - blockStart[1], true);
+      leftInBlock = blockStart[1] >> 1;
+    }
+  }
   int *nextCount = nextCount_.array();
   int *firstCount = firstCount_.array();
   int *startRow = startRowU_.array();
@@ -1195,6 +1442,14 @@ int CoinFactorization::factorSparseLarge()
           assert(numberInColumn[iColumn] == count);
           int start = startColumnU[iColumn];
           int iRow = indexRow[start];
+          if (block && (block[iRow] != currentBlock || block[look] != currentBlock)) {
+            // not in this block
+            int next = nextCount[look];
+            deleteLink(look);
+            addLink(look, biggerDimension_ + 1);
+            look = next;
+            continue;
+          }
 
           iPivotRow = iRow;
           pivotRowPosition = start;
@@ -1222,6 +1477,11 @@ int CoinFactorization::factorSparseLarge()
         }
 #endif
         look = nextCount[look];
+        if (block && block[iRow] != currentBlock) {
+          deleteLink(iRow);
+          addLink(iRow, biggerDimension_ + 1);
+          continue;
+        }
         bool rejected = false;
         int start = startRow[iRow];
         int end = start + count;
@@ -1230,6 +1490,8 @@ int CoinFactorization::factorSparseLarge()
         for (i = start; i < end; i++) {
           int iColumn = indexColumn[i];
           assert(numberInColumn[iColumn] > 0);
+          if (block && block[numberRows + iColumn] != currentBlock)
+            continue;
           double cost = (count - 1) * numberInColumn[iColumn];
 
           if (cost < minimumCost) {
@@ -1278,6 +1540,12 @@ int CoinFactorization::factorSparseLarge()
 
         assert(numberInColumn[iColumn] == count);
         look = nextCount[look];
+        if (block && block[numberRows + iColumn] != currentBlock) {
+          // not in this block - out until wanted
+          deleteLink(numberRows + iColumn);
+          addLink(numberRows + iColumn, biggerDimension_ + 1);
+          continue;
+        }
         int start = startColumn[iColumn];
         int end = start + numberInColumn[iColumn];
         CoinFactorizationDouble minimumValue = element[start];
@@ -1290,6 +1558,8 @@ int CoinFactorization::factorSparseLarge()
           value = fabs(value);
           if (value >= minimumValue) {
             int iRow = indexRow[i];
+            if (block && block[iRow] != currentBlock)
+              continue;
             int nInRow = numberInRow[iRow];
             assert(nInRow > 0);
             double cost = (count - 1) * nInRow;
@@ -1390,6 +1660,14 @@ int CoinFactorization::factorSparseLarge()
         assert(nextRow_.array()[iPivotRow] == numberGoodU_);
         pivotColumn[numberGoodU_] = iPivotColumn;
         numberGoodU_++;
+        if (block && !--leftInBlock && ++currentBlock < numberDiagonalBlocks_) {
+          // on to next block
+          int start = blockStart[currentBlock];
+          int number = blockStart[currentBlock + 1] - start;
+          linkDiagonalBlock(&blockMember[start], number, false);
+          leftInBlock = number >> 1;
+          separateLinks(1, (biasLU_ > 1));
+        }
         // This should not need to be trapped here - but be safe
         if (numberGoodU_ == numberRows_)
           count = biggerDimension_ + 1;
@@ -1442,7 +1720,7 @@ int CoinFactorization::factorSparseLarge()
 #if COIN_DENSE_MULTIPLIER2 > 10
         ratio = 10000;
 #endif
-        ratio *= COIN_DENSE_MULTIPLIER;
+        ratio *= COIN_DENSE_MULTIPLIER * denseMultiplier_;
         if ((ratio * leftElements > full && leftRows > denseThreshold)) {
 #if COIN_ALIGN_DENSE == 2
           if ((leftRows & 7) == 0) {
@@ -1476,6 +1754,13 @@ int CoinFactorization::factorSparseLarge()
     } else {
       //end of this - onto next
       count++;
+      if (count > biggerDimension_ && block) {
+        // blocks got in the way - go on without them
+        linkDiagonalBlock(&blockMember[0],
+          blockStart[numberDiagonalBlocks_], false);
+        block = NULL;
+        count = 1;
+      }
     }
   } /* endwhile */
   workArea_.conditionalDelete();
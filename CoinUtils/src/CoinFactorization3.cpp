@@ -16,6 +16,7 @@
 #include "CoinFactorization.hpp"
 #include "CoinIndexedVector.hpp"
 #include "CoinHelperFunctions.hpp"
+#include "CoinSimd.hpp"
 #include "CoinTime.hpp"
 #include <stdio.h>
 #include <iostream>
@@ -44,6 +45,9 @@ int clapack_dgetrs(const enum CBLAS_ORDER Order,
 #elif COIN_FACTORIZATION_DENSE_CODE == 3
 // Intel compiler
 #include "mkl_lapacke.h"
+#elif COIN_FACTORIZATION_DENSE_CODE == 4
+// built in
+#include "CoinDenseLU.hpp"
 #endif
 // For semi-sparse
 #define BITS_PER_CHECK 8
@@ -90,6 +94,24 @@ int CoinFactorization::updateColumn(CoinIndexedVector *regionSparse,
   CoinIndexedVector *regionSparse2,
   bool noPermute)
   const
+{
+  return gutsOfUpdateColumn(regionSparse, regionSparse2, noPermute, NULL);
+}
+/* Updates one column (FTRAN) as above but using workspace for
+   all scratch so factorization is only read */
+int CoinFactorization::updateColumn(CoinIndexedVector *regionSparse,
+  CoinIndexedVector *regionSparse2,
+  CoinFactorizationWorkspace &workspace,
+  bool noPermute) const
+{
+  prepareWorkspace(workspace);
+  return gutsOfUpdateColumn(regionSparse, regionSparse2, noPermute, &workspace);
+}
+// Does work of updateColumn - workspace may be NULL
+int CoinFactorization::gutsOfUpdateColumn(CoinIndexedVector *regionSparse,
+  CoinIndexedVector *regionSparse2,
+  bool noPermute,
+  CoinFactorizationWorkspace *workspace) const
 {
 #ifdef CLP_FACTORIZATION_INSTRUMENT
   double startTimeX = CoinCpuTime();
@@ -138,24 +160,24 @@ int CoinFactorization::updateColumn(CoinIndexedVector *regionSparse,
     numberNonZero = regionSparse->getNumElements();
   }
 #endif
-  if (collectStatistics_) {
+  if (collectStatistics_ && !workspace) {
     numberFtranCounts_++;
     ftranCountInput_ += numberNonZero;
   }
 
   //  ******* L
-  updateColumnL(regionSparse, regionIndex);
-  if (collectStatistics_)
+  updateColumnL(regionSparse, regionIndex, workspace);
+  if (collectStatistics_ && !workspace)
     ftranCountAfterL_ += regionSparse->getNumElements();
   //permute extra
   //row bits here
-  updateColumnR(regionSparse);
-  if (collectStatistics_)
+  updateColumnR(regionSparse, workspace);
+  if (collectStatistics_ && !workspace)
     ftranCountAfterR_ += regionSparse->getNumElements();
 
   //update counts
   //  ******* U
-  updateColumnU(regionSparse, regionIndex);
+  updateColumnU(regionSparse, regionIndex, workspace);
   if (!doForrestTomlin_) {
     // Do PFI after everything else
     updateColumnPFI(regionSparse);
@@ -174,6 +196,15 @@ int CoinFactorization::updateColumn(CoinIndexedVector *regionSparse,
     return regionSparse->getNumElements();
   }
 }
+/* Updates several columns (FTRAN) from regions
+   regionSparse starts as zero and is zero at end */
+void CoinFactorization::updateColumns(CoinIndexedVector *regionSparse,
+  CoinIndexedVector **regions, int numberRegions,
+  int strategy, int numberThreads) const
+{
+  updateManyColumns(regionSparse, regions, numberRegions, strategy,
+    numberThreads, false);
+}
 // Permutes back at end of updateColumn
 void CoinFactorization::permuteBack(CoinIndexedVector *regionSparse,
   CoinIndexedVector *outVector) const
@@ -236,7 +267,8 @@ void CoinFactorization::permuteBack(CoinIndexedVector *regionSparse,
 }
 //  updateColumnL.  Updates part of column (FTRANL)
 void CoinFactorization::updateColumnL(CoinIndexedVector *regionSparse,
-  int *COIN_RESTRICT regionIndex) const
+  int *COIN_RESTRICT regionIndex,
+  CoinFactorizationWorkspace *workspace) const
 {
   if (numberL_) {
     int number = regionSparse->getNumElements();
@@ -265,10 +297,10 @@ void CoinFactorization::updateColumnL(CoinIndexedVector *regionSparse,
       updateColumnLDensish(regionSparse, regionIndex);
       break;
     case 1: // middling
-      updateColumnLSparsish(regionSparse, regionIndex);
+      updateColumnLSparsish(regionSparse, regionIndex, workspace);
       break;
     case 2: // sparse
-      updateColumnLSparse(regionSparse, regionIndex);
+      updateColumnLSparse(regionSparse, regionIndex, workspace);
       break;
     }
   }
@@ -290,22 +322,7 @@ void CoinFactorization::updateColumnL(CoinIndexedVector *regionSparse,
       }
     }
     if (doDense) {
-#if COIN_FACTORIZATION_DENSE_CODE == 1
-      char trans = 'N';
-      int ione = 1;
-      int info;
-      F77_FUNC(dgetrs, DGETRS)
-      (&trans, &numberDense_, &ione, denseAreaAddress_, &numberDense_,
-        densePermute_, region + lastSparse, &numberDense_, &info, 1);
-#elif COIN_FACTORIZATION_DENSE_CODE == 2
-      clapack_dgetrs(CblasColMajor, CblasNoTrans, numberDense_, 1,
-        denseAreaAddress_, numberDense_, densePermute_,
-        region + lastSparse, numberDense_);
-#elif COIN_FACTORIZATION_DENSE_CODE == 3
-      LAPACKE_dgetrs(LAPACK_COL_MAJOR, 'N', numberDense_, 1,
-        denseAreaAddress_, numberDense_, densePermute_,
-        region + lastSparse, numberDense_);
-#endif
+      updateColumnDense(region, false);
       for (int i = lastSparse; i < numberRows_; i++) {
         double value = region[i];
         if (value) {
@@ -320,6 +337,34 @@ void CoinFactorization::updateColumnL(CoinIndexedVector *regionSparse,
   }
 #endif
 }
+// Solves with dense part of factorization (LAPACK or built in) in place
+void CoinFactorization::updateColumnDense(double *region, bool transpose) const
+{
+#ifdef COIN_FACTORIZATION_DENSE_CODE
+  int lastSparse = numberRows_ - numberDense_;
+#if COIN_FACTORIZATION_DENSE_CODE == 1
+  char trans = transpose ? 'T' : 'N';
+  int ione = 1;
+  int info;
+  F77_FUNC(dgetrs, DGETRS)
+  (&trans, &numberDense_, &ione, denseAreaAddress_, &numberDense_,
+    densePermute_, region + lastSparse, &numberDense_, &info, 1);
+#elif COIN_FACTORIZATION_DENSE_CODE == 2
+  clapack_dgetrs(CblasColMajor, transpose ? CblasTrans : CblasNoTrans,
+    numberDense_, 1, denseAreaAddress_, numberDense_, densePermute_,
+    region + lastSparse, numberDense_);
+#elif COIN_FACTORIZATION_DENSE_CODE == 3
+  LAPACKE_dgetrs(LAPACK_COL_MAJOR, transpose ? 'T' : 'N', numberDense_, 1,
+    denseAreaAddress_, numberDense_, densePermute_,
+    region + lastSparse, numberDense_);
+#elif COIN_FACTORIZATION_DENSE_CODE == 4
+  CoinDenseLUSolve(transpose, numberDense_, denseAreaAddress_, numberDense_,
+    densePermute_, region + lastSparse);
+#endif
+#else
+  abort();
+#endif
+}
 // Updates part of column (FTRANL) when densish
 void CoinFactorization::updateColumnLDensish(CoinIndexedVector *regionSparse,
   int *COIN_RESTRICT regionIndex)
@@ -357,13 +402,8 @@ void CoinFactorization::updateColumnLDensish(CoinIndexedVector *regionSparse,
     if (fabs(pivotValue) > tolerance) {
       int start = startColumn[i];
       int end = startColumn[i + 1];
-      for (int j = start; j < end; j++) {
-        int iRow = indexRow[j];
-        CoinFactorizationDouble result = region[iRow];
-        CoinFactorizationDouble value = element[j];
-
-        region[iRow] = result - value * pivotValue;
-      }
+      CoinSimdScatterSubtract(region, indexRow + start, element + start,
+        end - start, pivotValue);
       regionIndex[numberNonZero++] = i;
     } else {
       region[i] = 0.0;
@@ -382,7 +422,8 @@ void CoinFactorization::updateColumnLDensish(CoinIndexedVector *regionSparse,
 }
 // Updates part of column (FTRANL) when sparsish
 void CoinFactorization::updateColumnLSparsish(CoinIndexedVector *regionSparse,
-  int *COIN_RESTRICT regionIndex)
+  int *COIN_RESTRICT regionIndex,
+  CoinFactorizationWorkspace *workspace)
   const
 {
   double *COIN_RESTRICT region = regionSparse->denseVector();
@@ -409,7 +450,7 @@ void CoinFactorization::updateColumnLSparsish(CoinIndexedVector *regionSparse,
   int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
   assert(!sparseOffset);
 #endif
-  CoinCheckZero *COIN_RESTRICT mark = reinterpret_cast< CoinCheckZero * >(sparse_.array() + (2 + nInBig) * maximumRowsExtra_ + sparseOffset);
+  CoinCheckZero *COIN_RESTRICT mark = reinterpret_cast< CoinCheckZero * >(sparseArea(workspace) + (2 + nInBig) * maximumRowsExtra_ + sparseOffset);
   int smallestIndex = numberRowsExtra_;
   // do easy ones
   for (int k = 0; k < number; k++) {
@@ -530,7 +571,8 @@ void CoinFactorization::updateColumnLSparsish(CoinIndexedVector *regionSparse,
 }
 // Updates part of column (FTRANL) when sparse
 void CoinFactorization::updateColumnLSparse(CoinIndexedVector *regionSparse,
-  int *COIN_RESTRICT regionIndex)
+  int *COIN_RESTRICT regionIndex,
+  CoinFactorizationWorkspace *workspace)
   const
 {
   double *COIN_RESTRICT region = regionSparse->denseVector();
@@ -551,7 +593,7 @@ void CoinFactorization::updateColumnLSparse(CoinIndexedVector *regionSparse,
   int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
   assert(!sparseOffset);
 #endif
-  int *COIN_RESTRICT stack = sparse_.array() + sparseOffset; /* pivot */
+  int *COIN_RESTRICT stack = sparseArea(workspace) + sparseOffset; /* pivot */
   int *COIN_RESTRICT list = stack + maximumRowsExtra_; /* final list */
   int *COIN_RESTRICT next = reinterpret_cast< int * >(list + maximumRowsExtra_); /* jnext */
   char *COIN_RESTRICT mark = reinterpret_cast< char * >(next + maximumRowsExtra_);
@@ -562,53 +604,71 @@ void CoinFactorization::updateColumnLSparse(CoinIndexedVector *regionSparse,
   }
 #endif
   nList = 0;
-  for (int k = 0; k < number; k++) {
-    int kPivot = regionIndex[k];
-    if (kPivot >= baseL_) {
-      assert(kPivot < numberRowsExtra_);
-      //if (kPivot>=numberRowsExtra_) abort();
-      if (!mark[kPivot]) {
-        stack[0] = kPivot;
-        int j = startColumn[kPivot + 1] - 1;
-        int nStack = 0;
-        while (nStack >= 0) {
-          /* take off stack */
-          if (j >= startColumn[kPivot]) {
-            int jPivot = indexRow[j--];
-            assert(jPivot >= baseL_ && jPivot < numberRowsExtra_);
-            //if (jPivot<baseL_||jPivot>=numberRowsExtra_) abort();
-            /* put back on stack */
-            next[nStack] = j;
-            if (!mark[jPivot]) {
-              /* and new one */
-              kPivot = jPivot;
-              j = startColumn[kPivot + 1] - 1;
-              stack[++nStack] = kPivot;
-              assert(kPivot < numberRowsExtra_);
-              //if (kPivot>=numberRowsExtra_) abort();
-              mark[kPivot] = 1;
+  const int *reach = list;
+  const CoinFactorizationReachSet *reachSet = NULL;
+  if (reachCacheSize_ && !sparseOffset && !workspace)
+    reachSet = findReachSet(0, regionIndex, number, baseL_);
+  if (reachSet) {
+    // same pattern as before so just put others on list
+    for (int k = 0; k < number; k++) {
+      int kPivot = regionIndex[k];
+      if (kPivot < baseL_)
+        regionIndex[numberNonZero++] = kPivot;
+    }
+    nList = reachSet->numberList;
+    if (nList)
+      reach = &reachSet->list[0];
+  } else {
+    for (int k = 0; k < number; k++) {
+      int kPivot = regionIndex[k];
+      if (kPivot >= baseL_) {
+        assert(kPivot < numberRowsExtra_);
+        //if (kPivot>=numberRowsExtra_) abort();
+        if (!mark[kPivot]) {
+          stack[0] = kPivot;
+          int j = startColumn[kPivot + 1] - 1;
+          int nStack = 0;
+          while (nStack >= 0) {
+            /* take off stack */
+            if (j >= startColumn[kPivot]) {
+              int jPivot = indexRow[j--];
+              assert(jPivot >= baseL_ && jPivot < numberRowsExtra_);
+              //if (jPivot<baseL_||jPivot>=numberRowsExtra_) abort();
+              /* put back on stack */
               next[nStack] = j;
-            }
-          } else {
-            /* finished so mark */
-            list[nList++] = kPivot;
-            mark[kPivot] = 1;
-            --nStack;
-            if (nStack >= 0) {
-              kPivot = stack[nStack];
-              assert(kPivot < numberRowsExtra_);
-              j = next[nStack];
+              if (!mark[jPivot]) {
+                /* and new one */
+                kPivot = jPivot;
+                j = startColumn[kPivot + 1] - 1;
+                stack[++nStack] = kPivot;
+                assert(kPivot < numberRowsExtra_);
+                //if (kPivot>=numberRowsExtra_) abort();
+                mark[kPivot] = 1;
+                next[nStack] = j;
+              }
+            } else {
+              /* finished so mark */
+              list[nList++] = kPivot;
+              mark[kPivot] = 1;
+              --nStack;
+              if (nStack >= 0) {
+                kPivot = stack[nStack];
+                assert(kPivot < numberRowsExtra_);
+                j = next[nStack];
+              }
             }
           }
         }
+      } else {
+        // just put on list
+        regionIndex[numberNonZero++] = kPivot;
       }
-    } else {
-      // just put on list
-      regionIndex[numberNonZero++] = kPivot;
     }
+    if (reachCacheSize_ && !sparseOffset && !workspace)
+      saveReachSet(0, list, nList, NULL, 0);
   }
   for (int i = nList - 1; i >= 0; i--) {
-    int iPivot = list[i];
+    int iPivot = reach[i];
     mark[iPivot] = 0;
     CoinFactorizationDouble pivotValue = region[iPivot];
     if (fabs(pivotValue) > tolerance) {
@@ -625,6 +685,87 @@ void CoinFactorization::updateColumnLSparse(CoinIndexedVector *regionSparse,
   }
   regionSparse->setNumElements(numberNonZero);
 }
+// Looks for reach set from sparse FTRAN with same input pattern
+const CoinFactorizationReachSet *
+CoinFactorization::findReachSet(int type, const int *index, int number,
+  int first) const
+{
+  unsigned int hash = 2166136261u;
+  int numberKey = 0;
+  for (int i = 0; i < number; i++) {
+    int iPivot = index[i];
+    if (iPivot >= first) {
+      hash = (hash ^ static_cast< unsigned int >(iPivot)) * 16777619u;
+      numberKey++;
+    }
+  }
+  if (reachCacheClock_ == COIN_INT_MAX) {
+    // start again
+    reachCacheClock_ = 0;
+    for (int k = 0; k < reachCacheSize_; k++)
+      reachCache_[k].lastUsed = 0;
+  }
+  reachCacheClock_++;
+  int generation = reachGeneration_[type];
+  int replace = 0;
+  int oldest = COIN_INT_MAX;
+  for (int k = 0; k < reachCacheSize_; k++) {
+    CoinFactorizationReachSet &set = reachCache_[k];
+    bool valid = set.type >= 0 && set.generation == reachGeneration_[set.type];
+    if (valid && set.type == type && set.hash == hash
+      && static_cast< int >(set.key.size()) == numberKey) {
+      int j = 0;
+      for (int i = 0; i < number; i++) {
+        int iPivot = index[i];
+        if (iPivot >= first) {
+          if (iPivot != set.key[j])
+            break;
+          j++;
+        }
+      }
+      if (j == numberKey) {
+        set.lastUsed = reachCacheClock_;
+        reachCacheHits_++;
+        reachCacheSlot_ = -1;
+        return &set;
+      }
+    }
+    // replace one not valid or least recently used
+    int used = valid ? set.lastUsed : -1;
+    if (used < oldest) {
+      oldest = used;
+      replace = k;
+    }
+  }
+  reachCacheMisses_++;
+  CoinFactorizationReachSet &set = reachCache_[replace];
+  set.type = -1;
+  set.generation = generation;
+  set.hash = hash;
+  set.key.resize(numberKey);
+  numberKey = 0;
+  for (int i = 0; i < number; i++) {
+    int iPivot = index[i];
+    if (iPivot >= first)
+      set.key[numberKey++] = iPivot;
+  }
+  reachCacheSlot_ = replace;
+  return NULL;
+}
+// Saves reach set for last key not found
+void CoinFactorization::saveReachSet(int type, const int *list, int numberList,
+  const int *slacks, int numberSlacks) const
+{
+  if (reachCacheSlot_ < 0)
+    return;
+  CoinFactorizationReachSet &set = reachCache_[reachCacheSlot_];
+  set.list.assign(list, list + numberList);
+  set.list.insert(set.list.end(), slacks, slacks + numberSlacks);
+  set.numberList = numberList;
+  set.type = type;
+  set.lastUsed = reachCacheClock_;
+  reachCacheSlot_ = -1;
+}
 /* Updates one column (FTRAN) from region2
    Tries to do FT update
    number returned is negative if no room.
@@ -884,33 +1025,33 @@ void CoinFactorization::updateTwoColumnsUDensish(
       const int *COIN_RESTRICT thisIndex = indexRow + start;
       if (fabs(pivotValue1) <= tolerance) {
         // just region 2
-        for (int j = numberInColumn[i] - 1; j >= 0; j--) {
-          int iRow = thisIndex[j];
-          CoinFactorizationDouble value = thisElement[j];
-#ifdef NO_LOAD
-          region2[iRow] -= value * pivotValue2;
-#else
-          CoinFactorizationDouble regionValue2 = region2[iRow];
-          region2[iRow] = regionValue2 - value * pivotValue2;
-#endif
-        }
+        CoinSimdScatterSubtract(region2, thisIndex, thisElement,
+          numberInColumn[i], pivotValue2);
         pivotValue2 *= pivotRegion[i];
         region2[i] = pivotValue2;
         index2[numberNonZeroB++] = i;
       } else {
-        // both
-        for (int j = numberInColumn[i] - 1; j >= 0; j--) {
-          int iRow = thisIndex[j];
-          CoinFactorizationDouble value = thisElement[j];
+        // both (one after the other if long enough for vector kernels)
+        int number = numberInColumn[i];
+        if (number >= COIN_SIMD_MINIMUM && CoinSimdCurrentLevel) {
+          CoinSimdScatterSubtract(region1, thisIndex, thisElement,
+            number, pivotValue1);
+          CoinSimdScatterSubtract(region2, thisIndex, thisElement,
+            number, pivotValue2);
+        } else {
+          for (int j = number - 1; j >= 0; j--) {
+            int iRow = thisIndex[j];
+            CoinFactorizationDouble value = thisElement[j];
 #ifdef NO_LOAD
-          region1[iRow] -= value * pivotValue1;
-          region2[iRow] -= value * pivotValue2;
+            region1[iRow] -= value * pivotValue1;
+            region2[iRow] -= value * pivotValue2;
 #else
-          CoinFactorizationDouble regionValue1 = region1[iRow];
-          CoinFactorizationDouble regionValue2 = region2[iRow];
-          region1[iRow] = regionValue1 - value * pivotValue1;
-          region2[iRow] = regionValue2 - value * pivotValue2;
+            CoinFactorizationDouble regionValue1 = region1[iRow];
+            CoinFactorizationDouble regionValue2 = region2[iRow];
+            region1[iRow] = regionValue1 - value * pivotValue1;
+            region2[iRow] = regionValue2 - value * pivotValue2;
 #endif
+          }
         }
         pivotValue1 *= pivotRegion[i];
         pivotValue2 *= pivotRegion[i];
@@ -924,16 +1065,8 @@ void CoinFactorization::updateTwoColumnsUDensish(
       const CoinFactorizationDouble *COIN_RESTRICT thisElement = element + start;
       const int *COIN_RESTRICT thisIndex = indexRow + start;
       // just region 1
-      for (int j = numberInColumn[i] - 1; j >= 0; j--) {
-        int iRow = thisIndex[j];
-        CoinFactorizationDouble value = thisElement[j];
-#ifdef NO_LOAD
-        region1[iRow] -= value * pivotValue1;
-#else
-        CoinFactorizationDouble regionValue1 = region1[iRow];
-        region1[iRow] = regionValue1 - value * pivotValue1;
-#endif
-      }
+      CoinSimdScatterSubtract(region1, thisIndex, thisElement,
+        numberInColumn[i], pivotValue1);
       pivotValue1 *= pivotRegion[i];
       region1[i] = pivotValue1;
       index1[numberNonZeroA++] = i;
@@ -975,7 +1108,8 @@ double sumNumberDensishX = 0.0;
 #endif
 //  updateColumnU.  Updates part of column (FTRANU)
 void CoinFactorization::updateColumnU(CoinIndexedVector *regionSparse,
-  int *indexIn) const
+  int *indexIn,
+  CoinFactorizationWorkspace *workspace) const
 {
   int numberNonZero = regionSparse->getNumElements();
 
@@ -1030,13 +1164,13 @@ void CoinFactorization::updateColumnU(CoinIndexedVector *regionSparse,
     regionSparse->setNumElements(numberNonZero);
   } break;
   case 1: // middling
-    updateColumnUSparsish(regionSparse, indexIn);
+    updateColumnUSparsish(regionSparse, indexIn, workspace);
     break;
   case 2: // sparse
-    updateColumnUSparse(regionSparse, indexIn);
+    updateColumnUSparse(regionSparse, indexIn, workspace);
     break;
   }
-  if (collectStatistics_) {
+  if (collectStatistics_ && !workspace) {
     ftranCountAfterU_ += regionSparse->getNumElements();
 #ifdef CLP_FACTORIZATION_INSTRUMENT
     int numberNonZero = regionSparse->getNumElements();
@@ -1088,12 +1222,8 @@ int CoinFactorization::updateColumnUDensish(double *COIN_RESTRICT region,
 #ifdef COIN_DEVELOP
         nDone_DZ += numberInColumn[i];
 #endif
-        for (int j = numberInColumn[i] - 1; j >= 0; j--) {
-          int iRow = thisIndex[j];
-          CoinFactorizationDouble regionValue = region[iRow];
-          CoinFactorizationDouble value = thisElement[j];
-          region[iRow] = regionValue - value * pivotValue;
-        }
+        CoinSimdScatterSubtract(region, thisIndex, thisElement,
+          numberInColumn[i], pivotValue);
         pivotValue *= pivotRegion[i];
         region[i] = pivotValue;
         regionIndex[numberNonZero++] = i;
@@ -1181,7 +1311,8 @@ int CoinFactorization::updateColumnUDensish(double *COIN_RESTRICT region,
   but that would lead to other inefficiencies.
 */
 void CoinFactorization::updateColumnUSparse(CoinIndexedVector *regionSparse,
-  int *COIN_RESTRICT indexIn) const
+  int *COIN_RESTRICT indexIn,
+  CoinFactorizationWorkspace *workspace) const
 {
   int numberNonZero = regionSparse->getNumElements();
   int *COIN_RESTRICT regionIndex = regionSparse->getIndices();
@@ -1199,7 +1330,7 @@ void CoinFactorization::updateColumnUSparse(CoinIndexedVector *regionSparse,
   int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
   assert(!sparseOffset);
 #endif
-  int *COIN_RESTRICT stack = sparse_.array() + sparseOffset; /* pivot */
+  int *COIN_RESTRICT stack = sparseArea(workspace) + sparseOffset; /* pivot */
   int *COIN_RESTRICT list = stack + maximumRowsExtra_; /* final list */
   int *COIN_RESTRICT next = reinterpret_cast< int * >(list + maximumRowsExtra_); /* jnext */
   char *COIN_RESTRICT mark = reinterpret_cast< char * >(next + maximumRowsExtra_);
@@ -1215,56 +1346,77 @@ void CoinFactorization::updateColumnUSparse(CoinIndexedVector *regionSparse,
 
   const int *numberInColumn = numberInColumn_.array();
   int nList = 0;
-  for (int i = 0; i < numberNonZero; i++) {
-    int kPivot = indexIn[i];
-    stack[0] = kPivot;
-    int j = startColumn[kPivot] + numberInColumn[kPivot] - 1;
-    int nStack = 1;
-    next[0] = j;
-    while (nStack) {
-      /* take off stack */
-      int kPivot = stack[--nStack];
-      if (mark[kPivot] != 1) {
-        j = next[nStack];
-        if (j >= startColumn[kPivot]) {
-          kPivot = indexRow[j--];
-          /* put back on stack */
-          next[nStack++] = j;
-          if (!mark[kPivot]) {
-            /* and new one */
-            int numberIn = numberInColumn[kPivot];
-            if (numberIn) {
-              j = startColumn[kPivot] + numberIn - 1;
-              stack[nStack] = kPivot;
-              mark[kPivot] = 2;
-              next[nStack++] = j;
-            } else {
-              // can do immediately
-              /* finished so mark */
-              mark[kPivot] = 1;
-              if (kPivot >= numberSlacks_) {
-                list[nList++] = kPivot;
+  const int *reach = list;
+  const int *slack = put;
+  const int *lastSlack = putLast;
+  const CoinFactorizationReachSet *reachSet = NULL;
+  if (reachCacheSize_ && !sparseOffset && !workspace)
+    reachSet = findReachSet(1, indexIn, numberNonZero, 0);
+  if (reachSet) {
+    // same pattern as before
+    nList = reachSet->numberList;
+    if (nList)
+      reach = &reachSet->list[0];
+    int numberSlacks = static_cast< int >(reachSet->list.size()) - nList;
+    if (numberSlacks) {
+      slack = &reachSet->list[nList];
+      lastSlack = slack + numberSlacks;
+    }
+  } else {
+    for (int i = 0; i < numberNonZero; i++) {
+      int kPivot = indexIn[i];
+      stack[0] = kPivot;
+      int j = startColumn[kPivot] + numberInColumn[kPivot] - 1;
+      int nStack = 1;
+      next[0] = j;
+      while (nStack) {
+        /* take off stack */
+        int kPivot = stack[--nStack];
+        if (mark[kPivot] != 1) {
+          j = next[nStack];
+          if (j >= startColumn[kPivot]) {
+            kPivot = indexRow[j--];
+            /* put back on stack */
+            next[nStack++] = j;
+            if (!mark[kPivot]) {
+              /* and new one */
+              int numberIn = numberInColumn[kPivot];
+              if (numberIn) {
+                j = startColumn[kPivot] + numberIn - 1;
+                stack[nStack] = kPivot;
+                mark[kPivot] = 2;
+                next[nStack++] = j;
               } else {
-                // slack - put at end
-                --put;
-                *put = kPivot;
+                // can do immediately
+                /* finished so mark */
+                mark[kPivot] = 1;
+                if (kPivot >= numberSlacks_) {
+                  list[nList++] = kPivot;
+                } else {
+                  // slack - put at end
+                  --put;
+                  *put = kPivot;
+                }
               }
             }
-          }
-        } else {
-          /* finished so mark */
-          mark[kPivot] = 1;
-          if (kPivot >= numberSlacks_) {
-            list[nList++] = kPivot;
           } else {
-            // slack - put at end
-            assert(!numberInColumn[kPivot]);
-            --put;
-            *put = kPivot;
+            /* finished so mark */
+            mark[kPivot] = 1;
+            if (kPivot >= numberSlacks_) {
+              list[nList++] = kPivot;
+            } else {
+              // slack - put at end
+              assert(!numberInColumn[kPivot]);
+              --put;
+              *put = kPivot;
+            }
           }
         }
       }
     }
+    if (reachCacheSize_ && !sparseOffset && !workspace)
+      saveReachSet(1, list, nList, put, static_cast< int >(putLast - put));
+    slack = put;
   }
 #if 0
   {
@@ -1289,7 +1441,7 @@ void CoinFactorization::updateColumnUSparse(CoinIndexedVector *regionSparse,
 #endif
   numberNonZero = 0;
   for (int i = nList - 1; i >= 0; i--) {
-    int iPivot = list[i];
+    int iPivot = reach[i];
     mark[iPivot] = 0;
     CoinFactorizationDouble pivotValue = region[iPivot];
     region[iPivot] = 0.0;
@@ -1311,8 +1463,8 @@ void CoinFactorization::updateColumnUSparse(CoinIndexedVector *regionSparse,
   // slacks
 #ifndef COIN_FAST_CODE
   if (slackValue_ == 1.0) {
-    for (; put < putLast; put++) {
-      int iPivot = *put;
+    for (; slack < lastSlack; slack++) {
+      int iPivot = *slack;
       mark[iPivot] = 0;
       CoinFactorizationDouble pivotValue = region[iPivot];
       region[iPivot] = 0.0;
@@ -1323,8 +1475,8 @@ void CoinFactorization::updateColumnUSparse(CoinIndexedVector *regionSparse,
     }
   } else {
 #endif
-    for (; put < putLast; put++) {
-      int iPivot = *put;
+    for (; slack < lastSlack; slack++) {
+      int iPivot = *slack;
       mark[iPivot] = 0;
       CoinFactorizationDouble pivotValue = region[iPivot];
       region[iPivot] = 0.0;
@@ -1354,7 +1506,8 @@ double nnz_SZ = 0.0;
 double nDone_SZ = 0.0;
 #endif
 void CoinFactorization::updateColumnUSparsish(CoinIndexedVector *regionSparse,
-  int *COIN_RESTRICT indexIn) const
+  int *COIN_RESTRICT indexIn,
+  CoinFactorizationWorkspace *workspace) const
 {
   int *COIN_RESTRICT regionIndex = regionSparse->getIndices();
   // mark known to be zero
@@ -1364,7 +1517,7 @@ void CoinFactorization::updateColumnUSparsish(CoinIndexedVector *regionSparse,
   int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
   assert(!sparseOffset);
 #endif
-  int *COIN_RESTRICT stack = sparse_.array() + sparseOffset; /* pivot */
+  int *COIN_RESTRICT stack = sparseArea(workspace) + sparseOffset; /* pivot */
   int *COIN_RESTRICT list = stack + maximumRowsExtra_; /* final list */
   int *COIN_RESTRICT next = reinterpret_cast< int * >(list + maximumRowsExtra_); /* jnext */
   CoinCheckZero *COIN_RESTRICT mark = reinterpret_cast< CoinCheckZero * >(next + maximumRowsExtra_);
@@ -1615,7 +1768,8 @@ void CoinFactorization::updateColumnUSparsish(CoinIndexedVector *regionSparse,
 #endif
 }
 //  updateColumnR.  Updates part of column (FTRANR)
-void CoinFactorization::updateColumnR(CoinIndexedVector *regionSparse) const
+void CoinFactorization::updateColumnR(CoinIndexedVector *regionSparse,
+  CoinFactorizationWorkspace *workspace) const
 {
   double *COIN_RESTRICT region = regionSparse->denseVector();
   int *COIN_RESTRICT regionIndex = regionSparse->getIndices();
@@ -1683,7 +1837,7 @@ void CoinFactorization::updateColumnR(CoinIndexedVector *regionSparse) const
       int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
       assert(!sparseOffset);
 #endif
-    int *COIN_RESTRICT stack = sparse_.array() + sparseOffset; /* pivot */
+    int *COIN_RESTRICT stack = sparseArea(workspace) + sparseOffset; /* pivot */
     int *COIN_RESTRICT list = stack + maximumRowsExtra_; /* final list */
     int *COIN_RESTRICT next = (int *)(list + maximumRowsExtra_); /* jnext */
     char *COIN_RESTRICT mark = (char *)(next + maximumRowsExtra_);
@@ -1788,7 +1942,7 @@ void CoinFactorization::updateColumnR(CoinIndexedVector *regionSparse) const
     int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
     assert(!sparseOffset);
 #endif
-    int *COIN_RESTRICT stack = sparse_.array() + sparseOffset; /* pivot */
+    int *COIN_RESTRICT stack = sparseArea(workspace) + sparseOffset; /* pivot */
     int *COIN_RESTRICT list = stack + maximumRowsExtra_; /* final list */
     int *COIN_RESTRICT next = reinterpret_cast< int * >(list + maximumRowsExtra_); /* jnext */
     char *COIN_RESTRICT mark = reinterpret_cast< char * >(next + maximumRowsExtra_);
@@ -1813,12 +1967,8 @@ void CoinFactorization::updateColumnR(CoinIndexedVector *regionSparse) const
       if (number) {
         CoinFactorizationDouble pivotValue = region[iRow];
         int start = startR[iRow];
-        int end = start + number;
-        for (int j = start; j < end; j++) {
-          CoinFactorizationDouble value = elementR[j];
-          int jRow = indexRowR[j];
-          region[jRow] -= pivotValue * value;
-        }
+        CoinSimdScatterSubtract(region, indexRowR + start, elementR + start, number,
+          pivotValue);
       }
     }
     numberNonZero = newNumber;
@@ -1834,12 +1984,8 @@ void CoinFactorization::updateColumnR(CoinIndexedVector *regionSparse) const
           regionIndex[numberNonZero++] = i;
         int number = numberInColumnPlus[i];
         int start = startR[i];
-        int end = start + number;
-        for (int j = start; j < end; j++) {
-          CoinFactorizationDouble value = elementR[j];
-          int jRow = indexRowR[j];
-          region[jRow] -= pivotValue * value;
-        }
+        CoinSimdScatterSubtract(region, indexRowR + start, elementR + start, number,
+          pivotValue);
       } else {
         region[i] = 0.0;
       }
@@ -1863,12 +2009,8 @@ void CoinFactorization::updateColumnR(CoinIndexedVector *regionSparse) const
       if (number) {
         CoinFactorizationDouble pivotValue = region[iRow];
         int start = startR[iRow];
-        int end = start + number;
-        for (int j = start; j < end; j++) {
-          CoinFactorizationDouble value = elementR[j];
-          int jRow = indexRowR[j];
-          region[jRow] -= pivotValue * value;
-        }
+        CoinSimdScatterSubtract(region, indexRowR + start, elementR + start, number,
+          pivotValue);
       }
     }
     for (int i = numberRows_; i < numberRowsExtra_; i++) {
@@ -1882,12 +2024,8 @@ void CoinFactorization::updateColumnR(CoinIndexedVector *regionSparse) const
         regionIndex[numberNonZero++] = i;
         int number = numberInColumnPlus[i];
         int start = startR[i];
-        int end = start + number;
-        for (int j = start; j < end; j++) {
-          CoinFactorizationDouble value = elementR[j];
-          int jRow = indexRowR[j];
-          region[jRow] -= pivotValue * value;
-        }
+        CoinSimdScatterSubtract(region, indexRowR + start, elementR + start, number,
+          pivotValue);
       } else {
         region[i] = 0.0;
       }
@@ -1903,12 +2041,8 @@ void CoinFactorization::updateColumnR(CoinIndexedVector *regionSparse) const
       //zero out pre-permuted
       region[iRow] = 0.0;
 
-      for (int j = start; j < end; j++) {
-        CoinFactorizationDouble value = element[j];
-        int jRow = indexRow[j];
-        value *= region[jRow];
-        pivotValue -= value;
-      }
+      pivotValue = CoinSimdGatherSubtract(pivotValue, element + start, indexRow + start,
+        region, end - start);
       start = end;
       if (fabs(pivotValue) > tolerance) {
         region[i] = pivotValue;
@@ -1933,6 +2067,208 @@ void CoinFactorization::updateColumnR(CoinIndexedVector *regionSparse) const
   //set counts
   regionSparse->setNumElements(numberNonZero);
 }
+/* Updates several columns (FTRAN) together with dense code.
+   Same as L, R and U densish for each column but each column of
+   factorization is gone through once for all regions.
+   Regions are permuted and regionIndex gives entries (on exit as well) */
+void CoinFactorization::updateColumnsDense(double **region,
+  int **regionIndex, int *numberNonZero, int numberRegions) const
+{
+  double tolerance = zeroTolerance_;
+  //  ******* L
+  if (numberL_) {
+    const int *COIN_RESTRICT startColumn = startColumnL_.array();
+    const int *COIN_RESTRICT indexRow = indexRowL_.array();
+    const CoinFactorizationDouble *COIN_RESTRICT element = elementL_.array();
+    int last = numberRows_;
+    assert(last == baseL_ + numberL_);
+#if COIN_FACTORIZATION_DENSE_CODE
+    //can take out last bit of sparse L as empty
+    last -= numberDense_;
+#endif
+    int smallestIndex = numberRowsExtra_;
+    // do easy ones
+    for (int k = 0; k < numberRegions; k++) {
+      int *COIN_RESTRICT index = regionIndex[k];
+      int number = 0;
+      for (int j = 0; j < numberNonZero[k]; j++) {
+        int iPivot = index[j];
+        if (iPivot >= baseL_)
+          smallestIndex = CoinMin(iPivot, smallestIndex);
+        else
+          index[number++] = iPivot;
+      }
+      numberNonZero[k] = number;
+    }
+    // now others
+    for (int i = smallestIndex; i < last; i++) {
+      int start = startColumn[i];
+      int number = startColumn[i + 1] - start;
+      for (int k = 0; k < numberRegions; k++) {
+        double *COIN_RESTRICT thisRegion = region[k];
+        CoinFactorizationDouble pivotValue = thisRegion[i];
+        if (fabs(pivotValue) > tolerance) {
+          CoinSimdScatterSubtract(thisRegion, indexRow + start, element + start,
+            number, pivotValue);
+          regionIndex[k][numberNonZero[k]++] = i;
+        } else {
+          thisRegion[i] = 0.0;
+        }
+      }
+    }
+    // and dense
+    for (int k = 0; k < numberRegions; k++) {
+      double *COIN_RESTRICT thisRegion = region[k];
+      for (int i = last; i < numberRows_; i++) {
+        CoinFactorizationDouble pivotValue = thisRegion[i];
+        if (fabs(pivotValue) > tolerance) {
+          regionIndex[k][numberNonZero[k]++] = i;
+        } else {
+          thisRegion[i] = 0.0;
+        }
+      }
+    }
+  }
+#ifdef COIN_FACTORIZATION_DENSE_CODE
+  if (numberDense_) {
+    int lastSparse = numberRows_ - numberDense_;
+    for (int k = 0; k < numberRegions; k++) {
+      //take off list
+      double *COIN_RESTRICT thisRegion = region[k];
+      int *COIN_RESTRICT index = regionIndex[k];
+      int number = numberNonZero[k];
+      int i = 0;
+      bool doDense = false;
+      while (i < number) {
+        int iRow = index[i];
+        if (iRow >= lastSparse) {
+          doDense = true;
+          index[i] = index[--number];
+        } else {
+          i++;
+        }
+      }
+      if (doDense) {
+        updateColumnDense(thisRegion, false);
+        for (int i = lastSparse; i < numberRows_; i++) {
+          double value = thisRegion[i];
+          if (value) {
+            if (fabs(value) >= 1.0e-15)
+              index[number++] = i;
+            else
+              thisRegion[i] = 0.0;
+          }
+        }
+        numberNonZero[k] = number;
+      }
+    }
+  }
+#endif
+  //  ******* R (by dot product)
+  if (numberR_) {
+    const int *startColumn = startColumnR_.array() - numberRows_;
+    const int *indexRow = indexRowR_;
+    const CoinFactorizationDouble *element = elementR_;
+    const int *permute = permute_.array();
+    int start = startColumn[numberRows_];
+    for (int i = numberRows_; i < numberRowsExtra_; i++) {
+      //move using permute_ (stored in inverse fashion)
+      int end = startColumn[i + 1];
+      int iRow = permute[i];
+      for (int k = 0; k < numberRegions; k++) {
+        double *COIN_RESTRICT thisRegion = region[k];
+        CoinFactorizationDouble pivotValue = thisRegion[iRow];
+        //zero out pre-permuted
+        thisRegion[iRow] = 0.0;
+        pivotValue = CoinSimdGatherSubtract(pivotValue, element + start,
+          indexRow + start, thisRegion, end - start);
+        if (fabs(pivotValue) > tolerance) {
+          thisRegion[i] = pivotValue;
+          regionIndex[k][numberNonZero[k]++] = i;
+        } else {
+          thisRegion[i] = 0.0;
+        }
+      }
+      start = end;
+    }
+    // pack down
+    for (int k = 0; k < numberRegions; k++) {
+      const double *COIN_RESTRICT thisRegion = region[k];
+      int *COIN_RESTRICT index = regionIndex[k];
+      int n = numberNonZero[k];
+      int number = 0;
+      for (int i = 0; i < n; i++) {
+        int indexValue = index[i];
+        if (thisRegion[indexValue])
+          index[number++] = indexValue;
+      }
+      numberNonZero[k] = number;
+    }
+  }
+  //  ******* U
+  const int *startColumn = startColumnU_.array();
+  const int *indexRow = indexRowU_.array();
+  const CoinFactorizationDouble *element = elementU_.array();
+  const int *numberInColumn = numberInColumn_.array();
+  const CoinFactorizationDouble *pivotRegion = pivotRegion_.array();
+  for (int k = 0; k < numberRegions; k++)
+    numberNonZero[k] = 0;
+  for (int i = numberU_ - 1; i >= numberSlacks_; i--) {
+    int start = startColumn[i];
+    const CoinFactorizationDouble *thisElement = element + start;
+    const int *thisIndex = indexRow + start;
+    for (int k = 0; k < numberRegions; k++) {
+      double *COIN_RESTRICT thisRegion = region[k];
+      CoinFactorizationDouble pivotValue = thisRegion[i];
+      if (pivotValue) {
+        thisRegion[i] = 0.0;
+        if (fabs(pivotValue) > tolerance) {
+          CoinSimdScatterSubtract(thisRegion, thisIndex, thisElement,
+            numberInColumn[i], pivotValue);
+          pivotValue *= pivotRegion[i];
+          thisRegion[i] = pivotValue;
+          regionIndex[k][numberNonZero[k]++] = i;
+        }
+      }
+    }
+  }
+  // now do slacks
+  for (int k = 0; k < numberRegions; k++) {
+    double *COIN_RESTRICT thisRegion = region[k];
+    int *COIN_RESTRICT index = regionIndex[k];
+    int number = numberNonZero[k];
+#ifndef COIN_FAST_CODE
+    if (slackValue_ == -1.0) {
+#endif
+      for (int i = numberSlacks_ - 1; i >= 0; i--) {
+        double value = thisRegion[i];
+        if (value) {
+          thisRegion[i] = -value;
+          index[number] = i;
+          if (fabs(value) > tolerance)
+            number++;
+          else
+            thisRegion[i] = 0.0;
+        }
+      }
+#ifndef COIN_FAST_CODE
+    } else {
+      assert(slackValue_ == 1.0);
+      for (int i = numberSlacks_ - 1; i >= 0; i--) {
+        double value = thisRegion[i];
+        if (value) {
+          thisRegion[i] = 0.0;
+          if (fabs(value) > tolerance) {
+            thisRegion[i] = value;
+            index[number++] = i;
+          }
+        }
+      }
+    }
+#endif
+    numberNonZero[k] = number;
+  }
+}
 //  updateColumnR.  Updates part of column (FTRANR)
 void CoinFactorization::updateColumnRFT(CoinIndexedVector *regionSparse,
   int *COIN_RESTRICT regionIndex)
@@ -2040,12 +2376,8 @@ void CoinFactorization::updateColumnRFT(CoinIndexedVector *regionSparse,
         int number = numberInColumnPlus[iRow];
         if (number) {
           int start = startR[iRow];
-          int end = start + number;
-          for (int j = start; j < end; j++) {
-            CoinFactorizationDouble value = elementR[j];
-            int jRow = indexRowR[j];
-            region[jRow] -= pivotValue * value;
-          }
+          CoinSimdScatterSubtract(region, indexRowR + start, elementR + start, number,
+            pivotValue);
         }
       }
       numberNonZero = newNumber;
@@ -2065,12 +2397,8 @@ void CoinFactorization::updateColumnRFT(CoinIndexedVector *regionSparse,
           }
           int number = numberInColumnPlus[i];
           int start = startR[i];
-          int end = start + number;
-          for (int j = start; j < end; j++) {
-            CoinFactorizationDouble value = elementR[j];
-            int jRow = indexRowR[j];
-            region[jRow] -= pivotValue * value;
-          }
+          CoinSimdScatterSubtract(region, indexRowR + start, elementR + start, number,
+            pivotValue);
         } else {
           region[i] = 0.0;
         }
@@ -2094,12 +2422,8 @@ void CoinFactorization::updateColumnRFT(CoinIndexedVector *regionSparse,
         if (number) {
           CoinFactorizationDouble pivotValue = region[iRow];
           int start = startR[iRow];
-          int end = start + number;
-          for (int j = start; j < end; j++) {
-            CoinFactorizationDouble value = elementR[j];
-            int jRow = indexRowR[j];
-            region[jRow] -= pivotValue * value;
-          }
+          CoinSimdScatterSubtract(region, indexRowR + start, elementR + start, number,
+            pivotValue);
         }
       }
       for (int i = numberRows_; i < numberRowsExtra_; i++) {
@@ -2113,12 +2437,8 @@ void CoinFactorization::updateColumnRFT(CoinIndexedVector *regionSparse,
           regionIndex[numberNonZero++] = i;
           int number = numberInColumnPlus[i];
           int start = startR[i];
-          int end = start + number;
-          for (int j = start; j < end; j++) {
-            CoinFactorizationDouble value = elementR[j];
-            int jRow = indexRowR[j];
-            region[jRow] -= pivotValue * value;
-          }
+          CoinSimdScatterSubtract(region, indexRowR + start, elementR + start, number,
+            pivotValue);
         } else {
           region[i] = 0.0;
         }
@@ -2134,12 +2454,8 @@ void CoinFactorization::updateColumnRFT(CoinIndexedVector *regionSparse,
         //zero out pre-permuted
         region[iRow] = 0.0;
 
-        for (int j = start; j < end; j++) {
-          CoinFactorizationDouble value = element[j];
-          int jRow = indexRow[j];
-          value *= region[jRow];
-          pivotValue -= value;
-        }
+        pivotValue = CoinSimdGatherSubtract(pivotValue, element + start, indexRow + start,
+          region, end - start);
         start = end;
         if (fabs(pivotValue) > tolerance) {
           region[i] = pivotValue;
@@ -16,6 +16,8 @@
 #include "CoinFactorization.hpp"
 #include "CoinIndexedVector.hpp"
 #include "CoinHelperFunctions.hpp"
+#include "CoinParallel.hpp"
+#include "CoinSimd.hpp"
 #include "CoinTime.hpp"
 #include <stdio.h>
 #include <iostream>
@@ -293,6 +295,7 @@ int CoinFactorization::replaceColumn(CoinIndexedVector *regionSparse,
   double startTimeX = CoinCpuTime();
 #endif
   assert(numberU_ <= numberRowsExtra_);
+  invalidateReachSets(false);
   int *COIN_RESTRICT startColumnU = startColumnU_.array();
   int *COIN_RESTRICT startColumn;
   int *COIN_RESTRICT indexRow;
@@ -879,6 +882,7 @@ int CoinFactorization::replaceColumn2(CoinIndexedVector *regionSparse,
   double startTimeX = CoinCpuTime();
 #endif
   assert(numberU_ <= numberRowsExtra_);
+  invalidateReachSets(false);
   int *COIN_RESTRICT startColumnU = startColumnU_.array();
   int *COIN_RESTRICT startColumn;
   int *COIN_RESTRICT indexRow;
@@ -1191,6 +1195,22 @@ int CoinFactorization::replaceColumn2(CoinIndexedVector *regionSparse,
 int CoinFactorization::updateColumnTranspose(CoinIndexedVector *regionSparse,
   CoinIndexedVector *regionSparse2)
   const
+{
+  return gutsOfUpdateColumnTranspose(regionSparse, regionSparse2, NULL);
+}
+/* Updates one column transpose (BTRAN) as above but using workspace
+   for all scratch so factorization is only read */
+int CoinFactorization::updateColumnTranspose(CoinIndexedVector *regionSparse,
+  CoinIndexedVector *regionSparse2,
+  CoinFactorizationWorkspace &workspace) const
+{
+  prepareWorkspace(workspace);
+  return gutsOfUpdateColumnTranspose(regionSparse, regionSparse2, &workspace);
+}
+// Does work of updateColumnTranspose - workspace may be NULL
+int CoinFactorization::gutsOfUpdateColumnTranspose(CoinIndexedVector *regionSparse,
+  CoinIndexedVector *regionSparse2,
+  CoinFactorizationWorkspace *workspace) const
 {
 #ifdef CLP_FACTORIZATION_INSTRUMENT
   double startTimeX = CoinCpuTime();
@@ -1226,7 +1246,7 @@ int CoinFactorization::updateColumnTranspose(CoinIndexedVector *regionSparse,
     }
   }
   regionSparse->setNumElements(numberNonZero);
-  if (collectStatistics_) {
+  if (collectStatistics_ && !workspace) {
     numberBtranCounts_++;
     btranCountInput_ += static_cast< double >(numberNonZero);
   }
@@ -1245,16 +1265,16 @@ int CoinFactorization::updateColumnTranspose(CoinIndexedVector *regionSparse,
     smallestIndex = CoinMin(smallestIndex, iRow);
     region[iRow] *= pivotRegion[iRow];
   }
-  updateColumnTransposeU(regionSparse, smallestIndex);
-  if (collectStatistics_)
+  updateColumnTransposeU(regionSparse, smallestIndex, workspace);
+  if (collectStatistics_ && !workspace)
     btranCountAfterU_ += static_cast< double >(regionSparse->getNumElements());
   //permute extra
   //row bits here
-  updateColumnTransposeR(regionSparse);
+  updateColumnTransposeR(regionSparse, workspace);
   //  ******* L
-  updateColumnTransposeL(regionSparse);
+  updateColumnTransposeL(regionSparse, workspace);
   numberNonZero = regionSparse->getNumElements();
-  if (collectStatistics_) {
+  if (collectStatistics_ && !workspace) {
     btranCountAfterL_ += static_cast< double >(numberNonZero);
 #ifdef CLP_FACTORIZATION_INSTRUMENT
     scaledLengthDense += numberDense_ * numberNonZero;
@@ -1305,6 +1325,314 @@ int CoinFactorization::updateColumnTranspose(CoinIndexedVector *regionSparse,
 #endif
   return number;
 }
+/* Updates several columns (BTRAN) from regions
+   regionSparse starts as zero and is zero at end */
+void CoinFactorization::updateColumnsTranspose(CoinIndexedVector *regionSparse,
+  CoinIndexedVector **regions, int numberRegions,
+  int strategy, int numberThreads) const
+{
+  updateManyColumns(regionSparse, regions, numberRegions, strategy,
+    numberThreads, true);
+}
+/* Updates several columns (BTRAN) together with dense code.
+   Same as U, R and L densish for each column but each row of
+   factorization is gone through once for all regions.
+   Regions are permuted and regionIndex gives entries (on exit as well) */
+void CoinFactorization::updateColumnsTransposeDense(double **region,
+  int **regionIndex, int *numberNonZero, int numberRegions) const
+{
+  double tolerance = zeroTolerance_;
+  //  ******* U
+  // Apply pivot region
+  const CoinFactorizationDouble *COIN_RESTRICT pivotRegion = pivotRegion_.array();
+  int smallestIndex = numberRowsExtra_;
+  for (int k = 0; k < numberRegions; k++) {
+    double *COIN_RESTRICT thisRegion = region[k];
+    const int *COIN_RESTRICT index = regionIndex[k];
+    for (int j = 0; j < numberNonZero[k]; j++) {
+      int iRow = index[j];
+      smallestIndex = CoinMin(smallestIndex, iRow);
+      thisRegion[iRow] *= pivotRegion[iRow];
+    }
+  }
+  {
+    const int *startRow = startRowU_.array();
+    const int *convertRowToColumn = convertRowToColumnU_.array();
+    const int *indexColumn = indexColumnU_.array();
+    const CoinFactorizationDouble *element = elementU_.array();
+    const int *numberInRow = numberInRow_.array();
+    for (int i = smallestIndex; i < numberU_; i++) {
+      int start = startRow[i];
+      int number = numberInRow[i];
+      for (int k = 0; k < numberRegions; k++) {
+        double *COIN_RESTRICT thisRegion = region[k];
+        CoinFactorizationDouble pivotValue = thisRegion[i];
+        if (fabs(pivotValue) > tolerance) {
+          CoinSimdScatterSubtractIndirect(thisRegion, indexColumn + start,
+            convertRowToColumn + start, element, number, pivotValue);
+        } else {
+          thisRegion[i] = 0.0;
+        }
+      }
+    }
+  }
+  //  ******* R (lists are lost)
+  if (numberRowsExtra_ > numberRows_) {
+    const int *indexRow = indexRowR_;
+    const CoinFactorizationDouble *element = elementR_;
+    const int *startColumn = startColumnR_.array() - numberRows_;
+    //move using permute_ (stored in inverse fashion)
+    const int *permute = permute_.array();
+    for (int i = numberRowsExtra_ - 1; i >= numberRows_; i--) {
+      int putRow = permute[i];
+      int start = startColumn[i];
+      int number = startColumn[i + 1] - start;
+      for (int k = 0; k < numberRegions; k++) {
+        double *COIN_RESTRICT thisRegion = region[k];
+        CoinFactorizationDouble pivotValue = thisRegion[i];
+        //zero out  old permuted
+        thisRegion[i] = 0.0;
+        if (pivotValue) {
+          CoinSimdScatterSubtract(thisRegion, indexRow + start, element + start,
+            number, pivotValue);
+          thisRegion[putRow] = pivotValue;
+        }
+      }
+    }
+  }
+#ifdef COIN_FACTORIZATION_DENSE_CODE
+  if (numberDense_) {
+    int lastSparse = numberRows_ - numberDense_;
+    for (int k = 0; k < numberRegions; k++) {
+      const double *thisRegion = region[k];
+      for (int i = lastSparse; i < numberRows_; i++) {
+        if (thisRegion[i]) {
+          updateColumnDense(region[k], true);
+          break;
+        }
+      }
+    }
+  }
+#endif
+  //  ******* L (by column)
+  const int *COIN_RESTRICT startColumn = startColumnL_.array();
+  const int *COIN_RESTRICT indexRow = indexRowL_.array();
+  const CoinFactorizationDouble *COIN_RESTRICT element = elementL_.array();
+  int base = baseL_;
+  int last = baseL_ + numberL_;
+  int first = -1;
+  for (int k = 0; k < numberRegions; k++) {
+    double *COIN_RESTRICT thisRegion = region[k];
+    int *COIN_RESTRICT index = regionIndex[k];
+    int number = 0;
+    // rows after L (dense part)
+    for (int i = numberRows_ - 1; i >= last; i--) {
+      CoinFactorizationDouble pivotValue = thisRegion[i];
+      if (pivotValue) {
+        first = last - 1;
+        if (fabs(pivotValue) > tolerance)
+          index[number++] = i;
+        else
+          thisRegion[i] = 0.0;
+      }
+    }
+    numberNonZero[k] = number;
+    for (int i = last - 1; i > first; i--) {
+      if (thisRegion[i]) {
+        first = i;
+        break;
+      }
+    }
+  }
+  for (int i = first; i >= base; i--) {
+    int start = startColumn[i];
+    int number = startColumn[i + 1] - start;
+    for (int k = 0; k < numberRegions; k++) {
+      double *COIN_RESTRICT thisRegion = region[k];
+      CoinFactorizationDouble pivotValue = CoinSimdGatherSubtract(thisRegion[i],
+        element + start, indexRow + start, thisRegion, number);
+      if (fabs(pivotValue) > tolerance) {
+        thisRegion[i] = pivotValue;
+        regionIndex[k][numberNonZero[k]++] = i;
+      } else {
+        thisRegion[i] = 0.0;
+      }
+    }
+  }
+  //may have stopped early
+  if (first < base)
+    base = first + 1;
+  for (int k = 0; k < numberRegions; k++) {
+    double *COIN_RESTRICT thisRegion = region[k];
+    int *COIN_RESTRICT index = regionIndex[k];
+    int number = numberNonZero[k];
+    for (int i = base - 1; i >= 0; i--) {
+      CoinFactorizationDouble pivotValue = thisRegion[i];
+      if (fabs(pivotValue) > tolerance) {
+        index[number++] = i;
+      } else {
+        thisRegion[i] = 0.0;
+      }
+    }
+    numberNonZero[k] = number;
+  }
+}
+namespace {
+// Columns done together by updateManyColumns
+typedef struct {
+  const CoinFactorization *factorization;
+  CoinIndexedVector **regions;
+  // one work region per task
+  CoinIndexedVector **work;
+  int numberRegions;
+  int numberTasks;
+  bool transpose;
+} CoinFactorizationManyColumns;
+}
+// Does updateColumns (or Transpose)
+void CoinFactorization::updateManyColumns(CoinIndexedVector *regionSparse,
+  CoinIndexedVector **regions, int numberRegions,
+  int strategy, int numberThreads, bool transpose) const
+{
+  // PFI is only done one at a time
+  bool denseOkay = doForrestTomlin_ && strategy != 1;
+#if COIN_ONE_ETA_COPY
+  if (transpose && !convertRowToColumnU_.array())
+    denseOkay = false;
+#endif
+  // Guess at number at end
+  double average = transpose ? btranAverageAfterL_ : ftranAverageAfterU_;
+  if (!average)
+    average = 1.0;
+  CoinIndexedVector **together = new CoinIndexedVector *[numberRegions];
+  int numberTogether = 0;
+  for (int i = 0; i < numberRegions; i++) {
+    CoinIndexedVector *vector = regions[i];
+    // done in place so must have room for R
+    bool dense = denseOkay && vector->capacity() >= numberRowsExtra_;
+    if (dense && !strategy && sparseThreshold_ > 0)
+      dense = vector->getNumElements() * average >= sparseThreshold2_;
+    if (dense)
+      together[numberTogether++] = vector;
+    else if (transpose)
+      updateColumnTranspose(regionSparse, vector);
+    else
+      updateColumn(regionSparse, vector);
+  }
+  if (numberTogether) {
+    int numberTasks = 1;
+    if (CoinParallelAvailable())
+      numberTasks = CoinMax(1, CoinMin(numberThreads, numberTogether));
+    CoinIndexedVector **work = new CoinIndexedVector *[numberTasks];
+    work[0] = regionSparse;
+    for (int i = 1; i < numberTasks; i++) {
+      work[i] = new CoinIndexedVector();
+      work[i]->reserve(numberRowsExtra_);
+    }
+    CoinFactorizationManyColumns info;
+    info.factorization = this;
+    info.regions = together;
+    info.work = work;
+    info.numberRegions = numberTogether;
+    info.numberTasks = numberTasks;
+    info.transpose = transpose;
+    CoinParallelRun(numberTasks, numberTasks, updateManyColumnsTask, &info);
+    for (int i = 1; i < numberTasks; i++)
+      delete work[i];
+    delete[] work;
+  }
+  delete[] together;
+}
+// Task for CoinParallelRun - permutes and does one share of columns
+void CoinFactorization::updateManyColumnsTask(void *info, int whichTask)
+{
+  const CoinFactorizationManyColumns *many = static_cast< const CoinFactorizationManyColumns * >(info);
+  const CoinFactorization *factorization = many->factorization;
+  bool transpose = many->transpose;
+  int first = (whichTask * many->numberRegions) / many->numberTasks;
+  int numberRegions = ((whichTask + 1) * many->numberRegions) / many->numberTasks - first;
+  CoinIndexedVector **regions = many->regions + first;
+  CoinIndexedVector *work = many->work[whichTask];
+  double *COIN_RESTRICT workRegion = work->denseVector();
+  int *COIN_RESTRICT workIndex = work->getIndices();
+  const int *permute = transpose ? factorization->pivotColumn_.array()
+                                 : factorization->permute_.array();
+  const int *permuteBack = factorization->pivotColumnBack();
+  double **region = new double *[numberRegions];
+  int **regionIndex = new int *[numberRegions];
+  int *numberNonZero = new int[numberRegions];
+  bool *packed = new bool[numberRegions];
+  // permute in place (through work region)
+  for (int k = 0; k < numberRegions; k++) {
+    CoinIndexedVector *vector = regions[k];
+    double *COIN_RESTRICT array = vector->denseVector();
+    int *COIN_RESTRICT index = vector->getIndices();
+    int number = vector->getNumElements();
+    packed[k] = vector->packedMode();
+    for (int j = 0; j < number; j++) {
+      int iRow = index[j];
+      double value;
+      if (packed[k]) {
+        value = array[j];
+        array[j] = 0.0;
+      } else {
+        value = array[iRow];
+        array[iRow] = 0.0;
+      }
+      iRow = permute[iRow];
+      workRegion[iRow] = value;
+      workIndex[j] = iRow;
+    }
+    for (int j = 0; j < number; j++) {
+      int iRow = workIndex[j];
+      array[iRow] = workRegion[iRow];
+      workRegion[iRow] = 0.0;
+      index[j] = iRow;
+    }
+    region[k] = array;
+    regionIndex[k] = index;
+    numberNonZero[k] = number;
+  }
+  if (transpose)
+    factorization->updateColumnsTransposeDense(region, regionIndex,
+      numberNonZero, numberRegions);
+  else
+    factorization->updateColumnsDense(region, regionIndex,
+      numberNonZero, numberRegions);
+  // permute back (small values were dropped by BTRAN)
+  double tolerance = factorization->zeroTolerance_;
+  for (int k = 0; k < numberRegions; k++) {
+    CoinIndexedVector *vector = regions[k];
+    double *COIN_RESTRICT array = region[k];
+    int *COIN_RESTRICT index = regionIndex[k];
+    int number = 0;
+    for (int j = 0; j < numberNonZero[k]; j++) {
+      int iRow = index[j];
+      double value = array[iRow];
+      array[iRow] = 0.0;
+      if (transpose || fabs(value) > tolerance) {
+        iRow = permuteBack[iRow];
+        workRegion[iRow] = value;
+        workIndex[number++] = iRow;
+      }
+    }
+    for (int j = 0; j < number; j++) {
+      int iRow = workIndex[j];
+      if (packed[k])
+        array[j] = workRegion[iRow];
+      else
+        array[iRow] = workRegion[iRow];
+      workRegion[iRow] = 0.0;
+      index[j] = iRow;
+    }
+    vector->setNumElements(number);
+    vector->setPackedMode(packed[k] && number);
+  }
+  delete[] region;
+  delete[] regionIndex;
+  delete[] numberNonZero;
+  delete[] packed;
+}
 #define TYPE_TWO_TRANSPOSE 1
 #if TYPE_TWO_TRANSPOSE
 #if ABOCA_LITE_FACTORIZATION
@@ -1691,24 +2019,8 @@ void CoinFactorization::updateColumnTransposeUDensish(CoinIndexedVector *regionS
     CoinFactorizationDouble pivotValue = region[i];
     if (fabs(pivotValue) > tolerance) {
       int start = startRow[i];
-      int numberIn = numberInRow[i];
-      int end = start + (numberIn & (~1));
-      for (int j = start; j < end; j += 2) {
-        int iRow0 = indexColumn[j];
-        int iRow1 = indexColumn[j + 1];
-        int getElement0 = convertRowToColumn[j];
-        int getElement1 = convertRowToColumn[j + 1];
-        CoinFactorizationDouble value0 = element[getElement0];
-        CoinFactorizationDouble value1 = element[getElement1];
-        region[iRow0] -= value0 * pivotValue;
-        region[iRow1] -= value1 * pivotValue;
-      }
-      if ((numberIn & 1) != 0) {
-        int iRow = indexColumn[end];
-        int getElement = convertRowToColumn[end];
-        CoinFactorizationDouble value = element[getElement];
-        region[iRow] -= value * pivotValue;
-      }
+      CoinSimdScatterSubtractIndirect(region, indexColumn + start,
+        convertRowToColumn + start, element, numberInRow[i], pivotValue);
       regionIndex[numberNonZero++] = i;
     } else {
       region[i] = 0.0;
@@ -1720,7 +2032,8 @@ void CoinFactorization::updateColumnTransposeUDensish(CoinIndexedVector *regionS
 /* Updates part of column transpose (BTRANU) when sparsish,
       assumes index is sorted i.e. region is correct */
 void CoinFactorization::updateColumnTransposeUSparsish(CoinIndexedVector *regionSparse,
-  int smallestIndex) const
+  int smallestIndex,
+  CoinFactorizationWorkspace *workspace) const
 {
   double *COIN_RESTRICT region = regionSparse->denseVector();
   int numberNonZero = regionSparse->getNumElements();
@@ -1746,7 +2059,7 @@ void CoinFactorization::updateColumnTransposeUSparsish(CoinIndexedVector *region
   int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
   assert(!sparseOffset);
 #endif
-  CoinCheckZero *COIN_RESTRICT mark = reinterpret_cast< CoinCheckZero * >(sparse_.array() + (2 + nInBig) * maximumRowsExtra_ + sparseOffset);
+  CoinCheckZero *COIN_RESTRICT mark = reinterpret_cast< CoinCheckZero * >(sparseArea(workspace) + (2 + nInBig) * maximumRowsExtra_ + sparseOffset);
 
   for (int i = 0; i < numberNonZero; i++) {
     int iPivot = regionIndex[i];
@@ -1828,7 +2141,8 @@ void CoinFactorization::updateColumnTransposeUSparsish(CoinIndexedVector *region
 /* Updates part of column transpose (BTRANU) when sparse,
    assumes index is sorted i.e. region is correct */
 void CoinFactorization::updateColumnTransposeUSparse(
-  CoinIndexedVector *regionSparse) const
+  CoinIndexedVector *regionSparse,
+  CoinFactorizationWorkspace *workspace) const
 {
   double *COIN_RESTRICT region = regionSparse->denseVector();
   int numberNonZero = regionSparse->getNumElements();
@@ -1851,7 +2165,7 @@ void CoinFactorization::updateColumnTransposeUSparse(
 #else
   int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
 #endif
-  int *COIN_RESTRICT stack = sparse_.array() + sparseOffset; /* pivot */
+  int *COIN_RESTRICT stack = sparseArea(workspace) + sparseOffset; /* pivot */
   int *COIN_RESTRICT list = stack + maximumRowsExtra_; /* final list */
   int *COIN_RESTRICT next = reinterpret_cast< int * >(list + maximumRowsExtra_); /* jnext */
   char *COIN_RESTRICT mark = reinterpret_cast< char * >(next + maximumRowsExtra_);
@@ -1931,7 +2245,8 @@ void CoinFactorization::updateColumnTransposeUSparse(
 //assumes index is sorted i.e. region is correct
 //does not sort by sign
 void CoinFactorization::updateColumnTransposeU(CoinIndexedVector *regionSparse,
-  int smallestIndex) const
+  int smallestIndex,
+  CoinFactorizationWorkspace *workspace) const
 {
 #if COIN_ONE_ETA_COPY
   int *convertRowToColumn = convertRowToColumnU_.array();
@@ -1967,10 +2282,10 @@ void CoinFactorization::updateColumnTransposeU(CoinIndexedVector *regionSparse,
     updateColumnTransposeUDensish(regionSparse, smallestIndex);
     break;
   case 1: // middling
-    updateColumnTransposeUSparsish(regionSparse, smallestIndex);
+    updateColumnTransposeUSparsish(regionSparse, smallestIndex, workspace);
     break;
   case 2: // sparse
-    updateColumnTransposeUSparse(regionSparse);
+    updateColumnTransposeUSparse(regionSparse, workspace);
     break;
   }
 }
@@ -2003,13 +2318,9 @@ void CoinFactorization::updateColumnTransposeLDensish(CoinIndexedVector *regionS
       first = last - 1;
     }
     for (int i = first; i >= base; i--) {
-      int j;
-      CoinFactorizationDouble pivotValue = region[i];
-      for (j = startColumn[i]; j < startColumn[i + 1]; j++) {
-        int iRow = indexRow[j];
-        CoinFactorizationDouble value = element[j];
-        pivotValue -= value * region[iRow];
-      }
+      int start = startColumn[i];
+      CoinFactorizationDouble pivotValue = CoinSimdGatherSubtract(region[i],
+        element + start, indexRow + start, region, startColumn[i + 1] - start);
       if (fabs(pivotValue) > tolerance) {
         region[i] = pivotValue;
         regionIndex[numberNonZero++] = i;
@@ -2095,7 +2406,8 @@ void CoinFactorization::updateColumnTransposeLByRow(CoinIndexedVector *regionSpa
   regionSparse->setNumElements(numberNonZero);
 }
 // Updates part of column transpose (BTRANL) when sparsish by row
-void CoinFactorization::updateColumnTransposeLSparsish(CoinIndexedVector *regionSparse) const
+void CoinFactorization::updateColumnTransposeLSparsish(CoinIndexedVector *regionSparse,
+  CoinFactorizationWorkspace *workspace) const
 {
   double *COIN_RESTRICT region = regionSparse->denseVector();
   int *COIN_RESTRICT regionIndex = regionSparse->getIndices();
@@ -2113,7 +2425,7 @@ void CoinFactorization::updateColumnTransposeLSparsish(CoinIndexedVector *region
 #else
   int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
 #endif
-  CoinCheckZero *COIN_RESTRICT mark = reinterpret_cast< CoinCheckZero * >(sparse_.array() + (2 + nInBig) * maximumRowsExtra_ + sparseOffset);
+  CoinCheckZero *COIN_RESTRICT mark = reinterpret_cast< CoinCheckZero * >(sparseArea(workspace) + (2 + nInBig) * maximumRowsExtra_ + sparseOffset);
   for (int i = 0; i < numberNonZero; i++) {
     int iPivot = regionIndex[i];
     int iWord = iPivot >> CHECK_SHIFT;
@@ -2191,7 +2503,8 @@ void CoinFactorization::updateColumnTransposeLSparsish(CoinIndexedVector *region
 }
 /*  updateColumnTransposeLSparse. 
     Updates part of column transpose (BTRANL) sparse */
-void CoinFactorization::updateColumnTransposeLSparse(CoinIndexedVector *regionSparse) const
+void CoinFactorization::updateColumnTransposeLSparse(CoinIndexedVector *regionSparse,
+  CoinFactorizationWorkspace *workspace) const
 {
   double *COIN_RESTRICT region = regionSparse->denseVector();
   int *COIN_RESTRICT regionIndex = regionSparse->getIndices();
@@ -2209,7 +2522,7 @@ void CoinFactorization::updateColumnTransposeLSparse(CoinIndexedVector *regionSp
 #else
   int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
 #endif
-  int *COIN_RESTRICT stack = sparse_.array() + sparseOffset; /* pivot */
+  int *COIN_RESTRICT stack = sparseArea(workspace) + sparseOffset; /* pivot */
   int *COIN_RESTRICT list = stack + maximumRowsExtra_; /* final list */
   int *COIN_RESTRICT next = reinterpret_cast< int * >(list + maximumRowsExtra_); /* jnext */
   char *COIN_RESTRICT mark = reinterpret_cast< char * >(next + maximumRowsExtra_);
@@ -2275,7 +2588,8 @@ void CoinFactorization::updateColumnTransposeLSparse(CoinIndexedVector *regionSp
   regionSparse->setNumElements(numberNonZero);
 }
 //  updateColumnTransposeL.  Updates part of column transpose (BTRANL)
-void CoinFactorization::updateColumnTransposeL(CoinIndexedVector *regionSparse) const
+void CoinFactorization::updateColumnTransposeL(CoinIndexedVector *regionSparse,
+  CoinFactorizationWorkspace *workspace) const
 {
   int number = regionSparse->getNumElements();
   if (!numberL_ && !numberDense_) {
@@ -2340,22 +2654,7 @@ void CoinFactorization::updateColumnTransposeL(CoinIndexedVector *regionSparse)
     }
     if (doDense) {
       regionSparse->setNumElements(number);
-#if COIN_FACTORIZATION_DENSE_CODE == 1
-      char trans = 'T';
-      int ione = 1;
-      int info;
-      F77_FUNC(dgetrs, DGETRS)
-      (&trans, &numberDense_, &ione, denseAreaAddress_, &numberDense_,
-        densePermute_, region + lastSparse, &numberDense_, &info, 1);
-#elif COIN_FACTORIZATION_DENSE_CODE == 2
-      clapack_dgetrs(CblasColMajor, CblasTrans, numberDense_, 1,
-        denseAreaAddress_, numberDense_, densePermute_,
-        region + lastSparse, numberDense_);
-#elif COIN_FACTORIZATION_DENSE_CODE == 3
-      LAPACKE_dgetrs(LAPACK_COL_MAJOR, 'T', numberDense_, 1,
-        denseAreaAddress_, numberDense_, densePermute_,
-        region + lastSparse, numberDense_);
-#endif
+      updateColumnDense(region, true);
       //and scan again
       if (goSparse > 0 || !numberL_)
         regionSparse->scan(lastSparse, numberRows_, zeroTolerance_);
@@ -2380,10 +2679,10 @@ void CoinFactorization::updateColumnTransposeL(CoinIndexedVector *regionSparse)
     updateColumnTransposeLByRow(regionSparse);
     break;
   case 1: // middling(and by row)
-    updateColumnTransposeLSparsish(regionSparse);
+    updateColumnTransposeLSparsish(regionSparse, workspace);
     break;
   case 2: // sparse
-    updateColumnTransposeLSparse(regionSparse);
+    updateColumnTransposeLSparse(regionSparse, workspace);
     break;
   }
 }
@@ -2522,11 +2821,9 @@ void CoinFactorization::updateColumnTransposeRDensish(CoinIndexedVector *regionS
     //zero out  old permuted
     region[i] = 0.0;
     if (pivotValue) {
-      for (int j = startColumn[i]; j < startColumn[i + 1]; j++) {
-        CoinFactorizationDouble value = element[j];
-        int iRow = indexRow[j];
-        region[iRow] -= value * pivotValue;
-      }
+      int start = startColumn[i];
+      CoinSimdScatterSubtract(region, indexRow + start, element + start,
+        startColumn[i + 1] - start, pivotValue);
       region[putRow] = pivotValue;
       //putRow must have been zero before so put on list ??
       //but can't catch up so will have to do L from end
@@ -2535,7 +2832,8 @@ void CoinFactorization::updateColumnTransposeRDensish(CoinIndexedVector *regionS
   }
 }
 // Updates part of column transpose (BTRANR) when sparse
-void CoinFactorization::updateColumnTransposeRSparse(CoinIndexedVector *regionSparse) const
+void CoinFactorization::updateColumnTransposeRSparse(CoinIndexedVector *regionSparse,
+  CoinFactorizationWorkspace *workspace) const
 {
   double *COIN_RESTRICT region = regionSparse->denseVector();
   int *COIN_RESTRICT regionIndex = regionSparse->getIndices();
@@ -2559,7 +2857,7 @@ void CoinFactorization::updateColumnTransposeRSparse(CoinIndexedVector *regionSp
 #else
   int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
 #endif
-  int *COIN_RESTRICT spare = sparse_.array() + sparseOffset;
+  int *COIN_RESTRICT spare = sparseArea(workspace) + sparseOffset;
   for (int i = 0; i < numberNonZero; i++) {
     spare[regionIndex[i]] = i;
   }
@@ -2598,7 +2896,8 @@ void CoinFactorization::updateColumnTransposeRSparse(CoinIndexedVector *regionSp
 }
 
 //  updateColumnTransposeR.  Updates part of column (FTRANR)
-void CoinFactorization::updateColumnTransposeR(CoinIndexedVector *regionSparse) const
+void CoinFactorization::updateColumnTransposeR(CoinIndexedVector *regionSparse,
+  CoinFactorizationWorkspace *workspace) const
 {
   if (numberRowsExtra_ == numberRows_)
     return;
@@ -2606,14 +2905,14 @@ void CoinFactorization::updateColumnTransposeR(CoinIndexedVector *regionSparse)
 
   if (numberNonZero) {
     if (numberNonZero < (sparseThreshold_ << 2) || (!numberL_ && sparse_.array())) {
-      updateColumnTransposeRSparse(regionSparse);
-      if (collectStatistics_)
+      updateColumnTransposeRSparse(regionSparse, workspace);
+      if (collectStatistics_ && !workspace)
         btranCountAfterR_ += regionSparse->getNumElements();
     } else {
       updateColumnTransposeRDensish(regionSparse);
       // we have lost indices
       // make sure won't try and go sparse again
-      if (collectStatistics_)
+      if (collectStatistics_ && !workspace)
         btranCountAfterR_ += CoinMin((numberNonZero << 1), numberRows_);
       regionSparse->setNumElements(numberRows_ + 1);
     }
@@ -2708,6 +3007,28 @@ void CoinFactorization::goSparse()
   }
 }
 
+// Makes workspace big enough for sparse solves
+void CoinFactorization::prepareWorkspace(CoinFactorizationWorkspace &workspace) const
+{
+  if (!sparse_.array() || workspace.maximumRows_ == maximumRowsExtra_)
+    return;
+  // same layout as sparse_ (see goSparse)
+  int nRowIndex = (maximumRowsExtra_ + CoinSizeofAsInt(int) - 1) / CoinSizeofAsInt(char);
+  int nInBig = static_cast< int >(sizeof(int) / sizeof(int));
+#if ABOCA_LITE_FACTORIZATION == 0
+  workspace.sparse_.conditionalNew((2 + nInBig) * maximumRowsExtra_ + nRowIndex);
+  memset(workspace.sparse_.array() + (2 + nInBig) * maximumRowsExtra_,
+    0, maximumRowsExtra_ * sizeof(char));
+#else
+  workspace.sparse_.conditionalNew(2 * sparseOffset_);
+  memset(workspace.sparse_.array() + (2 + nInBig) * maximumRowsExtra_,
+    0, maximumRowsExtra_ * sizeof(char));
+  memset(workspace.sparse_.array() + sparseOffset_ + (2 + nInBig) * maximumRowsExtra_,
+    0, maximumRowsExtra_ * sizeof(char));
+#endif
+  workspace.maximumRows_ = maximumRowsExtra_;
+}
+
 //  set sparse threshold
 void CoinFactorization::sparseThreshold(int value)
 {
@@ -2731,6 +3052,23 @@ void CoinFactorization::sparseThreshold(int value)
     goSparse();
   }
 }
+// Keep reach sets of last few sparse FTRANs
+void CoinFactorization::setReachCache(int numberEntries)
+{
+  reachCacheSize_ = CoinMax(numberEntries, 0);
+  reachCacheSlot_ = -1;
+  if (reachCacheSize_) {
+    CoinFactorizationReachSet empty;
+    empty.type = -1;
+    empty.generation = 0;
+    empty.lastUsed = 0;
+    empty.hash = 0;
+    empty.numberList = 0;
+    reachCache_.assign(reachCacheSize_, empty);
+  } else {
+    std::vector< CoinFactorizationReachSet >().swap(reachCache_);
+  }
+}
 void CoinFactorization::maximumPivots(int value)
 {
   if (value > 0) {
@@ -2797,6 +3135,8 @@ void CoinFactorization::resetStatistics()
   btranAverageAfterU_ = 0.0;
   btranAverageAfterR_ = 0.0;
   btranAverageAfterL_ = 0.0;
+  reachCacheHits_ = 0;
+  reachCacheMisses_ = 0;
 }
 /*  getColumnSpaceIterate.  Gets space for one extra U element in Column
     may have to do compression  (returns true)
@@ -2972,6 +3312,7 @@ int CoinFactorization::replaceRow(int whichRow, int iNumberInRow,
 {
   if (!iNumberInRow)
     return 0;
+  invalidateReachSets(true);
   int next = nextRow_.array()[whichRow];
   int *numberInRow = numberInRow_.array();
 #ifndef NDEBUG
@@ -3089,6 +3430,7 @@ int CoinFactorization::replaceRow(int whichRow, int iNumberInRow,
 // Takes out all entries for given rows
 void CoinFactorization::emptyRows(int numberToEmpty, const int which[])
 {
+  invalidateReachSets(true);
   int i;
   int *delRow = new int[maximumRowsExtra_];
   int *indexRowU = indexRowU_.array();
@@ -3257,6 +3599,7 @@ int CoinFactorization::replaceColumnPFI(CoinIndexedVector *regionSparse,
   int pivotRow,
   double alpha)
 {
+  invalidateReachSets(false);
   int *startColumn = startColumnU_.array() + numberRows_;
   int *indexRow = indexRowU_.array();
   CoinFactorizationDouble *element = elementU_.array();
@@ -3438,6 +3781,18 @@ void CoinFactorization::gutsOfCopy(const CoinFactorization &other)
   biasLU_ = other.biasLU_;
   sparseThreshold_ = other.sparseThreshold_;
   sparseThreshold2_ = other.sparseThreshold2_;
+  reachCacheSize_ = other.reachCacheSize_;
+  reachCache_ = other.reachCache_;
+  reachCacheSlot_ = -1;
+  reachGeneration_[0] = other.reachGeneration_[0];
+  reachGeneration_[1] = other.reachGeneration_[1];
+  reachCacheClock_ = other.reachCacheClock_;
+  reachCacheHits_ = other.reachCacheHits_;
+  reachCacheMisses_ = other.reachCacheMisses_;
+  numberThreads_ = other.numberThreads_;
+  blockTriangular_ = other.blockTriangular_;
+  numberDiagonalBlocks_ = other.numberDiagonalBlocks_;
+  denseMultiplier_ = other.denseMultiplier_;
   int space = lengthAreaL_ - lengthL_;
 
   numberDense_ = other.numberDense_;
@@ -3752,6 +4107,7 @@ void CoinFactorization::replaceColumnPart3(CoinIndexedVector *regionSparse,
   double alpha)
 {
   assert(numberU_ <= numberRowsExtra_);
+  invalidateReachSets(false);
   int *COIN_RESTRICT startColumnU = startColumnU_.array();
   int *COIN_RESTRICT startColumn;
   int *COIN_RESTRICT indexRow;
@@ -12,10 +12,24 @@
 
 #include "CoinError.hpp"
 #include "CoinHelperFunctions.hpp"
+#include "CoinParallel.hpp"
 
 #include <vector>
 #include <cstring>
 
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+#define COIN_MAPPED_FILES
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#endif
+#ifdef COINUTILS_PTHREADS
+#include <pthread.h>
+#endif
+
 // ------ CoinFileIOBase -------
 
 CoinFileIOBase::CoinFileIOBase(const std::string &fileName)
@@ -81,13 +95,143 @@ char *CoinPlainFileInput::gets(char *buffer, int size)
   return fgets(buffer, size, f_);
 }
 
+// ------ Input for plain text mapped into memory ------
+
+CoinMappedFileInput::CoinMappedFileInput(const std::string &fileName)
+  : CoinFileInput(fileName)
+  , start_(0)
+  , position_(0)
+  , end_(0)
+{
+  // still plain text as far as users are concerned
+  readType_ = "plain";
+#ifdef COIN_MAPPED_FILES
+  int fd = open(fileName.c_str(), O_RDONLY);
+  if (fd >= 0) {
+    struct stat info;
+    // empty files can not be mapped
+    if (!fstat(fd, &info) && S_ISREG(info.st_mode) && info.st_size > 0) {
+      size_t size = static_cast< size_t >(info.st_size);
+      void *mapped = mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (mapped != MAP_FAILED) {
+#ifdef MADV_SEQUENTIAL
+        madvise(mapped, size, MADV_SEQUENTIAL);
+#endif
+        start_ = static_cast< const char * >(mapped);
+        position_ = start_;
+        end_ = start_ + size;
+      }
+    }
+    close(fd);
+  }
+#endif
+  if (!start_)
+    throw CoinError("Could not map file for reading!",
+      "CoinMappedFileInput",
+      "CoinMappedFileInput");
+}
+
+CoinMappedFileInput::~CoinMappedFileInput()
+{
+#ifdef COIN_MAPPED_FILES
+  if (start_)
+    munmap(const_cast< char * >(start_), end_ - start_);
+#endif
+}
+
+bool CoinMappedFileInput::available()
+{
+#ifdef COIN_MAPPED_FILES
+  return true;
+#else
+  return false;
+#endif
+}
+
+int CoinMappedFileInput::read(void *buffer, int size)
+{
+  if (size <= 0)
+    return 0;
+  int amount = size;
+  if (end_ - position_ < amount)
+    amount = static_cast< int >(end_ - position_);
+  CoinMemcpyN(position_, amount, static_cast< char * >(buffer));
+  position_ += amount;
+  return amount;
+}
+
+char *CoinMappedFileInput::gets(char *buffer, int size)
+{
+  int length;
+  const char *line = getsInPlace(size, length);
+  if (!line)
+    return 0;
+  CoinMemcpyN(line, length, buffer);
+  buffer[length] = '\0';
+  return buffer;
+}
+
+const char *CoinMappedFileInput::getsInPlace(int size, int &length)
+{
+  length = 0;
+  if (size <= 1 || position_ == end_)
+    return 0;
+  const char *line = position_;
+  size_t maxLength = static_cast< size_t >(end_ - position_);
+  if (maxLength > static_cast< size_t >(size - 1))
+    maxLength = size - 1;
+  const char *newLine = static_cast< const char * >(memchr(line, '\n', maxLength));
+  position_ = newLine ? newLine + 1 : line + maxLength;
+  length = static_cast< int >(position_ - line);
+  return line;
+}
+
 // ------ helper class supporting buffered gets -------
 
+namespace {
+/* -1 not set (default from number of processors), otherwise whether to
+   decompress in background.  Only written by setBackgroundDecompression
+   so opening files from several threads does not race on it. */
+int backgroundSetting = -1;
+
+#ifdef COINUTILS_PTHREADS
+/* Ring of buffers filled by a background thread (the producer) and
+   handed one at a time to the reader (the consumer).  A buffer is only
+   given back to the producer when the consumer asks for the next one.
+*/
+const int numberReadAhead = 4;
+const int readAheadSize = 256 * 1024;
+
+typedef struct {
+  std::vector< char > buffer[numberReadAhead];
+  int length[numberReadAhead];
+  // buffers filled and not yet given back (includes one being used)
+  int numberFilled;
+  int producerSlot;
+  int consumerSlot;
+  // consumer has buffer consumerSlot
+  bool holding;
+  // producer has read end of file (or error)
+  bool atEnd;
+  // producer must stop
+  bool stop;
+  pthread_mutex_t mutex;
+  pthread_cond_t filled;
+  pthread_cond_t emptied;
+  pthread_t thread;
+} CoinReadAhead;
+#endif
+} // end file-local namespace
+
 // This is a CoinFileInput class to handle cases, where the gets method
 // is not easy to implement (i.e. bzlib has no equivalent to gets, and
 // zlib's gzgets is extremely slow). It's subclasses only have to implement
 // the readRaw method, while the read and gets methods are handled by this
 // class using an internal buffer.
+// If wanted (and threads are available) readRaw is called by a background
+// thread, so decompression overlaps with whatever the reader does with
+// the data.  Subclasses must then call stopBackground() in their
+// destructors before closing anything readRaw uses.
 class CoinGetslessFileInput : public CoinFileInput {
 public:
   CoinGetslessFileInput(const std::string &fileName)
@@ -95,10 +239,17 @@ public:
     , dataBuffer_(8 * 1024)
     , dataStart_(&dataBuffer_[0])
     , dataEnd_(&dataBuffer_[0])
+#ifdef COINUTILS_PTHREADS
+    , readAhead_(NULL)
+    , tryBackground_(CoinFileInput::backgroundDecompression())
+#endif
   {
   }
 
-  virtual ~CoinGetslessFileInput() {}
+  virtual ~CoinGetslessFileInput()
+  {
+    stopBackground();
+  }
 
   virtual int read(void *buffer, int size)
   {
@@ -129,6 +280,22 @@ public:
 
     // If we require more data, use readRaw.
     // We don't use the buffer here, as readRaw is ecpected to be efficient.
+#ifdef COINUTILS_PTHREADS
+    if (size > 0 && (readAhead_ || startBackground())) {
+      // all data comes through ring
+      while (size > 0 && refill()) {
+        int amount = static_cast< int >(dataEnd_ - dataStart_);
+        if (amount > size)
+          amount = size;
+        CoinMemcpyN(dataStart_, amount, dest);
+        dest += amount;
+        size -= amount;
+        dataStart_ += amount;
+        r += amount;
+      }
+      return r;
+    }
+#endif
     if (size > 0)
       r += readRaw(dest, size);
 
@@ -148,19 +315,14 @@ public:
     for (;;) {
       // refill dataBuffer if needed
       if (dataStart_ == dataEnd_) {
-        dataStart_ = dataEnd_ = &dataBuffer_[0];
-        int count = readRaw(dataStart_, static_cast< int >(dataBuffer_.size()));
-
         // at EOF?
-        if (count <= 0) {
+        if (!refill()) {
           *dest = 0;
           // if it was initially empty we had nothing written and should
           // return 0, otherwise at least the buffer contents were
           // transfered and buffer has to be returned.
           return initiallyEmpty ? 0 : buffer;
         }
-
-        dataEnd_ = dataStart_ + count;
       }
 
       // copy character from buffer
@@ -181,16 +343,162 @@ public:
       "CoinGetslessFileInput");
   }
 
+  // Whole line if it is already in buffer, otherwise let gets do it
+  virtual const char *getsInPlace(int size, int &length)
+  {
+    char *start = dataStart_;
+    int available = static_cast< int >(dataEnd_ - start);
+    if (available > size - 1)
+      available = size - 1;
+    char *newLine = available > 0
+      ? static_cast< char * >(memchr(start, '\n', available))
+      : NULL;
+    if (!newLine) {
+      length = -1;
+      return 0;
+    }
+    dataStart_ = newLine + 1;
+    length = static_cast< int >(dataStart_ - start);
+    return start;
+  }
+
 protected:
   // This should be implemented by the subclasses. It essentially behaves
   // like fread: the location pointed to by buffer should be filled with
   // size bytes. Return value is the number of bytes written (0 indicates EOF).
   virtual int readRaw(void *buffer, int size) = 0;
 
+  // Stops background thread (if any) - must be called by destructors
+  // of subclasses before they close what readRaw uses
+  void stopBackground()
+  {
+#ifdef COINUTILS_PTHREADS
+    if (readAhead_) {
+      pthread_mutex_lock(&readAhead_->mutex);
+      readAhead_->stop = true;
+      pthread_cond_signal(&readAhead_->emptied);
+      pthread_mutex_unlock(&readAhead_->mutex);
+      pthread_join(readAhead_->thread, NULL);
+      pthread_mutex_destroy(&readAhead_->mutex);
+      pthread_cond_destroy(&readAhead_->filled);
+      pthread_cond_destroy(&readAhead_->emptied);
+      delete readAhead_;
+      readAhead_ = NULL;
+    }
+#endif
+  }
+
 private:
+  // Points dataStart_ and dataEnd_ at more data - false if EOF
+  bool refill()
+  {
+#ifdef COINUTILS_PTHREADS
+    if (readAhead_ || startBackground()) {
+      CoinReadAhead *ring = readAhead_;
+      pthread_mutex_lock(&ring->mutex);
+      if (ring->holding) {
+        // give back buffer just used
+        ring->holding = false;
+        ring->numberFilled--;
+        ring->consumerSlot = (ring->consumerSlot + 1) % numberReadAhead;
+        pthread_cond_signal(&ring->emptied);
+      }
+      while (!ring->numberFilled && !ring->atEnd)
+        pthread_cond_wait(&ring->filled, &ring->mutex);
+      bool gotData = ring->numberFilled > 0;
+      if (gotData) {
+        int slot = ring->consumerSlot;
+        ring->holding = true;
+        dataStart_ = &ring->buffer[slot][0];
+        dataEnd_ = dataStart_ + ring->length[slot];
+      } else {
+        dataStart_ = dataEnd_ = &dataBuffer_[0];
+      }
+      pthread_mutex_unlock(&ring->mutex);
+      return gotData;
+    }
+#endif
+    dataStart_ = dataEnd_ = &dataBuffer_[0];
+    int count = readRaw(dataStart_, static_cast< int >(dataBuffer_.size()));
+    if (count <= 0)
+      return false;
+    dataEnd_ = dataStart_ + count;
+    return true;
+  }
+
+#ifdef COINUTILS_PTHREADS
+  // Starts background thread on first read (subclass is complete then)
+  bool startBackground()
+  {
+    if (!tryBackground_)
+      return false;
+    tryBackground_ = false;
+    CoinReadAhead *ring = new CoinReadAhead;
+    for (int i = 0; i < numberReadAhead; i++) {
+      ring->buffer[i].resize(readAheadSize);
+      ring->length[i] = 0;
+    }
+    ring->numberFilled = 0;
+    ring->producerSlot = 0;
+    ring->consumerSlot = 0;
+    ring->holding = false;
+    ring->atEnd = false;
+    ring->stop = false;
+    pthread_mutex_init(&ring->mutex, NULL);
+    pthread_cond_init(&ring->filled, NULL);
+    pthread_cond_init(&ring->emptied, NULL);
+    readAhead_ = ring;
+    if (pthread_create(&ring->thread, NULL, backgroundRead, this)) {
+      // just read on this thread
+      readAhead_ = NULL;
+      pthread_mutex_destroy(&ring->mutex);
+      pthread_cond_destroy(&ring->filled);
+      pthread_cond_destroy(&ring->emptied);
+      delete ring;
+      return false;
+    }
+    return true;
+  }
+
+  // Producer - fills free buffers until end of file or told to stop
+  static void *backgroundRead(void *info)
+  {
+    CoinGetslessFileInput *input = static_cast< CoinGetslessFileInput * >(info);
+    CoinReadAhead *ring = input->readAhead_;
+    while (true) {
+      pthread_mutex_lock(&ring->mutex);
+      while (ring->numberFilled == numberReadAhead && !ring->stop)
+        pthread_cond_wait(&ring->emptied, &ring->mutex);
+      bool stop = ring->stop;
+      int slot = ring->producerSlot;
+      pthread_mutex_unlock(&ring->mutex);
+      if (stop)
+        break;
+      int count = input->readRaw(&ring->buffer[slot][0], readAheadSize);
+      pthread_mutex_lock(&ring->mutex);
+      if (count > 0) {
+        ring->length[slot] = count;
+        ring->numberFilled++;
+        ring->producerSlot = (slot + 1) % numberReadAhead;
+      } else {
+        ring->atEnd = true;
+      }
+      pthread_cond_signal(&ring->filled);
+      pthread_mutex_unlock(&ring->mutex);
+      if (count <= 0)
+        break;
+    }
+    return NULL;
+  }
+#endif
+
   std::vector< char > dataBuffer_; // memory used for buffering
   char *dataStart_; // pointer to currently buffered data
   char *dataEnd_; // pointer to "one behind last data element"
+#ifdef COINUTILS_PTHREADS
+  CoinReadAhead *readAhead_; // ring filled by background thread
+  bool tryBackground_; // start background thread on first read
+#endif
 };
 
 // -------- input for gzip compressed files -------
@@ -219,6 +527,7 @@ public:
 
   virtual ~CoinGzipFileInput()
   {
+    stopBackground();
     if (gzf_ != 0)
       gzclose(gzf_);
   }
@@ -266,6 +575,7 @@ public:
 
   virtual ~CoinBzip2FileInput()
   {
+    stopBackground();
     int bzError = BZ_OK;
     if (bzf_ != 0)
       BZ2_bzReadClose(&bzError, bzf_);
@@ -316,6 +626,23 @@ bool CoinFileInput::haveBzip2Support()
 #endif
 }
 
+void CoinFileInput::setBackgroundDecompression(bool yesNo)
+{
+  backgroundSetting = yesNo ? 1 : 0;
+}
+
+bool CoinFileInput::backgroundDecompression()
+{
+#ifdef COINUTILS_PTHREADS
+  // default worked out each time (cheap) rather than stored
+  if (backgroundSetting < 0)
+    return CoinNumberProcessors() > 1;
+  return backgroundSetting != 0;
+#else
+  return false;
+#endif
+}
+
 CoinFileInput *CoinFileInput::create(const std::string &fileName)
 {
   // first try to open file, and read first bytes
@@ -359,6 +686,13 @@ CoinFileInput *CoinFileInput::create(const std::string &fileName)
   }
 
   // fallback: probably plain text file
+  if (count && CoinMappedFileInput::available()) {
+    try {
+      return new CoinMappedFileInput(fileName);
+    } catch (CoinError &) {
+      // not a regular file or out of address space - read normally
+    }
+  }
   return new CoinPlainFileInput(fileName);
 }
 
@@ -371,6 +705,12 @@ CoinFileInput::~CoinFileInput()
 {
 }
 
+const char *CoinFileInput::getsInPlace(int, int &length)
+{
+  length = -1;
+  return 0;
+}
+
 // ------------------------------------------------------
 //   Some subclasses of CoinFileOutput
 //   for plain text and compressed files
@@ -44,6 +44,16 @@ public:
   /// indicates whether CoinFileInput supports bzip2'ed files
   static bool haveBzip2Support();
 
+  /// Whether compressed files are decompressed by a background thread
+  /// into a ring of buffers while the caller uses the previous ones.
+  /// Only possible if CoinUtils was configured with
+  /// --enable-coinutils-threads; default is on if there is more than
+  /// one processor.  Affects inputs created after the call, so call it
+  /// before any threads start opening files.
+  static void setBackgroundDecompression(bool yesNo);
+  /// Returns true if compressed files will be decompressed in background
+  static bool backgroundDecompression();
+
   /// Factory method, that creates a CoinFileInput (more precisely
   /// a subclass of it) for the file specified. This method reads the
   /// first few bytes of the file and determines if this is a compressed
@@ -76,6 +86,18 @@ public:
   /// @param size The size of the buffer in characters.
   /// @return buffer on success, or 0 if no characters have been read.
   virtual char *gets(char *buffer, int size) = 0;
+
+  /// Like gets, but if possible returns a pointer to the characters where
+  /// they already are in memory instead of copying them.
+  /// The line is not terminated with '\0' and is only valid until the next
+  /// call.  The default implementation (used unless the whole file is in
+  /// memory) returns 0 and sets length to -1, in which case gets should be
+  /// used instead.
+  /// @param size As for gets, at most (size-1) characters are returned.
+  /// @param length Set to the number of characters returned (including
+  /// any newline), 0 on EOF.
+  /// @return Start of the line, or 0 on EOF or if not supported.
+  virtual const char *getsInPlace(int size, int &length);
 };
 
 /// This reads plain text files
@@ -94,6 +116,40 @@ private:
   FILE *f_;
 };
 
+/** This reads plain text files by mapping them into memory.
+
+    CoinFileInput::create uses this for plain files where the operating
+    system supports it, so lines can be handed out in place (see
+    getsInPlace) and repeated reads of a file come from the page cache.
+    The constructor throws a CoinError if the file cannot be mapped.
+*/
+class CoinMappedFileInput : public CoinFileInput {
+public:
+  CoinMappedFileInput(const std::string &fileName);
+  virtual ~CoinMappedFileInput();
+
+  virtual int read(void *buffer, int size);
+
+  virtual char *gets(char *buffer, int size);
+
+  virtual const char *getsInPlace(int size, int &length);
+
+  /// Returns true if files can be mapped into memory on this platform
+  static bool available();
+
+private:
+  /// Copying not allowed
+  CoinMappedFileInput(const CoinMappedFileInput &);
+  CoinMappedFileInput &operator=(const CoinMappedFileInput &);
+
+  /// Start of mapped file
+  const char *start_;
+  /// Next character to be read
+  const char *position_;
+  /// End of mapped file
+  const char *end_;
+};
+
 /// Abstract base class for file output classes.
 class CoinFileOutput : public CoinFileIOBase {
 public:
@@ -10,6 +10,8 @@
 
 #include <limits>
 
+#include "CoinTypes.hpp"
+
 //=============================================================================
 // Smallest positive double value and Plus infinity (double and int)
 
@@ -18,11 +20,13 @@ const double COIN_DBL_MIN = (std::numeric_limits< double >::min)();
 const double COIN_DBL_MAX = (std::numeric_limits< double >::max)();
 const int COIN_INT_MAX = (std::numeric_limits< int >::max)();
 const double COIN_INT_MAX_AS_DOUBLE = (std::numeric_limits< int >::max)();
+const CoinBigIndex COIN_BIG_INDEX_MAX = (std::numeric_limits< CoinBigIndex >::max)();
 #else
 #define COIN_DBL_MIN (std::numeric_limits< double >::min())
 #define COIN_DBL_MAX (std::numeric_limits< double >::max())
 #define COIN_INT_MAX (std::numeric_limits< int >::max())
 #define COIN_INT_MAX_AS_DOUBLE (std::numeric_limits< int >::max())
+#define COIN_BIG_INDEX_MAX (std::numeric_limits< CoinBigIndex >::max())
 #endif
 
 /** checks if a double value is finite (not infinity and not NaN) */
@@ -575,13 +575,6 @@ public:
   {
     size_ = value;
   }
-#if COIN_BIG_INDEX
-  /// Set the size
-  inline void setSize(CoinByteArray value)
-  {
-    size_ = value;
-  }
-#endif
   /// Set the size to -1
   inline void switchOff()
   {
@@ -601,10 +594,6 @@ public:
   void swap(CoinArrayWithLength &other);
   /// Extend a persistent array keeping data (size in bytes)
   void extend(CoinByteArray newSize);
-#if COIN_BIG_INDEX
-  /// Extend a persistent array keeping data (size in bytes)
-  void extend(CoinByteArray newSize);
-#endif
   //@}
 
   /**@name Condition methods */
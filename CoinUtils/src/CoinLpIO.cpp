@@ -19,14 +19,20 @@
 #include <cassert>
 #include <string>
 #include <cstdarg>
+#include <vector>
 
 #include "CoinError.hpp"
 #include "CoinHelperFunctions.hpp"
 #include "CoinPackedMatrix.hpp"
 #include "CoinLpIO.hpp"
 #include "CoinMpsIO.hpp"
+#include "CoinNameArena.hpp"
+#include "CoinNameHash.hpp"
+#include "CoinParallel.hpp"
 #include "CoinFinite.hpp"
 #include "CoinSort.hpp"
+#include "CoinStrtod.hpp"
+#include "CoinDtoa.hpp"
 
 using namespace std;
 
@@ -58,6 +64,7 @@ CoinLpIO::CoinLpIO()
   , epsilon_(1e-5)
   , numberAcross_(10)
   , decimals_(9)
+  , numberThreads_(1)
   , wasMaximization_(false)
   , input_(NULL)
 {
@@ -70,15 +77,19 @@ CoinLpIO::CoinLpIO()
   card_previous_names_[1] = 0;
   previous_names_[0] = NULL;
   previous_names_[1] = NULL;
+  previousNameArena_[0] = NULL;
+  previousNameArena_[1] = NULL;
 
   maxHash_[0] = 0;
   numberHash_[0] = 0;
   hash_[0] = NULL;
   names_[0] = NULL;
+  nameArena_[0] = NULL;
   maxHash_[1] = 0;
   numberHash_[1] = 0;
   hash_[1] = NULL;
   names_[1] = NULL;
+  nameArena_[1] = NULL;
   handler_ = new CoinMessageHandler();
   messages_ = CoinMessage();
 }
@@ -108,6 +119,7 @@ CoinLpIO::CoinLpIO(const CoinLpIO &rhs)
   , infinity_(COIN_DBL_MAX)
   , epsilon_(1e-5)
   , numberAcross_(10)
+  , numberThreads_(rhs.numberThreads_)
   , input_(NULL)
 {
   num_objectives_ = rhs.num_objectives_;
@@ -124,14 +136,18 @@ CoinLpIO::CoinLpIO(const CoinLpIO &rhs)
   card_previous_names_[1] = 0;
   previous_names_[0] = NULL;
   previous_names_[1] = NULL;
+  previousNameArena_[0] = NULL;
+  previousNameArena_[1] = NULL;
   maxHash_[0] = 0;
   numberHash_[0] = 0;
   hash_[0] = NULL;
   names_[0] = NULL;
+  nameArena_[0] = NULL;
   maxHash_[1] = 0;
   numberHash_[1] = 0;
   hash_[1] = NULL;
   names_[1] = NULL;
+  nameArena_[1] = NULL;
 
   if (rhs.rowlower_ != NULL || rhs.collower_ != NULL) {
     gutsOfCopy(rhs);
@@ -207,6 +223,7 @@ void CoinLpIO::gutsOfCopy(const CoinLpIO &rhs)
   maxHash_[1] = rhs.maxHash_[1];
   infinity_ = rhs.infinity_;
   numberAcross_ = rhs.numberAcross_;
+  numberThreads_ = rhs.numberThreads_;
   for (int j = 0; j < num_objectives_; j++) {
     objectiveOffset_[j] = rhs.objectiveOffset_[j];
   }
@@ -217,14 +234,12 @@ void CoinLpIO::gutsOfCopy(const CoinLpIO &rhs)
       char **names2 = rhs.names_[section];
       names_[section] = reinterpret_cast< char ** >(malloc(maxHash_[section] * sizeof(char *)));
       char **names = names_[section];
-      int i;
+      memcpy(names, names2, numberHash_[section] * sizeof(char *));
+      CoinNameArena::release(nameArena_[section]);
+      nameArena_[section] = rhs.nameArena_[section]->share();
 
-      for (i = 0; i < numberHash_[section]; i++) {
-        names[i] = CoinStrdup(names2[i]);
-      }
-
-      hash_[section] = new CoinHashLink[maxHash_[section]];
-      std::memcpy(hash_[section], rhs.hash_[section], maxHash_[section] * sizeof(CoinHashLink));
+      hash_[section] = new CoinNameHash(*rhs.hash_[section]);
+      hash_[section]->setNames(names);
     }
   }
 }
@@ -278,17 +293,10 @@ CoinLpIO::~CoinLpIO()
 /************************************************************************/
 void CoinLpIO::freePreviousNames(const int section)
 {
-
-  int j;
-
-  if (previous_names_[section] != NULL) {
-    for (j = 0; j < card_previous_names_[section]; j++) {
-      free(previous_names_[section][j]);
-    }
-    free(previous_names_[section]);
-  }
+  free(previous_names_[section]);
   previous_names_[section] = NULL;
   card_previous_names_[section] = 0;
+  CoinNameArena::release(previousNameArena_[section]);
 } /* freePreviousNames */
 
 /************************************************************************/
@@ -502,7 +510,7 @@ const CoinPackedMatrix *CoinLpIO::getMatrixByCol() const
 {
   if (matrixByColumn_ == NULL && matrixByRow_) {
     matrixByColumn_ = new CoinPackedMatrix(*matrixByRow_);
-    matrixByColumn_->reverseOrdering();
+    matrixByColumn_->reverseOrdering(numberThreads_);
   }
   return matrixByColumn_;
 }
@@ -708,6 +716,24 @@ void CoinLpIO::setDecimals(const int value)
   }
 }
 
+/************************************************************************/
+int CoinLpIO::getNumberThreads() const
+{
+  return numberThreads_;
+}
+
+/************************************************************************/
+void CoinLpIO::setNumberThreads(const int value)
+{
+  if (value > 0) {
+    numberThreads_ = value;
+  } else {
+    char str[8192];
+    sprintf(str, "### ERROR: value: %d\n", value);
+    throw CoinError(str, "setNumberThreads", "CoinLpIO", __FILE__, __LINE__);
+  }
+}
+
 /************************************************************************/
 double CoinLpIO::objectiveOffset() const
 {
@@ -833,7 +859,7 @@ void CoinLpIO::setDefaultColNames()
 {
 
   int j, ncol = getNumCols();
-  char **defaultColNames = reinterpret_cast< char ** >(malloc(ncol * sizeof(char *)));
+  char **defaultColNames = reinterpret_cast< char ** >(calloc(ncol, sizeof(char *)));
   char buff[256];
 
   for (j = 0; j < ncol; j++) {
@@ -940,19 +966,28 @@ void CoinLpIO::out_coeff(FILE *fp, const double v, const int print_1) const
   }
 
   double frac = v - floor(v);
+  double value = v;
+  int decimals = 0;
 
   if (frac < lp_eps) {
-    fprintf(fp, " %.0f", floor(v));
+    value = floor(v);
   } else {
     if (frac > 1 - lp_eps) {
-      fprintf(fp, " %.0f", floor(v + 0.5));
+      value = floor(v + 0.5);
     } else {
-      int decimals = getDecimals();
-      char form[15];
-      sprintf(form, " %%.%df", decimals);
-      fprintf(fp, form, v);
+      decimals = getDecimals();
     }
   }
+  // no trailing zeros and no more digits than needed to read back exactly
+  char buffer[400];
+  buffer[0] = ' ';
+  if (CoinDtoaFixed(value, decimals, buffer + 1, sizeof(buffer) - 1) > 0) {
+    fputs(buffer, fp);
+  } else {
+    char form[15];
+    sprintf(form, " %%.%df", decimals);
+    fprintf(fp, form, value);
+  }
 } /* out_coeff */
 
 /************************************************************************/
@@ -1604,7 +1639,7 @@ int CoinLpIO::read_monom_obj(double *coeff, char **name, int *cnt,
   }
 
   if (first_is_number(start)) {
-    coeff[*cnt] = atof(start);
+    coeff[*cnt] = CoinStrtod(start, NULL);
     sprintf(loc_name, "aa");
     fscanfLpIO(loc_name);
   } else {
@@ -1679,7 +1714,7 @@ int CoinLpIO::read_monom_row(char *start_str,
   }
 
   if (first_is_number(start)) {
-    coeff[cnt_coeff] = atof(start);
+    coeff[cnt_coeff] = CoinStrtod(start, NULL);
     fscanfLpIO(loc_name);
   } else {
     coeff[cnt_coeff] = 1;
@@ -1783,7 +1818,7 @@ void CoinLpIO::read_row(char *buff,
   }
   (*cnt_coeff)--;
 
-  rhs[*cnt_row] = atof(start_str);
+  rhs[*cnt_row] = CoinStrtod(start_str, NULL);
 
   switch (read_sense) {
   case 0:
@@ -1805,6 +1840,423 @@ void CoinLpIO::read_row(char *buff,
 
 } /* read_row */
 
+/*************************************************************************/
+namespace {
+/* The rest of a file in memory.  Once the constraints have been read this
+   gives what was after them to newCardLpIO.  The original input is kept so
+   that it is deleted (and a file closed) at the same time as before.
+*/
+class CoinLpTailInput : public CoinFileInput {
+public:
+  CoinLpTailInput(CoinFileInput *input, const std::vector< char > &text,
+    size_t start)
+    : CoinFileInput("")
+    , input_(input)
+    , text_(text.begin() + start, text.end())
+    , position_(0)
+  {
+    readType_ = "memory";
+  }
+  virtual ~CoinLpTailInput()
+  {
+    delete input_;
+  }
+
+  virtual int read(void *buffer, int size)
+  {
+    int n = static_cast< int >(CoinMin(text_.size() - position_,
+      static_cast< size_t >(size)));
+    if (n)
+      memcpy(buffer, &text_[position_], n);
+    position_ += n;
+    return n;
+  }
+
+  // As fgets
+  virtual char *gets(char *buffer, int size)
+  {
+    if (position_ == text_.size() || size <= 1)
+      return NULL;
+    int n = 0;
+    while (n < size - 1 && position_ < text_.size()) {
+      char c = text_[position_++];
+      buffer[n++] = c;
+      if (c == '\n')
+        break;
+    }
+    buffer[n] = '\0';
+    return buffer;
+  }
+
+private:
+  CoinFileInput *input_;
+  std::vector< char > text_;
+  size_t position_;
+};
+
+/* Gives the words of LP text in memory as fscanfLpIO would - blanks
+   before ':' are ignored and a word starting with '/' or '\' skips the
+   rest of the line.
+*/
+class CoinLpWords {
+public:
+  CoinLpWords(const char *start, const char *end)
+    : position_(start)
+    , end_(end)
+    , word_(start)
+  {
+  }
+  // Copies next word to buff (1024 long), returns its length or 0 at end
+  int next(char *buff)
+  {
+    while (true) {
+      while (position_ != end_ && isBlank(*position_))
+        position_++;
+      if (position_ == end_)
+        return 0;
+      if (*position_ != '/' && *position_ != '\\')
+        break;
+      while (position_ != end_ && *position_ != '\n' && *position_ != '\r')
+        position_++;
+    }
+    word_ = position_;
+    int n = 0;
+    while (position_ != end_) {
+      if (isBlank(*position_)) {
+        const char *look = position_;
+        while (look != end_ && (*look == ' ' || *look == '\t'))
+          look++;
+        if (look == end_ || *look != ':')
+          break;
+        position_ = look;
+      }
+      if (n < 1023)
+        buff[n++] = *position_;
+      position_++;
+    }
+    buff[n] = '\0';
+    return n;
+  }
+  // Start of last word
+  inline const char *word() const
+  {
+    return word_;
+  }
+  // Just after last word
+  inline const char *position() const
+  {
+    return position_;
+  }
+
+private:
+  static inline bool isBlank(char c)
+  {
+    return static_cast< unsigned char >(c) <= ' ';
+  }
+  const char *position_;
+  const char *end_;
+  const char *word_;
+};
+
+// Constraints read from one piece of text
+typedef struct {
+  const char *start;
+  const char *end;
+  /* If true nothing is stored - just where each constraint ends, and end
+     is moved back to any keyword after the constraints */
+  bool findEnds;
+  // True if text ran out in the middle of a constraint
+  bool failed;
+  std::vector< const char * > ends;
+  // row names and distinct column names (each null terminated)
+  std::vector< char > names;
+  // offset of name of each row in names (-1 if none)
+  std::vector< int > rowName;
+  std::vector< double > rhs;
+  // as is_sense
+  std::vector< int > sense;
+  std::vector< int > rowLength;
+  std::vector< double > elements;
+  // column of each element as index in columnName
+  std::vector< int > columns;
+  // offset in names of each distinct column name in order of appearance
+  std::vector< int > columnName;
+} CoinLpRowChunk;
+
+typedef struct {
+  const CoinLpIO *model;
+  CoinLpRowChunk *chunks;
+} CoinLpRowWork;
+
+// Adds a null terminated name and returns its offset
+int addName(std::vector< char > &names, const char *name)
+{
+  int offset = static_cast< int >(names.size());
+  names.insert(names.end(), name, name + strlen(name) + 1);
+  return offset;
+}
+
+// As is_sense but quiet
+int senseOf(const char *buff)
+{
+  if (!strcmp(buff, "<="))
+    return 0;
+  else if (!strcmp(buff, "="))
+    return 1;
+  else if (!strcmp(buff, ">="))
+    return 2;
+  else
+    return -1;
+}
+} // end file-local namespace
+
+/* Reads constraints as the loop in readLp and read_row do.  A monomial is
+   an optional sign (which may be a word by itself), an optional number
+   and then a name.
+*/
+void CoinLpIO::readRowsChunk(void *info, int whichChunk)
+{
+  CoinLpRowWork *work = static_cast< CoinLpRowWork * >(info);
+  CoinLpRowChunk &chunk = work->chunks[whichChunk];
+  const CoinLpIO *model = work->model;
+  bool findEnds = chunk.findEnds;
+  CoinLpWords words(chunk.start, chunk.end);
+  // a name is never longer than its word so names never moves
+  if (!findEnds)
+    chunk.names.reserve(chunk.end - chunk.start + 1);
+  std::vector< const char * > columnNames;
+  CoinNameHash hash;
+  char buff[1024], name[1024];
+  chunk.failed = false;
+  while (words.next(buff)) {
+    if (model->is_keyword(buff)) {
+      chunk.end = words.word();
+      break;
+    }
+    size_t length = strlen(buff);
+    if (buff[length - 1] == ':') {
+      buff[length - 1] = '\0';
+      if (!findEnds)
+        chunk.rowName.push_back(addName(chunk.names, buff));
+      if (!words.next(buff)) {
+        chunk.failed = true;
+        break;
+      }
+    } else if (!findEnds) {
+      chunk.rowName.push_back(-1);
+    }
+    int numberElements = static_cast< int >(chunk.elements.size());
+    int sense;
+    while ((sense = findEnds ? senseOf(buff) : model->is_sense(buff)) < 0) {
+      char *start = buff;
+      double mult = 1.0;
+      if (buff[0] == '+') {
+        if (strlen(buff) == 1) {
+          if (!words.next(buff))
+            break;
+          start = buff;
+        } else {
+          start = &(buff[1]);
+        }
+      }
+      if (buff[0] == '-') {
+        mult = -1.0;
+        if (strlen(buff) == 1) {
+          if (!words.next(buff))
+            break;
+          start = buff;
+        } else {
+          start = &(buff[1]);
+        }
+      }
+      double value = 1.0;
+      if (model->first_is_number(start)) {
+        if (!findEnds)
+          value = CoinStrtod(start, NULL);
+        if (!words.next(name))
+          break;
+      } else {
+        strcpy(name, start);
+      }
+      value *= mult;
+      if (!findEnds) {
+#ifdef KILL_ZERO_READLP
+        if (fabs(value) > model->epsilon_)
+#endif
+        {
+          // local index of column
+          int offset = addName(chunk.names, name);
+          int number = static_cast< int >(columnNames.size());
+          columnNames.push_back(&chunk.names[offset]);
+          hash.setNames(&columnNames[0]);
+          int which = hash.insert(number);
+          if (which == number) {
+            chunk.columnName.push_back(offset);
+          } else {
+            columnNames.pop_back();
+            chunk.names.resize(offset);
+          }
+          chunk.elements.push_back(value);
+          chunk.columns.push_back(which);
+        }
+      }
+      if (!words.next(buff))
+        break;
+    }
+    if (sense < 0 || !words.next(buff)) {
+      chunk.failed = true;
+      break;
+    }
+    if (findEnds) {
+      chunk.ends.push_back(words.position());
+    } else {
+      chunk.rhs.push_back(CoinStrtod(buff, NULL));
+      chunk.sense.push_back(sense);
+      chunk.rowLength.push_back(static_cast< int >(chunk.elements.size()) - numberElements);
+    }
+  }
+}
+
+/*************************************************************************/
+void CoinLpIO::readRowsParallel(char *buff, double **pcoeff, int **pind,
+  int *cnt_coeff, int *maxcoeff,
+  char ***prowNames, CoinBigIndex **pstart, double **prhs,
+  double **prowlow, double **prowup, int *cnt_row, int *maxrow,
+  double inf)
+{
+  // rest of file starting with rest of current line
+  std::vector< char > image;
+  int length = abs(bufferLength_);
+  if (bufferPosition_ < length)
+    image.insert(image.end(), inputBuffer_ + bufferPosition_,
+      inputBuffer_ + length);
+  if (bufferLength_ >= 0)
+    image.push_back('\n');
+  while (true) {
+    const char *line = input_->getsInPlace(COIN_INT_MAX, length);
+    if (length < 0) {
+      line = input_->gets(buff, 1024);
+      length = line ? static_cast< int >(strlen(line)) : 0;
+    }
+    if (!length)
+      break;
+    image.insert(image.end(), line, line + length);
+  }
+  // so never empty
+  image.push_back('\n');
+  const char *text = &image[0];
+  // find where constraints end and cut into pieces there
+  CoinLpRowChunk all;
+  all.start = text;
+  all.end = text + image.size();
+  all.findEnds = true;
+  CoinLpRowWork work;
+  work.model = this;
+  work.chunks = &all;
+  readRowsChunk(&work, 0);
+  // a few pieces per thread so that threads finishing early can help
+  std::vector< CoinLpRowChunk > chunks;
+  size_t chunkSize = (all.end - text) / (4 * numberThreads_) + 1;
+  const char *piece = text;
+  for (size_t i = 0; i <= all.ends.size(); i++) {
+    const char *end = (i < all.ends.size()) ? all.ends[i] : all.end;
+    if (static_cast< size_t >(end - piece) >= chunkSize || (i == all.ends.size() && end > piece)) {
+      CoinLpRowChunk chunk;
+      chunk.start = piece;
+      chunk.end = end;
+      chunk.findEnds = false;
+      chunks.push_back(chunk);
+      piece = end;
+    }
+  }
+  int numberChunks = static_cast< int >(chunks.size());
+  if (numberChunks) {
+    work.chunks = &chunks[0];
+    CoinParallelRun(numberChunks, numberThreads_, readRowsChunk, &work);
+  }
+  int numberRows = 0;
+  int numberElements = 0;
+  for (int iChunk = 0; iChunk < numberChunks; iChunk++) {
+    if (chunks[iChunk].failed) {
+      char str[8192];
+      sprintf(str, "### ERROR: Unable to read row monomial\n");
+      throw CoinError(str, "read_monom_row", "CoinLpIO", __FILE__, __LINE__);
+    }
+    numberRows += static_cast< int >(chunks[iChunk].rhs.size());
+    numberElements += static_cast< int >(chunks[iChunk].elements.size());
+  }
+  if (*cnt_row + numberRows >= *maxrow) {
+    *maxrow = *cnt_row + numberRows + 1;
+    *prowNames = reinterpret_cast< char ** >(realloc((*prowNames), (*maxrow + MAX_OBJECTIVES) * sizeof(char *)));
+    *pstart = reinterpret_cast< CoinBigIndex * >(realloc((*pstart), (*maxrow + MAX_OBJECTIVES) * sizeof(CoinBigIndex)));
+    *prhs = reinterpret_cast< double * >(realloc((*prhs), (*maxrow + 1) * sizeof(double)));
+    *prowlow = reinterpret_cast< double * >(realloc((*prowlow), (*maxrow + 1) * sizeof(double)));
+    *prowup = reinterpret_cast< double * >(realloc((*prowup), (*maxrow + 1) * sizeof(double)));
+  }
+  if (*cnt_coeff + numberElements > *maxcoeff) {
+    *maxcoeff = *cnt_coeff + numberElements;
+    *pcoeff = reinterpret_cast< double * >(realloc((*pcoeff), (*maxcoeff + 1) * sizeof(double)));
+  }
+  *pind = reinterpret_cast< int * >(malloc((*maxcoeff + 1) * sizeof(int)));
+  char **rowNames = *prowNames;
+  CoinBigIndex *start = *pstart;
+  double *rhs = *prhs;
+  double *rowlow = *prowlow;
+  double *rowup = *prowup;
+  double *coeff = *pcoeff;
+  int *ind = *pind;
+  // put together in order - column names looked up once per piece
+  std::vector< int > which;
+  for (int iChunk = 0; iChunk < numberChunks; iChunk++) {
+    const CoinLpRowChunk &chunk = chunks[iChunk];
+    int numberNames = static_cast< int >(chunk.columnName.size());
+    which.resize(numberNames);
+    for (int i = 0; i < numberNames; i++)
+      which[i] = insertHash(&chunk.names[chunk.columnName[i]], 1);
+    int k = 0;
+    int numberRowsChunk = static_cast< int >(chunk.rhs.size());
+    for (int iRow = 0; iRow < numberRowsChunk; iRow++) {
+      if (chunk.rowName[iRow] >= 0) {
+        rowNames[*cnt_row] = CoinStrdup(&chunk.names[chunk.rowName[iRow]]);
+      } else {
+        char rname[15];
+        sprintf(rname, "cons%d", *cnt_row);
+        rowNames[*cnt_row] = CoinStrdup(rname);
+      }
+      for (int j = 0; j < chunk.rowLength[iRow]; j++, k++) {
+        coeff[*cnt_coeff] = chunk.elements[k];
+        ind[*cnt_coeff] = which[chunk.columns[k]];
+        (*cnt_coeff)++;
+      }
+      double value = chunk.rhs[iRow];
+      rhs[*cnt_row] = value;
+      switch (chunk.sense[iRow]) {
+      case 0:
+        rowlow[*cnt_row] = -inf;
+        rowup[*cnt_row] = value;
+        break;
+      case 1:
+        rowlow[*cnt_row] = value;
+        rowup[*cnt_row] = value;
+        break;
+      case 2:
+        rowlow[*cnt_row] = value;
+        rowup[*cnt_row] = inf;
+        break;
+      default:
+        break;
+      }
+      (*cnt_row)++;
+      start[*cnt_row] = *cnt_coeff;
+    }
+  }
+  // rest of file (starting with keyword) is read as usual
+  input_ = new CoinLpTailInput(input_, image, all.end - text);
+  bufferPosition_ = 0;
+  bufferLength_ = 0;
+  fscanfLpIO(buff);
+} /* readRowsParallel */
+
 /*************************************************************************/
 int CoinLpIO::is_keyword(const char *buff) const
 {
@@ -1948,39 +2400,51 @@ void CoinLpIO::readLp()
     }
   }
 
-  fscanfLpIO(buff);
+  int *ind = NULL;
+  // number of entries in colNames
+  int cnt_names = cnt_obj;
+  if (numberThreads_ > 1) {
+    // column names go straight into hash table
+    stopHash(1);
+    startHash(colNames, cnt_obj, 1);
+    readRowsParallel(buff, &coeff, &ind, &cnt_coeff, &maxcoeff,
+      &rowNames, &start, &rhs, &rowlow, &rowup, &cnt_row, &maxrow, lp_inf);
+  } else {
+    fscanfLpIO(buff);
 
-  while (!is_keyword(buff)) {
-    if (buff[strlen(buff) - 1] == ':') {
-      buff[strlen(buff) - 1] = '\0';
+    while (!is_keyword(buff)) {
+      if (buff[strlen(buff) - 1] == ':') {
+        buff[strlen(buff) - 1] = '\0';
 
 #ifdef LPIO_DEBUG
-      printf("CoinLpIO::readLp(): rowName[%d]: %s\n", cnt_row, buff);
+        printf("CoinLpIO::readLp(): rowName[%d]: %s\n", cnt_row, buff);
 #endif
 
-      rowNames[cnt_row] = CoinStrdup(buff);
+        rowNames[cnt_row] = CoinStrdup(buff);
+        fscanfLpIO(buff);
+      } else {
+        char rname[15];
+        sprintf(rname, "cons%d", cnt_row);
+        rowNames[cnt_row] = CoinStrdup(rname);
+      }
+      read_row(buff,
+        &coeff, &colNames, &cnt_coeff, &maxcoeff, rhs, rowlow, rowup,
+        &cnt_row, lp_inf);
       fscanfLpIO(buff);
-    } else {
-      char rname[15];
-      sprintf(rname, "cons%d", cnt_row);
-      rowNames[cnt_row] = CoinStrdup(rname);
-    }
-    read_row(buff,
-      &coeff, &colNames, &cnt_coeff, &maxcoeff, rhs, rowlow, rowup,
-      &cnt_row, lp_inf);
-    fscanfLpIO(buff);
-    start[cnt_row] = cnt_coeff;
+      start[cnt_row] = cnt_coeff;
 
-    if (cnt_row == maxrow) {
-      realloc_row(&rowNames, &start, &rhs, &rowlow, &rowup, &maxrow);
+      if (cnt_row == maxrow) {
+        realloc_row(&rowNames, &start, &rhs, &rowlow, &rowup, &maxrow);
+      }
     }
+
+    cnt_names = cnt_coeff;
+    stopHash(1);
+    startHash(colNames, cnt_coeff, 1);
   }
 
   numberRows_ = cnt_row;
 
-  stopHash(1);
-  startHash(colNames, cnt_coeff, 1);
-
   COINColumnIndex icol;
   int read_sense1, read_sense2;
   double bnd1 = 0, bnd2 = 0;
@@ -2025,7 +2489,7 @@ void CoinLpIO::readLp()
 
         int scan_sense = 0;
         if (first_is_number(start_str)) {
-          bnd1 = mult * atof(start_str);
+          bnd1 = mult * CoinStrtod(start_str, NULL);
           scan_sense = 1;
         } else {
           if (is_inf(start_str)) {
@@ -2078,7 +2542,7 @@ void CoinLpIO::readLp()
               }
             }
             if (first_is_number(start_str)) {
-              bnd2 = mult * atof(start_str);
+              bnd2 = mult * CoinStrtod(start_str, NULL);
               fscanfLpIO(buff);
             } else {
               if (is_inf(start_str)) {
@@ -2368,7 +2832,7 @@ void CoinLpIO::readLp()
                       next = buff - 1;
                     }
                   }
-                  double value = atof(next + 1);
+                  double value = CoinStrtod(next + 1, NULL);
                   if (numberEntries == maxEntries) {
                     maxEntries = 2 * maxEntries;
                     double *tempD = new double[maxEntries];
@@ -2475,9 +2939,10 @@ void CoinLpIO::readLp()
   printf("CoinLpIO::readLp(): Done with reading the Lp file\n");
 #endif
 
-  int *ind = reinterpret_cast< int * >(malloc((maxcoeff + 1) * sizeof(int)));
+  if (!ind)
+    ind = reinterpret_cast< int * >(malloc((maxcoeff + 1) * sizeof(int)));
 
-  for (i = 0; i < cnt_coeff; i++) {
+  for (i = 0; i < cnt_names; i++) {
     ind[i] = findHash(colNames[i], 1);
 
 #ifdef LPIO_DEBUG
@@ -2604,7 +3069,7 @@ void CoinLpIO::readLp()
                                                        << CoinMessageEol;
   }
 
-  for (i = 0; i < cnt_coeff; i++) {
+  for (i = 0; i < cnt_names; i++) {
     free(colNames[i]);
   }
   free(colNames);
@@ -2699,39 +3164,6 @@ void CoinLpIO::print() const
   printf("infinity_: %.5f\n", infinity_);
 } /* print */
 
-/*************************************************************************/
-// Hash functions slightly modified from CoinMpsIO.cpp
-
-namespace {
-const int mmult[] = {
-  262139, 259459, 256889, 254291, 251701, 249133, 246709, 244247,
-  241667, 239179, 236609, 233983, 231289, 228859, 226357, 223829,
-  221281, 218849, 216319, 213721, 211093, 208673, 206263, 203773,
-  201233, 198637, 196159, 193603, 191161, 188701, 186149, 183761,
-  181303, 178873, 176389, 173897, 171469, 169049, 166471, 163871,
-  161387, 158941, 156437, 153949, 151531, 149159, 146749, 144299,
-  141709, 139369, 136889, 134591, 132169, 129641, 127343, 124853,
-  122477, 120163, 117757, 115361, 112979, 110567, 108179, 105727,
-  103387, 101021, 98639, 96179, 93911, 91583, 89317, 86939, 84521,
-  82183, 79939, 77587, 75307, 72959, 70793, 68447, 66103
-};
-int compute_hash(const char *name, int maxsiz, int length)
-{
-
-  int n = 0;
-  int j;
-
-  const int nEntriesMMult = sizeof(mmult) / sizeof(int);
-
-  for (j = 0; j < length; ++j) {
-    int iname = name[j];
-
-    n += mmult[j % nEntriesMMult] * iname;
-  }
-  return (abs(n) % maxsiz); /* integer abs */
-}
-} // end file-local namespace
-
 /************************************************************************/
 //  startHash.  Creates hash list for names
 //  setup names_[section] with names in the same order as in the parameter,
@@ -2740,114 +3172,29 @@ int compute_hash(const char *name, int maxsiz, int length)
 void CoinLpIO::startHash(char const *const *const names,
   const COINColumnIndex number, int section)
 {
-  maxHash_[section] = 4 * number;
-  int maxhash = maxHash_[section];
-  COINColumnIndex i, ipos, iput;
+  maxHash_[section] = CoinMax(4 * number, 16);
+  COINColumnIndex i;
 
-  names_[section] = reinterpret_cast< char ** >(malloc(maxhash * sizeof(char *)));
-  hash_[section] = new CoinHashLink[maxhash];
+  names_[section] = reinterpret_cast< char ** >(malloc(maxHash_[section] * sizeof(char *)));
+  hash_[section] = new CoinNameHash();
+  CoinNameArena::release(nameArena_[section]);
+  nameArena_[section] = new CoinNameArena();
+  CoinNameArena *arena = nameArena_[section];
 
-  CoinHashLink *hashThis = hash_[section];
+  CoinNameHash *hashThis = hash_[section];
   char **hashNames = names_[section];
-
-  for (i = 0; i < maxhash; i++) {
-    hashThis[i].index = -1;
-    hashThis[i].next = -1;
-  }
-
-  /*
-   * Initialize the hash table.  Only the index of the first name that
-   * hashes to a value is entered in the table; subsequent names that
-   * collide with it are not entered.
-   */
-
-  for (i = 0; i < number; i++) {
-    const char *thisName = names[i];
-    int length = CoinStrlenAsInt(thisName);
-
-    ipos = compute_hash(thisName, maxhash, length);
-    if (hashThis[ipos].index == -1) {
-      hashThis[ipos].index = i; // will be changed below
-    }
-  }
-
-  /*
-   * Now take care of the names that collided in the preceding loop,
-   * by finding some other entry in the table for them.
-   * Since there are as many entries in the table as there are names,
-   * there must be room for them.
-   * Also setting up hashNames.
-   */
+  hashThis->setNames(hashNames);
+  hashThis->reserve(number);
 
   int cnt_distinct = 0;
 
-  iput = -1;
   for (i = 0; i < number; i++) {
-    const char *thisName = names[i];
-    int length = CoinStrlenAsInt(thisName);
-
-    ipos = compute_hash(thisName, maxhash, length);
-
-    while (1) {
-      COINColumnIndex j1 = hashThis[ipos].index;
-
-      if (j1 == i) {
-
-        // first occurence of thisName in the parameter "names"
-
-        hashThis[ipos].index = cnt_distinct;
-        hashNames[cnt_distinct] = CoinStrdup(thisName);
-        cnt_distinct++;
-        break;
-      } else {
-
-#ifdef LPIO_DEBUG
-        if (j1 > i) {
-          char str[8192];
-          sprintf(str, "### ERROR: Hash table: j1: %d  i: %d\n", j1, i);
-          throw CoinError(str, "startHash", "CoinLpIO", __FILE__, __LINE__);
-        }
-#endif
-
-        if (strcmp(thisName, hashNames[j1]) == 0) {
-
-          // thisName already entered
-
-          break;
-        } else {
-          // Collision; check if thisName already entered
-
-          COINColumnIndex k = hashThis[ipos].next;
-
-          if (k == -1) {
-
-            // thisName not found; enter it
-
-            while (1) {
-              ++iput;
-              if (iput > maxhash) {
-                char str[8192];
-                sprintf(str, "### ERROR: Hash table: too many names\n");
-                throw CoinError(str, "startHash", "CoinLpIO", __FILE__, __LINE__);
-                break;
-              }
-              if (hashThis[iput].index == -1) {
-                break;
-              }
-            }
-            hashThis[ipos].next = iput;
-            hashThis[iput].index = cnt_distinct;
-            hashNames[cnt_distinct] = CoinStrdup(thisName);
-            cnt_distinct++;
-            break;
-          } else {
-            ipos = k;
-
-            // continue the check with names in collision
-          }
-        }
-      }
-    }
+    // a copy is entered and kept unless thisName is already in
+    hashNames[cnt_distinct] = arena->add(names[i]);
+    if (hashThis->insert(cnt_distinct) == cnt_distinct)
+      cnt_distinct++;
+    else
+      arena->takeBack(hashNames[cnt_distinct]);
   }
 
   numberHash_[section] = cnt_distinct;
@@ -2861,8 +3208,10 @@ void CoinLpIO::stopHash(int section)
   freePreviousNames(section);
   previous_names_[section] = names_[section];
   card_previous_names_[section] = numberHash_[section];
+  previousNameArena_[section] = nameArena_[section];
+  nameArena_[section] = NULL;
 
-  delete[] hash_[section];
+  delete hash_[section];
   hash_[section] = NULL;
 
   maxHash_[section] = 0;
@@ -2883,98 +3232,32 @@ void CoinLpIO::stopHash(int section)
 COINColumnIndex
 CoinLpIO::findHash(const char *name, int section) const
 {
-  COINColumnIndex found = -1;
-
-  char **names = names_[section];
-  CoinHashLink *hashThis = hash_[section];
-  COINColumnIndex maxhash = maxHash_[section];
-  COINColumnIndex ipos;
-
   /* default if we don't find anything */
-  if (!maxhash)
+  if (!hash_[section])
     return -1;
 
-  int length = CoinStrlenAsInt(name);
-
-  ipos = compute_hash(name, maxhash, length);
-  while (1) {
-    COINColumnIndex j1 = hashThis[ipos].index;
-
-    if (j1 >= 0) {
-      char *thisName2 = names[j1];
-
-      if (strcmp(name, thisName2) != 0) {
-        COINColumnIndex k = hashThis[ipos].next;
-
-        if (k != -1)
-          ipos = k;
-        else
-          break;
-      } else {
-        found = j1;
-        break;
-      }
-    } else {
-      found = -1;
-      break;
-    }
-  }
-  return found;
+  return hash_[section]->find(name);
 } /* findHash */
 
 /*********************************************************************/
-void CoinLpIO::insertHash(const char *thisName, int section)
+int CoinLpIO::insertHash(const char *thisName, int section)
 {
 
   int number = numberHash_[section];
-  int maxhash = maxHash_[section];
-
-  CoinHashLink *hashThis = hash_[section];
-  char **hashNames = names_[section];
-
-  int iput = -1;
-  int length = CoinStrlenAsInt(thisName);
-
-  int ipos = compute_hash(thisName, maxhash, length);
-
-  while (1) {
-    COINColumnIndex j1 = hashThis[ipos].index;
-
-    if (j1 == -1) {
-      hashThis[ipos].index = number;
-      break;
-    } else {
-      char *thisName2 = hashNames[j1];
-
-      if (strcmp(thisName, thisName2) != 0) {
-        COINColumnIndex k = hashThis[ipos].next;
 
-        if (k == -1) {
-          while (1) {
-            ++iput;
-            if (iput == maxhash) {
-              char str[8192];
-              sprintf(str, "### ERROR: Hash table: too many names\n");
-              throw CoinError(str, "insertHash", "CoinLpIO", __FILE__, __LINE__);
-              break;
-            }
-            if (hashThis[iput].index == -1) {
-              break;
-            }
-          }
-          hashThis[ipos].next = iput;
-          hashThis[iput].index = number;
-          break;
-        } else {
-          ipos = k;
-          /* nothing worked - try it again */
-        }
-      }
-    }
+  if (number == maxHash_[section]) {
+    // more room for names
+    maxHash_[section] = 2 * number;
+    names_[section] = reinterpret_cast< char ** >(realloc(names_[section], maxHash_[section] * sizeof(char *)));
+    hash_[section]->setNames(names_[section]);
   }
-
-  hashNames[number] = CoinStrdup(thisName);
-  (numberHash_[section])++;
+  names_[section][number] = nameArena_[section]->add(thisName);
+  int index = hash_[section]->insert(number);
+  if (index == number)
+    (numberHash_[section])++;
+  else
+    nameArena_[section]->takeBack(names_[section][number]);
+  return index;
 }
 // Pass in Message handler (not deleted at end)
 void CoinLpIO::passInMessageHandler(CoinMessageHandler *handler)
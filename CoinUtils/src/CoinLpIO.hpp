@@ -21,6 +21,8 @@
 #include "CoinMessage.hpp"
 #include "CoinFileIO.hpp"
 class CoinSet;
+class CoinNameArena;
+class CoinNameHash;
 
 const int MAX_OBJECTIVES = 2;
 
@@ -327,12 +329,28 @@ public:
   /// Default: 10.
   void setNumberAcross(const int);
 
-  /// Get decimals, the number of digits to write after the decimal point
+  /// Get decimals, the maximum number of digits to write after the decimal point
   int getDecimals() const;
 
   /// Set decimals.
   /// Default: 5
   void setDecimals(const int);
+
+  /// Get the number of threads used to read constraints
+  int getNumberThreads() const;
+
+  /** Set the number of threads used to read constraints.
+      If more than one, readLp() reads the rest of the file into memory,
+      splits the constraints at constraint boundaries and parses the pieces
+      in parallel.  The pieces are then put together in order with one
+      pass to look up column names, so the result is exactly the same as
+      reading serially.  Without thread support (see
+      --enable-coinutils-threads) the pieces are parsed one after another.
+      The same number of threads is used to make the column copy for
+      getMatrixByCol.
+      Default: 1
+  */
+  void setNumberThreads(const int);
   //@}
 
   /**@name Public methods */
@@ -429,7 +447,8 @@ public:
       Coefficients with value less than epsilon away from an integer value
       are written as integers.
       Write at most numberAcross monomials on a line.
-      Write non integer numbers with decimals digits after the decimal point.
+      Write non integer numbers with decimals digits after the decimal point
+      (fewer if the number reads back exactly with fewer).
       Write objective function name and row names if useRowNames = true.
 
       Ranged constraints are written as two constraints.
@@ -449,7 +468,8 @@ public:
       Coefficients with value less than epsilon away from an integer value
       are written as integers.
       Write at most numberAcross monomials on a line.
-      Write non integer numbers with decimals digits after the decimal point.
+      Write non integer numbers with decimals digits after the decimal point
+      (fewer if the number reads back exactly with fewer).
       Write objective function name and row names if useRowNames = true.
 
       Ranged constraints are written as two constraints.
@@ -632,6 +652,9 @@ protected:
   /// Number of decimals printed for coefficients
   int decimals_;
 
+  /// Number of threads used to read constraints
+  int numberThreads_;
+
   /// Objective function name
   char *objName_[MAX_OBJECTIVES];
 
@@ -652,17 +675,19 @@ protected:
   /// section = 1 for column names.
   int card_previous_names_[2];
 
+  /// Storage for the strings in previous_names_[section].
+  CoinNameArena *previousNameArena_[2];
+
   /// Row names (including objective function name)
   /// and column names (linked to Hash tables).
   /// section = 0 for row names,
   /// section = 1 for column names.
   char **names_[2];
 
-  typedef struct {
-    int index, next;
-  } CoinHashLink;
+  /// Storage for the strings in names_[section] (shared with any copies).
+  CoinNameArena *nameArena_[2];
 
-  /// Maximum number of entries in a hash table section.
+  /// Room for names in names_[section].
   /// section = 0 for row names,
   /// section = 1 for column names.
   int maxHash_[2];
@@ -675,7 +700,7 @@ protected:
   /// Hash tables with two sections.
   /// section = 0 for row names (including objective function name),
   /// section = 1 for column names.
-  mutable CoinHashLink *hash_[2];
+  mutable CoinNameHash *hash_[2];
 
   /// Current buffer (needed so can get rid of blanks with :
   mutable char inputBuffer_[1028];
@@ -713,10 +738,10 @@ protected:
   COINColumnIndex findHash(const char *name, int section) const;
 
   /// Insert thisName in the hash table if not present yet; does nothing
-  /// if the name is already in.
+  /// if the name is already in.  Returns the index of thisName.
   /// section = 0 for row names,
   /// section = 1 for column names.
-  void insertHash(const char *thisName, int section);
+  int insertHash(const char *thisName, int section);
 
   /// Write a coefficient.
   /// print_1 = 0 : do not print the value 1.
@@ -802,6 +827,22 @@ protected:
     double *rhs, double *rowlow, double *rowup,
     int *cnt_row, double inf) const;
 
+  /** Read all constraints using numberThreads_ threads.
+      buff holds the first word after "subject to" and on return the keyword
+      after the constraints, as in the serial loop.  Row names, start,
+      bounds, coefficients and column indices (ind) are added after those
+      already there, arrays being made bigger as needed.  Column names are
+      put in the hash table (started with the objective names).
+  */
+  void readRowsParallel(char *buff, double **pcoeff, int **pind,
+    int *cnt_coeff, int *maxcoeff,
+    char ***prowNames, CoinBigIndex **pstart, double **prhs,
+    double **prowlow, double **prowup, int *cnt_row, int *maxrow,
+    double inf);
+
+  /// Parses one piece of the constraints (task for CoinParallelRun)
+  static void readRowsChunk(void *info, int whichChunk);
+
   /** Check that current objective name and all row names are distinct
       including row names obtained by adding "_low" for ranged constraints.
       If there is a conflict in the names, they are replaced by default 
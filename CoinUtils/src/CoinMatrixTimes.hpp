@@ -0,0 +1,227 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CoinMatrixTimes_H
+#define CoinMatrixTimes_H
+
+/** \file CoinMatrixTimes.hpp
+    \brief Matrix times vector split between threads.
+
+    Used by CoinPackedMatrix and CoinCompressedMatrix for timesMajor and
+    timesMinor (not installed).  The major vectors are split into pieces
+    with about the same number of elements and the pieces run with
+    CoinParallelRun.  With one piece nothing is allocated and the loop is
+    just run.
+*/
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinIndexedVector.hpp"
+#include "CoinParallel.hpp"
+
+/// Pieces of fewer elements than this are not worth a thread
+#define COIN_TIMES_MINIMUM_ELEMENTS 100000
+
+/** Number of pieces to split total elements into.  Each piece of a
+    scatter must also be worth an extra copy of y (size minimumSize). */
+inline int CoinTimesNumberTasks(CoinBigIndex total, int numberThreads,
+  CoinBigIndex minimumSize)
+{
+  int numberTasks = 1;
+  if (numberThreads > 1 && CoinParallelAvailable())
+    numberTasks = static_cast< int >(CoinMax(static_cast< CoinBigIndex >(1),
+      CoinMin(static_cast< CoinBigIndex >(numberThreads),
+        total / CoinMax(static_cast< CoinBigIndex >(COIN_TIMES_MINIMUM_ELEMENTS),
+                  minimumSize))));
+  return numberTasks;
+}
+
+/** x of timesMinor as a dense vector.
+
+    The dense part of x is zero except at the nonzeros so is used as it is.
+    If x is packed a dense copy of size sizeX is made and returned in
+    scratch, which the caller deletes.
+*/
+inline const double *CoinTimesDense(const CoinIndexedVector &x, int sizeX,
+  double *&scratch)
+{
+  scratch = NULL;
+  if (!x.packedMode())
+    return x.denseVector();
+  scratch = new double[sizeX];
+  CoinZeroN(scratch, sizeX);
+  int number = x.getNumElements();
+  const int *which = x.getIndices();
+  const double *elements = x.denseVector();
+  for (int k = 0; k < number; k++)
+    scratch[which[k]] = elements[k];
+  return scratch;
+}
+
+/** Pieces of one timesMajor (scatter) or timesMinor (dot).
+
+    Vectors gives the major vectors of the matrix with
+    - <code>size(i)</code> number of elements in vector i
+    - <code>scatter(i, x_i, y)</code> adds x_i times vector i into y
+    - <code>dot(i, x)</code> dot product of vector i with x
+*/
+template < class Vectors >
+class CoinTimesPieces {
+
+public:
+  explicit CoinTimesPieces(const Vectors &vectors)
+    : vectors_(vectors)
+    , x_(NULL)
+    , which_(NULL)
+    , packed_(false)
+    , y_(NULL)
+    , sizeY_(0)
+    , first_(NULL)
+    , numberTasks_(0)
+  {
+  }
+
+  /** Sets y (size sizeY) to the sum of x_i times vector i over all of x
+      (which NULL) or over the number nonzeros in which.  If packed x has
+      just the values of the nonzeros.  total is the number of elements in
+      the vectors used.  With more than one piece each piece has its own
+      copy of y and the copies are added at the end. */
+  void scatter(const double *x, const int *which, bool packed, int number,
+    CoinBigIndex total, double *y, int sizeY, int numberThreads)
+  {
+    x_ = x;
+    which_ = which;
+    packed_ = packed;
+    sizeY_ = sizeY;
+    CoinZeroN(y, sizeY);
+    int numberTasks = CoinTimesNumberTasks(total, numberThreads, sizeY);
+    if (numberTasks == 1) {
+      // just the serial loop
+      int first[2] = { 0, number };
+      y_ = &y;
+      first_ = first;
+      numberTasks_ = 1;
+      scatterTask(this, 0);
+      return;
+    }
+    split(number, total, numberTasks);
+    y_ = new double *[numberTasks];
+    y_[0] = y;
+    for (int iTask = 1; iTask < numberTasks; iTask++)
+      y_[iTask] = new double[sizeY];
+    CoinParallelRun(numberTasks, numberTasks, scatterTask, this);
+    CoinParallelRun(numberTasks, numberTasks, sumTask, this);
+    for (int iTask = 1; iTask < numberTasks; iTask++)
+      delete[] y_[iTask];
+    delete[] y_;
+    delete[] first_;
+  }
+
+  /// Sets y_i to dot product of vector i with x for number vectors
+  void dot(const double *x, int number, CoinBigIndex total, double *y,
+    int numberThreads)
+  {
+    x_ = x;
+    which_ = NULL;
+    packed_ = false;
+    sizeY_ = number;
+    y_ = &y;
+    int numberTasks = CoinTimesNumberTasks(total, numberThreads, 0);
+    if (numberTasks == 1) {
+      // just the serial loop
+      int first[2] = { 0, number };
+      first_ = first;
+      numberTasks_ = 1;
+      dotTask(this, 0);
+      return;
+    }
+    split(number, total, numberTasks);
+    CoinParallelRun(numberTasks, numberTasks, dotTask, this);
+    delete[] first_;
+  }
+
+private:
+  /// Not copied
+  CoinTimesPieces(const CoinTimesPieces &);
+  CoinTimesPieces &operator=(const CoinTimesPieces &);
+
+  /// Makes first_ so each piece has about the same number of elements
+  void split(int number, CoinBigIndex total, int numberTasks)
+  {
+    numberTasks_ = numberTasks;
+    first_ = new int[numberTasks + 1];
+    first_[0] = 0;
+    int iTask = 1;
+    CoinBigIndex sum = 0;
+    for (int k = 0; k < number && iTask < numberTasks; k++) {
+      sum += vectors_.size(which_ ? which_[k] : k);
+      while (iTask < numberTasks && static_cast< double >(sum) * numberTasks >= static_cast< double >(total) * iTask)
+        first_[iTask++] = k + 1;
+    }
+    while (iTask <= numberTasks)
+      first_[iTask++] = number;
+  }
+
+  /// Task for CoinParallelRun - adds one piece of vectors into its y
+  static void scatterTask(void *infoPointer, int whichTask)
+  {
+    const CoinTimesPieces *info = static_cast< const CoinTimesPieces * >(infoPointer);
+    const double *COIN_RESTRICT x = info->x_;
+    const int *COIN_RESTRICT which = info->which_;
+    double *COIN_RESTRICT y = info->y_[whichTask];
+    if (whichTask)
+      CoinZeroN(y, info->sizeY_);
+    for (int k = info->first_[whichTask + 1] - 1; k >= info->first_[whichTask]; --k) {
+      int i = which ? which[k] : k;
+      const double x_i = info->packed_ ? x[k] : x[i];
+      if (x_i != 0.0)
+        info->vectors_.scatter(i, x_i, y);
+    }
+  }
+
+  /// Task for CoinParallelRun - adds other copies of y into one part of y
+  static void sumTask(void *infoPointer, int whichTask)
+  {
+    const CoinTimesPieces *info = static_cast< const CoinTimesPieces * >(infoPointer);
+    int numberTasks = info->numberTasks_;
+    int first = static_cast< int >((static_cast< CoinBigIndex >(whichTask) * info->sizeY_) / numberTasks);
+    int last = static_cast< int >((static_cast< CoinBigIndex >(whichTask + 1) * info->sizeY_) / numberTasks);
+    double *COIN_RESTRICT y = info->y_[0];
+    for (int iTask = 1; iTask < numberTasks; iTask++) {
+      const double *COIN_RESTRICT partial = info->y_[iTask];
+      for (int i = first; i < last; i++)
+        y[i] += partial[i];
+    }
+  }
+
+  /// Task for CoinParallelRun - does dot products for one piece of y
+  static void dotTask(void *infoPointer, int whichTask)
+  {
+    const CoinTimesPieces *info = static_cast< const CoinTimesPieces * >(infoPointer);
+    double *COIN_RESTRICT y = info->y_[0];
+    for (int i = info->first_[whichTask + 1] - 1; i >= info->first_[whichTask]; --i)
+      y[i] = info->vectors_.dot(i, info->x_);
+  }
+
+  /// The major vectors
+  Vectors vectors_;
+  /// Dense x, or packed values of x if packed_
+  const double *x_;
+  /// Nonzeros of x (scatter with indexed vector) or NULL for all
+  const int *which_;
+  /// Whether x_ has just the values of the nonzeros
+  bool packed_;
+  /// y for first piece then one copy of y for each other piece (scatter)
+  double **y_;
+  /// Size of y
+  int sizeY_;
+  /// First vector (or nonzero of x) of each piece and one past last
+  int *first_;
+  /// Number of pieces
+  int numberTasks_;
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
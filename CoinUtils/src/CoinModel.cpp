@@ -8,6 +8,7 @@
 #include "CoinMessage.hpp"
 #include "CoinSort.hpp"
 #include "CoinMpsIO.hpp"
+#include "CoinNameArena.hpp"
 #include "CoinFloatEqual.hpp"
 
 //#############################################################################
@@ -256,7 +257,10 @@ CoinModel::CoinModel(const char *fileName, int allowStrings)
   m.setConvertObjective(true);
   if (!status) {
     try {
-      status = m.readMps(fileName, "");
+      if (CoinMpsIO::isBinaryFile(fileName))
+        status = m.readBinary(fileName);
+      else
+        status = m.readMps(fileName, "");
     } catch (CoinError &e) {
       e.print();
       status = -1;
@@ -281,6 +285,9 @@ CoinModel::CoinModel(const char *fileName, int allowStrings)
     const double *columnLower = m.getColLower();
     const double *columnUpper = m.getColUpper();
     const double *objective = m.getObjCoefficients();
+    // use names where they are
+    rowName_.setArena(m.nameArena(0));
+    columnName_.setArena(m.nameArena(1));
     int i;
     for (i = 0; i < numberRows; i++) {
       addRow(rowLength[i], column + rowStart[i],
@@ -297,7 +304,7 @@ CoinModel::CoinModel(const char *fileName, int allowStrings)
         numberIntegers++;
       }
     }
-    bool quadraticInteger = (numberIntegers != 0) && m.reader()->whichSection() == COIN_QUAD_SECTION;
+    bool quadraticInteger = (numberIntegers != 0) && m.reader() && m.reader()->whichSection() == COIN_QUAD_SECTION;
     // do names
     int iRow;
     for (iRow = 0; iRow < numberRows_; iRow++) {
@@ -362,7 +369,7 @@ CoinModel::CoinModel(const char *fileName, int allowStrings)
       }
     }
     // get quadratic part
-    if (m.reader()->whichSection() == COIN_QUAD_SECTION) {
+    if (m.reader() && m.reader()->whichSection() == COIN_QUAD_SECTION) {
       CoinBigIndex *start = NULL;
       int *column = NULL;
       double *element = NULL;
@@ -2059,10 +2066,131 @@ int CoinModel::createArrays(double *&rowLower, double *&rowUpper,
   return numberErrors;
 }
 
+/* Names as the writer would have them - defaults for missing names and
+   generated style names which clash changed.  Returns NULL if the names
+   can be used as they are.
+*/
+static char **
+uniqueNames(const char *const *names, int number, char first,
+  CoinNameArena &arena, int &numberChanged)
+{
+  numberChanged = 0;
+  if (!names)
+    return NULL;
+  char **copy = new char *[number];
+  char defaultName[12];
+  for (int i = 0; i < number; i++) {
+    if (names[i]) {
+      copy[i] = const_cast< char * >(names[i]);
+    } else {
+      sprintf(defaultName, "%c%7.7d", first, i);
+      copy[i] = arena.add(defaultName);
+    }
+  }
+  numberChanged = CoinMpsIO::makeUniqueNames(copy, number, first, arena);
+  if (!numberChanged) {
+    delete[] copy;
+    copy = NULL;
+  }
+  return copy;
+}
+
 /* Write the problem in MPS format to a file with the given filename.
  */
 int CoinModel::writeMps(const char *filename, int compression,
   int formatType, int numberAcross, bool keepStrings)
+{
+  CoinMpsIO writer;
+  if (keepStrings && string_.numberItems()) {
+    loadWriter(writer, keepStrings);
+    return writer.writeMps(filename, compression, formatType, numberAcross);
+  }
+  // Write straight from model so only matrix is copied
+  int numberErrors = 0;
+  double *rowLower = rowLower_;
+  double *rowUpper = rowUpper_;
+  double *columnLower = columnLower_;
+  double *columnUpper = columnUpper_;
+  double *objective = objective_;
+  int *integerType = integerType_;
+  double *associated = associated_;
+  // If strings then do copies
+  if (string_.numberItems()) {
+    numberErrors = createArrays(rowLower, rowUpper, columnLower, columnUpper,
+      objective, integerType, associated);
+  }
+  CoinPackedMatrix matrix;
+  const CoinPackedMatrix *useMatrix = &matrix;
+  if (type_ != 3)
+    createPackedMatrix(matrix, associated);
+  else
+    useMatrix = packedMatrix_;
+  char *integrality = NULL;
+  for (int i = 0; i < numberColumns_; i++) {
+    if (integerType[i]) {
+      if (!integrality) {
+        integrality = new char[numberColumns_];
+        memset(integrality, 0, numberColumns_);
+      }
+      integrality[i] = 1;
+    }
+  }
+  writer.setInfinity(COIN_DBL_MAX);
+  writer.setObjectiveOffset(objectiveOffset_);
+  writer.setProblemName(problemName_.c_str());
+  const char *const *rowNames = NULL;
+  if (rowName_.numberItems())
+    rowNames = rowName_.names();
+  const char *const *columnNames = NULL;
+  if (columnName_.numberItems())
+    columnNames = columnName_.names();
+  // clashing generated names are changed as when going through a copy
+  CoinNameArena newNames;
+  int numberChanged;
+  char **uniqueRowNames = uniqueNames(rowNames, numberRows_, 'R', newNames,
+    numberChanged);
+  if (uniqueRowNames) {
+    rowNames = uniqueRowNames;
+    writer.messageHandler()->message(COIN_MPS_CHANGED, writer.messages())
+      << "row" << numberChanged << CoinMessageEol;
+  }
+  char **uniqueColumnNames = uniqueNames(columnNames, numberColumns_, 'C',
+    newNames, numberChanged);
+  if (uniqueColumnNames) {
+    columnNames = uniqueColumnNames;
+    writer.messageHandler()->message(COIN_MPS_CHANGED, writer.messages())
+      << "column" << numberChanged << CoinMessageEol;
+  }
+  CoinMpsPackedColumns columns(*useMatrix, columnLower, columnUpper,
+    objective, integrality, columnNames);
+  int returnCode = writer.writeMps(filename, compression, formatType,
+    numberAcross, useMatrix->getNumRows(), rowLower, rowUpper, rowNames,
+    columns);
+  delete[] uniqueRowNames;
+  delete[] uniqueColumnNames;
+  delete[] integrality;
+  if (rowLower != rowLower_) {
+    delete[] rowLower;
+    delete[] rowUpper;
+    delete[] columnLower;
+    delete[] columnUpper;
+    delete[] objective;
+    delete[] integerType;
+    delete[] associated;
+    if (numberErrors && logLevel_ > 0)
+      printf("%d string elements had no values associated with them\n", numberErrors);
+  }
+  return returnCode;
+}
+// Write binary snapshot
+int CoinModel::writeBinary(const char *filename)
+{
+  CoinMpsIO writer;
+  loadWriter(writer, false);
+  return writer.writeBinary(filename);
+}
+// Loads model into writer for writeMps and writeBinary
+void CoinModel::loadWriter(CoinMpsIO &writer, bool keepStrings)
 {
   int numberErrors = 0;
   // Set arrays for normal use
@@ -2095,7 +2223,6 @@ int CoinModel::writeMps(const char *filename, int compression,
     }
   }
 
-  CoinMpsIO writer;
   writer.setInfinity(COIN_DBL_MAX);
   const char *const *rowNames = NULL;
   if (rowName_.numberItems())
@@ -2126,7 +2253,6 @@ int CoinModel::writeMps(const char *filename, int compression,
     // load up strings - sorted by column and row
     writer.copyStringElements(this);
   }
-  return writer.writeMps(filename, compression, formatType, numberAcross);
 }
 /* Check two models against each other.  Return nonzero if different.
    Ignore names if that set.
@@ -10,6 +10,8 @@
 #include "CoinMessageHandler.hpp"
 #include "CoinPackedMatrix.hpp"
 #include "CoinFinite.hpp"
+class CoinMpsIO;
+
 class CoinBaseModel {
 
 public:
@@ -471,6 +473,15 @@ public:
   int writeMps(const char *filename, int compression = 0,
     int formatType = 0, int numberAcross = 2, bool keepStrings = false);
 
+  /** Write the problem as a binary snapshot (see CoinMpsIO::writeBinary).
+
+      Such a file can be loaded much faster than an MPS file and the
+      constructor from a file name recognizes it.  Only the linear part
+      of the model is saved; string elements are replaced by their values.
+      not const as may change model e.g. fill in default bounds
+  */
+  int writeBinary(const char *filename);
+
   /** Check two models against each other.  Return nonzero if different.
       Ignore names if that set.
       May modify both models by cleaning up
@@ -981,7 +992,8 @@ public:
   CoinModel();
   /** Constructor with sizes. */
   CoinModel(int firstRows, int firstColumns, CoinBigIndex firstElements, bool noNames = false);
-  /** Read a problem in MPS or GAMS format from the given filename.
+  /** Read a problem in MPS or GAMS format (or as written by writeBinary)
+      from the given filename.
    */
   CoinModel(const char *fileName, int allowStrings = 0);
   /** Read a problem from AMPL nl file
@@ -1036,6 +1048,8 @@ private:
   double getDoubleFromString(CoinYacc &info, const char *string);
   /// Frees value memory
   void freeStringMemory(CoinYacc &info);
+  /// Loads model into writer for writeMps and writeBinary
+  void loadWriter(CoinMpsIO &writer, bool keepStrings);
 
 public:
   /// Fills in all associated - returning number of errors
@@ -11,11 +11,16 @@
 #include <cfloat>
 #include <string>
 #include <cstdio>
+#include <cstring>
 #include <iostream>
 
 #include "CoinHelperFunctions.hpp"
 
 #include "CoinModelUseful.hpp"
+#include "CoinNameArena.hpp"
+
+// Dead name bytes allowed before compacting is thought about
+#define COIN_MODEL_DEAD_NAMES 4096
 
 //#############################################################################
 // Constructors / Destructor / Assignment
@@ -97,6 +102,8 @@ CoinModelHash::CoinModelHash()
   , numberItems_(0)
   , maximumItems_(0)
   , lastSlot_(-1)
+  , arena_(NULL)
+  , deadBytes_(0)
 {
 }
 
@@ -109,14 +116,16 @@ CoinModelHash::CoinModelHash(const CoinModelHash &rhs)
   , numberItems_(rhs.numberItems_)
   , maximumItems_(rhs.maximumItems_)
   , lastSlot_(rhs.lastSlot_)
+  , arena_(NULL)
+  , deadBytes_(rhs.deadBytes_)
 {
   if (maximumItems_) {
-    names_ = new char *[maximumItems_];
-    for (int i = 0; i < maximumItems_; i++) {
-      names_[i] = CoinStrdup(rhs.names_[i]);
-    }
+    // names are shared not copied
+    names_ = CoinCopyOfArray(rhs.names_, maximumItems_);
     hash_ = CoinCopyOfArray(rhs.hash_, 4 * maximumItems_);
   }
+  if (rhs.arena_)
+    arena_ = rhs.arena_->share();
 }
 
 //-------------------------------------------------------------------
@@ -124,10 +133,9 @@ CoinModelHash::CoinModelHash(const CoinModelHash &rhs)
 //-------------------------------------------------------------------
 CoinModelHash::~CoinModelHash()
 {
-  for (int i = 0; i < maximumItems_; i++)
-    free(names_[i]);
   delete[] names_;
   delete[] hash_;
+  CoinNameArena::release(arena_);
 }
 
 //----------------------------------------------------------------
@@ -137,23 +145,22 @@ CoinModelHash &
 CoinModelHash::operator=(const CoinModelHash &rhs)
 {
   if (this != &rhs) {
-    for (int i = 0; i < maximumItems_; i++)
-      free(names_[i]);
     delete[] names_;
     delete[] hash_;
+    CoinNameArena::release(arena_);
     numberItems_ = rhs.numberItems_;
     maximumItems_ = rhs.maximumItems_;
     lastSlot_ = rhs.lastSlot_;
+    deadBytes_ = rhs.deadBytes_;
     if (maximumItems_) {
-      names_ = new char *[maximumItems_];
-      for (int i = 0; i < maximumItems_; i++) {
-        names_[i] = CoinStrdup(rhs.names_[i]);
-      }
+      names_ = CoinCopyOfArray(rhs.names_, maximumItems_);
       hash_ = CoinCopyOfArray(rhs.hash_, 4 * maximumItems_);
     } else {
       names_ = NULL;
       hash_ = NULL;
     }
+    if (rhs.arena_)
+      arena_ = rhs.arena_->share();
   }
   return *this;
 }
@@ -311,7 +318,9 @@ void CoinModelHash::addHash(int index, const char *name)
   if (numberItems_ >= maximumItems_)
     resize(1000 + 3 * numberItems_ / 2);
   assert(!names_[index]);
-  names_[index] = CoinStrdup(name);
+  if (!arena_)
+    arena_ = new CoinNameArena();
+  names_[index] = arena_->add(name);
   int ipos = hashValue(name);
   numberItems_ = CoinMax(numberItems_, index + 1);
   if (hash_[ipos].index < 0) {
@@ -336,9 +345,9 @@ void CoinModelHash::addHash(int index, const char *name)
               while (true) {
                 ++lastSlot_;
                 if (lastSlot_ > numberItems_) {
-                  printf("** too many names\n");
-                  abort();
-                  break;
+                  // slots used by deleted names - build hash again
+                  resize(maximumItems_, true);
+                  return;
                 }
                 if (hash_[lastSlot_].index < 0 && hash_[lastSlot_].next < 0) {
                   break;
@@ -377,9 +386,33 @@ void CoinModelHash::deleteHash(int index)
       }
     }
     assert(ipos >= 0);
-    free(names_[index]);
+    char *name = names_[index];
     names_[index] = NULL;
+    // a shared arena may still be using the space
+    if (arena_ && arena_->owns(name)
+      && (arena_->referenceCount() > 1 || !arena_->takeBack(name))) {
+      deadBytes_ += strlen(name) + 1;
+      if (deadBytes_ > COIN_MODEL_DEAD_NAMES && 2 * deadBytes_ > arena_->bytesUsed())
+        compactNames();
+    }
+  }
+}
+// Copies names to a new arena leaving dead ones behind
+void CoinModelHash::compactNames()
+{
+  CoinNameArena *arena = new CoinNameArena();
+  if (arena_->bytesUsed() > deadBytes_)
+    arena->reserve(arena_->bytesUsed() - deadBytes_);
+  for (int i = 0; i < numberItems_; i++) {
+    if (names_[i])
+      names_[i] = arena->add(names_[i]);
   }
+  // anything past the end would point into old arena
+  for (int i = numberItems_; i < maximumItems_; i++)
+    names_[i] = NULL;
+  CoinNameArena::release(arena_);
+  arena_ = arena;
+  deadBytes_ = 0;
 }
 // Returns name at position (or NULL)
 const char *
@@ -402,8 +435,23 @@ CoinModelHash::getName(int which) const
 // Sets name at position (does not create)
 void CoinModelHash::setName(int which, char *name)
 {
-  if (which < numberItems_)
+  if (which < numberItems_) {
+    if (name) {
+      if (!arena_)
+        arena_ = new CoinNameArena();
+      name = arena_->add(name);
+    }
     names_[which] = name;
+  }
+}
+// Shares arena for storing names
+void CoinModelHash::setArena(CoinNameArena *arena)
+{
+  assert(!numberItems_);
+  CoinNameArena::release(arena_);
+  deadBytes_ = 0;
+  if (arena)
+    arena_ = arena->share();
 }
 // Returns a hash value
 int CoinModelHash::hashValue(const char *name) const
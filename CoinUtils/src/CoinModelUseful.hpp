@@ -17,6 +17,8 @@
 #include "CoinTypes.hpp"
 #include "CoinPragma.hpp"
 
+class CoinNameArena;
+
 /**
    This is for various structures/classes needed by CoinModel.
 
@@ -265,20 +267,42 @@ public:
   int hash(const char *name) const;
   /// Adds to hash
   void addHash(int index, const char *name);
-  /// Deletes from hash
+  /** Deletes from hash.
+
+      The space of the name is reused at once if it was the last name
+      added (and the arena is not shared), otherwise it is counted and the
+      names are copied to a new arena once more than half are dead.
+      Hash slots left by deleted names are got back by addHash when it
+      runs out.
+  */
   void deleteHash(int index);
   /// Returns name at position (or NULL)
   const char *name(int which) const;
   /// Returns non const name at position (or NULL)
   char *getName(int which) const;
-  /// Sets name at position (does not create)
+  /** Sets name at position (does not create or rehash).
+
+      The name is copied into the arena unless it is already there, so the
+      caller keeps its own string.  The name replaced is not freed as it
+      may have been moved to another position.
+  */
   void setName(int which, char *name);
+  /** Shares arena for storing names (only before any names are added).
+      Names already in arena are then used without copying. */
+  void setArena(CoinNameArena *arena);
+  /// Arena names are stored in (NULL until first name added)
+  inline CoinNameArena *arena() const
+  {
+    return arena_;
+  }
   /// Validates
   void validateHash() const;
 
 private:
   /// Returns a hash value
   int hashValue(const char *name) const;
+  /// Copies names to a new arena leaving dead ones behind
+  void compactNames();
 
 public:
   //@}
@@ -295,6 +319,10 @@ private:
   int maximumItems_;
   /// Last slot looked at
   int lastSlot_;
+  /// Storage for names (shared with any copies)
+  CoinNameArena *arena_;
+  /// Bytes of deleted names still in arena
+  size_t deadBytes_;
   //@}
 };
 /// For int,int hashing
@@ -22,21 +22,19 @@
 #include "CoinMessage.hpp"
 #include "CoinHelperFunctions.hpp"
 #include "CoinModel.hpp"
+#include "CoinNameArena.hpp"
+#include "CoinNameHash.hpp"
 #include "CoinSort.hpp"
+#include "CoinParallel.hpp"
+#include "CoinStrtod.hpp"
+#include "CoinDtoa.hpp"
+#ifdef HAVE_SYS_STAT_H
+#include <sys/stat.h>
+#endif
 
 //#############################################################################
 // type - 0 normal, 1 INTEL IEEE, 2 other IEEE
 
-namespace {
-
-const double fraction[] = { 1.0, 1.0e-1, 1.0e-2, 1.0e-3, 1.0e-4, 1.0e-5, 1.0e-6, 1.0e-7, 1.0e-8,
-  1.0e-9, 1.0e-10, 1.0e-11, 1.0e-12, 1.0e-13, 1.0e-14, 1.0e-15, 1.0e-16,
-  1.0e-17, 1.0e-18, 1.0e-19, 1.0e-20, 1.0e-21, 1.0e-22, 1.0e-23 };
-
-const double exponent[] = { 1.0e-9, 1.0e-8, 1.0e-7, 1.0e-6, 1.0e-5, 1.0e-4, 1.0e-3, 1.0e-2, 1.0e-1,
-  1.0, 1.0e1, 1.0e2, 1.0e3, 1.0e4, 1.0e5, 1.0e6, 1.0e7, 1.0e8, 1.0e9 };
-
-} // end file-local namespace
 double CoinMpsCardReader::osi_strtod(char *ptr, char **output, int type)
 {
 
@@ -58,79 +56,16 @@ double CoinMpsCardReader::osi_strtod(char *ptr, char **output, int type)
     // more white space
     while (*ptr == ' ' || *ptr == '\t')
       ptr++;
-    char thisChar = 0;
-    while (value < 1.0e30) {
-      thisChar = *ptr;
-      ptr++;
-      if (thisChar >= '0' && thisChar <= '9')
-        value = value * 10.0 + thisChar - '0';
-      else
-        break;
-    }
-    if (value < 1.0e30) {
-      if (thisChar == '.') {
-        // do fraction
-        double value2 = 0.0;
-        int nfrac = 0;
-        while (nfrac < 24) {
-          thisChar = *ptr;
-          ptr++;
-          if (thisChar >= '0' && thisChar <= '9') {
-            value2 = value2 * 10.0 + thisChar - '0';
-            nfrac++;
-          } else {
-            break;
-          }
-        }
-        if (nfrac < 24) {
-          value += value2 * fraction[nfrac];
-        } else {
-          thisChar = 'x'; // force error
-        }
-      }
-      if (thisChar == 'e' || thisChar == 'E') {
-        // exponent
-        int sign2 = 1;
-        // do + or -
-        if (*ptr == '-') {
-          sign2 = -1;
-          ptr++;
-        } else if (*ptr == '+') {
-          ptr++;
-        }
-        int value3 = 0;
-        while (value3 < 1000) {
-          thisChar = *ptr;
-          ptr++;
-          if (thisChar >= '0' && thisChar <= '9') {
-            value3 = value3 * 10 + thisChar - '0';
-          } else {
-            break;
-          }
-        }
-        if (value3 < 300) {
-          value3 *= sign2; // power of 10
-          if (abs(value3) < 10) {
-            // do most common by lookup (for accuracy?)
-            value *= exponent[value3 + 9];
-          } else {
-            value *= pow(10.0, value3);
-          }
-        } else if (sign2 < 0.0) {
-          value = 0.0; // force zero
-        } else {
-          value = COIN_DBL_MAX;
-        }
-      }
-      if (thisChar == 0 || thisChar == '\t' || thisChar == ' ') {
-        // okay
-        *output = ptr;
-      } else {
-        value = osi_strtod(save, output);
-        sign1 = 1.0;
-      }
+    // CoinStrtod would also take sign, inf and nan - not wanted here
+    char *after = ptr;
+    if ((*ptr >= '0' && *ptr <= '9') || *ptr == '.')
+      value = CoinStrtod(ptr, &after);
+    if (after > ptr && (*after == '\0' || *after == '\t' || *after == ' ')) {
+      // okay
+      if (value > COIN_DBL_MAX)
+        value = COIN_DBL_MAX;
+      *output = after;
     } else {
-      // bad value
       value = osi_strtod(save, output);
       sign1 = 1.0;
     }
@@ -277,7 +212,24 @@ const static char *mpsTypes[] = {
 int CoinMpsCardReader::cleanCard()
 {
   char *getit;
-  getit = input_->gets(card_, MAX_CARD_LENGTH);
+  int length;
+  const char *line = input_->getsInPlace(MAX_CARD_LENGTH, length);
+  if (line) {
+    // copy straight from input - up to where loop below would stop anyway
+    int n;
+    for (n = 0; n < length; n++) {
+      char look = line[n];
+      if (look != '\t' && static_cast< unsigned char >(look) < ' ')
+        break;
+      card_[n] = look;
+    }
+    card_[n] = '\0';
+    getit = card_;
+  } else if (length < 0) {
+    getit = input_->gets(card_, MAX_CARD_LENGTH);
+  } else {
+    getit = NULL;
+  }
 
   if (getit) {
     cardNumber_++;
@@ -909,6 +861,38 @@ CoinMpsCardReader::nextField()
   }
   return section_;
 }
+// Reads rest of section as text - leaves reader on next section card
+COINSectionType
+CoinMpsCardReader::readSectionImage(std::vector< char > &image)
+{
+  image.clear();
+  while (true) {
+    if (cleanCard()) {
+      // as nextField - section not changed
+      return COIN_EOF_SECTION;
+    }
+    if (card_[0] == ' ' || card_[0] == '\0' || card_[0] == '*') {
+      // data, blank or comment
+      image.insert(image.end(), card_, card_ + strlen(card_));
+      image.push_back('\n');
+    } else {
+      // not a comment
+      int i;
+
+      handler_->message(COIN_MPS_LINE, messages_) << cardNumber_
+                                                  << card_ << CoinMessageEol;
+      for (i = COIN_ROW_SECTION; i < COIN_UNKNOWN_SECTION; i++) {
+        if (!strncmp(card_, section[i], strlen(section[i]))) {
+          break;
+        }
+      }
+      position_ = card_;
+      eol_ = card_;
+      section_ = static_cast< COINSectionType >(i);
+      return section_;
+    }
+  }
+}
 static char *
 nextNonBlank(char *image)
 {
@@ -922,6 +906,15 @@ nextNonBlank(char *image)
     image = NULL;
   return image;
 }
+namespace {
+// Value of a gms number field, -1.0e100 if not a number
+double gmsValue(const char *field)
+{
+  char *after;
+  double value = CoinStrtod(field, &after);
+  return after > field ? value : -1.0e100;
+}
+} // end file-local namespace
 /** Gets next field for .gms file and returns type.
     -1 - EOF
     0 - what we expected (and processed so pointer moves past)
@@ -1012,8 +1005,7 @@ int CoinMpsCardReader::nextGmsField(int expectedType)
             strcpy(rowName_, position_);
             next = eol_;
           }
-          value_ = -1.0e100;
-          sscanf(rowName_, "%lg", &value_);
+          value_ = gmsValue(rowName_);
           position_ = next;
         } else {
           returnCode = 1;
@@ -1063,8 +1055,7 @@ int CoinMpsCardReader::nextGmsField(int expectedType)
               assert(*next == '*');
               next++;
               rowName_[put] = '\0';
-              value_ = -1.0e100;
-              sscanf(rowName_, "%lg", &value_);
+              value_ = gmsValue(rowName_);
               position_ = next;
             } else {
               returnCode = 1;
@@ -1080,8 +1071,7 @@ int CoinMpsCardReader::nextGmsField(int expectedType)
             int length = static_cast< int >(next - position_);
             strncpy(rowName_, position_, length);
             rowName_[length] = '\0';
-            value_ = -1.0e100;
-            sscanf(rowName_, "%lg", &value_);
+            value_ = gmsValue(rowName_);
             position_ = next;
           }
         } else if ((nextChar >= 'a' && nextChar <= 'z') || (nextChar >= 'A' && nextChar <= 'Z')) {
@@ -1172,35 +1162,6 @@ int CoinMpsCardReader::nextGmsField(int expectedType)
 
 //#############################################################################
 
-namespace {
-const int mmult[] = {
-  262139, 259459, 256889, 254291, 251701, 249133, 246709, 244247,
-  241667, 239179, 236609, 233983, 231289, 228859, 226357, 223829,
-  221281, 218849, 216319, 213721, 211093, 208673, 206263, 203773,
-  201233, 198637, 196159, 193603, 191161, 188701, 186149, 183761,
-  181303, 178873, 176389, 173897, 171469, 169049, 166471, 163871,
-  161387, 158941, 156437, 153949, 151531, 149159, 146749, 144299,
-  141709, 139369, 136889, 134591, 132169, 129641, 127343, 124853,
-  122477, 120163, 117757, 115361, 112979, 110567, 108179, 105727,
-  103387, 101021, 98639, 96179, 93911, 91583, 89317, 86939, 84521,
-  82183, 79939, 77587, 75307, 72959, 70793, 68447, 66103
-};
-
-int hash(const char *name, int maxsiz, int length)
-{
-
-  int n = 0;
-  int j;
-
-  for (j = 0; j < length; ++j) {
-    int iname = name[j];
-
-    n += mmult[j % (sizeof(mmult)/sizeof(int)) ] * iname;
-  }
-  return (abs(n) % maxsiz); /* integer abs */
-}
-} // end file-local namespace
-
 // Define below if you are reading a Cnnnnnn file
 // Will not do row names (for electricfence)
 //#define NONAMES
@@ -1216,82 +1177,14 @@ void CoinMpsIO::startHash(int section) const
 {
   char **names = names_[section];
   COINColumnIndex number = numberHash_[section];
-  COINColumnIndex i;
-  COINColumnIndex maxhash = 4 * number;
-  COINColumnIndex ipos, iput;
-
-  //hash_=(CoinHashLink *) malloc(maxhash*sizeof(CoinHashLink));
-  hash_[section] = new CoinHashLink[maxhash];
-
-  CoinHashLink *hashThis = hash_[section];
-
-  for (i = 0; i < maxhash; i++) {
-    hashThis[i].index = -1;
-    hashThis[i].next = -1;
-  }
-
-  /*
-   * Initialize the hash table.  Only the index of the first name that
-   * hashes to a value is entered in the table; subsequent names that
-   * collide with it are not entered.
-   */
-  for (i = 0; i < number; ++i) {
-    char *thisName = names[i];
-    int length = static_cast< int >(strlen(thisName));
 
-    ipos = hash(thisName, maxhash, length);
-    if (hashThis[ipos].index == -1) {
-      hashThis[ipos].index = i;
-    }
-  }
-
-  /*
-   * Now take care of the names that collided in the preceding loop,
-   * by finding some other entry in the table for them.
-   * Since there are as many entries in the table as there are names,
-   * there must be room for them.
-   */
-  iput = -1;
-  for (i = 0; i < number; ++i) {
-    char *thisName = names[i];
-    int length = static_cast< int >(strlen(thisName));
-
-    ipos = hash(thisName, maxhash, length);
-
-    while (1) {
-      COINColumnIndex j1 = hashThis[ipos].index;
-
-      if (j1 == i)
-        break;
-      else {
-        char *thisName2 = names[j1];
-
-        if (strcmp(thisName, thisName2) == 0) {
-          printf("** duplicate name %s\n", names[i]);
-          break;
-        } else {
-          COINColumnIndex k = hashThis[ipos].next;
-
-          if (k == -1) {
-            while (1) {
-              ++iput;
-              if (iput > number) {
-                printf("** too many names\n");
-                break;
-              }
-              if (hashThis[iput].index == -1) {
-                break;
-              }
-            }
-            hashThis[ipos].next = iput;
-            hashThis[iput].index = i;
-            break;
-          } else {
-            ipos = k;
-            /* nothing worked - try it again */
-          }
-        }
-      }
+  delete hash_[section];
+  hash_[section] = new CoinNameHash();
+  // Only the first of any duplicate names is entered
+  if (hash_[section]->build(names, number)) {
+    for (COINColumnIndex i = 0; i < number; ++i) {
+      if (hash_[section]->find(names[i]) != i)
+        printf("** duplicate name %s\n", names[i]);
     }
   }
 }
@@ -1299,7 +1192,7 @@ void CoinMpsIO::startHash(int section) const
 //  stopHash.  Deletes hash storage
 void CoinMpsIO::stopHash(int section)
 {
-  delete[] hash_[section];
+  delete hash_[section];
   hash_[section] = NULL;
 }
 
@@ -1307,42 +1200,10 @@ void CoinMpsIO::stopHash(int section)
 COINColumnIndex
 CoinMpsIO::findHash(const char *name, int section) const
 {
-  COINColumnIndex found = -1;
-
-  char **names = names_[section];
-  CoinHashLink *hashThis = hash_[section];
-  COINColumnIndex maxhash = 4 * numberHash_[section];
-  COINColumnIndex ipos;
-
   /* default if we don't find anything */
-  if (!maxhash)
+  if (!hash_[section])
     return -1;
-  int length = static_cast< int >(strlen(name));
-
-  ipos = hash(name, maxhash, length);
-  while (1) {
-    COINColumnIndex j1 = hashThis[ipos].index;
-
-    if (j1 >= 0) {
-      char *thisName2 = names[j1];
-
-      if (strcmp(name, thisName2) != 0) {
-        COINColumnIndex k = hashThis[ipos].next;
-
-        if (k != -1)
-          ipos = k;
-        else
-          break;
-      } else {
-        found = j1;
-        break;
-      }
-    } else {
-      found = -1;
-      break;
-    }
-  }
-  return found;
+  return hash_[section]->find(name);
 }
 #else
 // Version when we know images are C/Rnnnnnn
@@ -1561,6 +1422,316 @@ int CoinMpsIO::readMps()
   delete[] sets;
   return returnCode;
 }
+//#############################################################################
+// Support for decoding the COLUMNS section in parallel
+
+namespace {
+
+// Hands out lines held in memory as if they were a file
+class CoinMpsMemoryInput : public CoinFileInput {
+public:
+  CoinMpsMemoryInput(const char *start, const char *end)
+    : CoinFileInput("")
+    , position_(start)
+    , end_(end)
+  {
+    readType_ = "memory";
+  }
+  virtual ~CoinMpsMemoryInput() {}
+
+  virtual int read(void *buffer, int size)
+  {
+    int n = static_cast< int >(end_ - position_);
+    if (n > size)
+      n = size;
+    memcpy(buffer, position_, n);
+    position_ += n;
+    return n;
+  }
+
+  // As fgets but the newline is not kept (cards are cleaned anyway)
+  virtual char *gets(char *buffer, int size)
+  {
+    int length;
+    const char *line = getsInPlace(size, length);
+    if (!line)
+      return NULL;
+    memcpy(buffer, line, length);
+    buffer[length] = '\0';
+    return buffer;
+  }
+
+  // Lines are complete cards so newline is always skipped
+  virtual const char *getsInPlace(int size, int &length)
+  {
+    length = 0;
+    if (position_ == end_ || size <= 1)
+      return NULL;
+    const char *line = position_;
+    const char *last = line + size - 1;
+    while (position_ != end_ && position_ != last && *position_ != '\n')
+      position_++;
+    length = static_cast< int >(position_ - line);
+    if (position_ != end_ && *position_ == '\n')
+      position_++;
+    return line;
+  }
+
+private:
+  const char *position_;
+  const char *end_;
+};
+
+// Card reader positioned in COLUMNS section of part of a file
+class CoinMpsChunkReader : public CoinMpsCardReader {
+public:
+  CoinMpsChunkReader(CoinFileInput *input, CoinMpsIO *reader,
+    bool freeFormat, int ieeeFormat, bool eightChar)
+    : CoinMpsCardReader(input, reader)
+  {
+    section_ = COIN_COLUMN_SECTION;
+    freeFormat_ = freeFormat;
+    ieeeFormat_ = ieeeFormat;
+    eightChar_ = eightChar;
+  }
+};
+
+// One field as returned by nextField
+typedef struct {
+  double value;
+  // card number within chunk
+  CoinBigIndex card;
+  // row index, -2 if not looked up, <= -3 if not found (name at -3-row)
+  int row;
+  // offset of column name (-1 if none)
+  int name;
+  COINMpsType mpsType;
+} CoinMpsField;
+
+// A line-aligned piece of COLUMNS section
+typedef struct {
+  const char *start;
+  const char *end;
+  // Whether all names so far fitted in 8 characters at start and end
+  bool eightCharIn;
+  bool eightCharOut;
+  CoinBigIndex firstCard;
+  CoinBigIndex numberCards;
+  std::vector< CoinMpsField > fields;
+  std::vector< char > names;
+} CoinMpsColumnChunk;
+
+// Passed to CoinMpsIO::readColumnsChunk
+typedef struct {
+  CoinMpsIO *model;
+  CoinMpsColumnChunk *chunks;
+  int firstChunk;
+  bool freeFormat;
+  int ieeeFormat;
+} CoinMpsColumnWork;
+
+int addName(std::vector< char > &names, const char *name)
+{
+  int offset = static_cast< int >(names.size());
+  names.insert(names.end(), name, name + strlen(name) + 1);
+  return offset;
+}
+
+/* Gives the fields of a COLUMNS section in order.  Normally this just
+   passes on what the card reader finds but after decode the fields come
+   from chunks decoded (possibly in parallel) in advance.
+*/
+class CoinMpsColumnCards {
+public:
+  CoinMpsColumnCards(CoinMpsCardReader *reader)
+    : reader_(reader)
+    , rowNames_(NULL)
+    , decoded_(false)
+    , endSection_(COIN_EOF_SECTION)
+    , chunk_(0)
+    , field_(-1)
+    , current_(NULL)
+  {
+  }
+
+  // Reads rest of section and decodes it
+  void decode(CoinMpsIO *model, char **rowNames, int numberThreads,
+    CoinParallelTask task);
+
+  COINSectionType nextField()
+  {
+    if (!decoded_)
+      return reader_->nextField();
+    int numberChunks = static_cast< int >(chunks_.size());
+    field_++;
+    while (chunk_ < numberChunks && field_ == static_cast< int >(chunks_[chunk_].fields.size())) {
+      chunk_++;
+      field_ = 0;
+    }
+    if (chunk_ == numberChunks)
+      return endSection_;
+    current_ = &chunks_[chunk_].fields[field_];
+    return COIN_COLUMN_SECTION;
+  }
+  inline COINMpsType mpsType() const
+  {
+    return decoded_ ? current_->mpsType : reader_->mpsType();
+  }
+  inline double value() const
+  {
+    return decoded_ ? current_->value : reader_->value();
+  }
+  inline const char *valueString() const
+  {
+    return reader_->valueString();
+  }
+  inline const char *columnName() const
+  {
+    if (!decoded_)
+      return reader_->columnName();
+    return current_->name >= 0 ? &chunks_[chunk_].names[current_->name] : "";
+  }
+  inline const char *rowName() const
+  {
+    if (!decoded_ || current_->row == -2)
+      return reader_->rowName();
+    else if (current_->row < 0)
+      return &chunks_[chunk_].names[-3 - current_->row];
+    else
+      return rowNames_[current_->row];
+  }
+  // Row index if already known, -2 if it still has to be looked up
+  inline int row() const
+  {
+    return decoded_ ? current_->row : -2;
+  }
+  inline CoinBigIndex cardNumber() const
+  {
+    return decoded_ ? chunks_[chunk_].firstCard + current_->card : reader_->cardNumber();
+  }
+  // Only used for messages so can be slow
+  const char *card()
+  {
+    if (!decoded_)
+      return reader_->card();
+    const CoinMpsColumnChunk &chunk = chunks_[chunk_];
+    const char *line = chunk.start;
+    for (CoinBigIndex i = 1; i < current_->card; i++)
+      line = strchr(line, '\n') + 1;
+    card_.assign(line, strchr(line, '\n') - line);
+    return card_.c_str();
+  }
+
+private:
+  CoinMpsCardReader *reader_;
+  char **rowNames_;
+  bool decoded_;
+  COINSectionType endSection_;
+  std::vector< char > image_;
+  std::vector< CoinMpsColumnChunk > chunks_;
+  int chunk_;
+  int field_;
+  const CoinMpsField *current_;
+  std::string card_;
+};
+
+void CoinMpsColumnCards::decode(CoinMpsIO *model, char **rowNames,
+  int numberThreads, CoinParallelTask task)
+{
+  rowNames_ = rowNames;
+  CoinBigIndex firstCard = reader_->cardNumber();
+  bool eightChar = reader_->eightChar();
+  endSection_ = reader_->readSectionImage(image_);
+  // a few chunks per thread so that threads finishing early can help
+  size_t size = image_.size();
+  size_t chunkSize = size / (4 * numberThreads) + 1;
+  size_t start = 0;
+  while (start < size) {
+    size_t end = CoinMin(start + chunkSize, size);
+    while (image_[end - 1] != '\n')
+      end++;
+    CoinMpsColumnChunk chunk;
+    chunk.start = &image_[0] + start;
+    chunk.end = &image_[0] + end;
+    chunk.eightCharIn = eightChar;
+    chunk.eightCharOut = eightChar;
+    chunk.firstCard = 0;
+    chunk.numberCards = 0;
+    chunks_.push_back(chunk);
+    start = end;
+  }
+  int numberChunks = static_cast< int >(chunks_.size());
+  if (numberChunks) {
+    CoinMpsColumnWork work;
+    work.model = model;
+    work.chunks = &chunks_[0];
+    work.firstChunk = 0;
+    work.freeFormat = reader_->freeFormat();
+    work.ieeeFormat = reader_->ieeeFormat();
+    CoinParallelRun(numberChunks, numberThreads, task, &work);
+    /* A long name switches off embedded blanks for the rest of the file.
+       All chunks after the first one where that happened have to be
+       done again (as it can never be switched back on they can all be
+       done together).
+    */
+    int iChunk;
+    for (iChunk = 0; iChunk < numberChunks; iChunk++) {
+      if (!chunks_[iChunk].eightCharOut)
+        break;
+    }
+    if (iChunk < numberChunks - 1 && chunks_[iChunk + 1].eightCharIn) {
+      for (int jChunk = iChunk + 1; jChunk < numberChunks; jChunk++)
+        chunks_[jChunk].eightCharIn = false;
+      work.firstChunk = iChunk + 1;
+      CoinParallelRun(numberChunks - iChunk - 1, numberThreads, task, &work);
+    }
+    reader_->setEightChar(chunks_[numberChunks - 1].eightCharOut);
+  }
+  for (int iChunk = 0; iChunk < numberChunks; iChunk++) {
+    chunks_[iChunk].firstCard = firstCard;
+    firstCard += chunks_[iChunk].numberCards;
+  }
+  decoded_ = true;
+}
+} // end file-local namespace
+
+// Decodes one chunk of a COLUMNS section
+void CoinMpsIO::readColumnsChunk(void *info, int whichChunk)
+{
+  CoinMpsColumnWork *work = static_cast< CoinMpsColumnWork * >(info);
+  CoinMpsColumnChunk &chunk = work->chunks[work->firstChunk + whichChunk];
+  CoinMpsIO *model = work->model;
+  CoinMpsChunkReader reader(new CoinMpsMemoryInput(chunk.start, chunk.end),
+    model, work->freeFormat, work->ieeeFormat, chunk.eightCharIn);
+  chunk.fields.clear();
+  chunk.names.clear();
+  int lastName = -1;
+  while (reader.nextField() == COIN_COLUMN_SECTION) {
+    CoinMpsField field;
+    field.value = reader.value();
+    field.card = reader.cardNumber();
+    field.row = -2;
+    field.name = lastName;
+    field.mpsType = reader.mpsType();
+    if (field.mpsType == COIN_BLANK_COLUMN) {
+      const char *name = reader.columnName();
+      if (lastName < 0 || strcmp(&chunk.names[lastName], name)) {
+        lastName = addName(chunk.names, name);
+        field.name = lastName;
+      }
+      // look up row where serial code would
+      if (fabs(field.value) > model->smallElement_ || field.value == STRING_VALUE) {
+        field.row = model->findHash(reader.rowName(), 0);
+        if (field.row < 0)
+          field.row = -3 - addName(chunk.names, reader.rowName());
+      }
+    }
+    chunk.fields.push_back(field);
+  }
+  chunk.numberCards = reader.cardNumber();
+  chunk.eightCharOut = reader.eightChar();
+}
+
 int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
 {
   bool ifmps;
@@ -1648,6 +1819,7 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
 
       reinterpret_cast< COINMpsType * >(malloc(maxRows * sizeof(COINMpsType)));
     char **rowName = reinterpret_cast< char ** >(malloc(maxRows * sizeof(char *)));
+    CoinNameArena *rowArena = newNameArena(0);
 
     // for discarded free rows
     COINRowIndex maxFreeRows = 100;
@@ -1670,7 +1842,7 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
             freeRowName = reinterpret_cast< char ** >(realloc(freeRowName,
               maxFreeRows * sizeof(char *)));
           }
-          freeRowName[numberOtherFreeRows] = CoinStrdup(cardReader_->columnName());
+          freeRowName[numberOtherFreeRows] = rowArena->add(cardReader_->columnName());
           numberOtherFreeRows++;
         }
         break;
@@ -1687,7 +1859,7 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
         }
         rowType[numberRows_] = cardReader_->mpsType();
 #ifndef NONAMES
-        rowName[numberRows_] = CoinStrdup(cardReader_->columnName());
+        rowName[numberRows_] = rowArena->add(cardReader_->columnName());
 #endif
         numberRows_++;
         break;
@@ -1723,7 +1895,7 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
         numberOtherFreeRows)
         * sizeof(char *)));
 #ifndef NONAMES
-    rowName[numberRows_] = CoinStrdup(objectiveName_);
+    rowName[numberRows_] = rowArena->add(objectiveName_);
     memcpy(rowName + numberRows_ + 1, freeRowName,
       numberOtherFreeRows * sizeof(char *));
     // now we can get rid of this array
@@ -1737,6 +1909,7 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
     CoinBigIndex maxElements = 5000 + numberRows_ / 2;
     COINMpsType *columnType = reinterpret_cast< COINMpsType * >(malloc(maxColumns * sizeof(COINMpsType)));
     char **columnName = reinterpret_cast< char ** >(malloc(maxColumns * sizeof(char *)));
+    CoinNameArena *columnArena = newNameArena(1);
 
     objective_ = reinterpret_cast< double * >(malloc(maxColumns * sizeof(double)));
     start = reinterpret_cast< CoinBigIndex * >(malloc((maxColumns + 1) * sizeof(CoinBigIndex)));
@@ -1758,10 +1931,14 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
     bool inIntegerSet = false;
     COINColumnIndex numberIntegers = 0;
 
-    while (cardReader_->nextField() == COIN_COLUMN_SECTION) {
-      switch (cardReader_->mpsType()) {
+    // fields may be decoded in advance - see setNumberThreads
+    CoinMpsColumnCards cards(cardReader_);
+    if (numberThreads_ > 1 && !allowStringElements_)
+      cards.decode(this, rowName, numberThreads_, readColumnsChunk);
+    while (cards.nextField() == COIN_COLUMN_SECTION) {
+      switch (cards.mpsType()) {
       case COIN_BLANK_COLUMN:
-        if (strcmp(lastColumn, cardReader_->columnName())) {
+        if (strcmp(lastColumn, cards.columnName())) {
           // new column
 
           // reset old column and take out tiny
@@ -1798,26 +1975,28 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
             numberIntegers++;
           }
 #ifndef NONAMES
-          columnName[column] = CoinStrdup(cardReader_->columnName());
+          columnName[column] = columnArena->add(cards.columnName());
 #else
           columnName[column] = NULL;
 #endif
-          strcpy(lastColumn, cardReader_->columnName());
+          strcpy(lastColumn, cards.columnName());
           objective_[column] = 0.0;
           start[column] = numberElements_;
           numberColumns_++;
         }
-        if (fabs(cardReader_->value()) > smallElement_) {
+        if (fabs(cards.value()) > smallElement_) {
           if (numberElements_ == maxElements) {
             maxElements = (3 * maxElements) / 2 + 1000;
             row = reinterpret_cast< COINRowIndex * >(realloc(row, maxElements * sizeof(COINRowIndex)));
             element = reinterpret_cast< double * >(realloc(element, maxElements * sizeof(double)));
           }
           // get row number
-          COINRowIndex irow = findHash(cardReader_->rowName(), 0);
+          COINRowIndex irow = cards.row();
+          if (irow == -2)
+            irow = findHash(cards.rowName(), 0);
 
           if (irow >= 0) {
-            double value = cardReader_->value();
+            double value = cards.value();
 
             // check for duplicates
             if (irow == numberRows_) {
@@ -1826,7 +2005,7 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
                 numberErrors++;
                 if (numberErrors < 100) {
                   handler_->message(COIN_MPS_DUPOBJ, messages_)
-                    << cardReader_->cardNumber() << cardReader_->card()
+                    << cards.cardNumber() << cards.card()
                     << CoinMessageEol;
                 } else if (numberErrors > 100000) {
                   handler_->message(COIN_MPS_RETURNING, messages_)
@@ -1847,8 +2026,8 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
                 numberErrors++;
                 if (numberErrors < 100) {
                   handler_->message(COIN_MPS_DUPROW, messages_)
-                    << cardReader_->rowName() << cardReader_->cardNumber()
-                    << cardReader_->card()
+                    << cards.rowName() << cards.cardNumber()
+                    << cards.card()
                     << CoinMessageEol;
                 } else if (numberErrors > 100000) {
                   handler_->message(COIN_MPS_RETURNING, messages_)
@@ -1866,19 +2045,21 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
             numberErrors++;
             if (numberErrors < 100) {
               handler_->message(COIN_MPS_NOMATCHROW, messages_)
-                << cardReader_->rowName() << cardReader_->cardNumber() << cardReader_->card()
+                << cards.rowName() << cards.cardNumber() << cards.card()
                 << CoinMessageEol;
             } else if (numberErrors > 100000) {
               handler_->message(COIN_MPS_RETURNING, messages_) << CoinMessageEol;
               return numberErrors;
             }
           }
-        } else if (cardReader_->value() == STRING_VALUE) {
+        } else if (cards.value() == STRING_VALUE) {
           // tiny element - string
-          const char *s = cardReader_->valueString();
+          const char *s = cards.valueString();
           assert(*s == '=');
           // get row number
-          COINRowIndex irow = findHash(cardReader_->rowName(), 0);
+          COINRowIndex irow = cards.row();
+          if (irow == -2)
+            irow = findHash(cards.rowName(), 0);
 
           if (irow >= 0) {
             addString(irow, column, s + 1);
@@ -1886,7 +2067,7 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
             numberErrors++;
             if (numberErrors < 100) {
               handler_->message(COIN_MPS_NOMATCHROW, messages_)
-                << cardReader_->rowName() << cardReader_->cardNumber() << cardReader_->card()
+                << cards.rowName() << cards.cardNumber() << cards.card()
                 << CoinMessageEol;
             } else if (numberErrors > 100000) {
               handler_->message(COIN_MPS_RETURNING, messages_) << CoinMessageEol;
@@ -1911,8 +2092,8 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
       default:
         numberErrors++;
         if (numberErrors < 100) {
-          handler_->message(COIN_MPS_BADIMAGE, messages_) << cardReader_->cardNumber()
-                                                          << cardReader_->card()
+          handler_->message(COIN_MPS_BADIMAGE, messages_) << cards.cardNumber()
+                                                          << cards.card()
                                                           << CoinMessageEol;
         } else if (numberErrors > 100000) {
           handler_->message(COIN_MPS_RETURNING, messages_) << CoinMessageEol;
@@ -2589,7 +2770,7 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
           //integerType_[icolumn]=2;
           double value = cardReader_->value();
           if (value == -1.0e100)
-            value = atof(cardReader_->rowName()); // try from row name
+            value = CoinStrtod(cardReader_->rowName(), NULL); // try from row name
           which[numberInSet] = icolumn;
           weights[numberInSet++] = value;
         } else {
@@ -2832,6 +3013,7 @@ int CoinMpsIO::readGMPL(const char *modelName, const char *dataName,
   int *ind = new int[numberColumns_];
   char **names = NULL;
   if (keepNames) {
+    newNameArena(0);
     names = reinterpret_cast< char ** >(malloc(numberRows_ * sizeof(char *)));
     names_[0] = names;
     numberHash_[0] = numberRows_;
@@ -2867,7 +3049,7 @@ int CoinMpsIO::readGMPL(const char *modelName, const char *dataName,
     if (keepNames) {
       strcpy(name, glp_get_row_name(cbc_glp_prob, iRow + 1));
       // could look at name?
-      names[kRow] = CoinStrdup(name);
+      names[kRow] = nameArena_[0]->add(name);
     }
     kRow++;
     start[kRow] = numberElements_;
@@ -2901,6 +3083,7 @@ int CoinMpsIO::readGMPL(const char *modelName, const char *dataName,
   colupper_ = reinterpret_cast< double * >(malloc(numberColumns_ * sizeof(double)));
   integerType_ = reinterpret_cast< char * >(malloc(numberColumns_ * sizeof(char)));
   if (keepNames) {
+    newNameArena(1);
     names = reinterpret_cast< char ** >(malloc(numberColumns_ * sizeof(char *)));
     names_[1] = names;
     numberHash_[1] = numberColumns_;
@@ -2946,7 +3129,7 @@ int CoinMpsIO::readGMPL(const char *modelName, const char *dataName,
     if (keepNames) {
       strcpy(name, glp_get_col_name(cbc_glp_prob, iColumn + 1));
       // could look at name?
-      names[iColumn] = CoinStrdup(name);
+      names[iColumn] = nameArena_[1]->add(name);
     }
   }
   // leave in case report needed
@@ -3116,8 +3299,10 @@ int CoinMpsIO::readGms(int & /*numberSets*/, CoinSet **& /*sets*/)
   double *element = reinterpret_cast< double * >(malloc(numberElements_ * sizeof(double)));
   COINMpsType *rowType = reinterpret_cast< COINMpsType * >(malloc(numberRows_ * sizeof(COINMpsType)));
   char **rowName = reinterpret_cast< char ** >(malloc(numberRows_ * sizeof(char *)));
+  CoinNameArena *rowArena = newNameArena(0);
   COINMpsType *columnType = reinterpret_cast< COINMpsType * >(malloc(numberColumns_ * sizeof(COINMpsType)));
   char **columnName = reinterpret_cast< char ** >(malloc(numberColumns_ * sizeof(char *)));
+  CoinNameArena *columnArena = newNameArena(1);
 
   start[0] = 0;
   numberElements_ = 0;
@@ -3143,7 +3328,7 @@ int CoinMpsIO::readGms(int & /*numberSets*/, CoinSet **& /*sets*/)
     }
     assert(*next == ',' || *next == ';');
     cardReader_->setPosition(next + 1);
-    columnName[i] = CoinStrdup(cardReader_->columnName());
+    columnName[i] = columnArena->add(cardReader_->columnName());
     // Default is free?
     collower_[i] = -COIN_DBL_MAX;
     // Surely not - check
@@ -3227,7 +3412,7 @@ int CoinMpsIO::readGms(int & /*numberSets*/, CoinSet **& /*sets*/)
     }
     assert(*next == ',' || *next == ';');
     cardReader_->setPosition(next + 1);
-    rowName[i] = CoinStrdup(cardReader_->columnName());
+    rowName[i] = rowArena->add(cardReader_->columnName());
     // Default is free?
     rowlower_[i] = -COIN_DBL_MAX;
     rowupper_[i] = COIN_DBL_MAX;
@@ -3342,7 +3527,7 @@ int CoinMpsIO::readGms(int & /*numberSets*/, CoinSet **& /*sets*/)
         // bound
         char *next = strchr(dot + 1, '=');
         assert(next);
-        double value = atof(next + 1);
+        double value = CoinStrtod(next + 1, NULL);
         if (!strncmp(dot + 1, "fx", 2)) {
           collower_[iColumn] = value;
           colupper_[iColumn] = value;
@@ -3366,7 +3551,7 @@ int CoinMpsIO::readGms(int & /*numberSets*/, CoinSet **& /*sets*/)
         // bound
         next = strchr(dot + 1, '=');
         assert(next);
-        double value = atof(next + 1);
+        double value = CoinStrtod(next + 1, NULL);
         if (!strncmp(dot + 1, "fx", 2)) {
           collower_[iColumn] = value;
           abort();
@@ -3391,7 +3576,6 @@ int CoinMpsIO::readGms(int & /*numberSets*/, CoinSet **& /*sets*/)
   } else {
     // move column stuff
     COINColumnIndex iColumn;
-    free(names_[1][iObjCol]);
     for (iColumn = iObjCol + 1; iColumn < numberColumns_; iColumn++) {
       integerType_[iColumn - 1] = integerType_[iColumn];
       collower_[iColumn - 1] = collower_[iColumn];
@@ -3429,7 +3613,6 @@ int CoinMpsIO::readGms(int & /*numberSets*/, CoinSet **& /*sets*/)
         start[kRow + 1] = nel;
         kRow++;
       } else {
-        free(names_[0][iRow]);
         iObjRow = iRow;
         for (j = last; j < start[iRow + 1]; j++) {
           int iColumn = column[j];
@@ -3672,8 +3855,8 @@ int CoinMpsIO::readBasis(const char *filename, const char *extension,
     free(names_[1]);
     names_[1] = NULL;
     numberHash_[1] = 0;
-    delete[] hash_[0];
-    delete[] hash_[1];
+    delete hash_[0];
+    delete hash_[1];
     hash_[0] = 0;
     hash_[1] = 0;
   }
@@ -3743,7 +3926,11 @@ void CoinConvertDouble(int section, int formatType, double value, char outputVal
 {
   if (formatType == 0) {
     bool stripZeros = true;
-    if (fabs(value) < 1.0e40) {
+    char shortest[32];
+    if (fabs(value) >= 1.0e-20 && fabs(value) < 1.0e40 && CoinDtoa(value, shortest) <= 12) {
+      // shortest exact form fits in field
+      strcpy(outputValue, shortest);
+    } else if (fabs(value) < 1.0e40) {
       int power10, decimal;
       if (value >= 0.0) {
         power10 = static_cast< int >(log10(value));
@@ -3838,7 +4025,11 @@ void CoinConvertDouble(int section, int formatType, double value, char outputVal
       outputValue[i] = ' ';
     outputValue[12] = '\0';
   } else if (formatType == 1) {
-    if (fabs(value) < 1.0e40) {
+    char shortest[32];
+    if (fabs(value) < 1.0e40 && CoinDtoa(value, shortest) < 24) {
+      strcpy(outputValue, shortest);
+    } else if (fabs(value) < 1.0e40) {
+      // would not fit - rare enough
       memset(outputValue, ' ', 24);
       sprintf(outputValue, "%.16g", value);
       // take out blanks
@@ -3910,23 +4101,62 @@ void CoinConvertDouble(int section, int formatType, double value, char outputVal
     }
   }
 }
+namespace {
+/* Collects cards so CoinFileOutput is called with large blocks.  In the
+   COLUMNS section writeMps asks for a flush after each column, so whole
+   columns go out together unless a column is very long.
+*/
+class CoinMpsOutputBuffer {
+public:
+  CoinMpsOutputBuffer(CoinFileOutput *output)
+    : output_(output)
+  {
+    buffer_.reserve(4 * flushSize_);
+  }
+  /// Text is added here
+  inline std::string &buffer()
+  {
+    return buffer_;
+  }
+  /** Writes out if buffer is getting full - if not at a good place
+      (e.g. in middle of a column) allow it to get fuller */
+  inline void flushIfFull(bool goodPlace = true)
+  {
+    if (buffer_.size() >= (goodPlace ? flushSize_ : 4 * flushSize_))
+      flush();
+  }
+  /// Writes out everything
+  void flush()
+  {
+    if (output_ && buffer_.size())
+      output_->write(buffer_.data(), static_cast< int >(buffer_.size()));
+    buffer_.clear();
+  }
+
+private:
+  static const size_t flushSize_ = 65536;
+  CoinFileOutput *output_;
+  std::string buffer_;
+};
+} // end file-local namespace
+
 static void
-writeString(CoinFileOutput *output, const char *str)
+writeString(CoinMpsOutputBuffer *output, const char *str)
 {
-  if (output != 0) {
-    output->puts(str);
-  }
+  output->buffer() += str;
+  output->flushIfFull();
 }
 
 // Put out card image
 static void outputCard(int formatType, int numberFields,
-  CoinFileOutput *output,
-  std::string head, const char *name,
+  CoinMpsOutputBuffer *output,
+  const std::string &head, const char *name,
   const char outputValue[2][24],
   const char outputRow[2][100])
 {
   // fprintf(fp,"%s",head.c_str());
-  std::string line = head;
+  std::string &line = output->buffer();
+  line += head;
   int i;
   if (formatType == 0 || (formatType >= 2 && formatType < 8)) {
     char outputColumn[9];
@@ -3965,10 +4195,10 @@ static void outputCard(int formatType, int numberFields,
 
   // fprintf(fp,"\n");
   line += "\n";
-  writeString(output, line.c_str());
+  output->flushIfFull(false);
 }
 static int
-makeUniqueNames(char **names, int number, char first)
+makeUniqueNames(char **names, int number, char first, CoinNameArena *arena)
 {
   int largest = -1;
   int i;
@@ -4018,10 +4248,9 @@ makeUniqueNames(char **names, int number, char first)
           } else {
             // duplicate
             nDup++;
-            free(names[i]);
             char newName[12];
             sprintf(newName, "%c%7.7d", first, largest);
-            names[i] = CoinStrdup(newName);
+            names[i] = arena->add(newName);
             largest++;
           }
         }
@@ -4040,10 +4269,452 @@ strcpyeq(char *output, const char *input)
   strcpy(output + 1, input);
 }
 
+//#############################################################################
+// Binary snapshot of linear part of model
+
+namespace {
+
+const char binaryMagic[8] = { 'C', 'O', 'I', 'N', 'M', 'P', 'S', 'B' };
+const int binaryVersion = 1;
+
+/* Start of a binary file.  Then come (each padded to a multiple of 8
+   bytes so all arrays are aligned if the file is mapped into memory)
+     column starts     CoinBigIndex[numberColumns+1]
+     row indices       int[numberElements]
+     elements          double[numberElements]
+     column lower, column upper and objective   double[numberColumns]
+     row lower and row upper                     double[numberRows]
+     integer markers   char[numberColumns] (only if flags&1)
+     row names, column names and then problem, objective, rhs, range
+     and bound names - each name followed by '\0'
+*/
+typedef struct {
+  char magic[8];
+  int version;
+  // 0x01020304 as written so byte order can be checked
+  int byteOrder;
+  int sizeBigIndex;
+  // 1 integer markers
+  int flags;
+  CoinInt64 numberRows;
+  CoinInt64 numberColumns;
+  CoinInt64 numberElements;
+  CoinInt64 lengthRowNames;
+  CoinInt64 lengthColumnNames;
+  CoinInt64 lengthOtherNames;
+  double infinity;
+  double objectiveOffset;
+} CoinMpsBinaryHeader;
+
+// Writes in pieces so sizes fit in an int and then pads
+bool writeBinaryArray(CoinFileOutput *output, const void *array, size_t size)
+{
+  const char *put = static_cast< const char * >(array);
+  size_t left = size;
+  while (left) {
+    int n = static_cast< int >(CoinMin(left, static_cast< size_t >(1 << 30)));
+    if (output->write(put, n) != n)
+      return false;
+    put += n;
+    left -= n;
+  }
+  const char zero[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+  int pad = static_cast< int >((8 - size % 8) % 8);
+  return !pad || output->write(zero, pad) == pad;
+}
+
+bool readBinaryArray(CoinFileInput *input, void *array, size_t size)
+{
+  char *get = static_cast< char * >(array);
+  size_t left = size;
+  while (left) {
+    int n = static_cast< int >(CoinMin(left, static_cast< size_t >(1 << 30)));
+    if (input->read(get, n) != n)
+      return false;
+    get += n;
+    left -= n;
+  }
+  char padding[8];
+  int pad = static_cast< int >((8 - size % 8) % 8);
+  return !pad || input->read(padding, pad) == pad;
+}
+
+// Size of array in file including padding
+CoinInt64 binaryArraySize(CoinInt64 size)
+{
+  return size + (8 - size % 8) % 8;
+}
+
+// Size of file in bytes or -1 if not known
+CoinInt64 binaryFileSize(const char *filename)
+{
+#ifdef HAVE_SYS_STAT_H
+  struct stat info;
+  if (stat(filename, &info))
+    return -1;
+  return static_cast< CoinInt64 >(info.st_size);
+#else
+  FILE *fp = fopen(filename, "rb");
+  if (!fp)
+    return -1;
+  CoinInt64 size = -1;
+  if (!fseek(fp, 0, SEEK_END))
+    size = static_cast< CoinInt64 >(ftell(fp));
+  fclose(fp);
+  return size;
+#endif
+}
+
+/* Whether the file is exactly as long as header says - checked before
+   anything is allocated so a damaged header can not ask for huge arrays */
+bool binaryFileFits(const CoinMpsBinaryHeader &header, CoinInt64 fileSize)
+{
+  // each count must fit in file before multiplying
+  if (fileSize < 0 || header.numberElements > fileSize
+    || header.lengthRowNames > fileSize || header.lengthColumnNames > fileSize
+    || header.lengthOtherNames > fileSize)
+    return false;
+  CoinInt64 size = binaryArraySize(sizeof(CoinMpsBinaryHeader));
+  size += binaryArraySize((header.numberColumns + 1) * sizeof(CoinBigIndex));
+  size += binaryArraySize(header.numberElements * sizeof(int));
+  size += binaryArraySize(header.numberElements * sizeof(double));
+  size += 3 * binaryArraySize(header.numberColumns * sizeof(double));
+  size += 2 * binaryArraySize(header.numberRows * sizeof(double));
+  if (header.flags & 1)
+    size += binaryArraySize(header.numberColumns);
+  size += binaryArraySize(header.lengthRowNames);
+  size += binaryArraySize(header.lengthColumnNames);
+  size += binaryArraySize(header.lengthOtherNames);
+  return size == fileSize;
+}
+
+// Adds names (or empty names if none) to block
+void addNames(std::vector< char > &block, const char *const *names, int number)
+{
+  for (int i = 0; i < number; i++) {
+    const char *name = names ? names[i] : NULL;
+    if (name)
+      block.insert(block.end(), name, name + strlen(name));
+    block.push_back('\0');
+  }
+}
+
+// Splits block into names - false if wrong number
+bool splitNames(std::vector< char > &block, std::vector< const char * > &names,
+  int number)
+{
+  names.clear();
+  size_t size = block.size();
+  size_t i = 0;
+  while (i < size) {
+    names.push_back(&block[i]);
+    i += strlen(&block[i]) + 1;
+  }
+  return static_cast< int >(names.size()) == number && (!size || block[size - 1] == '\0');
+}
+} // end file-local namespace
+
+bool CoinMpsIO::isBinaryFile(const char *filename)
+{
+  char magic[8];
+  FILE *fp = fopen(filename, "rb");
+  if (!fp)
+    return false;
+  size_t n = fread(magic, 1, 8, fp);
+  fclose(fp);
+  return n == 8 && !memcmp(magic, binaryMagic, 8);
+}
+
+int CoinMpsIO::writeBinary(const char *filename) const
+{
+  const CoinPackedMatrix *matrix = getMatrixByCol();
+  CoinPackedMatrix packed;
+  if (matrix && matrix->hasGaps()) {
+    packed = *matrix;
+    packed.removeGaps();
+    matrix = &packed;
+  }
+  CoinMpsBinaryHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, binaryMagic, 8);
+  header.version = binaryVersion;
+  header.byteOrder = 0x01020304;
+  header.sizeBigIndex = static_cast< int >(sizeof(CoinBigIndex));
+  header.flags = integerType_ ? 1 : 0;
+  header.numberRows = numberRows_;
+  header.numberColumns = numberColumns_;
+  header.numberElements = matrix ? matrix->getNumElements() : 0;
+  std::vector< char > rowNames;
+  addNames(rowNames, names_[0], numberRows_);
+  std::vector< char > columnNames;
+  addNames(columnNames, names_[1], numberColumns_);
+  std::vector< char > otherNames;
+  const char *other[5] = { problemName_, objectiveName_, rhsName_,
+    rangeName_, boundName_ };
+  addNames(otherNames, other, 5);
+  header.lengthRowNames = static_cast< CoinInt64 >(rowNames.size());
+  header.lengthColumnNames = static_cast< CoinInt64 >(columnNames.size());
+  header.lengthOtherNames = static_cast< CoinInt64 >(otherNames.size());
+  header.infinity = infinity_;
+  header.objectiveOffset = objectiveOffset_;
+
+  CoinFileOutput *output = CoinFileOutput::create(filename,
+    CoinFileOutput::COMPRESS_NONE);
+  bool ok = writeBinaryArray(output, &header, sizeof(header));
+  if (matrix) {
+    ok = ok && writeBinaryArray(output, matrix->getVectorStarts(), (numberColumns_ + 1) * sizeof(CoinBigIndex));
+    ok = ok && writeBinaryArray(output, matrix->getIndices(), header.numberElements * sizeof(int));
+    ok = ok && writeBinaryArray(output, matrix->getElements(), header.numberElements * sizeof(double));
+  } else {
+    std::vector< CoinBigIndex > start(numberColumns_ + 1, 0);
+    ok = ok && writeBinaryArray(output, &start[0], (numberColumns_ + 1) * sizeof(CoinBigIndex));
+  }
+  ok = ok && writeBinaryArray(output, collower_, numberColumns_ * sizeof(double));
+  ok = ok && writeBinaryArray(output, colupper_, numberColumns_ * sizeof(double));
+  ok = ok && writeBinaryArray(output, objective_, numberColumns_ * sizeof(double));
+  ok = ok && writeBinaryArray(output, rowlower_, numberRows_ * sizeof(double));
+  ok = ok && writeBinaryArray(output, rowupper_, numberRows_ * sizeof(double));
+  if (integerType_)
+    ok = ok && writeBinaryArray(output, integerType_, numberColumns_);
+  ok = ok && writeBinaryArray(output, rowNames.size() ? &rowNames[0] : NULL, rowNames.size());
+  ok = ok && writeBinaryArray(output, columnNames.size() ? &columnNames[0] : NULL, columnNames.size());
+  ok = ok && writeBinaryArray(output, &otherNames[0], otherNames.size());
+  delete output;
+  return ok ? 0 : -1;
+}
+
+int CoinMpsIO::readBinary(const char *filename)
+{
+  CoinFileInput *input = NULL;
+  try {
+    input = CoinFileInput::create(filename);
+  } catch (CoinError &) {
+    handler_->message(COIN_MPS_FILE, messages_) << filename
+                                                << CoinMessageEol;
+    return -1;
+  }
+  CoinMpsBinaryHeader header;
+  bool ok = readBinaryArray(input, &header, sizeof(header));
+  if (!ok || memcmp(header.magic, binaryMagic, 8) || header.version != binaryVersion
+    || header.byteOrder != 0x01020304
+    || header.sizeBigIndex != static_cast< int >(sizeof(CoinBigIndex))
+    || header.numberRows < 0 || header.numberRows > COIN_INT_MAX
+    || header.numberColumns < 0 || header.numberColumns > COIN_INT_MAX
+    || header.numberElements < 0) {
+    delete input;
+    handler_->message(COIN_GENERAL_WARNING, messages_)
+      << "Not a binary file written by this version of CoinMpsIO"
+      << CoinMessageEol;
+    return -2;
+  }
+  if (static_cast< CoinInt64 >(static_cast< CoinBigIndex >(header.numberElements)) != header.numberElements
+    || header.lengthRowNames < 0 || header.lengthColumnNames < 0
+    || header.lengthOtherNames < 0
+    || input->getReadType() != "plain"
+    || !binaryFileFits(header, binaryFileSize(filename))) {
+    delete input;
+    handler_->message(COIN_MPS_EOF, messages_) << filename
+                                               << CoinMessageEol;
+    return -3;
+  }
+  freeAll();
+  delete cardReader_;
+  cardReader_ = NULL;
+  numberRows_ = static_cast< int >(header.numberRows);
+  numberColumns_ = static_cast< int >(header.numberColumns);
+  numberElements_ = static_cast< CoinBigIndex >(header.numberElements);
+  infinity_ = header.infinity;
+  objectiveOffset_ = header.objectiveOffset;
+  // matrix arrays are handed over to matrix
+  CoinBigIndex *start = new CoinBigIndex[numberColumns_ + 1];
+  int *row = new int[numberElements_];
+  double *element = new double[numberElements_];
+  int *length = new int[numberColumns_];
+  ok = readBinaryArray(input, start, (numberColumns_ + 1) * sizeof(CoinBigIndex));
+  ok = ok && readBinaryArray(input, row, numberElements_ * sizeof(int));
+  ok = ok && readBinaryArray(input, element, numberElements_ * sizeof(double));
+  // a corrupt file must not give a matrix with bad indices
+  ok = ok && start[0] == 0 && start[numberColumns_] == numberElements_;
+  for (int i = 0; ok && i < numberColumns_; i++) {
+    ok = start[i + 1] >= start[i];
+    length[i] = static_cast< int >(start[i + 1] - start[i]);
+  }
+  for (CoinBigIndex j = 0; ok && j < numberElements_; j++)
+    ok = row[j] >= 0 && row[j] < numberRows_;
+  if (ok) {
+    matrixByColumn_ = new CoinPackedMatrix();
+    matrixByColumn_->assignMatrix(true, numberRows_, numberColumns_,
+      numberElements_, element, row, start, length);
+  } else {
+    delete[] start;
+    delete[] row;
+    delete[] element;
+    delete[] length;
+  }
+  collower_ = reinterpret_cast< double * >(malloc(numberColumns_ * sizeof(double)));
+  colupper_ = reinterpret_cast< double * >(malloc(numberColumns_ * sizeof(double)));
+  objective_ = reinterpret_cast< double * >(malloc(numberColumns_ * sizeof(double)));
+  rowlower_ = reinterpret_cast< double * >(malloc(numberRows_ * sizeof(double)));
+  rowupper_ = reinterpret_cast< double * >(malloc(numberRows_ * sizeof(double)));
+  ok = ok && readBinaryArray(input, collower_, numberColumns_ * sizeof(double));
+  ok = ok && readBinaryArray(input, colupper_, numberColumns_ * sizeof(double));
+  ok = ok && readBinaryArray(input, objective_, numberColumns_ * sizeof(double));
+  ok = ok && readBinaryArray(input, rowlower_, numberRows_ * sizeof(double));
+  ok = ok && readBinaryArray(input, rowupper_, numberRows_ * sizeof(double));
+  if (header.flags & 1) {
+    integerType_ = reinterpret_cast< char * >(malloc(numberColumns_ * sizeof(char)));
+    ok = ok && readBinaryArray(input, integerType_, numberColumns_);
+  }
+  std::vector< char > rowNames(static_cast< size_t >(header.lengthRowNames));
+  std::vector< char > columnNames(static_cast< size_t >(header.lengthColumnNames));
+  std::vector< char > otherNames(static_cast< size_t >(header.lengthOtherNames));
+  ok = ok && readBinaryArray(input, rowNames.size() ? &rowNames[0] : NULL, rowNames.size());
+  ok = ok && readBinaryArray(input, columnNames.size() ? &columnNames[0] : NULL, columnNames.size());
+  ok = ok && readBinaryArray(input, otherNames.size() ? &otherNames[0] : NULL, otherNames.size());
+  delete input;
+  std::vector< const char * > rowName;
+  std::vector< const char * > columnName;
+  std::vector< const char * > otherName;
+  ok = ok && splitNames(rowNames, rowName, numberRows_);
+  ok = ok && splitNames(columnNames, columnName, numberColumns_);
+  ok = ok && splitNames(otherNames, otherName, 5);
+  if (!ok) {
+    freeAll();
+    numberRows_ = 0;
+    numberColumns_ = 0;
+    numberElements_ = 0;
+    handler_->message(COIN_MPS_EOF, messages_) << filename
+                                               << CoinMessageEol;
+    return -3;
+  }
+  setMpsDataColAndRowNames(numberColumns_ ? &columnName[0] : NULL,
+    numberRows_ ? &rowName[0] : NULL);
+  problemName_ = CoinStrdup(otherName[0]);
+  objectiveName_ = CoinStrdup(otherName[1]);
+  rhsName_ = CoinStrdup(otherName[2]);
+  rangeName_ = CoinStrdup(otherName[3]);
+  boundName_ = CoinStrdup(otherName[4]);
+  fileName_ = CoinStrdup(filename);
+  handler_->message(COIN_MPS_STATS, messages_) << problemName_
+                                               << numberRows_
+                                               << numberColumns_
+                                               << numberElements_
+                                               << CoinMessageEol;
+  return 0;
+}
+
+//#############################################################################
+// Column source looking at existing arrays
+
+CoinMpsPackedColumns::CoinMpsPackedColumns(const CoinPackedMatrix &matrix,
+  const double *columnLower, const double *columnUpper,
+  const double *objective, const char *integerType,
+  const char *const *columnNames)
+  : matrix_(&matrix)
+  , columnCopy_(NULL)
+  , columnLower_(columnLower)
+  , columnUpper_(columnUpper)
+  , objective_(objective)
+  , integerType_(integerType)
+  , columnNames_(columnNames)
+{
+  if (!matrix.isColOrdered()) {
+    columnCopy_ = new CoinPackedMatrix();
+    columnCopy_->reverseOrderedCopyOf(matrix);
+    matrix_ = columnCopy_;
+  }
+}
+
+CoinMpsPackedColumns::~CoinMpsPackedColumns()
+{
+  delete columnCopy_;
+}
+
+int CoinMpsPackedColumns::numberColumns() const
+{
+  return matrix_->getNumCols();
+}
+
+int CoinMpsPackedColumns::getColumn(int iColumn, int *rows, double *elements)
+{
+  CoinBigIndex start = matrix_->getVectorStarts()[iColumn];
+  int length = matrix_->getVectorLengths()[iColumn];
+  memcpy(rows, matrix_->getIndices() + start, length * sizeof(int));
+  memcpy(elements, matrix_->getElements() + start, length * sizeof(double));
+  return length;
+}
+
+void CoinMpsPackedColumns::getColumnData(int iColumn, double &lower,
+  double &upper, double &objective, char &type)
+{
+  lower = columnLower_ ? columnLower_[iColumn] : 0.0;
+  upper = columnUpper_ ? columnUpper_[iColumn] : COIN_DBL_MAX;
+  objective = objective_ ? objective_[iColumn] : 0.0;
+  type = integerType_ ? integerType_[iColumn] : 0;
+}
+
+int CoinMpsIO::makeUniqueNames(char **names, int number, char first,
+  CoinNameArena &arena)
+{
+  return ::makeUniqueNames(names, number, first, &arena);
+}
+
+const char *CoinMpsPackedColumns::columnName(int iColumn)
+{
+  return columnNames_ ? columnNames_[iColumn] : NULL;
+}
+
+// Name or default name
+static const char *
+nameOrDefault(const char *name, char first, int index, char defaultName[12])
+{
+  if (!name) {
+    sprintf(defaultName, "%c%7.7d", first, index);
+    name = defaultName;
+  }
+  return name;
+}
+
 int CoinMpsIO::writeMps(const char *filename, int compression,
   int formatType, int numberAcross,
   CoinPackedMatrix *quadratic,
   int numberSOS, const CoinSet *setInfo) const
+{
+  // Check names for uniqueness if default
+  int nChanged;
+  nChanged = ::makeUniqueNames(names_[0], numberRows_, 'R', nameArena_[0]);
+  if (nChanged)
+    handler_->message(COIN_MPS_CHANGED, messages_) << "row" << nChanged
+                                                   << CoinMessageEol;
+  nChanged = ::makeUniqueNames(names_[1], numberColumns_, 'C', nameArena_[1]);
+  if (nChanged)
+    handler_->message(COIN_MPS_CHANGED, messages_) << "column" << nChanged
+                                                   << CoinMessageEol;
+  CoinMpsPackedColumns columns(*getMatrixByCol(), getColLower(),
+    getColUpper(), getObjCoefficients(), integerType_, names_[1]);
+  return gutsOfWriteMps(filename, compression, formatType, numberAcross,
+    numberRows_, getRowLower(), getRowUpper(), names_[0], columns,
+    quadratic, numberSOS, setInfo, true);
+}
+
+int CoinMpsIO::writeMps(const char *filename, int compression,
+  int formatType, int numberAcross, int numberRows,
+  const double *rowLower, const double *rowUpper,
+  const char *const *rowNames, CoinMpsColumnSource &columns,
+  const CoinPackedMatrix *quadratic,
+  int numberSOS, const CoinSet *setInfo) const
+{
+  return gutsOfWriteMps(filename, compression, formatType, numberAcross,
+    numberRows, rowLower, rowUpper, rowNames, columns,
+    quadratic, numberSOS, setInfo, false);
+}
+
+int CoinMpsIO::gutsOfWriteMps(const char *filename, int compression,
+  int formatType, int numberAcross, int numberRows,
+  const double *rowLower, const double *rowUpper,
+  const char *const *rowNames, CoinMpsColumnSource &columns,
+  const CoinPackedMatrix *quadratic,
+  int numberSOS, const CoinSet *setInfo, bool useStrings) const
 {
   // Clean up format and numberacross
   numberAcross = CoinMax(1, numberAcross);
@@ -4065,56 +4736,54 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
       compression = 0;
   }
   std::string line = filename;
-  CoinFileOutput *output = 0;
+  CoinFileOutput *fileOutput = 0;
   switch (compression) {
   case 1:
     if (strcmp(line.c_str() + (line.size() - 3), ".gz") != 0) {
       line += ".gz";
     }
-    output = CoinFileOutput::create(line, CoinFileOutput::COMPRESS_GZIP);
+    fileOutput = CoinFileOutput::create(line, CoinFileOutput::COMPRESS_GZIP);
     break;
 
   case 2:
     if (strcmp(line.c_str() + (line.size() - 4), ".bz2") != 0) {
       line += ".bz2";
     }
-    output = CoinFileOutput::create(line, CoinFileOutput::COMPRESS_BZIP2);
+    fileOutput = CoinFileOutput::create(line, CoinFileOutput::COMPRESS_BZIP2);
     break;
 
   case 0:
   default:
-    output = CoinFileOutput::create(line, CoinFileOutput::COMPRESS_NONE);
+    fileOutput = CoinFileOutput::create(line, CoinFileOutput::COMPRESS_NONE);
     break;
   }
+  // cards are collected and written out a block at a time
+  CoinMpsOutputBuffer outputBuffer(fileOutput);
+  CoinMpsOutputBuffer *output = &outputBuffer;
 
   // Set locale so won't get , instead of .
   char *saveLocale = strdup(setlocale(LC_ALL, NULL));
   setlocale(LC_ALL, "C");
-  const char *const *const rowNames = names_[0];
-  const char *const *const columnNames = names_[1];
+  const int numberColumns = columns.numberColumns();
+  // for default names
+  char rowName[12];
+  char columnName[12];
   int i;
   unsigned int length = 8;
   bool freeFormat = (formatType == 1);
-  // Check names for uniqueness if default
-  int nChanged;
-  nChanged = makeUniqueNames(names_[0], numberRows_, 'R');
-  if (nChanged)
-    handler_->message(COIN_MPS_CHANGED, messages_) << "row" << nChanged
-                                                   << CoinMessageEol;
-  nChanged = makeUniqueNames(names_[1], numberColumns_, 'C');
-  if (nChanged)
-    handler_->message(COIN_MPS_CHANGED, messages_) << "column" << nChanged
-                                                   << CoinMessageEol;
-  for (i = 0; i < numberRows_; ++i) {
-    if (strlen(rowNames[i]) > length) {
-      length = static_cast< int >(strlen(rowNames[i]));
-      break;
+  if (rowNames) {
+    for (i = 0; i < numberRows; ++i) {
+      if (strlen(rowNames[i]) > length) {
+        length = static_cast< int >(strlen(rowNames[i]));
+        break;
+      }
     }
   }
   if (length <= 8) {
-    for (i = 0; i < numberColumns_; ++i) {
-      if (strlen(columnNames[i]) > length) {
-        length = static_cast< int >(strlen(columnNames[i]));
+    for (i = 0; i < numberColumns; ++i) {
+      const char *name = columns.columnName(i);
+      if (name && strlen(name) > length) {
+        length = static_cast< int >(strlen(name));
         break;
       }
     }
@@ -4123,7 +4792,8 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
     freeFormat = true;
     formatType += 8;
   }
-  if (numberStringElements_) {
+  useStrings = useStrings && numberStringElements_ != 0;
+  if (useStrings) {
     freeFormat = true;
     numberAcross = 1;
   }
@@ -4169,12 +4839,13 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
   // Rows section
   // Sense array
   // But massage if looks odd
-  char *sense = new char[numberRows_];
-  memcpy(sense, getRowSense(), numberRows_);
-  const double *rowLower = getRowLower();
-  const double *rowUpper = getRowUpper();
+  char *sense = new char[numberRows];
+  for (i = 0; i < numberRows; i++) {
+    double dummyRhs, dummyRange;
+    convertBoundToSense(rowLower[i], rowUpper[i], sense[i], dummyRhs, dummyRange);
+  }
 
-  for (i = 0; i < numberRows_; i++) {
+  for (i = 0; i < numberRows; i++) {
     line = " ";
     if (sense[i] != 'R') {
       line.append(1, sense[i]);
@@ -4192,7 +4863,7 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
       }
     }
     line.append("  ");
-    line.append(rowNames[i]);
+    line.append(nameOrDefault(rowNames ? rowNames[i] : NULL, 'R', i, rowName));
     line.append("\n");
     writeString(output, line.c_str());
   }
@@ -4204,34 +4875,27 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
   double largeValue = infinity_;
   largeValue = 1.0e30; // safer
 
-  const double *columnLower = getColLower();
-  const double *columnUpper = getColUpper();
-  const double *objective = getObjCoefficients();
-  const CoinPackedMatrix *matrix = getMatrixByCol();
-  const double *elements = matrix->getElements();
-  const int *rows = matrix->getIndices();
-  const CoinBigIndex *starts = matrix->getVectorStarts();
-  const int *lengths = matrix->getVectorLengths();
-
   char outputValue[2][24];
   char outputRow[2][100];
   // strings
-  int nextRowString = numberRows_ + 10;
-  int nextColumnString = numberColumns_ + 10;
+  int nextRowString = numberRows + 10;
+  int nextColumnString = numberColumns + 10;
   int whichString = 0;
   const char *nextString = NULL;
   // mark string rows
-  char *stringRow = new char[numberRows_ + 1];
-  memset(stringRow, 0, numberRows_ + 1);
-  if (numberStringElements_) {
+  char *stringRow = new char[numberRows + 1];
+  memset(stringRow, 0, numberRows + 1);
+  if (useStrings) {
     decodeString(whichString, nextRowString, nextColumnString, nextString);
   }
   // Arrays so we can put out rows in order
-  int *tempRow = new int[numberRows_];
-  double *tempValue = new double[numberRows_];
+  int *tempRow = new int[numberRows];
+  double *tempValue = new double[numberRows];
+  // Columns put out (so bounds wanted)
+  char *columnWritten = new char[numberColumns];
 
   // Through columns (only put out if elements or objective value)
-  for (i = 0; i < numberColumns_; i++) {
+  for (i = 0; i < numberColumns; i++) {
     if (i == nextColumnString) {
       // set up
       int k = whichString;
@@ -4244,20 +4908,28 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
         decodeString(k, iRow, iColumn, dummy);
       }
     }
-    if (objective[i] || lengths[i] || i == nextColumnString) {
+    double lower;
+    double upper;
+    double objective;
+    char type;
+    columns.getColumnData(i, lower, upper, objective, type);
+    int numberEntries = columns.getColumn(i, tempRow, tempValue);
+    const char *name = nameOrDefault(columns.columnName(i), 'C', i, columnName);
+    columnWritten[i] = static_cast< char >(objective || numberEntries);
+    if (objective || numberEntries || i == nextColumnString) {
       // see if bound will be needed
-      if (columnLower[i] || columnUpper[i] < largeValue || isInteger(i))
+      if (lower || upper < largeValue || type)
         ifBounds = true;
       int numberFields = 0;
-      if (objective[i]) {
-        convertDouble(0, formatType, objective[i], outputValue[0],
+      if (objective) {
+        convertDouble(0, formatType, objective, outputValue[0],
           objrow, outputRow[0]);
         numberFields = 1;
-        if (stringRow[numberRows_]) {
-          assert(objective[i] == STRING_VALUE);
-          assert(nextColumnString == i && nextRowString == numberRows_);
+        if (stringRow[numberRows]) {
+          assert(objective == STRING_VALUE);
+          assert(nextColumnString == i && nextRowString == numberRows);
           strcpyeq(outputValue[0], nextString);
-          stringRow[numberRows_] = 0;
+          stringRow[numberRows] = 0;
           decodeString(++whichString, nextRowString, nextColumnString, nextString);
         }
       }
@@ -4265,18 +4937,12 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
         // put out card
         outputCard(formatType, numberFields,
           output, "    ",
-          columnNames[i],
+          name,
           outputValue,
           outputRow);
         numberFields = 0;
       }
       int j;
-      int numberEntries = lengths[i];
-      CoinBigIndex start = starts[i];
-      for (j = 0; j < numberEntries; j++) {
-        tempRow[j] = rows[start + j];
-        tempValue[j] = elements[start + j];
-      }
       CoinSort_2(tempRow, tempRow + numberEntries, tempValue);
       for (j = 0; j < numberEntries; j++) {
         int jRow = tempRow[j];
@@ -4284,14 +4950,14 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
         if (value && !stringRow[jRow]) {
           convertDouble(0, formatType, value,
             outputValue[numberFields],
-            rowNames[jRow],
+            nameOrDefault(rowNames ? rowNames[jRow] : NULL, 'R', jRow, rowName),
             outputRow[numberFields]);
           numberFields++;
           if (numberFields == numberAcross) {
             // put out card
             outputCard(formatType, numberFields,
               output, "    ",
-              columnNames[i],
+              name,
               outputValue,
               outputRow);
             numberFields = 0;
@@ -4302,7 +4968,7 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
         // put out card
         outputCard(formatType, numberFields,
           output, "    ",
-          columnNames[i],
+          name,
           outputValue,
           outputRow);
       }
@@ -4321,13 +4987,14 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
         // put out card
         outputCard(formatType, 1,
           output, "    ",
-          columnNames[i],
+          name,
           outputValue,
           outputRow);
         stringRow[iRow] = 0;
         decodeString(++whichString, nextRowString, nextColumnString, nextString);
       }
     }
+    output->flushIfFull();
   }
   delete[] tempRow;
   delete[] tempValue;
@@ -4355,7 +5022,7 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
       numberFields = 0;
     }
   }
-  for (i = 0; i < numberRows_; i++) {
+  for (i = 0; i < numberRows; i++) {
     double value;
     switch (sense[i]) {
     case 'E':
@@ -4378,9 +5045,9 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
     if (value != 0.0) {
       convertDouble(1, formatType, value,
         outputValue[numberFields],
-        rowNames[i],
+        nameOrDefault(rowNames ? rowNames[i] : NULL, 'R', i, rowName),
         outputRow[numberFields]);
-      if (i == nextRowString && nextColumnString >= numberColumns_) {
+      if (i == nextRowString && nextColumnString >= numberColumns) {
         strcpyeq(outputValue[0], nextString);
         decodeString(++whichString, nextRowString, nextColumnString, nextString);
       }
@@ -4410,13 +5077,13 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
     writeString(output, "RANGES\n");
 
     numberFields = 0;
-    for (i = 0; i < numberRows_; i++) {
+    for (i = 0; i < numberRows; i++) {
       if (sense[i] == 'R') {
         double value = rowUpper[i] - rowLower[i];
         if (value < 1.0e30) {
           convertDouble(1, formatType, value,
             outputValue[numberFields],
-            rowNames[i],
+            nameOrDefault(rowNames ? rowNames[i] : NULL, 'R', i, rowName),
             outputRow[numberFields]);
           numberFields++;
           if (numberFields == numberAcross) {
@@ -4445,20 +5112,26 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
     // BOUNDS
     writeString(output, "BOUNDS\n");
 
-    for (i = 0; i < numberColumns_; i++) {
+    for (i = 0; i < numberColumns; i++) {
+      double lower;
+      double upper;
+      double objective;
+      char type;
+      columns.getColumnData(i, lower, upper, objective, type);
+      const char *name = nameOrDefault(columns.columnName(i), 'C', i, columnName);
       if (i == nextColumnString) {
         // just lo and up
-        if (columnLower[i] == STRING_VALUE) {
-          assert(nextRowString == numberRows_ + 1);
+        if (lower == STRING_VALUE) {
+          assert(nextRowString == numberRows + 1);
           convertDouble(2, formatType, 1.0,
             outputValue[0],
-            columnNames[i],
+            name,
             outputRow[0]);
           strcpyeq(outputValue[0], nextString);
           decodeString(++whichString, nextRowString, nextColumnString, nextString);
           if (i == nextColumnString) {
-            assert(columnUpper[i] == STRING_VALUE);
-            assert(nextRowString == numberRows_ + 2);
+            assert(upper == STRING_VALUE);
+            assert(nextRowString == numberRows + 2);
             if (!strcmp(nextString, outputValue[0])) {
               // put out card FX
               outputCard(formatType, 1,
@@ -4491,11 +5164,11 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
               outputValue,
               outputRow);
           }
-        } else if (columnUpper[i] == STRING_VALUE) {
-          assert(nextRowString == numberRows_ + 2);
+        } else if (upper == STRING_VALUE) {
+          assert(nextRowString == numberRows + 2);
           convertDouble(2, formatType, 1.0,
             outputValue[0],
-            columnNames[i],
+            name,
             outputRow[0]);
           strcpyeq(outputValue[0], nextString);
           outputCard(formatType, 1,
@@ -4507,12 +5180,12 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
         }
         continue;
       }
-      if (objective[i] || lengths[i]) {
+      if (columnWritten[i]) {
         // see if bound will be needed
-        if (columnLower[i] || columnUpper[i] < largeValue || isInteger(i)) {
-          double lowerValue = columnLower[i];
-          double upperValue = columnUpper[i];
-          if (isInteger(i)) {
+        if (lower || upper < largeValue || type) {
+          double lowerValue = lower;
+          double upperValue = upper;
+          if (type) {
             // Old argument - what are correct ranges for integer variables
             lowerValue = CoinMax(lowerValue, -MAX_INTEGER);
             upperValue = CoinMin(upperValue, MAX_INTEGER);
@@ -4522,13 +5195,13 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
           double value[2];
           if (lowerValue <= -largeValue) {
             // FR or MI
-            if (upperValue >= largeValue && !isInteger(i)) {
+            if (upperValue >= largeValue && !type) {
               header[0] = " FR ";
               value[0] = largeValue;
             } else {
               header[0] = " MI ";
               value[0] = -largeValue;
-              if (!isInteger(i))
+              if (!type)
                 header[1] = " UP ";
               else
                 header[1] = " UI ";
@@ -4543,13 +5216,13 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
             value[0] = lowerValue;
           } else {
             // do LO if needed
-            if (lowerValue || isIntegerOrSemiContinuous(i) > 2) {
+            if (lowerValue || type > 2) {
               // LO
               header[0] = " LO ";
               value[0] = lowerValue;
-              if (isIntegerOrSemiContinuous(i) > 2) {
+              if (type > 2) {
                 if (lowerValue) {
-                  if (isIntegerOrSemiContinuous(i) == 4)
+                  if (type == 4)
                     header[0] = " LI ";
                   numberFields = 2;
                 }
@@ -4558,7 +5231,7 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
                   value[numberFields - 1] = upperValue;
                 else
                   value[numberFields - 1] = largeValue;
-              } else if (isInteger(i)) {
+              } else if (type) {
                 // Integer variable so UI
                 header[1] = " UI ";
                 if (upperValue < largeValue)
@@ -4573,7 +5246,7 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
                 numberFields = 2;
               }
             } else {
-              if (isInteger(i)) {
+              if (type) {
                 // Integer variable so BV or UI
                 if (fabs(upperValue - 1.0) < 1.0e-8) {
                   // BV
@@ -4599,7 +5272,7 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
           for (j = 0; j < numberFields; j++) {
             convertDouble(2, formatType, value[j],
               outputValue[0],
-              columnNames[i],
+              name,
               outputRow[0]);
             // put out card
             outputCard(formatType, 1,
@@ -4612,6 +5285,7 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
       }
     }
   }
+  delete[] columnWritten;
 
   // do any quadratic part
   if (quadratic) {
@@ -4622,7 +5296,7 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
     const CoinBigIndex *columnQuadraticStart = quadratic->getVectorStarts();
     const int *columnQuadraticLength = quadratic->getVectorLengths();
     const double *quadraticElement = quadratic->getElements();
-    for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
       int numberFields = 0;
       for (CoinBigIndex j = columnQuadraticStart[iColumn];
            j < columnQuadraticStart[iColumn] + columnQuadraticLength[iColumn]; j++) {
@@ -4630,14 +5304,14 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
         double elementValue = quadraticElement[j];
         convertDouble(0, formatType, elementValue,
           outputValue[numberFields],
-          columnNames[jColumn],
+          nameOrDefault(columns.columnName(jColumn), 'C', jColumn, columnName),
           outputRow[numberFields]);
         numberFields++;
         if (numberFields == numberAcross) {
           // put out card
           outputCard(formatType, numberFields,
             output, "    ",
-            columnNames[iColumn],
+            nameOrDefault(columns.columnName(iColumn), 'C', iColumn, columnName),
             outputValue,
             outputRow);
           numberFields = 0;
@@ -4647,7 +5321,7 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
         // put out card
         outputCard(formatType, numberFields,
           output, "    ",
-          columnNames[iColumn],
+          nameOrDefault(columns.columnName(iColumn), 'C', iColumn, columnName),
           outputValue,
           outputRow);
       }
@@ -4671,7 +5345,7 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
         // put out card
         outputCard(formatType, 1,
           output, "   ",
-          columnNames[k],
+          nameOrDefault(columns.columnName(k), 'C', k, columnName),
           outputValue, outputRow);
       }
     }
@@ -4680,10 +5354,11 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
   // and finish
 
   writeString(output, "ENDATA\n");
+  output->flush();
 
   free(objrow);
 
-  delete output;
+  delete fileOutput;
   setlocale(LC_ALL, saveLocale);
   free(saveLocale);
   return 0;
@@ -4891,7 +5566,7 @@ const CoinPackedMatrix *CoinMpsIO::getMatrixByRow() const
 {
   if (matrixByRow_ == NULL && matrixByColumn_) {
     matrixByRow_ = new CoinPackedMatrix(*matrixByColumn_);
-    matrixByRow_->reverseOrdering();
+    matrixByRow_->reverseOrdering(numberThreads_);
   }
   return matrixByRow_;
 }
@@ -4957,7 +5632,8 @@ void CoinMpsIO::setMpsDataColAndRowNames(
 {
   releaseRowNames();
   releaseColumnNames();
-  // If long names free format
+  CoinNameArena *rowArena = newNameArena(0);
+  CoinNameArena *columnArena = newNameArena(1);
   names_[0] = reinterpret_cast< char ** >(malloc(numberRows_ * sizeof(char *)));
   names_[1] = reinterpret_cast< char ** >(malloc(numberColumns_ * sizeof(char *)));
   numberHash_[0] = numberRows_;
@@ -4965,56 +5641,22 @@ void CoinMpsIO::setMpsDataColAndRowNames(
   char **rowNames = names_[0];
   char **columnNames = names_[1];
   int i;
-  // so we can adjust for long names
-  int lengthMalloc = 9;
-  int maxIndex = 10000000;
-  if (rownames) {
-    for (i = 0; i < numberRows_; ++i) {
-      if (i == maxIndex) {
-        lengthMalloc++;
-        maxIndex *= 10;
-      }
-      if (rownames[i]) {
-        rowNames[i] = CoinStrdup(rownames[i]);
-      } else {
-        rowNames[i] = reinterpret_cast< char * >(malloc(lengthMalloc * sizeof(char)));
-        sprintf(rowNames[i], "R%7.7d", i);
-      }
-    }
-  } else {
-    for (i = 0; i < numberRows_; ++i) {
-      if (i == maxIndex) {
-        lengthMalloc++;
-        maxIndex *= 10;
-      }
-      rowNames[i] = reinterpret_cast< char * >(malloc(lengthMalloc * sizeof(char)));
-      sprintf(rowNames[i], "R%7.7d", i);
+  char defaultName[20];
+  for (i = 0; i < numberRows_; ++i) {
+    if (rownames && rownames[i]) {
+      rowNames[i] = rowArena->add(rownames[i]);
+    } else {
+      sprintf(defaultName, "R%7.7d", i);
+      rowNames[i] = rowArena->add(defaultName);
     }
   }
 #ifndef NONAMES
-  lengthMalloc = 9;
-  maxIndex = 10000000;
-  if (colnames) {
-    for (i = 0; i < numberColumns_; ++i) {
-      if (i == maxIndex) {
-        lengthMalloc++;
-        maxIndex *= 10;
-      }
-      if (colnames[i]) {
-        columnNames[i] = CoinStrdup(colnames[i]);
-      } else {
-        columnNames[i] = reinterpret_cast< char * >(malloc(lengthMalloc * sizeof(char)));
-        sprintf(columnNames[i], "C%7.7d", i);
-      }
-    }
-  } else {
-    for (i = 0; i < numberColumns_; ++i) {
-      if (i == maxIndex) {
-        lengthMalloc++;
-        maxIndex *= 10;
-      }
-      columnNames[i] = reinterpret_cast< char * >(malloc(lengthMalloc * sizeof(char)));
-      sprintf(columnNames[i], "C%7.7d", i);
+  for (i = 0; i < numberColumns_; ++i) {
+    if (colnames && colnames[i]) {
+      columnNames[i] = columnArena->add(colnames[i]);
+    } else {
+      sprintf(defaultName, "C%7.7d", i);
+      columnNames[i] = columnArena->add(defaultName);
     }
   }
 #else
@@ -5023,8 +5665,8 @@ void CoinMpsIO::setMpsDataColAndRowNames(
   const int *lengths = matrix->getVectorLengths();
   int k = 0;
   for (i = 0; i < numberColumns_; ++i) {
-    columnNames[i] = reinterpret_cast< char * >(malloc(9 * sizeof(char)));
-    sprintf(columnNames[i], "C%7.7d", k);
+    sprintf(defaultName, "C%7.7d", k);
+    columnNames[i] = columnArena->add(defaultName);
     if (objective[i] || lengths[i])
       k++;
   }
@@ -5035,44 +5677,32 @@ void CoinMpsIO::setMpsDataColAndRowNames(
   const std::vector< std::string > &colnames,
   const std::vector< std::string > &rownames)
 {
-  // If long names free format
+  CoinNameArena *rowArena = newNameArena(0);
+  CoinNameArena *columnArena = newNameArena(1);
   names_[0] = reinterpret_cast< char ** >(malloc(numberRows_ * sizeof(char *)));
   names_[1] = reinterpret_cast< char ** >(malloc(numberColumns_ * sizeof(char *)));
   char **rowNames = names_[0];
   char **columnNames = names_[1];
   int i;
+  char defaultName[20];
   if (rownames.size() != 0) {
     for (i = 0; i < numberRows_; ++i) {
-      rowNames[i] = CoinStrdup(rownames[i].c_str());
+      rowNames[i] = rowArena->add(rownames[i].c_str());
     }
   } else {
-    // so we can adjust for long names
-    int lengthMalloc = 9;
-    int maxIndex = 10000000;
     for (i = 0; i < numberRows_; ++i) {
-      if (i == maxIndex) {
-        lengthMalloc++;
-        maxIndex *= 10;
-      }
-      rowNames[i] = reinterpret_cast< char * >(malloc(lengthMalloc * sizeof(char)));
-      sprintf(rowNames[i], "R%7.7d", i);
+      sprintf(defaultName, "R%7.7d", i);
+      rowNames[i] = rowArena->add(defaultName);
     }
   }
   if (colnames.size() != 0) {
     for (i = 0; i < numberColumns_; ++i) {
-      columnNames[i] = CoinStrdup(colnames[i].c_str());
+      columnNames[i] = columnArena->add(colnames[i].c_str());
     }
   } else {
-    // so we can adjust for long names
-    int lengthMalloc = 9;
-    int maxIndex = 10000000;
     for (i = 0; i < numberColumns_; ++i) {
-      if (i == maxIndex) {
-        lengthMalloc++;
-        maxIndex *= 10;
-      }
-      columnNames[i] = reinterpret_cast< char * >(malloc(lengthMalloc * sizeof(char)));
-      sprintf(columnNames[i], "C%7.7d", i);
+      sprintf(defaultName, "C%7.7d", i);
+      columnNames[i] = columnArena->add(defaultName);
     }
   }
 }
@@ -5282,25 +5912,30 @@ void CoinMpsIO::releaseIntegerInformation()
 void CoinMpsIO::releaseRowNames()
 {
   releaseRedundantInformation();
-  int i;
-  for (i = 0; i < numberHash_[0]; i++) {
-    free(names_[0][i]);
-  }
   free(names_[0]);
   names_[0] = NULL;
   numberHash_[0] = 0;
+  CoinNameArena::release(nameArena_[0]);
 }
 // Release column names
 void CoinMpsIO::releaseColumnNames()
 {
   releaseRedundantInformation();
-  int i;
-  for (i = 0; i < numberHash_[1]; i++) {
-    free(names_[1][i]);
-  }
   free(names_[1]);
   names_[1] = NULL;
   numberHash_[1] = 0;
+  CoinNameArena::release(nameArena_[1]);
+}
+// Releases names of a section and starts a new arena for them
+CoinNameArena *CoinMpsIO::newNameArena(int section)
+{
+  stopHash(section);
+  free(names_[section]);
+  names_[section] = NULL;
+  numberHash_[section] = 0;
+  CoinNameArena::release(nameArena_[section]);
+  nameArena_[section] = new CoinNameArena();
+  return nameArena_[section];
 }
 // Release matrix information
 void CoinMpsIO::releaseMatrixInformation()
@@ -5338,6 +5973,7 @@ CoinMpsIO::CoinMpsIO()
   , defaultBound_(1)
   , infinity_(COIN_DBL_MAX)
   , smallElement_(1.0e-14)
+  , numberThreads_(1)
   , defaultHandler_(true)
   , cardReader_(NULL)
   , convertObjective_(false)
@@ -5349,9 +5985,11 @@ CoinMpsIO::CoinMpsIO()
   numberHash_[0] = 0;
   hash_[0] = NULL;
   names_[0] = NULL;
+  nameArena_[0] = NULL;
   numberHash_[1] = 0;
   hash_[1] = NULL;
   names_[1] = NULL;
+  nameArena_[1] = NULL;
   handler_ = new CoinMessageHandler();
   messages_ = CoinMessage();
 }
@@ -5384,6 +6022,7 @@ CoinMpsIO::CoinMpsIO(const CoinMpsIO &rhs)
   , defaultBound_(1)
   , infinity_(COIN_DBL_MAX)
   , smallElement_(1.0e-14)
+  , numberThreads_(rhs.numberThreads_)
   , defaultHandler_(true)
   , cardReader_(NULL)
   , allowStringElements_(rhs.allowStringElements_)
@@ -5394,9 +6033,11 @@ CoinMpsIO::CoinMpsIO(const CoinMpsIO &rhs)
   numberHash_[0] = 0;
   hash_[0] = NULL;
   names_[0] = NULL;
+  nameArena_[0] = NULL;
   numberHash_[1] = 0;
   hash_[1] = NULL;
   names_[1] = NULL;
+  nameArena_[1] = NULL;
   if (rhs.rowlower_ != NULL || rhs.collower_ != NULL) {
     gutsOfCopy(rhs);
     // OK and proper to leave rowsense_, rhs_, and
@@ -5455,17 +6096,15 @@ void CoinMpsIO::gutsOfCopy(const CoinMpsIO &rhs)
   defaultBound_ = rhs.defaultBound_;
   infinity_ = rhs.infinity_;
   smallElement_ = rhs.smallElement_;
+  numberThreads_ = rhs.numberThreads_;
   objectiveOffset_ = rhs.objectiveOffset_;
   int section;
   for (section = 0; section < 2; section++) {
     if (numberHash_[section]) {
       char **names2 = rhs.names_[section];
       names_[section] = reinterpret_cast< char ** >(malloc(numberHash_[section] * sizeof(char *)));
-      char **names = names_[section];
-      int i;
-      for (i = 0; i < numberHash_[section]; i++) {
-        names[i] = CoinStrdup(names2[i]);
-      }
+      memcpy(names_[section], names2, numberHash_[section] * sizeof(char *));
+      nameArena_[section] = rhs.nameArena_[section]->share();
     }
   }
   allowStringElements_ = rhs.allowStringElements_;
@@ -5557,6 +6196,9 @@ void CoinMpsIO::freeAll()
   for (int i = 0; i < numberStringElements_; i++)
     free(stringElements_[i]);
   delete[] stringElements_;
+  stringElements_ = NULL;
+  numberStringElements_ = 0;
+  maximumStringElements_ = 0;
 }
 
 /* Release all information which can be re-calculated e.g. rowsense
@@ -5569,8 +6211,8 @@ void CoinMpsIO::releaseRedundantInformation()
   rowsense_ = NULL;
   rhs_ = NULL;
   rowrange_ = NULL;
-  delete[] hash_[0];
-  delete[] hash_[1];
+  delete hash_[0];
+  delete hash_[1];
   hash_[0] = 0;
   hash_[1] = 0;
   delete matrixByRow_;
@@ -19,6 +19,8 @@
 #include "CoinMessageHandler.hpp"
 #include "CoinFileIO.hpp"
 class CoinModel;
+class CoinNameArena;
+class CoinNameHash;
 
 /// The following lengths are in decreasing order (for 64 bit etc)
 /// Large enough to contain element index
@@ -203,6 +205,29 @@ public:
   {
     stringsAllowed_ = true;
   }
+  /// Whether IEEE - 0 no, 1 INTEL, 2 not INTEL
+  inline int ieeeFormat() const
+  {
+    return ieeeFormat_;
+  }
+  /// Whether all names so far have fitted in 8 characters
+  inline bool eightChar() const
+  {
+    return eightChar_;
+  }
+  /// Sets whether all names so far have fitted in 8 characters
+  inline void setEightChar(bool yesNo)
+  {
+    eightChar_ = yesNo;
+  }
+  /** Reads the rest of the current section without decoding it.
+
+      The cleaned cards (including blank and comment cards, so that card
+      numbers can be recovered) are put in \p image, one per line.  The
+      reader is left on the next section card, just as nextField would
+      leave it, and the new section (or COIN_EOF_SECTION) is returned.
+  */
+  COINSectionType readSectionImage(std::vector< char > &image);
   //@}
 
   ////////////////// data //////////////////
@@ -385,6 +410,79 @@ protected:
   //@}
 };
 
+//#############################################################################
+/** Supplies columns to CoinMpsIO::writeMps one at a time
+
+    This lets a model be written without first being copied into a
+    CoinMpsIO.  Columns are asked for in order and each once, but the data
+    and names of a column may be asked for several times and the name of
+    any column may be wanted when writing a quadratic objective or sets.
+*/
+class CoinMpsColumnSource {
+
+public:
+  /// Destructor
+  virtual ~CoinMpsColumnSource() {}
+  /// Number of columns
+  virtual int numberColumns() const = 0;
+  /** Puts the row indices (in any order) and elements of column iColumn in
+      rows and elements, which have room for number of rows entries, and
+      returns the number of elements */
+  virtual int getColumn(int iColumn, int *rows, double *elements) = 0;
+  /** Bounds and objective of column iColumn and its type (0 continuous,
+      1 integer, 3 semi-continuous and 4 semi-continuous integer) */
+  virtual void getColumnData(int iColumn, double &lower, double &upper,
+    double &objective, char &type)
+    = 0;
+  /** Name of column iColumn or NULL for default name.  The name need
+      only stay valid until the next call. */
+  virtual const char *columnName(int iColumn) = 0;
+};
+
+/** Column source for CoinMpsIO::writeMps looking at existing arrays
+
+    Nothing is copied if the matrix is column ordered (if it is row ordered
+    a column ordered copy is made).  The arrays must exist until writing is
+    finished.  Any of columnLower (0.0), columnUpper (infinity), objective
+    (0.0), integerType (continuous) and columnNames may be NULL.
+*/
+class CoinMpsPackedColumns : public CoinMpsColumnSource {
+
+public:
+  /// Constructor
+  CoinMpsPackedColumns(const CoinPackedMatrix &matrix,
+    const double *columnLower, const double *columnUpper,
+    const double *objective, const char *integerType,
+    const char *const *columnNames);
+  /// Destructor
+  virtual ~CoinMpsPackedColumns();
+
+  /// Number of columns
+  virtual int numberColumns() const;
+  /// Gets column
+  virtual int getColumn(int iColumn, int *rows, double *elements);
+  /// Bounds, objective and type of column
+  virtual void getColumnData(int iColumn, double &lower, double &upper,
+    double &objective, char &type);
+  /// Name of column
+  virtual const char *columnName(int iColumn);
+
+private:
+  /// Not allowed
+  CoinMpsPackedColumns(const CoinMpsPackedColumns &);
+  CoinMpsPackedColumns &operator=(const CoinMpsPackedColumns &);
+
+  /// Column ordered matrix
+  const CoinPackedMatrix *matrix_;
+  /// Column ordered copy if one had to be made
+  CoinPackedMatrix *columnCopy_;
+  const double *columnLower_;
+  const double *columnUpper_;
+  const double *objective_;
+  const char *integerType_;
+  const char *const *columnNames_;
+};
+
 //#############################################################################
 
 /** MPS IO Interface
@@ -532,6 +630,16 @@ public:
     */
   int columnIndex(const char *name) const;
 
+  /** Returns the arena holding the names of a section (0 - rows,
+      1 - columns) or NULL if there are no names.
+
+	Another object can share() it to use the names without copying them.
+    */
+  inline CoinNameArena *nameArena(int section) const
+  {
+    return nameArena_[section];
+  }
+
   /** Returns the (constant) objective offset
     
 	This is the RHS entry for the objective row
@@ -655,6 +763,27 @@ public:
   {
     smallElement_ = value;
   }
+  /// Number of threads used when reading the COLUMNS section
+  inline int numberThreads() const
+  {
+    return numberThreads_;
+  }
+  /** Set number of threads used when reading the COLUMNS section.
+
+      If more than one, the COLUMNS section is read into memory, split into
+      line-aligned chunks and the chunks are decoded (names looked up and
+      numbers converted) in parallel before being put together in order.
+      The result is exactly the same as reading serially.  This needs
+      memory for the text of the section, and is not used if string
+      elements are allowed.  Without thread support (see
+      --enable-coinutils-threads) the chunks are decoded one after another.
+      The same number of threads is used to make the row copy for
+      getMatrixByRow.
+  */
+  inline void setNumberThreads(int value)
+  {
+    numberThreads_ = value;
+  }
   //@}
 
   /** @name Methods for problem input and output
@@ -780,6 +909,60 @@ public:
     CoinPackedMatrix *quadratic = NULL,
     int numberSOS = 0, const CoinSet *setInfo = NULL) const;
 
+  /** Write a problem which is not in this object in MPS format.
+
+      The rows are given as arrays and the columns come from a column
+      source, one at a time, so the matrix is never copied (see
+      CoinMpsPackedColumns to write from a CoinPackedMatrix).  Row names
+      may be NULL for default names.  Problem, objective, rhs, range and
+      bound names, objective offset, infinity and message handler are
+      taken from this object.  Other arguments are as for the other
+      writeMps, except that names are not made unique (see
+      makeUniqueNames).
+  */
+  int writeMps(const char *filename, int compression, int formatType,
+    int numberAcross, int numberRows, const double *rowLower,
+    const double *rowUpper, const char *const *rowNames,
+    CoinMpsColumnSource &columns,
+    const CoinPackedMatrix *quadratic = NULL,
+    int numberSOS = 0, const CoinSet *setInfo = NULL) const;
+
+  /** Makes generated style names unique as writeMps does for its own.
+
+      A name of the form \p first and seven digits (as R0000001) which
+      repeats an earlier one is changed to the next unused number.  The
+      new names are kept in \p arena.  Returns the number changed.
+  */
+  static int makeUniqueNames(char **names, int number, char first,
+    CoinNameArena &arena);
+
+  /** Write the problem as a binary snapshot which readBinary can load
+      without any parsing.
+
+      Only the linear part of the problem (matrix, bounds, objective,
+      integer markers, names and objective offset) is saved.  The file
+      is versioned and the arrays are aligned so it could also be mapped
+      into memory and used directly; it can only be read on a machine
+      with the same byte order and CoinBigIndex size.
+      Returns 0 if all went well, -1 on a write error.
+  */
+  int writeBinary(const char *filename) const;
+
+  /** Read a problem written by writeBinary.
+
+      The arrays are read into memory (not used in place from a mapping,
+      as the matrix and bounds own their arrays).  The file must be as
+      written, not compressed, and is checked to be exactly the length
+      given by its header before the current problem is freed.
+      Returns 0 if all went well, -1 if the file could not be opened,
+      -2 if it is not a binary file this version can read and -3 if
+      it is truncated or inconsistent.
+  */
+  int readBinary(const char *filename);
+
+  /// Returns true if the file looks like one written by writeBinary
+  static bool isBinaryFile(const char *filename);
+
   /// Return card reader object so can see what last card was e.g. QUADOBJ
   inline const CoinMpsCardReader *reader() const
   {
@@ -979,13 +1162,15 @@ protected:
   void addString(int iRow, int iColumn, const char *value);
   /// Decode string
   void decodeString(int iString, int &iRow, int &iColumn, const char *&value) const;
+  /** Does the work for both writeMps methods - strings are only put out
+      if useStrings true (when writing this object) */
+  int gutsOfWriteMps(const char *filename, int compression, int formatType,
+    int numberAcross, int numberRows, const double *rowLower,
+    const double *rowUpper, const char *const *rowNames,
+    CoinMpsColumnSource &columns, const CoinPackedMatrix *quadratic,
+    int numberSOS, const CoinSet *setInfo, bool useStrings) const;
   //@}
 
-  // for hashing
-  typedef struct {
-    int index, next;
-  } CoinHashLink;
-
   /**@name Hash table methods */
   //@{
   /// Creates hash list for names (section = 0 for rows, 1 columns)
@@ -996,8 +1181,13 @@ protected:
   void stopHash(int section);
   /// Finds match using hash,  -1 not found
   int findHash(const char *name, int section) const;
+  /// Releases names of a section and starts a new arena for them
+  CoinNameArena *newNameArena(int section);
   //@}
 
+  /// Decodes one chunk of a COLUMNS section (task for CoinParallelRun)
+  static void readColumnsChunk(void *info, int whichChunk);
+
   /**@name Cached problem information */
   //@{
   /// Problem name
@@ -1068,6 +1258,9 @@ protected:
 	  Linked to hash table sections (0 - row names, 1 column names)
       */
   char **names_[2];
+
+  /// Storage for the strings in names_ (shared with any copies)
+  CoinNameArena *nameArena_[2];
   //@}
 
   /** @name Hash tables */
@@ -1079,7 +1272,7 @@ protected:
   int numberHash_[2];
 
   /// Hash tables (two sections, 0 - row names, 1 - column names)
-  mutable CoinHashLink *hash_[2];
+  mutable CoinNameHash *hash_[2];
   //@}
 
   /** @name CoinMpsIO object parameters */
@@ -1091,6 +1284,8 @@ protected:
   double infinity_;
   /// Small element value
   double smallElement_;
+  /// Number of threads for reading COLUMNS section
+  int numberThreads_;
 
   /// Message handler
   CoinMessageHandler *handler_;
@@ -1128,6 +1323,8 @@ protected:
 void CoinMpsIOUnitTest(const std::string &mpsDir);
 // Function to return number in most efficient way
 // section is 0 for columns, 1 for rhs,ranges and 2 for bounds
+// Numbers are written with fewest digits which read back exactly (see
+// CoinDtoa) unless that does not fit in 12 characters (formatType 0)
 /* formatType is
    0 - normal and 8 character names
    1 - extra accuracy
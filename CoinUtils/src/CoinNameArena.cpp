@@ -0,0 +1,121 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cassert>
+#include <cstring>
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinNameArena.hpp"
+
+// Size of first block
+#define COIN_NAME_ARENA_FIRST 4096
+
+CoinNameArena::CoinNameArena()
+  : blocks_(NULL)
+  , blockSizes_(NULL)
+  , numberBlocks_(0)
+  , maximumBlocks_(0)
+  , next_(NULL)
+  , left_(0)
+  , lastName_(NULL)
+  , numberNames_(0)
+  , bytesUsed_(0)
+  , referenceCount_(1)
+{
+}
+
+CoinNameArena::~CoinNameArena()
+{
+  for (int i = 0; i < numberBlocks_; i++)
+    delete[] blocks_[i];
+  delete[] blocks_;
+  delete[] blockSizes_;
+}
+
+void CoinNameArena::release(CoinNameArena *&arena)
+{
+  if (arena) {
+    assert(arena->referenceCount_ > 0);
+    if (!--arena->referenceCount_)
+      delete arena;
+    arena = NULL;
+  }
+}
+
+char *CoinNameArena::add(const char *name)
+{
+  if (owns(name))
+    return const_cast< char * >(name);
+  size_t size = strlen(name) + 1;
+  if (size > left_)
+    newBlock(size);
+  char *put = next_;
+  memcpy(put, name, size);
+  next_ += size;
+  left_ -= size;
+  lastName_ = put;
+  numberNames_++;
+  bytesUsed_ += size;
+  return put;
+}
+
+bool CoinNameArena::takeBack(const char *name)
+{
+  if (!lastName_ || name != lastName_)
+    return false;
+  size_t size = next_ - lastName_;
+  next_ = lastName_;
+  left_ += size;
+  lastName_ = NULL;
+  numberNames_--;
+  bytesUsed_ -= size;
+  return true;
+}
+
+void CoinNameArena::reserve(size_t size)
+{
+  if (size > left_)
+    newBlock(size);
+}
+
+// Newest (and largest) blocks are looked at first
+bool CoinNameArena::owns(const char *name) const
+{
+  for (int i = numberBlocks_ - 1; i >= 0; i--) {
+    const char *start = blocks_[i];
+    if (name >= start && name < start + blockSizes_[i])
+      return true;
+  }
+  return false;
+}
+
+// Blocks at least double so there are never many of them
+void CoinNameArena::newBlock(size_t size)
+{
+  size_t blockSize = COIN_NAME_ARENA_FIRST;
+  if (numberBlocks_)
+    blockSize = 2 * blockSizes_[numberBlocks_ - 1];
+  blockSize = CoinMax(blockSize, size);
+  if (numberBlocks_ == maximumBlocks_) {
+    int newMaximum = CoinMax(2 * maximumBlocks_, 8);
+    char **tempBlocks = new char *[newMaximum];
+    size_t *tempSizes = new size_t[newMaximum];
+    CoinMemcpyN(blocks_, numberBlocks_, tempBlocks);
+    CoinMemcpyN(blockSizes_, numberBlocks_, tempSizes);
+    delete[] blocks_;
+    delete[] blockSizes_;
+    blocks_ = tempBlocks;
+    blockSizes_ = tempSizes;
+    maximumBlocks_ = newMaximum;
+  }
+  next_ = new char[blockSize];
+  blocks_[numberBlocks_] = next_;
+  blockSizes_[numberBlocks_] = blockSize;
+  numberBlocks_++;
+  left_ = blockSize;
+  lastName_ = NULL;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
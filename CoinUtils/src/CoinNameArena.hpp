@@ -0,0 +1,116 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CoinNameArena_H
+#define CoinNameArena_H
+
+#include <cstddef>
+
+/** Storage for row and column names.
+
+    Names are copied end to end into a few large blocks instead of each
+    being malloc'ed, and are all freed together when the arena goes.
+    Blocks double in size and are never moved, so a name stays where it
+    is while more are added (the char ** name arrays in CoinMpsIO,
+    CoinLpIO and CoinModelHash point straight into the arena).
+
+    An arena is reference counted so that a copy of an object (or another
+    class, e.g. CoinModel reading names from CoinMpsIO) can share the
+    names instead of copying them.  add() returns a name already in the
+    arena as it is.  Names are only taken back when the last user calls
+    release().  None of this is thread safe.
+*/
+class CoinNameArena {
+
+public:
+  /**@name Constructors and destructor */
+  //@{
+  /// Default constructor - empty arena with one user
+  CoinNameArena();
+  /// Destructor
+  ~CoinNameArena();
+  //@}
+
+  /**@name Adding names */
+  //@{
+  /** Returns a copy of name in the arena.
+
+      If name is already in this arena it is returned unchanged.
+  */
+  char *add(const char *name);
+  /** If name was the last copy made by add its space is reused.
+
+      Returns true if so.  Used when a name turns out to be a duplicate.
+  */
+  bool takeBack(const char *name);
+  /// Makes sure at least size bytes can be added without a new block
+  void reserve(size_t size);
+  //@}
+
+  /**@name Sharing */
+  //@{
+  /// Adds a user and returns this
+  inline CoinNameArena *share()
+  {
+    referenceCount_++;
+    return this;
+  }
+  /// Removes a user (deleting the arena if it was the last) and sets arena NULL
+  static void release(CoinNameArena *&arena);
+  /// Number of users
+  inline int referenceCount() const
+  {
+    return referenceCount_;
+  }
+  //@}
+
+  /**@name Queries */
+  //@{
+  /// True if name points into this arena
+  bool owns(const char *name) const;
+  /// Number of names copied in
+  inline int numberNames() const
+  {
+    return numberNames_;
+  }
+  /// Bytes used by names (including the terminating nulls)
+  inline size_t bytesUsed() const
+  {
+    return bytesUsed_;
+  }
+  //@}
+
+private:
+  /// Not copyable (use share)
+  CoinNameArena(const CoinNameArena &);
+  CoinNameArena &operator=(const CoinNameArena &);
+  /// Starts a new block of at least size bytes
+  void newBlock(size_t size);
+
+  /// Start of each block
+  char **blocks_;
+  /// Size of each block
+  size_t *blockSizes_;
+  /// Number of blocks
+  int numberBlocks_;
+  /// Room in blocks_
+  int maximumBlocks_;
+  /// Where next name goes in last block
+  char *next_;
+  /// Bytes left in last block
+  size_t left_;
+  /// Last name copied by add (or NULL)
+  char *lastName_;
+  /// Number of names copied in
+  int numberNames_;
+  /// Bytes used by names
+  size_t bytesUsed_;
+  /// Number of users
+  int referenceCount_;
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
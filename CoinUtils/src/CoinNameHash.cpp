@@ -0,0 +1,188 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstring>
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinNameHash.hpp"
+
+CoinNameHash::CoinNameHash()
+  : names_(NULL)
+  , slots_(NULL)
+  , mask_(-1)
+  , numberEntries_(0)
+  , lengths_(NULL)
+  , maximumIndex_(0)
+{
+}
+
+CoinNameHash::CoinNameHash(const CoinNameHash &rhs)
+  : names_(rhs.names_)
+  , slots_(NULL)
+  , mask_(rhs.mask_)
+  , numberEntries_(rhs.numberEntries_)
+  , lengths_(NULL)
+  , maximumIndex_(rhs.maximumIndex_)
+{
+  if (rhs.slots_) {
+    slots_ = new CoinNameHashSlot[mask_ + 1];
+    CoinMemcpyN(rhs.slots_, mask_ + 1, slots_);
+  }
+  if (rhs.lengths_)
+    lengths_ = CoinCopyOfArray(rhs.lengths_, maximumIndex_);
+}
+
+CoinNameHash &
+CoinNameHash::operator=(const CoinNameHash &rhs)
+{
+  if (this != &rhs) {
+    clear();
+    names_ = rhs.names_;
+    mask_ = rhs.mask_;
+    numberEntries_ = rhs.numberEntries_;
+    maximumIndex_ = rhs.maximumIndex_;
+    if (rhs.slots_) {
+      slots_ = new CoinNameHashSlot[mask_ + 1];
+      CoinMemcpyN(rhs.slots_, mask_ + 1, slots_);
+    }
+    if (rhs.lengths_)
+      lengths_ = CoinCopyOfArray(rhs.lengths_, maximumIndex_);
+  }
+  return *this;
+}
+
+CoinNameHash::~CoinNameHash()
+{
+  clear();
+}
+
+void CoinNameHash::clear()
+{
+  delete[] slots_;
+  delete[] lengths_;
+  slots_ = NULL;
+  lengths_ = NULL;
+  mask_ = -1;
+  numberEntries_ = 0;
+  maximumIndex_ = 0;
+}
+
+/* FNV-1a over the characters (finding the length on the way) and then
+   a final mix so that the low bits used for the slot depend on all of them.
+*/
+unsigned int
+CoinNameHash::hashValue(const char *name, int &length)
+{
+  const unsigned char *get = reinterpret_cast< const unsigned char * >(name);
+  unsigned int hash = 2166136261u;
+  while (*get) {
+    hash = (hash ^ *get) * 16777619u;
+    get++;
+  }
+  length = static_cast< int >(get - reinterpret_cast< const unsigned char * >(name));
+  hash ^= hash >> 16;
+  hash *= 0x85ebca6bu;
+  hash ^= hash >> 13;
+  hash *= 0xc2b2ae35u;
+  hash ^= hash >> 16;
+  return hash;
+}
+
+int CoinNameHash::build(const char *const *names, int number)
+{
+  clear();
+  names_ = names;
+  reserve(number);
+  maximumIndex_ = number;
+  lengths_ = new int[maximumIndex_];
+  int numberDuplicates = 0;
+  for (int i = 0; i < number; i++) {
+    if (insert(i) != i)
+      numberDuplicates++;
+  }
+  return numberDuplicates;
+}
+
+int CoinNameHash::insert(int index)
+{
+  reserve(numberEntries_ + 1);
+  if (index >= maximumIndex_) {
+    int newMaximum = CoinMax(CoinMax(2 * maximumIndex_, index + 1), 16);
+    int *temp = new int[newMaximum];
+    CoinMemcpyN(lengths_, maximumIndex_, temp);
+    delete[] lengths_;
+    lengths_ = temp;
+    maximumIndex_ = newMaximum;
+  }
+  const char *name = names_[index];
+  int length;
+  unsigned int hash = hashValue(name, length);
+  unsigned int mask = static_cast< unsigned int >(mask_);
+  unsigned int iPosition = hash & mask;
+  while (slots_[iPosition].index >= 0) {
+    const CoinNameHashSlot &slot = slots_[iPosition];
+    if (slot.hash == hash && lengths_[slot.index] == length
+      && !memcmp(names_[slot.index], name, length))
+      return slot.index;
+    iPosition = (iPosition + 1) & mask;
+  }
+  slots_[iPosition].hash = hash;
+  slots_[iPosition].index = index;
+  lengths_[index] = length;
+  numberEntries_++;
+  return index;
+}
+
+int CoinNameHash::find(const char *name) const
+{
+  if (!numberEntries_)
+    return -1;
+  int length;
+  unsigned int hash = hashValue(name, length);
+  unsigned int mask = static_cast< unsigned int >(mask_);
+  unsigned int iPosition = hash & mask;
+  while (true) {
+    const CoinNameHashSlot &slot = slots_[iPosition];
+    if (slot.index < 0)
+      return -1;
+    if (slot.hash == hash && lengths_[slot.index] == length
+      && !memcmp(names_[slot.index], name, length))
+      return slot.index;
+    iPosition = (iPosition + 1) & mask;
+  }
+}
+
+// Keeps table at most half full
+void CoinNameHash::reserve(int number)
+{
+  if (2 * number <= mask_ + 1)
+    return;
+  int size = 16;
+  while (size < 2 * number)
+    size *= 2;
+  CoinNameHashSlot *oldSlots = slots_;
+  int oldSize = mask_ + 1;
+  slots_ = new CoinNameHashSlot[size];
+  mask_ = size - 1;
+  for (int i = 0; i < size; i++)
+    slots_[i].index = -1;
+  for (int i = 0; i < oldSize; i++) {
+    if (oldSlots[i].index >= 0)
+      enter(oldSlots[i].hash, oldSlots[i].index);
+  }
+  delete[] oldSlots;
+}
+
+void CoinNameHash::enter(unsigned int hash, int index)
+{
+  unsigned int mask = static_cast< unsigned int >(mask_);
+  unsigned int iPosition = hash & mask;
+  while (slots_[iPosition].index >= 0)
+    iPosition = (iPosition + 1) & mask;
+  slots_[iPosition].hash = hash;
+  slots_[iPosition].index = index;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,96 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CoinNameHash_H
+#define CoinNameHash_H
+
+/** Hash table giving the index of a name in an array of names.
+
+    The names themselves stay in the user's array (which must not move while
+    the table is in use, see setNames).  The table is open addressing with
+    linear probing and each slot holds the full hash value next to the
+    index, so a lookup normally touches one cache line of the table and
+    compares at most one string.  The length of each name is kept too.
+    The table is at most half full and grows as needed.
+*/
+class CoinNameHash {
+
+public:
+  /**@name Constructors and destructor */
+  //@{
+  /// Default constructor - empty table
+  CoinNameHash();
+  /// Copy constructor (uses the same name array - see setNames)
+  CoinNameHash(const CoinNameHash &rhs);
+  /// Assignment operator
+  CoinNameHash &operator=(const CoinNameHash &rhs);
+  /// Destructor
+  ~CoinNameHash();
+  //@}
+
+  /**@name Building */
+  //@{
+  /** Builds the table for names[0] .. names[number-1].
+
+      If a name occurs more than once only the first index is entered.
+      Returns the number of names not entered because of this.
+  */
+  int build(const char *const *names, int number);
+  /** Enters names[index] (which must be set in the name array).
+
+      Returns index, or the index already entered if the name is there.
+  */
+  int insert(int index);
+  /// Points the table at a copy of the name array (e.g. after a realloc)
+  inline void setNames(const char *const *names)
+  {
+    names_ = names;
+  }
+  /// Makes room for number names so the table need not grow
+  void reserve(int number);
+  /// Empties the table and frees storage
+  void clear();
+  //@}
+
+  /**@name Lookup */
+  //@{
+  /// Index of name or -1 if not there
+  int find(const char *name) const;
+  /// Number of names entered
+  inline int numberEntries() const
+  {
+    return numberEntries_;
+  }
+  /// Hash value of name (also sets its length)
+  static unsigned int hashValue(const char *name, int &length);
+  //@}
+
+private:
+  /// Puts entry in table - name known not to be there
+  void enter(unsigned int hash, int index);
+
+  /// Slot in table (index -1 if empty)
+  typedef struct {
+    unsigned int hash;
+    int index;
+  } CoinNameHashSlot;
+
+  /// Name array (not owned)
+  const char *const *names_;
+  /// Table
+  CoinNameHashSlot *slots_;
+  /// Number of slots (a power of 2) less one
+  int mask_;
+  /// Number of names entered
+  int numberEntries_;
+  /// Length of each name indexed as names array
+  int *lengths_;
+  /// Room in lengths_
+  int maximumIndex_;
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
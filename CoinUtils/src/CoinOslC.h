@@ -57,12 +57,12 @@ void c_ekkftrn2(register EKKfactinfo *fact, double *dwork1,
   double *dwork1_ft, int *mpt_ft, int *nincolp_ft);
 
 int c_ekklfct(register EKKfactinfo *fact);
-int c_ekkslcf(register const EKKfactinfo *fact);
-inline void c_ekkscpy(int n, const int *marr1, int *marr2)
+CoinBigIndex c_ekkslcf(register const EKKfactinfo *fact);
+inline void c_ekkscpy(CoinBigIndex n, const int *marr1, int *marr2)
 {
   CoinMemcpyN(marr1, n, marr2);
 }
-inline void c_ekkdcpy(int n, const double *marr1, double *marr2)
+inline void c_ekkdcpy(CoinBigIndex n, const double *marr1, double *marr2)
 {
   CoinMemcpyN(marr1, n, marr2);
 }
@@ -71,11 +71,11 @@ void c_ekk_Set(int *array, int bit);
 void c_ekk_Unset(int *array, int bit);
 
 void c_ekkzero(int length, int n, void *array);
-inline void c_ekkdzero(int n, double *marray)
+inline void c_ekkdzero(CoinBigIndex n, double *marray)
 {
   CoinZeroN(marray, n);
 }
-inline void c_ekkizero(int n, int *marray)
+inline void c_ekkizero(CoinBigIndex n, int *marray)
 {
   CoinZeroN(marray, n);
 }
@@ -91,8 +91,8 @@ inline void c_ekkczero(int n, char *marray)
 #define c_ekks1cpy(n, marr1, marr2) CoinMemcpyN(marr1, n, marr2)
 void clp_setup_pointers(EKKfactinfo *fact);
 void clp_memory(int type);
-double *clp_double(int number_entries);
-int *clp_int(int number_entries);
+double *clp_double(CoinBigIndex number_entries);
+int *clp_int(CoinBigIndex number_entries);
 void *clp_malloc(int number_entries);
 void clp_free(void *oldArray);
 
@@ -180,40 +180,46 @@ void clp_free(void *oldArray);
   int *hcoli = fact->xecadr;
   double *dluval = fact->xeeadr;
   double *dvalpv = fact->kw3adr;
-  int *mrstrt = fact->xrsadr;
+  CoinBigIndex *mrstrt = fact->xrsadr;
   int *hrowi = fact->xeradr;
-  int *mcstrt = fact->xcsadr;
+  CoinBigIndex *mcstrt = fact->xcsadr;
   int *hinrow = fact->xrnadr;
   int *hincol = fact->xcnadr;
   int *hpivro = fact->krpadr;
   int *hpivco = fact->kcpadr;
 #endif
-  int nnentl = fact->nnentl;
-  int nnentu = fact->nnentu;
-  int kmxeta = fact->kmxeta;
-  int xnewro = *xnewrop;
+  CoinBigIndex nnentl = fact->nnentl;
+  CoinBigIndex nnentu = fact->nnentu;
+  CoinBigIndex kmxeta = fact->kmxeta;
+  CoinBigIndex xnewro = *xnewrop;
   int ncompactions = *ncompactionsp;
 
   MACTION_T *maction = reinterpret_cast< MACTION_T * >(maction_void);
 
-  int i, j, k;
+  int i, j;
+  CoinBigIndex k;
   double d1;
   int j1, j2;
-  int jj, kk, kr, nz, jj1, jj2, kce, kcs, kqq, npr;
+  int jj, nz, jj1, jj2, npr;
+  CoinBigIndex kk, kr, kce, kcs, kqq;
   int fill, naft;
   int enpr;
-  int nres, npre;
-  int knpr, irow, iadd32, ibase;
+  int npre;
+  CoinBigIndex nres;
+  int irow, iadd32;
+  CoinBigIndex knpr, ibase;
   double pivot;
   int count, nznpr;
   int nlast, epivr1;
-  int kipis;
+  CoinBigIndex kipis;
   double dpivx;
-  int kipie, kcpiv, knprs, knpre;
+  CoinBigIndex kipie, kcpiv, knprs, knpre;
   bool cancel;
   double multip, elemnt;
-  int ipivot, jpivot, epivro, epivco, lstart, nfirst;
-  int nzpivj, kfill, kstart;
+  int ipivot, jpivot, epivro, epivco, nfirst;
+  CoinBigIndex lstart;
+  int nzpivj, kfill;
+  CoinBigIndex kstart;
   int nmove, ileft;
 #ifndef C_EKKCMFY
   int iput, nspare;
@@ -229,8 +235,8 @@ void clp_free(void *oldArray);
 
   /* Function Body */
   lstart = nnetas - nnentl + 1;
-  for (i = lstart; i <= nnetas; ++i) {
-    hrowi[i] = SHIFT_INDEX(hcoli[i]);
+  for (k = lstart; k <= nnetas; ++k) {
+    hrowi[k] = SHIFT_INDEX(hcoli[k]);
   }
 
   for (i = 1; i <= nrow; ++i) {
@@ -369,7 +375,7 @@ void clp_free(void *oldArray);
 
 #if 1
       /* MONSTER_UNROLLED_CODE - see below */
-      kfill = epivr1 - (knpre - knprs + 1);
+      kfill = epivr1 - static_cast< int >(knpre - knprs + 1);
       nres = ((knpre - knprs + 1) & 1) + knprs;
       cancel = false;
       d1 = 1e33;
@@ -427,7 +433,7 @@ void clp_free(void *oldArray);
        * "cancel" says if the result of combining the pivot row with this one
        * causes an entry to get too small; if so, we discard those entries.
        */
-      kfill = epivr1 - (knpre - knprs + 1);
+      kfill = epivr1 - static_cast< int >(knpre - knprs + 1);
       cancel = false;
 
       for (kr = knprs; kr <= knpre; kr++) {
@@ -500,7 +506,7 @@ void clp_free(void *oldArray);
             /* compressions would just be 1 remainder which eventually will */
             /* fit in cache */
             {
-              int iput = c_ekkrwcs(fact, dluval, hcoli, mrstrt, hinrow, mwork, nfirst);
+              CoinBigIndex iput = c_ekkrwcs(fact, dluval, hcoli, mrstrt, hinrow, mwork, nfirst);
               kmxeta += xnewro - iput;
               xnewro = iput - 1;
               ++ncompactions;
@@ -537,7 +543,7 @@ void clp_free(void *oldArray);
             nlast = npr;
             kstart = xnewro;
             mrstrt[npr] = kstart + 1;
-            nmove = knpre - knprs + 1;
+            nmove = static_cast< int >(knpre - knprs + 1);
             ibase = kstart + 1 - knprs;
             for (kr = knprs; kr <= knpre; ++kr) {
               dluval[ibase + kr] = dluval[kr];
@@ -667,7 +673,7 @@ void clp_free(void *oldArray);
           xnewro = kstart;
         }
       }
-      hinrow[npr] = kstart - mrstrt[npr] + 1;
+      hinrow[npr] = static_cast< int >(kstart - mrstrt[npr] + 1);
       /* Check if row or column file needs compression */
       if (!(xnewco + 1 < lstart)) {
         xnewco = c_ekkclco(fact, hrowi, mcstrt, hincol, xnewco);
@@ -676,7 +682,7 @@ void clp_free(void *oldArray);
         kcpiv = mcstrt[jpivot] - 1;
       }
       if (!(xnewro + 1 < lstart)) {
-        int iput = c_ekkrwcs(fact, dluval, hcoli, mrstrt, hinrow, mwork, nfirst);
+        CoinBigIndex iput = c_ekkrwcs(fact, dluval, hcoli, mrstrt, hinrow, mwork, nfirst);
         kmxeta += xnewro - iput;
         xnewro = iput - 1;
         ++ncompactions;
@@ -698,7 +704,8 @@ void clp_free(void *oldArray);
 #if INLINE_AFPV
       {
         int j;
-        int nel, krs;
+        int nel;
+        CoinBigIndex krs;
         int koff;
         int *index;
         double *els;
@@ -766,7 +773,7 @@ void clp_free(void *oldArray);
 
     /* after pivot move biggest to first in each row */
 #if INLINE_AFPV == 0
-    int nn = mcstrt[fact->xnetal] - lstart + 1;
+    CoinBigIndex nn = mcstrt[fact->xnetal] - lstart + 1;
     c_ekkafpv(hrowi + lstart, hcoli, dluval, mrstrt, hinrow, nn);
 #endif
 
@@ -821,7 +828,7 @@ void clp_free(void *oldArray);
           c_ekkizero(nrow, reinterpret_cast< int * >(maction + 1));
         } else {
           /* pack down then back up */
-          int iput = c_ekkrwcs(fact, dluval, hcoli, mrstrt, hinrow, mwork, nfirst);
+          CoinBigIndex iput = c_ekkrwcs(fact, dluval, hcoli, mrstrt, hinrow, mwork, nfirst);
           kmxeta += xnewro - iput;
           xnewro = iput - 1;
           ++ncompactions;
@@ -856,9 +863,9 @@ void clp_free(void *oldArray);
         if (1) {
           /* return and increase size of etas if possible */
           if (!noRoomForDense) {
-            int etasize = CoinMax(4 * fact->nnentu + (nnetas - fact->nnentl) + 1000, fact->eta_size);
+            CoinBigIndex etasize = CoinMax(4 * fact->nnentu + (nnetas - fact->nnentl) + 1000, fact->eta_size);
             noRoomForDense = ndense;
-            fact->eta_size = CoinMin(static_cast< int >(1.2 * fact->eta_size), etasize);
+            fact->eta_size = CoinMin(static_cast< CoinBigIndex >(1.2 * fact->eta_size), etasize);
             if (fact->maxNNetas > 0 && fact->eta_size > fact->maxNNetas) {
               fact->eta_size = fact->maxNNetas;
             }
@@ -870,7 +877,7 @@ void clp_free(void *oldArray);
   }
 
 L1050 : {
-  int iput = c_ekkrwcs(fact, dluval, hcoli, mrstrt, hinrow, mwork, nfirst);
+  CoinBigIndex iput = c_ekkrwcs(fact, dluval, hcoli, mrstrt, hinrow, mwork, nfirst);
   kmxeta += xnewro - iput;
   xnewro = iput - 1;
   ++ncompactions;
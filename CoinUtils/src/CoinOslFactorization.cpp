@@ -2,7 +2,6 @@
 // Copyright (C) 1987, 2009, International Business Machines
 // Corporation and others.  All Rights Reserved.
 // This code is licensed under the terms of the Eclipse Public License (EPL).
-#if COIN_BIG_INDEX == 0
 
 #include "CoinUtilsConfig.h"
 
@@ -140,7 +139,10 @@ void CoinOslFactorization::getAreas(int numberOfRows,
 
   numberRows_ = numberOfRows;
   numberColumns_ = numberOfColumns;
-  CoinBigIndex size = static_cast< CoinBigIndex >(factInfo_.areaFactor * (maximumL + maximumU));
+  // Sizes are worked out in double so growth cannot overflow; keep a
+  // quarter of the index range free for the 4*nnentu style estimates
+  const double maximumSize = static_cast< double >(COIN_BIG_INDEX_MAX >> 2);
+  CoinBigIndex size = static_cast< CoinBigIndex >(CoinMin(factInfo_.areaFactor * (static_cast< double >(maximumL) + static_cast< double >(maximumU)), maximumSize));
   factInfo_.zeroTolerance = zeroTolerance_;
   // If wildly out redo
   if (maximumRows_ > numberRows_ + 1000) {
@@ -154,10 +156,13 @@ void CoinOslFactorization::getAreas(int numberOfRows,
     maximumSpace_ = size;
   }
   factInfo_.lastEtaCount = factInfo_.nnentu + factInfo_.nnentl;
-  int oldnnetas = factInfo_.last_eta_size;
+  CoinBigIndex oldnnetas = factInfo_.last_eta_size;
   // If we are going to increase then be on safe side
   if (size > oldnnetas)
-    size = static_cast< int >(1.1 * size);
+    size = static_cast< CoinBigIndex >(CoinMin(1.1 * size, maximumSize));
+  // Near the cap go straight to it rather than growing in small steps
+  if (factInfo_.maxNNetas > 0 && size > factInfo_.maxNNetas - (factInfo_.maxNNetas >> 3))
+    size = factInfo_.maxNNetas;
   factInfo_.eta_size = CoinMax(size, oldnnetas);
   //printf("clp size %d, old %d now %d - iteration %d - last count %d - rows %d,%d,%d\n",
   // size,oldnnetas,factInfo_.eta_size,factInfo_.iterno,factInfo_.lastEtaCount,
@@ -217,9 +222,9 @@ void CoinOslFactorization::preProcess()
   int *indexRowU = factInfo_.xeradr + 1;
   CoinBigIndex *startColumnU = factInfo_.xcsadr + 1;
   for (int i = 0; i < numberRows_; i++) {
-    int start = startColumnU[i];
+    CoinBigIndex start = startColumnU[i];
     startColumnU[i]++; // to Fortran
-    for (int j = start; j < startColumnU[i + 1]; j++) {
+    for (CoinBigIndex j = start; j < startColumnU[i + 1]; j++) {
       indexRowU[j]++; // to Fortran
       hcoli[j] = i + 1; // to Fortran
     }
@@ -228,7 +233,7 @@ void CoinOslFactorization::preProcess()
 
   /* can do in column order - no zeros or duplicates */
 #ifndef NDEBUG
-  int ninbas =
+  CoinBigIndex ninbas =
 #endif
     c_ekkslcf(&factInfo_);
   assert(ninbas > 0);
@@ -346,8 +351,8 @@ void CoinOslFactorization::postProcess(const int *sequence, int *pivotVariable)
     pivotVariable[i] = k;
   }
 #ifdef CLP_REUSE_ETAS
-  int *start = factInfo_.xcsadr + 1;
-  int *putSeq = factInfo_.xrsadr + 2 * factInfo_.nrowmx + 2;
+  CoinBigIndex *start = factInfo_.xcsadr + 1;
+  CoinBigIndex *putSeq = factInfo_.xrsadr + 2 * factInfo_.nrowmx + 2;
   int *position = putSeq + factInfo_.maxinv;
   int *putStart = position + factInfo_.maxinv;
   memcpy(putStart, start, numberRows_ * sizeof(int));
@@ -360,7 +365,7 @@ void CoinOslFactorization::postProcess(const int *sequence, int *pivotVariable)
     int lstart = numberRows_ + factInfo_.maxinv + 5;
     int ndo = factInfo_.xnetal - lstart;
     double *dluval = factInfo_.xeeadr;
-    int *mcstrt = factInfo_.xcsadr + lstart;
+    CoinBigIndex *mcstrt = factInfo_.xcsadr + lstart;
     if (ndo)
       assert(dluval[mcstrt[ndo] + 1] < 1.0e50);
   }
@@ -400,7 +405,7 @@ int CoinOslFactorization::replaceColumn(CoinIndexedVector *regionSparse,
     int lstart = numberRows_ + factInfo_.maxinv + 5;
     int ndo = factInfo_.xnetal - lstart;
     double *dluval = factInfo_.xeeadr;
-    int *mcstrt = factInfo_.xcsadr + lstart;
+    CoinBigIndex *mcstrt = factInfo_.xcsadr + lstart;
     if (ndo)
       assert(dluval[mcstrt[ndo] + 1] < 1.0e50);
   }
@@ -418,7 +423,7 @@ int CoinOslFactorization::updateColumn(CoinIndexedVector *regionSparse,
     int lstart = numberRows_ + factInfo_.maxinv + 5;
     int ndo = factInfo_.xnetal - lstart;
     double *dluval = factInfo_.xeeadr;
-    int *mcstrt = factInfo_.xcsadr + lstart;
+    CoinBigIndex *mcstrt = factInfo_.xcsadr + lstart;
     if (ndo)
       assert(dluval[mcstrt[ndo] + 1] < 1.0e50);
   }
@@ -559,12 +564,12 @@ int CoinOslFactorization::updateColumnTranspose(CoinIndexedVector *regionSparse,
   } else {
 #ifndef NDEBUG
     {
-      int *mcstrt = factInfo_.xcsadr;
+      CoinBigIndex *mcstrt = factInfo_.xcsadr;
       int *hpivco_new = factInfo_.kcpadr + 1;
       int nrow = factInfo_.nrow;
       int i;
       int ipiv = hpivco_new[0];
-      int last = mcstrt[ipiv];
+      CoinBigIndex last = mcstrt[ipiv];
       for (i = 0; i < nrow - 1; i++) {
         ipiv = hpivco_new[ipiv];
         assert(mcstrt[ipiv] > last);
@@ -572,9 +577,9 @@ int CoinOslFactorization::updateColumnTranspose(CoinIndexedVector *regionSparse,
       }
     }
 #endif
-    int iSmallest = COIN_INT_MAX;
+    CoinBigIndex iSmallest = COIN_BIG_INDEX_MAX;
     int iPiv = 0;
-    const int *mcstrt = factInfo_.xcsadr;
+    const CoinBigIndex *mcstrt = factInfo_.xcsadr;
     // permute and save where nonzeros are
     if (!factInfo_.packedMode) {
       if ((numberRows_ < 200 || (numberNonZero << 4) > numberRows_)) {
@@ -679,7 +684,7 @@ void CoinOslFactorization::setUsefulInformation(const int *info, int whereFrom)
   if (whereFrom) {
     factInfo_.reintro = -1;
     if (factInfo_.first_dense >= factInfo_.last_dense) {
-      int *putSeq = factInfo_.xrsadr + 2 * factInfo_.nrowmx + 2;
+      CoinBigIndex *putSeq = factInfo_.xrsadr + 2 * factInfo_.nrowmx + 2;
       int *position = putSeq + factInfo_.maxinv;
       //int * putStart = position+factInfo_.maxinv;
       int iSequence = info[1];
@@ -818,7 +823,7 @@ static void clp_adjust(void *temp, int size, int type)
 }
 #endif
 /* covers */
-double *clp_double(int number_entries)
+double *clp_double(CoinBigIndex number_entries)
 {
 #if CLP_DEBUG_MALLOC == 0
   return reinterpret_cast< double * >(malloc(number_entries * sizeof(double)));
@@ -833,7 +838,7 @@ double *clp_double(int number_entries)
   return temp + extra;
 #endif
 }
-int *clp_int(int number_entries)
+int *clp_int(CoinBigIndex number_entries)
 {
 #if CLP_DEBUG_MALLOC == 0
   return reinterpret_cast< int * >(malloc(number_entries * sizeof(int)));
@@ -999,20 +1004,22 @@ clp_alloc_memory(EKKfactinfo *fact, int type, int *length)
   /* integer arrays */
   tempI = reinterpret_cast< int * >(tempD);
   tempI = reinterpret_cast< int * >(clp_align(tempI));
-  fact->xrsadr = tempI;
+  /* starts are CoinBigIndex so carve them in units of that */
+  const int bigUnit = static_cast< int >(sizeof(CoinBigIndex) / sizeof(int));
+  fact->xrsadr = reinterpret_cast< CoinBigIndex * >(tempI);
 #ifdef CLP_REUSE_ETAS
-  tempI += (3 * (nrowmx + fact->maxinv + 1));
+  tempI += (3 * (nrowmx + fact->maxinv + 1)) * bigUnit;
 #else
-  tempI += ((nrowmx << 1) + fact->maxinv + 1);
+  tempI += ((nrowmx << 1) + fact->maxinv + 1) * bigUnit;
 #endif
   tempI = reinterpret_cast< int * >(clp_align(tempI));
-  fact->xcsadr = tempI;
+  fact->xcsadr = reinterpret_cast< CoinBigIndex * >(tempI);
 #if 1 //def CLP_REUSE_ETAS
-  tempI += (2 * nrowmx + 8 + 2 * fact->maxinv);
+  tempI += (2 * nrowmx + 8 + 2 * fact->maxinv) * bigUnit;
 #else
-  tempI += (2 * nrowmx + 8 + fact->maxinv);
+  tempI += (2 * nrowmx + 8 + fact->maxinv) * bigUnit;
 #endif
-  tempI += FIX_ADD + FIX_ADD2;
+  tempI += (FIX_ADD + FIX_ADD2) * bigUnit;
   tempI = reinterpret_cast< int * >(clp_align(tempI));
   fact->xrnadr = tempI;
   tempI += nrowmx;
@@ -1045,7 +1052,7 @@ clp_alloc_memory(EKKfactinfo *fact, int type, int *length)
 static void c_ekksmem(EKKfactinfo *fact, int nrow, int maximumPivots)
 {
   /* space for invert */
-  int nnetas = fact->eta_size;
+  CoinBigIndex nnetas = fact->eta_size;
   fact->nrow = nrow;
   if (!(nnetas > fact->last_eta_size || (!fact->xe2adr && fact->if_sparse_update) || nrow > fact->nrowmx || maximumPivots > fact->maxinv))
     return;
@@ -1119,8 +1126,8 @@ static void c_ekksmem(EKKfactinfo *fact, int nrow, int maximumPivots)
   }
   if (!nnetas) {
     char msg[100];
-    sprintf(msg, "Unable to allocate factorization memory for %d elements",
-      nnetas);
+    sprintf(msg, "Unable to allocate factorization memory for %g elements",
+      static_cast< double >(fact->eta_size));
     throw(msg);
   }
   /*c_ekklplp->nnetas=nnetas;*/
@@ -1130,7 +1137,8 @@ static void c_ekksmem(EKKfactinfo *fact, int nrow, int maximumPivots)
 static void c_ekksmem_copy(EKKfactinfo *fact, const EKKfactinfo *rhsFact)
 {
   /* space for invert */
-  int nrowmx = rhsFact->nrowmx, nnetas = rhsFact->nnetas;
+  int nrowmx = rhsFact->nrowmx;
+  CoinBigIndex nnetas = rhsFact->nnetas;
   int canReuseEtas = (fact->eta_size == rhsFact->eta_size) ? 1 : 0;
   int canReuseArrays = (fact->nrowmx == rhsFact->nrowmx) ? 1 : 0;
   clp_adjust_pointers(fact, +1);
@@ -1138,10 +1146,11 @@ static void c_ekksmem_copy(EKKfactinfo *fact, const EKKfactinfo *rhsFact)
   /*memset(fact,0,sizeof(EKKfactinfo));*/
   /* copy scalars */
   memcpy(&fact->drtpiv, &rhsFact->drtpiv, 5 * sizeof(double));
-  memcpy(&fact->nrow, &rhsFact->nrow, ((&fact->maxNNetas - &fact->nrow) + 1) * sizeof(int));
+  memcpy(&fact->nrow, &rhsFact->nrow,
+    reinterpret_cast< const char * >(&rhsFact->maxNNetas + 1) - reinterpret_cast< const char * >(&rhsFact->nrow));
   if (nrowmx) {
     int length;
-    int kCopyEnd, nCopyEnd, nCopyStart;
+    CoinBigIndex kCopyEnd, nCopyEnd, nCopyStart;
     if (!canReuseEtas) {
       clp_free(fact->xeradr);
       clp_free(fact->xecadr);
@@ -1164,9 +1173,9 @@ static void c_ekksmem_copy(EKKfactinfo *fact, const EKKfactinfo *rhsFact)
     assert(nnetas);
     {
       int n2 = rhsFact->nR_etas;
-      int n3 = n2 ? rhsFact->R_etas_start[1 + n2] : 0;
+      CoinBigIndex n3 = n2 ? rhsFact->R_etas_start[1 + n2] : 0;
       int *startR = rhsFact->R_etas_index + n3;
-      nCopyEnd = static_cast< int >((rhsFact->xeradr + nnetas) - startR);
+      nCopyEnd = static_cast< CoinBigIndex >((rhsFact->xeradr + nnetas) - startR);
       nCopyStart = rhsFact->nnentu;
       nCopyEnd = CoinMin(nCopyEnd + 20, nnetas);
       kCopyEnd = nnetas - nCopyEnd;
@@ -1242,7 +1251,7 @@ static void c_ekksmem_copy(EKKfactinfo *fact, const EKKfactinfo *rhsFact)
           int i;
           int *hcoliR = rhsFact->xecadr - 1;
           int *hcoli = fact->xecadr - 1;
-          int *mrstrt = fact->xrsadr;
+          CoinBigIndex *mrstrt = fact->xrsadr;
           int *hinrow = fact->xrnadr;
 #if 0
 	  memcpy(fact->xecadr+kCopyEnd,rhsFact->xecadr+kCopyEnd,
@@ -1252,7 +1261,7 @@ static void c_ekksmem_copy(EKKfactinfo *fact, const EKKfactinfo *rhsFact)
 #endif
           if (!fact->xe2adr) {
             for (i = 0; i < fact->nrow; i++) {
-              int istart = mrstrt[i];
+              CoinBigIndex istart = mrstrt[i];
               assert(istart > 0 && istart <= nnetas);
               assert(hinrow[i] >= 0 && hinrow[i] <= fact->nrow);
               memcpy(hcoli + istart, hcoliR + istart, hinrow[i] * sizeof(int));
@@ -1267,14 +1276,14 @@ static void c_ekksmem_copy(EKKfactinfo *fact, const EKKfactinfo *rhsFact)
             c_ekkdcpy(nCopyEnd, rhsFact->xe2adr + kCopyEnd, fact->xe2adr + kCopyEnd);
 #endif
             for (i = 0; i < fact->nrow; i++) {
-              int istart = mrstrt[i];
+              CoinBigIndex istart = mrstrt[i];
               assert(istart > 0 && istart <= nnetas);
               assert(hinrow[i] >= 0 && hinrow[i] <= fact->nrow);
               memcpy(hcoli + istart, hcoliR + istart, hinrow[i] * sizeof(int));
               memcpy(de2val + istart, de2valR + istart, hinrow[i] * sizeof(double));
 #ifndef NDEBUG
               {
-                int j;
+                CoinBigIndex j;
                 for (j = istart; j < istart + hinrow[i]; j++)
                   assert(fabs(de2val[j]) < 1.0e50);
               }
@@ -1420,7 +1429,7 @@ int CoinOslFactorization::factorize(
   // Fill in counts so we can skip part of preProcess
   double *elementU = elements();
   int *indexRowU = indices();
-  int *startColumnU = starts();
+  CoinBigIndex *startColumnU = starts();
   int *numberInRow = this->numberInRow();
   int *numberInColumn = this->numberInColumn();
   CoinZeroN(numberInRow, numberRows);
@@ -1479,16 +1488,15 @@ CoinOslFactorization::conditionNumber() const
 {
   double condition = 1.0;
   const double *dluval = factInfo_.xeeadr + 1 - 1; // stored before
-  const int *mcstrt = factInfo_.xcsadr + 1;
+  const CoinBigIndex *mcstrt = factInfo_.xcsadr + 1;
   for (int i = 0; i < numberRows_; i++) {
-    const int kx = mcstrt[i];
+    const CoinBigIndex kx = mcstrt[i];
     const double dpiv = dluval[kx];
     condition *= dpiv;
   }
   condition = CoinMax(fabs(condition), 1.0e-50);
   return 1.0 / condition;
 }
-#endif
 
 /* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
 */
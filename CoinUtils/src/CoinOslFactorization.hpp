@@ -34,8 +34,8 @@ typedef struct _EKKfactinfo {
   double zpivlu;
   double zeroTolerance;
   double areaFactor;
-  int *xrsadr;
-  int *xcsadr;
+  CoinBigIndex *xrsadr;
+  CoinBigIndex *xcsadr;
   int *xrnadr;
   int *xcnadr;
   int *krpadr;
@@ -47,7 +47,7 @@ typedef struct _EKKfactinfo {
   double *trueStart;
   mutable double *kadrpm;
   int *R_etas_index;
-  int *R_etas_start;
+  CoinBigIndex *R_etas_start;
   double *R_etas_element;
 
   int *xecadr;
@@ -65,20 +65,20 @@ typedef struct _EKKfactinfo {
   int firstDoRow;
   int firstLRow;
   int maxinv;
-  int nnetas;
+  CoinBigIndex nnetas;
   int iterin;
   int iter0;
   int invok;
   int nbfinv;
   int num_resets;
-  int nnentl;
-  int nnentu;
+  CoinBigIndex nnentl;
+  CoinBigIndex nnentu;
 #ifdef CLP_REUSE_ETAS
-  int save_nnentu;
+  CoinBigIndex save_nnentu;
 #endif
   int ndenuc;
   int npivots; /* use as xpivsq in factorization */
-  int kmxeta;
+  CoinBigIndex kmxeta;
   int xnetal;
   int first_dense;
   int last_dense;
@@ -98,11 +98,11 @@ typedef struct _EKKfactinfo {
 #endif
   int nR_etas;
   int sortedEta; /* if vector for F-T is sorted */
-  int lastEtaCount;
+  CoinBigIndex lastEtaCount;
   int ifvsol;
-  int eta_size;
-  int last_eta_size;
-  int maxNNetas;
+  CoinBigIndex eta_size;
+  CoinBigIndex last_eta_size;
+  CoinBigIndex maxNNetas;
 } EKKfactinfo;
 
 class CoinOslFactorization : public CoinOtherFactorization {
@@ -129,8 +129,8 @@ public:
   /// Gets space for a factorization
   virtual void getAreas(int numberRows,
     int numberColumns,
-    int maximumL,
-    int maximumU);
+    CoinBigIndex maximumL,
+    CoinBigIndex maximumU);
 
   /// PreProcesses column ordered copy of basis
   virtual void preProcess();
@@ -159,9 +159,9 @@ public:
   /**@name general stuff such as number of elements */
   //@{
   /// Total number of elements in factorization
-  virtual inline int numberElements() const
+  virtual inline CoinBigIndex numberElements() const
   {
-    return numberRows_ * (numberColumns_ + numberPivots_);
+    return static_cast< CoinBigIndex >(numberRows_) * (numberColumns_ + numberPivots_);
   }
   /// Returns array to put basis elements in
   virtual CoinFactorizationDouble *elements() const;
@@ -176,7 +176,7 @@ public:
   /// Number of entries in each column
   virtual int *numberInColumn() const;
   /// Returns array to put basis starts in
-  virtual int *starts() const;
+  virtual CoinBigIndex *starts() const;
   /// Returns permute back
   virtual int *permuteBack() const;
   /// Returns true if wants tableauColumn in replaceColumn
@@ -281,6 +281,12 @@ protected:
   EKKfactinfo factInfo_;
   //@}
 };
+
+//#############################################################################
+/** A function that tests CoinOslFactorization - solves after updates and
+    the eta sizes getAreas works out.  Not compiled into the library so it
+    can be compiled with debugging. */
+void CoinOslFactorizationUnitTest(const std::string &mpsDir);
 #endif
 
 /* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
@@ -5,7 +5,6 @@
 
   This code is licensed under the terms of the Eclipse Public License (EPL).
 */
-#if COIN_BIG_INDEX == 0
 /*
   CLP_OSL - if defined use osl
   0 - don't unroll 2 and 3 - don't use in Gomory
@@ -336,7 +335,7 @@ double c_ekkputl(const EKKfactinfo *COIN_RESTRICT2 fact,
 {
   double *COIN_RESTRICT dwork3 = fact->xeeadr + fact->nnentu;
   int *COIN_RESTRICT hrowi = fact->xeradr + fact->nnentu;
-  int offset = fact->R_etas_start[fact->nR_etas + 1];
+  CoinBigIndex offset = fact->R_etas_start[fact->nR_etas + 1];
   int *COIN_RESTRICT hrowiR = fact->R_etas_index + offset;
   double *COIN_RESTRICT dluval = fact->R_etas_element + offset;
   int i, j;
@@ -375,7 +374,7 @@ int c_ekkputl2(const EKKfactinfo *COIN_RESTRICT2 fact,
 {
   double *COIN_RESTRICT dwork3 = fact->xeeadr + fact->nnentu;
   int *COIN_RESTRICT hrowi = fact->xeradr + fact->nnentu;
-  int offset = fact->R_etas_start[fact->nR_etas + 1];
+  CoinBigIndex offset = fact->R_etas_start[fact->nR_etas + 1];
   int *COIN_RESTRICT hrowiR = fact->R_etas_index + offset;
   double *COIN_RESTRICT dluval = fact->R_etas_element + offset;
   int i, j;
@@ -423,14 +422,14 @@ int c_ekkputl2(const EKKfactinfo *COIN_RESTRICT2 fact,
 } /* c_ekkputl */
 static void c_ekkbtj4p_no_dense(const int nrow, const double *COIN_RESTRICT dluval,
   const int *COIN_RESTRICT hrowi,
-  const int *COIN_RESTRICT mcstrt,
+  const CoinBigIndex *COIN_RESTRICT mcstrt,
   double *COIN_RESTRICT dwork1, int ndo, int jpiv)
 {
   int i;
   double dv1;
-  int iel;
+  CoinBigIndex iel;
   int irow;
-  int i1, i2;
+  CoinBigIndex i1, i2;
 
   /* count down to first nonzero */
   for (i = nrow; i >= 1; i--) {
@@ -448,7 +447,7 @@ static void c_ekkbtj4p_no_dense(const int nrow, const double *COIN_RESTRICT dluv
     double dv1b = 0.0;
     int nel;
     i1 = mcstrt[i];
-    nel = i1 - i2;
+    nel = static_cast< int >(i1 - i2);
     dv1 = dwork1[i];
     iel = i2;
     if ((nel & 1) != 0) {
@@ -469,12 +468,12 @@ static void c_ekkbtj4p_no_dense(const int nrow, const double *COIN_RESTRICT dluv
 
 static int c_ekkbtj4p_dense(const int nrow, const double *COIN_RESTRICT dluval,
   const int *COIN_RESTRICT hrowi,
-  const int *COIN_RESTRICT mcstrt, double *COIN_RESTRICT dwork1,
+  const CoinBigIndex *COIN_RESTRICT mcstrt, double *COIN_RESTRICT dwork1,
   int ndenuc,
   int ndo, int jpiv)
 {
   int i;
-  int i2;
+  CoinBigIndex i2;
 
   int last = ndo - ndenuc + 1;
   double *COIN_RESTRICT densew = &dwork1[nrow - 1];
@@ -527,15 +526,15 @@ static int c_ekkbtj4p_dense(const int nrow, const double *COIN_RESTRICT dluval,
 
 static void c_ekkbtj4p_after_dense(const double *COIN_RESTRICT dluval,
   const int *COIN_RESTRICT hrowi,
-  const int *COIN_RESTRICT mcstrt,
+  const CoinBigIndex *COIN_RESTRICT mcstrt,
   double *COIN_RESTRICT dwork1, int i, int jpiv)
 {
-  int iel;
+  CoinBigIndex iel;
   mcstrt -= jpiv;
   i += jpiv;
   iel = mcstrt[i + 1];
   for (; i > jpiv + 1; i -= 2) {
-    int i1 = mcstrt[i];
+    CoinBigIndex i1 = mcstrt[i];
     double dv1 = dwork1[i];
     double dv2;
     for (; iel < i1; iel++) {
@@ -552,7 +551,7 @@ static void c_ekkbtj4p_after_dense(const double *COIN_RESTRICT dluval,
     dwork1[i - 1] = dv2;
   }
   if (i > jpiv) {
-    int i1 = mcstrt[i];
+    CoinBigIndex i1 = mcstrt[i];
     double dv1 = dwork1[i];
     for (; iel < i1; iel++) {
       int irow = hrowi[iel];
@@ -569,7 +568,7 @@ static void c_ekkbtj4p(COIN_REGISTER const EKKfactinfo *COIN_RESTRICT2 fact,
   const int *COIN_RESTRICT hpivco = fact->kcpadr;
   const double *COIN_RESTRICT dluval = fact->xeeadr + 1;
   const int *COIN_RESTRICT hrowi = fact->xeradr + 1;
-  const int *COIN_RESTRICT mcstrt = fact->xcsadr + lstart - 1;
+  const CoinBigIndex *COIN_RESTRICT mcstrt = fact->xcsadr + lstart - 1;
   int jpiv = hpivco[lstart] - 1;
   int ndo = fact->xnetalval;
   /*     see if dense enough to unroll */
@@ -590,22 +589,23 @@ static int c_ekkbtj4_sparse(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fac
 {
   const int nrow = fact->nrow;
   const int *COIN_RESTRICT hcoli = fact->xecadr;
-  const int *COIN_RESTRICT mrstrt = fact->xrsadr + nrow;
+  const CoinBigIndex *COIN_RESTRICT mrstrt = fact->xrsadr + nrow;
   char *COIN_RESTRICT nonzero = fact->nonzero;
   const int *COIN_RESTRICT hpivro = fact->krpadr;
   const double *COIN_RESTRICT de2val = fact->xe2adr - 1;
   double tolerance = fact->zeroTolerance;
   double dv;
-  int iel;
+  CoinBigIndex iel;
 
-  int k, nStack, kx;
+  int k, nStack;
+  CoinBigIndex kx;
   int nList = 0;
   int *COIN_RESTRICT list = spare;
   int *COIN_RESTRICT stack = spare + nrow;
   int *COIN_RESTRICT next = stack + nrow;
   int iPivot, kPivot;
   int iput, nput = 0, kput = nrow;
-  int j;
+  CoinBigIndex j;
   int firstDoRow = fact->firstDoRow;
 
   for (k = 0; k < nincol; k++) {
@@ -613,12 +613,13 @@ static int c_ekkbtj4_sparse(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fac
     iPivot = mpt[k];
     if (nonzero[iPivot] != 1 && iPivot >= firstDoRow) {
       stack[0] = iPivot;
-      next[0] = mrstrt[iPivot];
+      next[0] = 0;
       while (nStack) {
         /* take off stack */
         kPivot = stack[--nStack];
         if (nonzero[kPivot] != 1 && kPivot >= firstDoRow) {
-          j = next[nStack];
+          /* next holds offsets within rows */
+          j = mrstrt[kPivot] + next[nStack];
           if (j == mrstrt[kPivot + 1]) {
             /* finished so mark */
             list[nList++] = kPivot;
@@ -631,7 +632,7 @@ static int c_ekkbtj4_sparse(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fac
               /* and new one */
               stack[nStack] = kPivot;
               nonzero[kPivot] = 2;
-              next[nStack++] = mrstrt[kPivot];
+              next[nStack++] = 0;
             }
           }
         } else if (kPivot < firstDoRow) {
@@ -723,11 +724,12 @@ static int c_ekkbtj4_sparse(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fac
 static void c_ekkbtjl(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fact,
   double *COIN_RESTRICT dwork1)
 {
-  int i, j, k, k1;
+  int i, j, k;
+  CoinBigIndex k1;
   int l1;
   const double *COIN_RESTRICT dluval = fact->R_etas_element;
   const int *COIN_RESTRICT hrowi = fact->R_etas_index;
-  const int *COIN_RESTRICT mcstrt = fact->R_etas_start;
+  const CoinBigIndex *COIN_RESTRICT mcstrt = fact->R_etas_start;
   const int *COIN_RESTRICT hpivco = fact->hpivcoR;
   int ndo = fact->nR_etas;
 #ifndef UNROLL1
@@ -738,9 +740,9 @@ static void c_ekkbtjl(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fact,
 #endif
   int kn;
   double dv;
-  int iel;
+  CoinBigIndex iel;
   int ipiv;
-  int knext;
+  CoinBigIndex knext;
 
   knext = mcstrt[ndo + 1];
 #if UNROLL1 > 2
@@ -750,7 +752,7 @@ static void c_ekkbtjl(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fact,
     ipiv = hpivco[i];
     dv = dwork1[ipiv];
     /*       fast floating */
-    k = knext - k1;
+    k = static_cast< int >(knext - k1);
     kn = k >> 2;
     iel = k1 + 1;
     if (dv != 0.) {
@@ -790,7 +792,7 @@ static void c_ekkbtjl(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fact,
     knext = mcstrt[i];
     ipiv = hpivco[i];
     dv = dwork1[ipiv];
-    k = knext - k1;
+    k = static_cast< int >(knext - k1);
     kn = k >> 1;
     iel = k1 + 1;
     if (dv != 0.) {
@@ -820,15 +822,16 @@ static int c_ekkbtjl_sparse(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fac
 {
   const double *COIN_RESTRICT dluval = fact->R_etas_element;
   const int *COIN_RESTRICT hrowi = fact->R_etas_index;
-  const int *COIN_RESTRICT mcstrt = fact->R_etas_start;
+  const CoinBigIndex *COIN_RESTRICT mcstrt = fact->R_etas_start;
   const int *COIN_RESTRICT hpivco = fact->hpivcoR;
   char *COIN_RESTRICT nonzero = fact->nonzero;
   int ndo = fact->nR_etas;
-  int i, j, k1;
+  int i;
+  CoinBigIndex j, k1;
   double dv;
   int ipiv;
   int irow0, irow1;
-  int knext;
+  CoinBigIndex knext;
   int number = nincol;
 
   /*     ------------------------------------------- */
@@ -876,7 +879,7 @@ static int c_ekkbtjl_sparse(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fac
 static void c_ekkbtju_dense(const int nrow,
   const double *COIN_RESTRICT dluval,
   const int *COIN_RESTRICT hrowi,
-  const int *COIN_RESTRICT mcstrt,
+  const CoinBigIndex *COIN_RESTRICT mcstrt,
   int *COIN_RESTRICT hpivco,
   double *COIN_RESTRICT dwork1,
   int *COIN_RESTRICT start, int last, int offset,
@@ -891,9 +894,10 @@ static void c_ekkbtju_dense(const int nrow,
   ipiv1 = *start;
   ipiv2 = hpivco[ipiv1];
   while (ipiv2 < last) {
-    int iel, k;
-    const int kx1 = mcstrt[ipiv1];
-    const int kx2 = mcstrt[ipiv2];
+    int k;
+    CoinBigIndex iel;
+    const CoinBigIndex kx1 = mcstrt[ipiv1];
+    const CoinBigIndex kx2 = mcstrt[ipiv2];
     const int nel1 = hrowi[kx1 - 1];
     const int nel2 = hrowi[kx2 - 1];
     const double dpiv1 = dluval[kx1 - 1];
@@ -901,8 +905,8 @@ static void c_ekkbtju_dense(const int nrow,
     const int n1 = offset + ipiv1; /* number in dense part */
     const int nsparse1 = nel1 - n1;
     const int nsparse2 = nel2 - n1 - (ipiv2 - ipiv1);
-    const int k1 = kx1 + nsparse1;
-    const int k2 = kx2 + nsparse2;
+    const CoinBigIndex k1 = kx1 + nsparse1;
+    const CoinBigIndex k2 = kx2 + nsparse2;
     const double *dlu1 = &dluval[k1];
     const double *dlu2 = &dluval[k2];
 
@@ -934,7 +938,7 @@ static void c_ekkbtju_dense(const int nrow,
 /* about 8-10% of execution time is spent in this routine */
 static int c_ekkbtju_aux(const double *COIN_RESTRICT dluval,
   const int *COIN_RESTRICT hrowi,
-  const int *COIN_RESTRICT mcstrt,
+  const CoinBigIndex *COIN_RESTRICT mcstrt,
   const int *COIN_RESTRICT hpivco,
   double *COIN_RESTRICT dwork1,
   int ipiv, int loop_end)
@@ -948,7 +952,7 @@ static int c_ekkbtju_aux(const double *COIN_RESTRICT dluval,
 #endif
 #endif
   while (ipiv <= loop_end) {
-    int kx = mcstrt[ipiv];
+    CoinBigIndex kx = mcstrt[ipiv];
     const int nel = hrowi[kx - 1];
 #if UNROLL2 < 2
     const int kxe = kx + nel;
@@ -1040,7 +1044,7 @@ static void c_ekkbtju(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fact,
   const int nrow = fact->nrow;
   double *COIN_RESTRICT dluval = fact->xeeadr;
   int *COIN_RESTRICT hrowi = fact->xeradr;
-  int *COIN_RESTRICT mcstrt = fact->xcsadr;
+  CoinBigIndex *COIN_RESTRICT mcstrt = fact->xcsadr;
   int *COIN_RESTRICT hpivco_new = fact->kcpadr + 1;
   int ndenuc = fact->ndenuc;
   int first_dense = fact->first_dense;
@@ -1069,9 +1073,9 @@ static void c_ekkbtju(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fact,
 
     /* check first dense to see where in triangle it is */
     int last = first_dense;
-    int j = mcstrt[last] - 1;
-    int k1 = j;
-    int k2 = j + hrowi[j];
+    CoinBigIndex j = mcstrt[last] - 1;
+    CoinBigIndex k1 = j;
+    CoinBigIndex k2 = j + hrowi[j];
 
     for (j = k2; j > k1; j--) {
       int irow = UNSHIFT_INDEX(hrowi[j]);
@@ -1106,16 +1110,17 @@ static int c_ekkbtju_sparse(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fac
   int *COIN_RESTRICT spare)
 {
   const double *COIN_RESTRICT dluval = fact->xeeadr + 1;
-  const int *COIN_RESTRICT mcstrt = fact->xcsadr;
+  const CoinBigIndex *COIN_RESTRICT mcstrt = fact->xcsadr;
   char *COIN_RESTRICT nonzero = fact->nonzero;
   const int *COIN_RESTRICT hcoli = fact->xecadr;
-  const int *COIN_RESTRICT mrstrt = fact->xrsadr;
+  const CoinBigIndex *COIN_RESTRICT mrstrt = fact->xrsadr;
   const int *COIN_RESTRICT hinrow = fact->xrnadr;
   const double *COIN_RESTRICT de2val = fact->xe2adr - 1;
   int i;
   int iPivot;
   int nList = 0;
-  int nStack, k, kx;
+  int nStack, k;
+  CoinBigIndex kx;
   const int nrow = fact->nrow;
   const double tolerance = fact->zeroTolerance;
   int *COIN_RESTRICT list = spare;
@@ -1173,9 +1178,9 @@ static int c_ekkbtju_sparse(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fac
     dv = dpiv * dwork1[iPivot];
     nonzero[iPivot] = 0;
     if (fabs(dv) >= tolerance) {
-      int iel;
-      int krx = mrstrt[iPivot];
-      int krxe = krx + hinrow[iPivot];
+      CoinBigIndex iel;
+      CoinBigIndex krx = mrstrt[iPivot];
+      CoinBigIndex krxe = krx + hinrow[iPivot];
       dwork1[iPivot] = dv;
       mpt[nList++] = iPivot;
       for (iel = krx; iel < krxe; iel++) {
@@ -1523,10 +1528,10 @@ int c_ekkbtrn_ipivrw(COIN_REGISTER3 const EKKfactinfo *COIN_RESTRICT2 fact,
 
   const int *COIN_RESTRICT mpermu = fact->mpermu;
   const double *COIN_RESTRICT dluval = fact->xeeadr;
-  const int *COIN_RESTRICT mrstrt = fact->xrsadr;
+  const CoinBigIndex *COIN_RESTRICT mrstrt = fact->xrsadr;
   const int *COIN_RESTRICT hinrow = fact->xrnadr;
   const int *COIN_RESTRICT hcoli = fact->xecadr;
-  const int *COIN_RESTRICT mcstrt = fact->xcsadr;
+  const CoinBigIndex *COIN_RESTRICT mcstrt = fact->xcsadr;
 
   int nincol;
 
@@ -1554,13 +1559,13 @@ int c_ekkbtrn_ipivrw(COIN_REGISTER3 const EKKfactinfo *COIN_RESTRICT2 fact,
        * so we may as well use it to do the slack row
        */
       int iipivrw = nrow + 1;
-      int itest = fact->nnentu + 1;
-      int k = mrstrt[kpivrw];
-      int lastInRow = k + hinrow[kpivrw];
+      CoinBigIndex itest = fact->nnentu + 1;
+      CoinBigIndex k = mrstrt[kpivrw];
+      CoinBigIndex lastInRow = k + hinrow[kpivrw];
       double dpiv, dv;
       for (; k < lastInRow; k++) {
         int icol = hcoli[k];
-        int start = mcstrt[icol];
+        CoinBigIndex start = mcstrt[icol];
         if (start < itest) {
           iipivrw = icol;
           itest = start;
@@ -1635,7 +1640,7 @@ int c_ekkbtrn_ipivrw(COIN_REGISTER3 const EKKfactinfo *COIN_RESTRICT2 fact,
  */
 static void c_ekketju_aux(COIN_REGISTER2 EKKfactinfo *COIN_RESTRICT2 fact, int sparse,
   double *COIN_RESTRICT dluval, int *COIN_RESTRICT hrowi,
-  const int *COIN_RESTRICT mcstrt, const int *COIN_RESTRICT hpivco,
+  const CoinBigIndex *COIN_RESTRICT mcstrt, const int *COIN_RESTRICT hpivco,
   double *COIN_RESTRICT dwork1,
   int *ipivp, int jpivrw, int stop_col)
 {
@@ -1655,12 +1660,12 @@ static void c_ekketju_aux(COIN_REGISTER2 EKKfactinfo *COIN_RESTRICT2 fact, int s
 
   while (ipiv < stop_col) {
     double dv = dwork1[ipiv];
-    int kx = mcstrt[ipiv];
+    CoinBigIndex kx = mcstrt[ipiv];
     int nel = hrowi[kx];
     double dpiv = dluval[kx];
-    int kcs = kx + 1;
-    int kce = kx + nel;
-    int iel;
+    CoinBigIndex kcs = kx + 1;
+    CoinBigIndex kce = kx + nel;
+    CoinBigIndex iel;
 
     for (iel = kcs; iel <= kce; ++iel) {
       int irow = hrowi[iel];
@@ -1715,7 +1720,7 @@ static void c_ekketju_aux(COIN_REGISTER2 EKKfactinfo *COIN_RESTRICT2 fact, int s
 
 /* dwork1 is assumed to be zeroed on entry */
 static void c_ekketju(COIN_REGISTER EKKfactinfo *COIN_RESTRICT2 fact, double *dluval, int *hrowi,
-  const int *COIN_RESTRICT mcstrt, const int *COIN_RESTRICT hpivco,
+  const CoinBigIndex *COIN_RESTRICT mcstrt, const int *COIN_RESTRICT hpivco,
   double *COIN_RESTRICT dwork1,
   int kpivrw, int first_dense, int last_dense)
 {
@@ -1757,9 +1762,9 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
 
   int *COIN_RESTRICT hcoli = fact->xecadr;
   double *COIN_RESTRICT dluval = fact->xeeadr;
-  int *COIN_RESTRICT mrstrt = fact->xrsadr;
+  CoinBigIndex *COIN_RESTRICT mrstrt = fact->xrsadr;
   int *COIN_RESTRICT hrowi = fact->xeradr;
-  int *COIN_RESTRICT mcstrt = fact->xcsadr;
+  CoinBigIndex *COIN_RESTRICT mcstrt = fact->xcsadr;
   int *COIN_RESTRICT hinrow = fact->xrnadr;
   /*int *hincol	= fact->xcnadr;
     int *hpivro	= fact->krpadr;*/
@@ -1769,19 +1774,20 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
   const int nrow = fact->nrow;
   const int ifRowCopy = fact->rows_ok;
 
-  int i, j = -1, k, i1, i2, k1;
-  int kc, iel;
+  int i;
+  CoinBigIndex j = -1, k, i1, i2, k1;
+  CoinBigIndex kc, iel;
   double del3;
   int nroom;
   bool ifrows = (mrstrt[1] != 0);
   int kpivrw, jpivrw;
-  int first_dense_mcstrt, last_dense_mcstrt;
-  int nnentl; /* includes row stuff */
+  CoinBigIndex first_dense_mcstrt, last_dense_mcstrt;
+  CoinBigIndex nnentl; /* includes row stuff */
   int doSparse = (fact->if_sparse_update > 0);
 #ifdef MORE_DEBUG
   {
     const int *COIN_RESTRICT hrowi = fact->R_etas_index;
-    const int *COIN_RESTRICT mcstrt = fact->R_etas_start;
+    const CoinBigIndex *COIN_RESTRICT mcstrt = fact->R_etas_start;
     int ndo = fact->nR_etas;
     int knext;
 
@@ -1796,7 +1802,7 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
   }
 #endif
 
-  int mcstrt_piv;
+  CoinBigIndex mcstrt_piv;
   int nincol = 0;
   int *COIN_RESTRICT hpivco_new = fact->kcpadr + 1;
   int *COIN_RESTRICT back = fact->back;
@@ -1830,7 +1836,7 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
     last_dense_mcstrt = 0;
   }
   {
-    int kdnspt = fact->nnetas - fact->nnentl;
+    CoinBigIndex kdnspt = fact->nnetas - fact->nnentl;
 
     i1 = ((kdnspt - 1) + fact->R_etas_start[fact->nR_etas + 1]);
     /*i1 = -99999999;*/
@@ -1862,18 +1868,18 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
         bool foundit = true;
 
         /* binary search - sort of implies hrowi is sorted */
-        i = i1;
-        if (hrowi[i] != jpivrw) {
+        iel = i1;
+        if (hrowi[iel] != jpivrw) {
           while (1) {
-            i = (i1 + i2) >> 1;
-            if (i == i1) {
+            iel = (i1 + i2) >> 1;
+            if (iel == i1) {
               foundit = false;
               break;
             }
-            if (hrowi[i] < jpivrw) {
-              i1 = i;
-            } else if (hrowi[i] > jpivrw) {
-              i2 = i;
+            if (hrowi[iel] < jpivrw) {
+              i1 = iel;
+            } else if (hrowi[iel] > jpivrw) {
+              i2 = iel;
             } else
               break;
           }
@@ -1881,22 +1887,22 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
         /* ??? what if we didn't find it? */
 
         if (foundit) {
-          del3 = dluval[i];
+          del3 = dluval[iel];
           --nuspik;
           /* remove it and move the last element into its place */
-          hrowi[i] = hrowi[nuspik + fact->nnentu + 1];
-          dluval[i] = dluval[nuspik + fact->nnentu + 1];
+          hrowi[iel] = hrowi[nuspik + fact->nnentu + 1];
+          dluval[iel] = dluval[nuspik + fact->nnentu + 1];
         }
       }
     } else {
       /* search */
-      for (i = i1; i <= i2; i++) {
-        if (hrowi[i] == jpivrw) {
-          del3 = dluval[i];
+      for (iel = i1; iel <= i2; iel++) {
+        if (hrowi[iel] == jpivrw) {
+          del3 = dluval[iel];
           --nuspik;
           /* remove it and move the last element into its place */
-          hrowi[i] = hrowi[i2];
-          dluval[i] = dluval[i2];
+          hrowi[iel] = hrowi[i2];
+          dluval[iel] = dluval[i2];
           break;
         }
       }
@@ -1926,18 +1932,18 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
        * find its position in the U row rep and remove it
        * by overwriting it with the last element.
        */
-      int k1x = mcstrt[kpivrw];
+      CoinBigIndex k1x = mcstrt[kpivrw];
       int nel = hrowi[k1x]; /* yes, this is the nel, for the pivot */
-      int k2x = k1x + nel;
+      CoinBigIndex k2x = k1x + nel;
 
       for (k = k1x + 1; k <= k2x; ++k) {
         int irow = UNSHIFT_INDEX(hrowi[k]);
-        int kx = mrstrt[irow];
+        CoinBigIndex kx = mrstrt[irow];
         int nel = hinrow[irow] - 1;
         hinrow[irow] = nel;
 
-        int jlast = kx + nel;
-        for (int iel = kx; iel < jlast; iel++) {
+        CoinBigIndex jlast = kx + nel;
+        for (CoinBigIndex iel = kx; iel < jlast; iel++) {
           if (kpivrw == hcoli[iel]) {
             hcoli[iel] = hcoli[jlast];
             de2val[iel] = de2val[jlast];
@@ -1947,16 +1953,16 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
       }
     } else if (ifRowCopy) {
       /* still take out */
-      int k1x = mcstrt[kpivrw];
+      CoinBigIndex k1x = mcstrt[kpivrw];
       int nel = hrowi[k1x]; /* yes, this is the nel, for the pivot */
-      int k2x = k1x + nel;
+      CoinBigIndex k2x = k1x + nel;
 
       for (k = k1x + 1; k <= k2x; ++k) {
         int irow = UNSHIFT_INDEX(hrowi[k]);
-        int kx = mrstrt[irow];
+        CoinBigIndex kx = mrstrt[irow];
         int nel = hinrow[irow] - 1;
         hinrow[irow] = nel;
-        int jlast = kx + nel;
+        CoinBigIndex jlast = kx + nel;
         for (; kx < jlast; kx++) {
           if (kpivrw == hcoli[kx]) {
             hcoli[kx] = hcoli[jlast];
@@ -1980,7 +1986,7 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
       for (iel = i1; iel <= i2; ++iel) {
         int irow = UNSHIFT_INDEX(hrowi[iel]);
         int iput = hinrow[irow];
-        int kput = mrstrt[irow];
+        CoinBigIndex kput = mrstrt[irow];
         int nextRow = eta_next[irow];
         assert(kput > 0);
         kput += iput;
@@ -2006,7 +2012,7 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
         for (iel = i1; iel <= i2; ++iel) {
           int irow = UNSHIFT_INDEX(hrowi[iel]);
           int iput = hinrow[irow];
-          int kput = mrstrt[irow];
+          CoinBigIndex kput = mrstrt[irow];
           int nextRow = eta_next[irow];
           assert(kput > 0);
           kput += iput;
@@ -2026,7 +2032,8 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
         }
       } else {
         for (iel = i1; iel <= i2; ++iel) {
-          int j, k;
+          int j;
+          CoinBigIndex k;
           int irow = UNSHIFT_INDEX(hrowi[iel]);
           int iput = hinrow[irow];
           k = mrstrt[irow] + iput;
@@ -2034,12 +2041,12 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
           if (k >= mrstrt[j]) {
             /* no room - can we make some? */
             int klast = eta_last[nrow + 1];
-            int jput = mrstrt[klast] + hinrow[klast] + 2;
-            int distance = mrstrt[nrow + 1] - jput;
+            CoinBigIndex jput = mrstrt[klast] + hinrow[klast] + 2;
+            CoinBigIndex distance = mrstrt[nrow + 1] - jput;
             if (iput + 1 < distance) {
               /* this presumably copies the row to the end */
               int jn, jl;
-              int kstart = mrstrt[irow];
+              CoinBigIndex kstart = mrstrt[irow];
               int nin = hinrow[irow];
               /* out */
               jn = eta_next[irow];
@@ -2063,21 +2070,22 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
               k = jput + iput;
             } else {
               /* shuffle down */
-              int spare = (fact->nnetas - fact->nnentu - fact->nnentl - 3);
+              CoinBigIndex spare = (fact->nnetas - fact->nnentu - fact->nnentl - 3);
               if (spare > nrow << 1) {
                 /* presumbly, this compacts the rows */
-                int jrow, jput;
+                int jrow;
+                CoinBigIndex jput;
                 if (1) {
                   if (fact->num_resets < 1000000) {
-                    int etasize = CoinMax(4 * fact->nnentu + (fact->nnetas - fact->nnentl) + 1000, fact->eta_size);
+                    CoinBigIndex etasize = CoinMax(4 * fact->nnentu + (fact->nnetas - fact->nnentl) + 1000, fact->eta_size);
                     if (ifrows) {
                       fact->num_resets++;
                       if (npivot > 40 && fact->num_resets << 4 > npivot) {
-                        fact->eta_size = static_cast< int >(1.05 * fact->eta_size);
+                        fact->eta_size = static_cast< CoinBigIndex >(1.05 * fact->eta_size);
                         fact->num_resets = 1000000;
                       }
                     } else {
-                      fact->eta_size = static_cast< int >(1.1 * fact->eta_size);
+                      fact->eta_size = static_cast< CoinBigIndex >(1.1 * fact->eta_size);
                       fact->num_resets = 1000000;
                     }
                     fact->eta_size = CoinMin(fact->eta_size, etasize);
@@ -2089,7 +2097,8 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
                 jrow = eta_next[0];
                 jput = 1;
                 for (j = 0; j < nrow; j++) {
-                  int k, nin = hinrow[jrow];
+                  CoinBigIndex k;
+                  int nin = hinrow[jrow];
                   k = mrstrt[jrow];
                   mrstrt[jrow] = jput;
                   for (; nin; nin--) {
@@ -2109,7 +2118,8 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
                 ;
                 jrow = eta_last[nrow + 1];
                 for (j = 0; j < nrow; j++) {
-                  int k, nin = hinrow[jrow];
+                  CoinBigIndex k;
+                  int nin = hinrow[jrow];
                   k = mrstrt[jrow] + nin;
                   jput -= spare;
                   for (; nin; nin--) {
@@ -2144,7 +2154,7 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
     k1 = mrstrt[kpivrw];
 
   L1226 : {
-    int k2 = k1 + hinrow[kpivrw] - 1;
+    CoinBigIndex k2 = k1 + hinrow[kpivrw] - 1;
 
     /* "delete" the row */
     hinrow[kpivrw] = 0;
@@ -2153,7 +2163,7 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
       /* remove pivot row entries from the corresponding columns */
       for (k = k1; k <= k2; ++k) {
         int icol = hcoli[k];
-        int kx = mcstrt[icol];
+        CoinBigIndex kx = mcstrt[icol];
         int nel = hrowi[kx];
         for (iel = kx + 1; iel <= kx + nel; iel++) {
           if (hrowi[iel] == jpivrw) {
@@ -2189,10 +2199,10 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
       /* row version isn't ok (?) */
       for (k = k1; k <= k2; ++k) {
         int icol = hcoli[k];
-        int kx = mcstrt[icol];
+        CoinBigIndex kx = mcstrt[icol];
         int nel = hrowi[kx];
         j = kx + nel;
-        int iel;
+        CoinBigIndex iel;
         for (iel = kx + 1; iel <= j; iel++) {
           if (hrowi[iel] == jpivrw)
             break;
@@ -2271,7 +2281,7 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
     if (orig_nincol != 0) {
       /* STORE AS A ROW VECTOR */
       int n = fact->nR_etas + 1;
-      int i1 = fact->R_etas_start[n];
+      CoinBigIndex i1 = fact->R_etas_start[n];
       fact->nR_etas = n;
       fact->R_etas_start[n + 1] = i1 - orig_nincol;
       hpivco[fact->nR_etas + nrow + 3] = kpivrw;
@@ -2280,7 +2290,7 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
 
   /*       CHECK DEL3 AGAINST DALPHA/DOUT */
   {
-    int kx = mcstrt[kpivrw];
+    CoinBigIndex kx = mcstrt[kpivrw];
     double dout = dluval[kx];
     double dcheck = fabs(dalpha / dout);
     double difference = 0.0;
@@ -2326,7 +2336,7 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
   mcstrt[kpivrw] = fact->nnentu;
 #ifdef CLP_REUSE_ETAS
   {
-    int *putSeq = fact->xrsadr + 2 * fact->nrowmx + 2;
+    CoinBigIndex *putSeq = fact->xrsadr + 2 * fact->nrowmx + 2;
     int *position = putSeq + fact->maxinv;
     int *putStart = position + fact->maxinv;
     putStart[fact->nrow + fact->npivots - 1] = fact->nnentu;
@@ -2431,7 +2441,7 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
     fact->nnentu++;
     dluval[fact->nnentu] = del3Orig;
     hrowi[fact->nnentu] = kpivrw;
-    int *putSeq = fact->xrsadr + 2 * fact->nrowmx + 2;
+    CoinBigIndex *putSeq = fact->xrsadr + 2 * fact->nrowmx + 2;
     int *position = putSeq + fact->maxinv;
     int *putStart = position + fact->maxinv;
     int nnentu_at_factor = putStart[fact->nrow] & 0x7fffffff;
@@ -2458,7 +2468,7 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
   }
 #endif
   {
-    int kdnspt = fact->nnetas - fact->nnentl;
+    CoinBigIndex kdnspt = fact->nnetas - fact->nnentl;
 
     /* fact->R_etas_start[fact->nR_etas + 1] is -(the number of els in R) */
     nnentl = fact->nnetas - ((kdnspt - 1) + fact->R_etas_start[fact->nR_etas + 1]);
@@ -2467,8 +2477,8 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
 
   /*     if need to redo row version */
   if (!fact->rows_ok && fact->first_dense >= fact->last_dense) {
-    int extraSpace = 10000;
-    int spareSpace;
+    CoinBigIndex extraSpace = 10000;
+    CoinBigIndex spareSpace;
     if (fact->if_sparse_update > 0) {
       spareSpace = (fact->nnetas - fact->nnentu - fact->nnentl);
     } else {
@@ -2476,7 +2486,7 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
       spareSpace = fact->nnetas - fact->nnentu;
     }
     /*       save clean row copy if enough room */
-    nroom = spareSpace / nrow;
+    nroom = static_cast< int >(CoinMin(spareSpace / nrow, static_cast< CoinBigIndex >(COIN_INT_MAX)));
 
     if ((fact->nnentu << 3) > 150 * fact->maxinv) {
       extraSpace = 150 * fact->maxinv;
@@ -2504,11 +2514,11 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
         if (ifrows) {
           fact->num_resets++;
           if (npivot > 40 && fact->num_resets << 4 > npivot) {
-            fact->eta_size = static_cast< int >(1.05 * fact->eta_size);
+            fact->eta_size = static_cast< CoinBigIndex >(1.05 * fact->eta_size);
             fact->num_resets = 1000000;
           }
         } else {
-          fact->eta_size = static_cast< int >(1.1 * fact->eta_size);
+          fact->eta_size = static_cast< CoinBigIndex >(1.1 * fact->eta_size);
           fact->num_resets = 1000000;
         }
         if (fact->maxNNetas > 0 && fact->eta_size > fact->maxNNetas) {
@@ -2518,13 +2528,13 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
     }
     fact->rows_ok = ifrows;
     if (ifrows) {
-      int ibase = 1;
+      CoinBigIndex ibase = 1;
       c_ekkizero(nrow, &hinrow[1]);
       for (i = 1; i <= nrow; ++i) {
-        int kx = mcstrt[i];
+        CoinBigIndex kx = mcstrt[i];
         int nel = hrowi[kx];
-        int kcs = kx + 1;
-        int kce = kx + nel;
+        CoinBigIndex kcs = kx + 1;
+        CoinBigIndex kce = kx + nel;
         for (kc = kcs; kc <= kce; ++kc) {
           int irow = UNSHIFT_INDEX(hrowi[kc]);
           if (dluval[kc]) {
@@ -2547,10 +2557,10 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
       mrstrt[nrow + 1] = ibase;
       if (fact->xe2adr == 0) {
         for (i = 1; i <= nrow; ++i) {
-          int kx = mcstrt[i];
+          CoinBigIndex kx = mcstrt[i];
           int nel = hrowi[kx];
-          int kcs = kx + 1;
-          int kce = kx + nel;
+          CoinBigIndex kcs = kx + 1;
+          CoinBigIndex kce = kx + nel;
           for (kc = kcs; kc <= kce; ++kc) {
             if (dluval[kc]) {
               int irow = UNSHIFT_INDEX(hrowi[kc]);
@@ -2563,10 +2573,10 @@ int c_ekketsj(COIN_REGISTER2 /*const*/ EKKfactinfo *COIN_RESTRICT2 fact,
         }
       } else {
         for (i = 1; i <= nrow; ++i) {
-          int kx = mcstrt[i];
+          CoinBigIndex kx = mcstrt[i];
           int nel = hrowi[kx];
-          int kcs = kx + 1;
-          int kce = kx + nel;
+          CoinBigIndex kcs = kx + 1;
+          CoinBigIndex kce = kx + nel;
           for (kc = kcs; kc <= kce; ++kc) {
             int irow = UNSHIFT_INDEX(hrowi[kc]);
             int iput = hinrow[irow];
@@ -2603,10 +2613,10 @@ L7000:
         if (ratio > 2.0) {
           ratio = 2.0;
         } /* endif */
-        fact->eta_size = static_cast< int >(ratio * fact->eta_size);
+        fact->eta_size = static_cast< CoinBigIndex >(ratio * fact->eta_size);
       } /* endif */
     } else {
-      fact->eta_size = static_cast< int >(1.05 * fact->eta_size);
+      fact->eta_size = static_cast< CoinBigIndex >(1.05 * fact->eta_size);
     } /* endif */
     if (fact->maxNNetas > 0 && fact->eta_size > fact->maxNNetas) {
       fact->eta_size = fact->maxNNetas;
@@ -2619,7 +2629,7 @@ L8000:
   *nuspikp = nuspik;
 #ifdef MORE_DEBUG
   for (int i = 1; i <= fact->nrow; i++) {
-    int kx = mcstrt[i];
+    CoinBigIndex kx = mcstrt[i];
     int nel = hrowi[kx];
     for (int j = 0; j < nel; j++) {
       assert(i != hrowi[j + kx + 1]);
@@ -2647,9 +2657,10 @@ static void c_ekkftj4p(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fact,
   int jpiv = hpivco[lstart];
   const double *COIN_RESTRICT dluval = fact->xeeadr;
   const int *COIN_RESTRICT hrowi = fact->xeradr;
-  const int *COIN_RESTRICT mcstrt = fact->xcsadr + lstart;
+  const CoinBigIndex *COIN_RESTRICT mcstrt = fact->xcsadr + lstart;
   int ndo = fact->xnetal - lstart;
-  int i, iel;
+  int i;
+  CoinBigIndex iel;
 
   /* find first non-zero */
   for (i = 0; i < ndo; i++) {
@@ -2660,7 +2671,7 @@ static void c_ekkftj4p(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fact,
     double dv = dwork1[i + jpiv];
 
     if (dv != 0.) {
-      int kce1 = mcstrt[i + 1];
+      CoinBigIndex kce1 = mcstrt[i + 1];
 
       for (iel = mcstrt[i]; iel > kce1; --iel) {
         int irow0 = hrowi[iel];
@@ -2711,7 +2722,7 @@ static int c_ekkftj4_sparse(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fac
   const int *COIN_RESTRICT hpivco = fact->kcpadr;
   const double *COIN_RESTRICT dluval = fact->xeeadr;
   const int *COIN_RESTRICT hrowi = fact->xeradr;
-  const int *COIN_RESTRICT mcstrt = fact->xcsadr + lstart - 1;
+  const CoinBigIndex *COIN_RESTRICT mcstrt = fact->xcsadr + lstart - 1;
   double tolerance = fact->zeroTolerance;
   int jpiv = hpivco[lstart] - 1;
   char *COIN_RESTRICT nonzero = fact->nonzero;
@@ -2723,23 +2734,25 @@ static int c_ekkftj4_sparse(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fac
   int *COIN_RESTRICT stack = spare + nrow;
   int *COIN_RESTRICT next = stack + nrow;
   double dv;
-  int iel;
+  CoinBigIndex iel;
   int nput = 0, kput = nrow;
   int check = jpiv + ndo + 1;
-  const int *COIN_RESTRICT mcstrt2 = mcstrt - jpiv;
+  const CoinBigIndex *COIN_RESTRICT mcstrt2 = mcstrt - jpiv;
 
   for (k = 0; k < nincol; k++) {
     nStack = 1;
     iPivot = mpt[k];
     if (nonzero[iPivot] != 1 && iPivot > jpiv && iPivot < check) {
       stack[0] = iPivot;
-      next[0] = mcstrt2[iPivot + 1] + 1;
+      next[0] = 1;
       while (nStack) {
-        int kPivot, j;
+        int kPivot;
+        CoinBigIndex j;
         /* take off stack */
         kPivot = stack[--nStack];
         if (nonzero[kPivot] != 1 && kPivot > jpiv && kPivot < check) {
-          j = next[nStack];
+          /* next holds offsets within columns */
+          j = mcstrt2[kPivot + 1] + next[nStack];
           if (j > mcstrt2[kPivot]) {
             /* finished so mark */
             list[nList++] = kPivot;
@@ -2752,7 +2765,7 @@ static int c_ekkftj4_sparse(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fac
               /* and new one */
               stack[nStack] = kPivot;
               nonzero[kPivot] = 2;
-              next[nStack++] = mcstrt2[kPivot + 1] + 1;
+              next[nStack++] = 1;
             }
           }
         } else if (kPivot >= check) {
@@ -2773,7 +2786,7 @@ static int c_ekkftj4_sparse(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fac
     nonzero[iPivot] = 0;
     if (fabs(dv) > tolerance) {
       /* the same code as in c_ekkftj4p */
-      int kce1 = mcstrt2[iPivot + 1];
+      CoinBigIndex kce1 = mcstrt2[iPivot + 1];
       for (iel = mcstrt2[iPivot]; iel > kce1; --iel) {
         int irow0 = hrowi[iel];
         SHIFT_REF(dwork1, irow0) += dv * dluval[iel];
@@ -2815,12 +2828,12 @@ static int c_ekkftjl_sparse3(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fa
   int nincol)
 {
   int i;
-  int knext;
+  CoinBigIndex knext;
   int ipiv;
   double dv;
   const double *COIN_RESTRICT dluval = fact->R_etas_element + 1;
   const int *COIN_RESTRICT hrowi = fact->R_etas_index + 1;
-  const int *COIN_RESTRICT mcstrt = fact->R_etas_start;
+  const CoinBigIndex *COIN_RESTRICT mcstrt = fact->R_etas_start;
   int ndo = fact->nR_etas;
   double tolerance = fact->zeroTolerance;
   const int *COIN_RESTRICT hpivco = fact->hpivcoR;
@@ -2835,8 +2848,8 @@ static int c_ekkftjl_sparse3(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fa
   if (ndo != 0) {
     knext = mcstrt[1];
     for (i = 1; i <= ndo; ++i) {
-      int k1 = knext; /* == mcstrt[i] */
-      int iel;
+      CoinBigIndex k1 = knext; /* == mcstrt[i] */
+      CoinBigIndex iel;
       ipiv = hpivco[i];
       dv = dwork1[ipiv];
       bool onList = (dv != 0.0);
@@ -2876,7 +2889,7 @@ static int c_ekkftjl_sparse3(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fa
       dwork1[ipiv] = 0.0;
     }
   }
-  return knext;
+  return static_cast< int >(knext);
 } /* c_ekkftjl */
 
 static int c_ekkftjl_sparse2(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fact,
@@ -2887,11 +2900,11 @@ static int c_ekkftjl_sparse2(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fa
   double tolerance = fact->zeroTolerance;
   const double *COIN_RESTRICT dluval = fact->R_etas_element + 1;
   const int *COIN_RESTRICT hrowi = fact->R_etas_index + 1;
-  const int *COIN_RESTRICT mcstrt = fact->R_etas_start;
+  const CoinBigIndex *COIN_RESTRICT mcstrt = fact->R_etas_start;
   int ndo = fact->nR_etas;
   const int *COIN_RESTRICT hpivco = fact->hpivcoR;
   int i;
-  int knext;
+  CoinBigIndex knext;
   int ipiv;
   double dv;
 
@@ -2902,8 +2915,8 @@ static int c_ekkftjl_sparse2(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fa
   if (ndo != 0) {
     knext = mcstrt[1];
     for (i = 1; i <= ndo; ++i) {
-      int k1 = knext; /* == mcstrt[i] */
-      int iel;
+      CoinBigIndex k1 = knext; /* == mcstrt[i] */
+      CoinBigIndex iel;
       ipiv = hpivco[i];
       dv = dwork1[ipiv];
       bool onList = (dv != 0.0);
@@ -2941,7 +2954,7 @@ static int c_ekkftjl_sparse2(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fa
       dwork1[ipiv] = 0.0;
     }
   }
-  return knext;
+  return static_cast< int >(knext);
 } /* c_ekkftjl */
 
 static void c_ekkftjl(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fact,
@@ -2950,11 +2963,11 @@ static void c_ekkftjl(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fact,
   double tolerance = fact->zeroTolerance;
   const double *COIN_RESTRICT dluval = fact->R_etas_element + 1;
   const int *COIN_RESTRICT hrowi = fact->R_etas_index + 1;
-  const int *COIN_RESTRICT mcstrt = fact->R_etas_start;
+  const CoinBigIndex *COIN_RESTRICT mcstrt = fact->R_etas_start;
   int ndo = fact->nR_etas;
   const int *COIN_RESTRICT hpivco = fact->hpivcoR;
   int i;
-  int knext;
+  CoinBigIndex knext;
 
   /* DO ANY ROW TRANSFORMATIONS */
 
@@ -2973,10 +2986,10 @@ static void c_ekkftjl(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fact,
 
     knext = mcstrt[1];
     for (i = 1; i <= ndo; ++i) {
-      int k1 = knext; /* == mcstrt[i] */
+      CoinBigIndex k1 = knext; /* == mcstrt[i] */
       int ipiv = hpivco[i];
       double dv = dwork1[ipiv];
-      int iel;
+      CoinBigIndex iel;
       //#define UNROLL3 2
 #ifndef UNROLL3
 #if CLP_OSL == 2 || CLP_OSL == 3
@@ -3030,7 +3043,7 @@ c_ekkftjup_scan_aux(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fact,
 {
   const double *COIN_RESTRICT dluval = fact->xeeadr + 1;
   const int *COIN_RESTRICT hrowi = fact->xeradr + 1;
-  const int *COIN_RESTRICT mcstrt = fact->xcsadr;
+  const CoinBigIndex *COIN_RESTRICT mcstrt = fact->xcsadr;
   const int *COIN_RESTRICT hpivro = fact->krpadr;
   const int *COIN_RESTRICT back = fact->back;
   double tolerance = fact->zeroTolerance;
@@ -3051,7 +3064,7 @@ c_ekkftjup_scan_aux(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fact,
     /* in the case of world.mps with dual, this condition is true
      * only 20-60% of the time. */
     if (fabs(dv) > tolerance) {
-      const int kx = mcstrt[ipiv];
+      const CoinBigIndex kx = mcstrt[ipiv];
       const int nel = hrowi[kx - 1];
       const double dpiv = dluval[kx - 1];
 #if UNROLL4 > 1
@@ -3166,7 +3179,7 @@ static void c_ekkftjup_aux3(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fac
 }
 static void c_ekkftju_dense(const double *dluval,
   const int *COIN_RESTRICT hrowi,
-  const int *COIN_RESTRICT mcstrt,
+  const CoinBigIndex *COIN_RESTRICT mcstrt,
   const int *COIN_RESTRICT back,
   double *COIN_RESTRICT dwork1,
   int *start, int last,
@@ -3179,15 +3192,16 @@ static void c_ekkftju_dense(const double *dluval,
     double dv1 = dwork1[ipiv1];
     ipiv = back[ipiv];
     if (fabs(dv1) > 1.0e-14) {
-      const int kx1 = mcstrt[ipiv1];
+      const CoinBigIndex kx1 = mcstrt[ipiv1];
       const int nel1 = hrowi[kx1 - 1];
       const double dpiv1 = dluval[kx1 - 1];
 
-      int iel, k;
+      int k;
+      CoinBigIndex iel;
       const int n1 = offset + ipiv1; /* number in dense part */
 
       const int nsparse1 = nel1 - n1;
-      const int k1 = kx1 + nsparse1;
+      const CoinBigIndex k1 = kx1 + nsparse1;
       const double *dlu1 = &dluval[k1];
 
       int ipiv2 = back[ipiv1];
@@ -3202,14 +3216,14 @@ static void c_ekkftju_dense(const double *dluval,
         double dv2 = densew[k] - dval;
         ipiv = back[ipiv];
         if (fabs(dv2) > 1.0e-14) {
-          const int kx2 = mcstrt[ipiv2];
+          const CoinBigIndex kx2 = mcstrt[ipiv2];
           const int nel2 = hrowi[kx2 - 1];
           const double dpiv2 = dluval[kx2 - 1];
 
           /* number in dense part is k */
           const int nsparse2 = nel2 - k;
 
-          const int k2 = kx2 + nsparse2;
+          const CoinBigIndex k2 = kx2 + nsparse2;
           const double *dlu2 = &dluval[k2];
 
           dv2 *= dpiv2;
@@ -3335,7 +3349,7 @@ static int c_ekkftjup(COIN_REGISTER3 const EKKfactinfo *COIN_RESTRICT2 fact,
 {
   const double *COIN_RESTRICT dluval = fact->xeeadr;
   const int *COIN_RESTRICT hrowi = fact->xeradr;
-  const int *COIN_RESTRICT mcstrt = fact->xcsadr;
+  const CoinBigIndex *COIN_RESTRICT mcstrt = fact->xcsadr;
   const int *COIN_RESTRICT hpivro = fact->krpadr;
   double tolerance = fact->zeroTolerance;
   int ndenuc = fact->ndenuc;
@@ -3354,7 +3368,7 @@ static int c_ekkftjup(COIN_REGISTER3 const EKKfactinfo *COIN_RESTRICT2 fact,
       &mptX);
 
     {
-      int j;
+      CoinBigIndex j;
       int n = 0;
       const int firstDense = nrow - ndenuc + 1;
       double *densew = &dwork1[firstDense];
@@ -3362,8 +3376,8 @@ static int c_ekkftjup(COIN_REGISTER3 const EKKfactinfo *COIN_RESTRICT2 fact,
 
       /* check first dense to see where in triangle it is */
       int last = first_dense;
-      const int k1 = mcstrt[last];
-      const int k2 = k1 + hrowi[k1];
+      const CoinBigIndex k1 = mcstrt[last];
+      const CoinBigIndex k2 = k1 + hrowi[k1];
 
       for (j = k2; j > k1; j--) {
         int irow = UNSHIFT_INDEX(hrowi[j]);
@@ -3430,7 +3444,7 @@ c_ekkftjup_scan_aux_pack(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fact,
   double tolerance = fact->zeroTolerance;
   const double *dluval = fact->xeeadr + 1;
   const int *hrowi = fact->xeradr + 1;
-  const int *mcstrt = fact->xcsadr;
+  const CoinBigIndex *mcstrt = fact->xcsadr;
   const int *hpivro = fact->krpadr;
   const int *back = fact->back;
   int ipiv = *ip;
@@ -3471,7 +3485,7 @@ c_ekkftjup_scan_aux_pack(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 fact,
     /* in the case of world.mps with dual, this condition is true
      * only 20-60% of the time. */
     if (fabs(dv) > tolerance) {
-      const int kx = mcstrt[ipiv];
+      const CoinBigIndex kx = mcstrt[ipiv];
       const int nel = hrowi[kx - 1];
       const double dpiv = dluval[kx - 1];
 #ifndef UNROLL5
@@ -3602,7 +3616,7 @@ static int c_ekkftjup_pack(COIN_REGISTER3 const EKKfactinfo *COIN_RESTRICT2 fact
 {
   const double *COIN_RESTRICT dluval = fact->xeeadr;
   const int *COIN_RESTRICT hrowi = fact->xeradr;
-  const int *COIN_RESTRICT mcstrt = fact->xcsadr;
+  const CoinBigIndex *COIN_RESTRICT mcstrt = fact->xcsadr;
   const int *COIN_RESTRICT hpivro = fact->krpadr;
   double tolerance = fact->zeroTolerance;
   int ndenuc = fact->ndenuc;
@@ -3624,7 +3638,7 @@ static int c_ekkftjup_pack(COIN_REGISTER3 const EKKfactinfo *COIN_RESTRICT2 fact
     dworko += (mptX - mpt);
     mpt = mptX;
     {
-      int j;
+      CoinBigIndex j;
       int n = 0;
       const int firstDense = nrow - ndenuc + 1;
       double *densew = &dwork1[firstDense];
@@ -3632,8 +3646,8 @@ static int c_ekkftjup_pack(COIN_REGISTER3 const EKKfactinfo *COIN_RESTRICT2 fact
 
       /* check first dense to see where in triangle it is */
       int last = first_dense;
-      const int k1 = mcstrt[last];
-      const int k2 = k1 + hrowi[k1];
+      const CoinBigIndex k1 = mcstrt[last];
+      const CoinBigIndex k2 = k1 + hrowi[k1];
 
       for (j = k2; j > k1; j--) {
         int irow = UNSHIFT_INDEX(hrowi[j]);
@@ -3689,11 +3703,12 @@ static int c_ekkftju_sparse_a(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 f
   int nincol, int *COIN_RESTRICT spare)
 {
   const int *COIN_RESTRICT hrowi = fact->xeradr + 1;
-  const int *COIN_RESTRICT mcstrt = fact->xcsadr;
+  const CoinBigIndex *COIN_RESTRICT mcstrt = fact->xcsadr;
   const int nrow = fact->nrow;
   char *COIN_RESTRICT nonzero = fact->nonzero;
 
-  int k, nStack, kx, nel;
+  int k, nStack, nel;
+  CoinBigIndex kx;
   int nList = 0;
   int iPivot;
   /*int kkk=nincol;*/
@@ -3742,11 +3757,13 @@ static int c_ekkftju_sparse_b(COIN_REGISTER2 const EKKfactinfo *COIN_RESTRICT2 f
 
   const double *COIN_RESTRICT dluval = fact->xeeadr + 1;
   const int *COIN_RESTRICT hrowi = fact->xeradr + 1;
-  const int *COIN_RESTRICT mcstrt = fact->xcsadr;
+  const CoinBigIndex *COIN_RESTRICT mcstrt = fact->xcsadr;
   const int *COIN_RESTRICT hpivro = fact->krpadr;
   double tolerance = fact->zeroTolerance;
   char *COIN_RESTRICT nonzero = fact->nonzero;
-  int i, k, kx, nel;
+  int i, nel;
+  CoinBigIndex k;
+  CoinBigIndex kx;
   int iPivot;
   /*int kkk=nincol;*/
   int *COIN_RESTRICT list = spare;
@@ -3829,7 +3846,7 @@ int c_ekkftrn_ft(COIN_REGISTER EKKfactinfo *COIN_RESTRICT2 fact,
 
   int lastSlack;
 
-  int kdnspt = fact->nnetas - fact->nnentl;
+  CoinBigIndex kdnspt = fact->nnetas - fact->nnentl;
   bool isRoom = (fact->nnentu + (nrow << 1) < (kdnspt - 2)
       + fact->R_etas_start[fact->nR_etas + 1]);
 
@@ -3843,10 +3860,10 @@ int c_ekkftrn_ft(COIN_REGISTER EKKfactinfo *COIN_RESTRICT2 fact,
 
   int save_nR_etas = fact->nR_etas;
   int *save_hpivcoR = fact->hpivcoR;
-  int *save_R_etas_start = fact->R_etas_start;
+  CoinBigIndex *save_R_etas_start = fact->R_etas_start;
   if (skipStuff) {
     // just move
-    int *putSeq = fact->xrsadr + 2 * fact->nrowmx + 2;
+    CoinBigIndex *putSeq = fact->xrsadr + 2 * fact->nrowmx + 2;
     int *position = putSeq + fact->maxinv;
     int *putStart = position + fact->maxinv;
     memset(dwork1_ft, 0, nincol * sizeof(double));
@@ -4006,7 +4023,7 @@ void c_ekkftrn2(COIN_REGISTER EKKfactinfo *COIN_RESTRICT2 fact, double *COIN_RES
   /* using dwork1 instead double *dpermu_ft = fact->kadrpm; */
   int *spare = reinterpret_cast< int * >(fact->kp1adr);
 
-  int kdnspt = fact->nnetas - fact->nnentl;
+  CoinBigIndex kdnspt = fact->nnetas - fact->nnentl;
   bool isRoom = (fact->nnentu + (nrow << 1) < (kdnspt - 2)
       + fact->R_etas_start[fact->nR_etas + 1]);
   /* say F-T will be sorted */
@@ -4023,10 +4040,10 @@ void c_ekkftrn2(COIN_REGISTER EKKfactinfo *COIN_RESTRICT2 fact, double *COIN_RES
   bool skipStuff = (fact->reintro >= 0);
   int save_nR_etas = fact->nR_etas;
   int *save_hpivcoR = fact->hpivcoR;
-  int *save_R_etas_start = fact->R_etas_start;
+  CoinBigIndex *save_R_etas_start = fact->R_etas_start;
   if (skipStuff) {
     // just move
-    int *putSeq = fact->xrsadr + 2 * fact->nrowmx + 2;
+    CoinBigIndex *putSeq = fact->xrsadr + 2 * fact->nrowmx + 2;
     int *position = putSeq + fact->maxinv;
     int *putStart = position + fact->maxinv;
     memset(dwork1_ft, 0, nincol * sizeof(double));
@@ -4165,7 +4182,6 @@ void c_ekkftrn2(COIN_REGISTER EKKfactinfo *COIN_RESTRICT2 fact, double *COIN_RES
   *nincolp = c_ekkftjup(fact,
     dpermu1, lastSlack, dwork1, mpt1);
 }
-#endif
 
 /* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
 */
@@ -5,74 +5,73 @@
 
   This code is licensed under the terms of the Eclipse Public License (EPL).
 */
-#if COIN_BIG_INDEX == 0
 #include "CoinOslFactorization.hpp"
 #include "CoinOslC.h"
 #include "CoinFinite.hpp"
 #define GO_DENSE 70
 #define GO_DENSE_RATIO 1.8
-int c_ekkclco(const EKKfactinfo *fact, int *hcoli,
-  int *mrstrt, int *hinrow, int xnewro);
+CoinBigIndex c_ekkclco(const EKKfactinfo *fact, int *hcoli,
+  CoinBigIndex *mrstrt, int *hinrow, CoinBigIndex xnewro);
 
-void c_ekkclcp(const int *hcol, const double *dels, const int *mrstrt,
-  int *hrow, double *dels2, int *mcstrt,
+void c_ekkclcp(const int *hcol, const double *dels, const CoinBigIndex *mrstrt,
+  int *hrow, double *dels2, CoinBigIndex *mcstrt,
   int *hincol, int itype, int nnrow, int nncol,
-  int ninbas);
+  CoinBigIndex ninbas);
 
 int c_ekkcmfc(EKKfactinfo *fact,
   EKKHlink *rlink, EKKHlink *clink,
   EKKHlink *mwork, void *maction_void,
-  int nnetas,
+  CoinBigIndex nnetas,
   int *nsingp, int *xrejctp,
-  int *xnewrop, int xnewco,
+  CoinBigIndex *xnewrop, CoinBigIndex xnewco,
   int *ncompactionsp);
 
 int c_ekkcmfy(EKKfactinfo *fact,
   EKKHlink *rlink, EKKHlink *clink,
   EKKHlink *mwork, void *maction_void,
-  int nnetas,
+  CoinBigIndex nnetas,
   int *nsingp, int *xrejctp,
-  int *xnewrop, int xnewco,
+  CoinBigIndex *xnewrop, CoinBigIndex xnewco,
   int *ncompactionsp);
 
 int c_ekkcmfd(EKKfactinfo *fact,
   int *mcol,
   EKKHlink *rlink, EKKHlink *clink,
   int *maction,
-  int nnetas,
-  int *nnentlp, int *nnentup,
+  CoinBigIndex nnetas,
+  CoinBigIndex *nnentlp, CoinBigIndex *nnentup,
   int *nsingp);
 int c_ekkford(const EKKfactinfo *fact, const int *hinrow, const int *hincol,
   int *hpivro, int *hpivco,
   EKKHlink *rlink, EKKHlink *clink);
 void c_ekkrowq(int *hrow, int *hcol, double *dels,
-  int *mrstrt,
-  const int *hinrow, int nnrow, int ninbas);
-int c_ekkrwco(const EKKfactinfo *fact, double *dluval, int *hcoli, int *mrstrt, int *hinrow, int xnewro);
+  CoinBigIndex *mrstrt,
+  const int *hinrow, int nnrow, CoinBigIndex ninbas);
+CoinBigIndex c_ekkrwco(const EKKfactinfo *fact, double *dluval, int *hcoli, CoinBigIndex *mrstrt, int *hinrow, CoinBigIndex xnewro);
 
-int c_ekkrwcs(const EKKfactinfo *fact, double *dluval, int *hcoli, int *mrstrt,
+CoinBigIndex c_ekkrwcs(const EKKfactinfo *fact, double *dluval, int *hcoli, CoinBigIndex *mrstrt,
   const int *hinrow, const EKKHlink *mwork,
   int nfirst);
 
-void c_ekkrwct(const EKKfactinfo *fact, double *dluval, int *hcoli, int *mrstrt,
+void c_ekkrwct(const EKKfactinfo *fact, double *dluval, int *hcoli, CoinBigIndex *mrstrt,
   const int *hinrow, const EKKHlink *mwork,
   const EKKHlink *rlink,
   const short *msort, double *dsort,
-  int nlast, int xnewro);
+  int nlast, CoinBigIndex xnewro);
 
 int c_ekkshff(EKKfactinfo *fact,
   EKKHlink *clink, EKKHlink *rlink,
-  int xnewro);
+  CoinBigIndex xnewro);
 
 void c_ekkshfv(EKKfactinfo *fact, EKKHlink *rlink, EKKHlink *clink,
-  int xnewro);
+  CoinBigIndex xnewro);
 int c_ekktria(EKKfactinfo *fact,
   EKKHlink *rlink,
   EKKHlink *clink,
   int *nsingp,
-  int *xnewcop, int *xnewrop,
+  CoinBigIndex *xnewcop, CoinBigIndex *xnewrop,
   int *nlrowtp,
-  const int ninbas);
+  const CoinBigIndex ninbas);
 #if 0
 static void c_ekkafpv(int *hentry, int *hcoli,
 	     double *dluval, int *mrstrt,
@@ -173,9 +172,9 @@ int c_ekkcsin(EKKfactinfo *fact,
   int *hcoli = fact->xecadr;
   double *dluval = fact->xeeadr;
   //double *dvalpv = fact->kw3adr;
-  int *mrstrt = fact->xrsadr;
+  CoinBigIndex *mrstrt = fact->xrsadr;
   int *hrowi = fact->xeradr;
-  int *mcstrt = fact->xcsadr;
+  CoinBigIndex *mcstrt = fact->xcsadr;
   int *hinrow = fact->xrnadr;
   int *hincol = fact->xcnadr;
   int *hpivro = fact->krpadr;
@@ -184,14 +183,15 @@ int c_ekkcsin(EKKfactinfo *fact,
   const int nrow = fact->nrow;
   const double drtpiv = fact->drtpiv;
 
-  int j, k, kc, kce, kcs, nzj;
+  int j, nzj;
+  CoinBigIndex k, kc, kce, kcs;
   double pivot;
-  int kipis, kipie;
+  CoinBigIndex kipis, kipie;
   int jpivot;
 #ifndef NDEBUG
-  int kpivot = -1;
+  CoinBigIndex kpivot = -1;
 #else
-  int kpivot = -1;
+  CoinBigIndex kpivot = -1;
 #endif
 
   bool small_pivot = false;
@@ -306,19 +306,19 @@ int c_ekkrsin(EKKfactinfo *fact,
   EKKHlink *rlink, EKKHlink *clink,
   EKKHlink *mwork, int nfirst,
   int *nsingp,
-  int *xnewcop, int *xnewrop,
-  int *nnentup,
-  int *kmxetap, int *ncompactionsp,
-  int *nnentlp)
+  CoinBigIndex *xnewcop, CoinBigIndex *xnewrop,
+  CoinBigIndex *nnentup,
+  CoinBigIndex *kmxetap, int *ncompactionsp,
+  CoinBigIndex *nnentlp)
 
 {
 #if 1
   int *hcoli = fact->xecadr;
   double *dluval = fact->xeeadr;
   //double *dvalpv = fact->kw3adr;
-  int *mrstrt = fact->xrsadr;
+  CoinBigIndex *mrstrt = fact->xrsadr;
   int *hrowi = fact->xeradr;
-  int *mcstrt = fact->xcsadr;
+  CoinBigIndex *mcstrt = fact->xcsadr;
   int *hinrow = fact->xrnadr;
   int *hincol = fact->xcnadr;
   int *hpivro = fact->krpadr;
@@ -327,25 +327,27 @@ int c_ekkrsin(EKKfactinfo *fact,
   const int nrow = fact->nrow;
   const double drtpiv = fact->drtpiv;
 
-  int xnewro = *xnewrop;
-  int xnewco = *xnewcop;
-  int kmxeta = *kmxetap;
-  int nnentu = *nnentup;
+  CoinBigIndex xnewro = *xnewrop;
+  CoinBigIndex xnewco = *xnewcop;
+  CoinBigIndex kmxeta = *kmxetap;
+  CoinBigIndex nnentu = *nnentup;
   int ncompactions = *ncompactionsp;
-  int nnentl = *nnentlp;
+  CoinBigIndex nnentl = *nnentlp;
 
-  int i, j, k, kc, kr, npr, nzi;
+  int i, j, npr, nzi;
+  CoinBigIndex k, kc, kr;
   double pivot;
-  int kjpis, kjpie, knprs, knpre;
+  CoinBigIndex kjpis, kjpie, knprs, knpre;
   double elemnt, maxaij;
-  int ipivot, epivco, lstart;
+  int ipivot, epivco;
+  CoinBigIndex lstart;
 #ifndef NDEBUG
-  int kpivot = -1;
+  CoinBigIndex kpivot = -1;
 #else
-  int kpivot = -1;
+  CoinBigIndex kpivot = -1;
 #endif
   int irtcod = 0;
-  const int nnetas = fact->nnetas;
+  const CoinBigIndex nnetas = fact->nnetas;
 
   lstart = nnetas - nnentl + 1;
 
@@ -399,7 +401,7 @@ int c_ekkrsin(EKKfactinfo *fact,
         return (-5);
       }
       {
-        int iput = c_ekkrwcs(fact, dluval, hcoli, mrstrt, hinrow, mwork, nfirst);
+        CoinBigIndex iput = c_ekkrwcs(fact, dluval, hcoli, mrstrt, hinrow, mwork, nfirst);
         kmxeta += xnewro - iput;
         xnewro = iput - 1;
         ++ncompactions;
@@ -518,15 +520,16 @@ int c_ekkfpvt(const EKKfactinfo *fact,
   int *hcoli = fact->xecadr;
   double *dluval = fact->xeeadr;
   //double *dvalpv = fact->kw3adr;
-  int *mrstrt = fact->xrsadr;
+  CoinBigIndex *mrstrt = fact->xrsadr;
   int *hrowi = fact->xeradr;
-  int *mcstrt = fact->xcsadr;
+  CoinBigIndex *mcstrt = fact->xcsadr;
   int *hinrow = fact->xrnadr;
   int *hincol = fact->xcnadr;
   int *hpivro = fact->krpadr;
   int *hpivco = fact->kcpadr;
 #endif
-  int i, j, k, ke, kk, ks, nz, nz1, kce, kcs, kre, krs;
+  int i, j, nz, nz1;
+  CoinBigIndex k, ke, kk, ks, kce, kcs, kre, krs;
   double minsze;
   int marcst, mincst, mincnt, trials, nentri;
   int jpivot = -1;
@@ -657,31 +660,31 @@ void c_ekkprpv(EKKfactinfo *fact,
   int *hcoli = fact->xecadr;
   double *dluval = fact->xeeadr;
   //double *dvalpv = fact->kw3adr;
-  int *mrstrt = fact->xrsadr;
+  CoinBigIndex *mrstrt = fact->xrsadr;
   int *hrowi = fact->xeradr;
-  int *mcstrt = fact->xcsadr;
+  CoinBigIndex *mcstrt = fact->xcsadr;
   int *hinrow = fact->xrnadr;
   int *hincol = fact->xcnadr;
   int *hpivro = fact->krpadr;
   int *hpivco = fact->kcpadr;
 #endif
-  int i, k;
-  int kc;
+  int i;
+  CoinBigIndex k, kc;
   double pivot;
-  int kipis = mrstrt[ipivot];
-  int kipie = kipis + hinrow[ipivot] - 1;
+  CoinBigIndex kipis = mrstrt[ipivot];
+  CoinBigIndex kipie = kipis + hinrow[ipivot] - 1;
 
 #ifndef NDEBUG
-  int kpivot = -1;
+  CoinBigIndex kpivot = -1;
 #else
-  int kpivot = -1;
+  CoinBigIndex kpivot = -1;
 #endif
   const int nrow = fact->nrow;
 
   /*     Update data structures */
   {
-    int kjpis = mcstrt[jpivot];
-    int kjpie = kjpis + hincol[jpivot];
+    CoinBigIndex kjpis = mcstrt[jpivot];
+    CoinBigIndex kjpie = kjpis + hincol[jpivot];
     for (k = kjpis; k < kjpie; ++k) {
       i = hrowi[k];
       C_EKK_REMOVE_LINK(hpivro, hinrow, rlink, i);
@@ -696,8 +699,8 @@ void c_ekkprpv(EKKfactinfo *fact,
     }
 
     --hincol[j];
-    int kcs = mcstrt[j];
-    int kce = kcs + hincol[j];
+    CoinBigIndex kcs = mcstrt[j];
+    CoinBigIndex kce = kcs + hincol[j];
 
     for (kc = kcs; kc < kce; kc++) {
       if (hrowi[kc] == ipivot)
@@ -728,7 +731,7 @@ void c_ekkprpv(EKKfactinfo *fact,
 /*
  * c_ekkclco is almost exactly like c_ekkrwco.
  */
-int c_ekkclco(const EKKfactinfo *fact, int *hcoli, int *mrstrt, int *hinrow, int xnewro)
+CoinBigIndex c_ekkclco(const EKKfactinfo *fact, int *hcoli, CoinBigIndex *mrstrt, int *hinrow, CoinBigIndex xnewro)
 {
 #if 0
   int *hcoli	= fact->xecadr;
@@ -742,8 +745,9 @@ int c_ekkclco(const EKKfactinfo *fact, int *hcoli, int *mrstrt, int *hinrow, int
   int *hpivro	= fact->krpadr; 
   int *hpivco	= fact->kcpadr;
 #endif
-  int i, k, nz, kold;
-  int kstart;
+  int i, nz;
+  CoinBigIndex k, kold;
+  CoinBigIndex kstart;
   const int nrow = fact->nrow;
 
   for (i = 1; i <= nrow; ++i) {
@@ -771,7 +775,7 @@ int c_ekkclco(const EKKfactinfo *fact, int *hcoli, int *mrstrt, int *hinrow, int
 
         /* update mrstart and hinrow */
         mrstrt[i] = kold + 1;
-        hinrow[i] = kstart - kold;
+        hinrow[i] = static_cast< int >(kstart - kold);
         kold = kstart;
       }
 
@@ -791,9 +795,9 @@ int c_ekkclco(const EKKfactinfo *fact, int *hcoli, int *mrstrt, int *hinrow, int
 int c_ekkcmfc(EKKfactinfo *fact,
   EKKHlink *rlink, EKKHlink *clink,
   EKKHlink *mwork, void *maction_void,
-  int nnetas,
+  CoinBigIndex nnetas,
   int *nsingp, int *xrejctp,
-  int *xnewrop, int xnewco,
+  CoinBigIndex *xnewrop, CoinBigIndex xnewco,
   int *ncompactionsp)
 
 #include "CoinOslC.h"
@@ -835,32 +839,34 @@ int c_ekkcmfd(EKKfactinfo *fact,
   int *mcol,
   EKKHlink *rlink, EKKHlink *clink,
   int *maction,
-  int nnetas,
-  int *nnentlp, int *nnentup,
+  CoinBigIndex nnetas,
+  CoinBigIndex *nnentlp, CoinBigIndex *nnentup,
   int *nsingp)
 {
   int *hcoli = fact->xecadr;
   double *dluval = fact->xeeadr;
-  int *mrstrt = fact->xrsadr;
+  CoinBigIndex *mrstrt = fact->xrsadr;
   int *hrowi = fact->xeradr;
-  int *mcstrt = fact->xcsadr;
+  CoinBigIndex *mcstrt = fact->xcsadr;
   int *hinrow = fact->xrnadr;
   int *hincol = fact->xcnadr;
   int *hpivro = fact->krpadr;
   int *hpivco = fact->kcpadr;
-  int nnentl = *nnentlp;
-  int nnentu = *nnentup;
+  CoinBigIndex nnentl = *nnentlp;
+  CoinBigIndex nnentu = *nnentup;
   int storeZero = fact->ndenuc;
 
-  int mkrs[8];
+  CoinBigIndex mkrs[8];
   double dpivyy[8];
 
   /* Local variables */
   int i, j;
   double d0, dx;
-  int nz, ndo, krs;
+  int nz, ndo;
+  CoinBigIndex krs;
   int kend, jcol;
-  int irow, iput, jrow, krxs;
+  int irow, iput, jrow;
+  CoinBigIndex krxs;
   int mjcol[8];
   double pivot;
   int count;
@@ -868,8 +874,9 @@ int c_ekkcmfd(EKKfactinfo *fact,
   double dpivx, dsave;
   double dpivxx[8];
   double multip;
-  int lstart, ndense, krlast, kcount, idense, ipivot,
+  int ndense, kcount, idense, ipivot,
     jdense, kchunk, jpivot;
+  CoinBigIndex lstart, krlast;
 
   const int nrow = fact->nrow;
 
@@ -1183,9 +1190,9 @@ int c_ekkcmfd(EKKfactinfo *fact,
 int c_ekkcmfy(EKKfactinfo *fact,
   EKKHlink *rlink, EKKHlink *clink,
   EKKHlink *mwork, void *maction_void,
-  int nnetas,
+  CoinBigIndex nnetas,
   int *nsingp, int *xrejctp,
-  int *xnewrop, int xnewco,
+  CoinBigIndex *xnewrop, CoinBigIndex xnewco,
   int *ncompactionsp)
 
 #include "CoinOslC.h"
@@ -1314,7 +1321,7 @@ int c_ekkcmfy(EKKfactinfo *fact,
  * This establishes this property; later on we take steps to preserve it.
  */
 static void c_ekkmltf(const EKKfactinfo *fact, double *dluval, int *hcoli,
-  const int *mrstrt, const int *hinrow,
+  const CoinBigIndex *mrstrt, const int *hinrow,
   const EKKHlink *rlink)
 {
 #if 0
@@ -1329,16 +1336,17 @@ static void c_ekkmltf(const EKKfactinfo *fact, double *dluval, int *hcoli,
   int *hpivro	= fact->krpadr; 
   int *hpivco	= fact->kcpadr;
 #endif
-  int i, j, k;
-  int koff = -1;
+  int i, j;
+  CoinBigIndex k;
+  CoinBigIndex koff = -1;
   const int nrow = fact->nrow;
 
   for (i = 1; i <= nrow; ++i) {
     /* ignore rows that have already been pivoted */
     /* if it is a singleton row, the property trivially holds */
     if (!(rlink[i].pre < 0 || hinrow[i] <= 1)) {
-      const int krs = mrstrt[i];
-      const int kre = krs + hinrow[i] - 1;
+      const CoinBigIndex krs = mrstrt[i];
+      const CoinBigIndex kre = krs + hinrow[i] - 1;
 
       double maxaij = 0.f;
 
@@ -1364,13 +1372,13 @@ static void c_ekkmltf(const EKKfactinfo *fact, double *dluval, int *hcoli,
 int c_ekklfct(register EKKfactinfo *fact)
 {
   const int nrow = fact->nrow;
-  int ninbas = fact->xcsadr[nrow + 1] - 1;
+  CoinBigIndex ninbas = fact->xcsadr[nrow + 1] - 1;
   int ifvsol = fact->ifvsol;
   int *hcoli = fact->xecadr;
   double *dluval = fact->xeeadr;
-  int *mrstrt = fact->xrsadr;
+  CoinBigIndex *mrstrt = fact->xrsadr;
   int *hrowi = fact->xeradr;
-  int *mcstrt = fact->xcsadr;
+  CoinBigIndex *mcstrt = fact->xcsadr;
   int *hinrow = fact->xrnadr;
   int *hincol = fact->xcnadr;
   int *hpivro = fact->krpadr;
@@ -1380,11 +1388,12 @@ int c_ekklfct(register EKKfactinfo *fact)
   EKKHlink *clink = fact->kp2adr;
   EKKHlink *mwork = (reinterpret_cast< EKKHlink * >(fact->kw1adr)) - 1;
 
-  int nsing, kdnspt, xnewro, xnewco;
+  int nsing;
+  CoinBigIndex kdnspt, xnewro, xnewco;
   int i;
   int xrejct;
   int irtcod;
-  const int nnetas = fact->nnetas;
+  const CoinBigIndex nnetas = fact->nnetas;
 
   int ncompactions;
   double save_drtpiv = fact->drtpiv;
@@ -1490,8 +1499,8 @@ int c_ekklfct(register EKKfactinfo *fact)
   /* give message if tight on memory */
   if (ncompactions > 2) {
     if (1) {
-      int etasize = CoinMax(4 * fact->nnentu + (nnetas - fact->nnentl) + 1000, fact->eta_size);
-      fact->eta_size = CoinMin(static_cast< int >(1.2 * fact->eta_size), etasize);
+      CoinBigIndex etasize = CoinMax(4 * fact->nnentu + (nnetas - fact->nnentl) + 1000, fact->eta_size);
+      fact->eta_size = CoinMin(static_cast< CoinBigIndex >(1.2 * fact->eta_size), etasize);
       if (fact->maxNNetas > 0 && fact->eta_size > fact->maxNNetas) {
         fact->eta_size = fact->maxNNetas;
       }
@@ -1595,12 +1604,13 @@ L8500:
 */
 
 void c_ekkrowq(int *hrow, int *hcol, double *dels,
-  int *mrstrt,
-  const int *hinrow, int nnrow, int ninbas)
+  CoinBigIndex *mrstrt,
+  const int *hinrow, int nnrow, CoinBigIndex ninbas)
 {
-  int i, k, iak, jak;
+  int i, iak, jak;
+  CoinBigIndex k;
   double daik;
-  int iloc;
+  CoinBigIndex iloc;
   double dsave;
   int isave, jsave;
 
@@ -1641,11 +1651,12 @@ void c_ekkrowq(int *hrow, int *hcol, double *dels,
   }
 } /* c_ekkrowq */
 
-int c_ekkrwco(const EKKfactinfo *fact, double *dluval,
-  int *hcoli, int *mrstrt, int *hinrow, int xnewro)
+CoinBigIndex c_ekkrwco(const EKKfactinfo *fact, double *dluval,
+  int *hcoli, CoinBigIndex *mrstrt, int *hinrow, CoinBigIndex xnewro)
 {
-  int i, k, nz, kold;
-  int kstart;
+  int i, nz;
+  CoinBigIndex k, kold;
+  CoinBigIndex kstart;
   const int nrow = fact->nrow;
 
   for (i = 1; i <= nrow; ++i) {
@@ -1674,7 +1685,7 @@ int c_ekkrwco(const EKKfactinfo *fact, double *dluval,
         /* update mrstart and hinrow */
         /* ACTUALLY, hinrow should already be accurate */
         mrstrt[i] = kold + 1;
-        hinrow[i] = kstart - kold;
+        hinrow[i] = static_cast< int >(kstart - kold);
         kold = kstart;
       }
 
@@ -1687,8 +1698,8 @@ int c_ekkrwco(const EKKfactinfo *fact, double *dluval,
   return (kstart);
 } /* c_ekkrwco */
 
-int c_ekkrwcs(const EKKfactinfo *fact, double *dluval, int *hcoli, int *mrstrt,
-  const int *hinrow, const EKKHlink *mwork,
+CoinBigIndex c_ekkrwcs(const EKKfactinfo *fact, double *dluval, int *hcoli,
+  CoinBigIndex *mrstrt, const int *hinrow, const EKKHlink *mwork,
   int nfirst)
 {
 #if 0
@@ -1703,8 +1714,10 @@ int c_ekkrwcs(const EKKfactinfo *fact, double *dluval, int *hcoli, int *mrstrt,
   int *hpivro	= fact->krpadr; 
   int *hpivco	= fact->kcpadr;
 #endif
-  int i, k, k1, k2, nz;
-  int irow, iput;
+  int i, nz;
+  CoinBigIndex k, k1, k2;
+  int irow;
+  CoinBigIndex iput;
   const int nrow = fact->nrow;
 
   /*     Compress row file */
@@ -1730,11 +1743,11 @@ int c_ekkrwcs(const EKKfactinfo *fact, double *dluval, int *hcoli, int *mrstrt,
 
   return (iput);
 } /* c_ekkrwcs */
-void c_ekkrwct(const EKKfactinfo *fact, double *dluval, int *hcoli, int *mrstrt,
-  const int *hinrow, const EKKHlink *mwork,
+void c_ekkrwct(const EKKfactinfo *fact, double *dluval, int *hcoli,
+  CoinBigIndex *mrstrt, const int *hinrow, const EKKHlink *mwork,
   const EKKHlink *rlink,
   const short *msort, double *dsort,
-  int nlast, int xnewro)
+  int nlast, CoinBigIndex xnewro)
 {
 #if 0
   int *hcoli	= fact->xecadr;
@@ -1748,9 +1761,11 @@ void c_ekkrwct(const EKKfactinfo *fact, double *dluval, int *hcoli, int *mrstrt,
   int *hpivro	= fact->krpadr; 
   int *hpivco	= fact->kcpadr;
 #endif
-  int i, k, k1, nz, icol;
+  int i, k, nz, icol;
+  CoinBigIndex k1;
   int kmax;
-  int irow, iput;
+  int irow;
+  CoinBigIndex iput;
   int ilook;
   const int nrow = fact->nrow;
 
@@ -1789,7 +1804,7 @@ void c_ekkrwct(const EKKfactinfo *fact, double *dluval, int *hcoli, int *mrstrt,
 /*     takes Uwe's modern structures and puts them back 20 years */
 int c_ekkshff(EKKfactinfo *fact,
   EKKHlink *clink, EKKHlink *rlink,
-  int xnewro)
+  CoinBigIndex xnewro)
 {
   int *hpivro = fact->krpadr;
 
@@ -1972,32 +1987,33 @@ static void c_ekk_sort2(int *key, double *array2, int number)
 /*     and set up backward pointers for pivot rows */
 void c_ekkshfv(EKKfactinfo *fact,
   EKKHlink *rlink, EKKHlink *clink,
-  int xnewro)
+  CoinBigIndex xnewro)
 {
   int *hcoli = fact->xecadr;
   double *dluval = fact->xeeadr;
   double *dvalpv = fact->kw3adr;
-  int *mrstrt = fact->xrsadr;
+  CoinBigIndex *mrstrt = fact->xrsadr;
   int *hrowi = fact->xeradr;
-  int *mcstrt = fact->xcsadr;
+  CoinBigIndex *mcstrt = fact->xcsadr;
   int *hinrow = fact->xrnadr;
   int *hincol = fact->xcnadr;
   int *hpivro = fact->krpadr;
   int *hpivco = fact->kcpadr;
   double *dpermu = fact->kadrpm;
   double *de2val = fact->xe2adr ? fact->xe2adr - 1 : 0;
-  int nnentu = fact->nnentu;
+  CoinBigIndex nnentu = fact->nnentu;
   int xnetal = fact->xnetal;
 
   int numberSlacks; /* numberSlacks not read */
 
-  int i, j, k, kk, nel;
+  int i, j, nel;
+  CoinBigIndex k, kk;
   int nroom;
   bool need_more_space;
   int ndenuc = fact->ndenuc;
   int if_sparse_update = fact->if_sparse_update;
-  int nnentl = fact->nnentl;
-  int nnetas = fact->nnetas;
+  CoinBigIndex nnentl = fact->nnentl;
+  CoinBigIndex nnetas = fact->nnetas;
 
   int *ihlink = (reinterpret_cast< int * >(clink)) + 1; /* can't use rlink for simple loop below */
 
@@ -2007,8 +2023,9 @@ void c_ekkshfv(EKKfactinfo *fact,
   /* this is not just a temporary - c_ekkbtrn etc use this */
   int *mpermu = (reinterpret_cast< int * >(dpermu + nrow)) + 1;
 
-  int *temp = ihlink + nrow;
-  int *temp2 = temp + nrow;
+  /* kw2adr is free once c_ekkcmfc is done; use it for row starts */
+  CoinBigIndex *temp = reinterpret_cast< CoinBigIndex * >(fact->kw2adr);
+  int *temp2 = ihlink + nrow;
   const int notMuchRoom = (nnentu + xnewro + 10 > nnetas - nnentl);
 
   /* compress hlink and make simpler */
@@ -2021,7 +2038,7 @@ void c_ekkshfv(EKKfactinfo *fact,
 
   /* must be same as in c_ekkshff */
   if (fact->ndenuc || notMuchRoom || nrow < C_EKK_GO_SPARSE) {
-    int ninbas;
+    CoinBigIndex ninbas;
 
     /* CHANGE COLUMN NUMBERS AND FILL IN RECIPROCALS */
     /* ALSO RECOMPUTE NUMBER IN COLUMN */
@@ -2029,7 +2046,7 @@ void c_ekkshfv(EKKfactinfo *fact,
     c_ekkscpy_0_1(nrow, 1, &hincol[1]);
 
     if (notMuchRoom) {
-      fact->eta_size = static_cast< int >(1.05 * fact->eta_size);
+      fact->eta_size = static_cast< CoinBigIndex >(1.05 * fact->eta_size);
 
       /* eta_size can be no larger than maxNNetas */
       if (fact->maxNNetas > 0 && fact->eta_size > fact->maxNNetas) {
@@ -2045,8 +2062,8 @@ void c_ekkshfv(EKKfactinfo *fact,
     for (i = 1; i <= nrow; ++i) {
       int jpiv = mpermu[i];
       int nin = hinrow[i];
-      int krs = mrstrt[i];
-      int kre = krs + nin;
+      CoinBigIndex krs = mrstrt[i];
+      CoinBigIndex kre = krs + nin;
 
       temp[jpiv] = krs;
       temp2[jpiv] = nin;
@@ -2069,7 +2086,7 @@ void c_ekkshfv(EKKfactinfo *fact,
     /* temp2[mpermu[i]] == hinrow[i] */
 
     ninbas--; /* ???? */
-    c_ekkscpy(nrow, &temp[1], &mrstrt[1]);
+    CoinMemcpyN(&temp[1], nrow, &mrstrt[1]);
     c_ekkscpy(nrow, &temp2[1], &hinrow[1]);
 
     /* now mrstrt, hinrow, hcoli and hrowi have been permuted */
@@ -2085,19 +2102,19 @@ void c_ekkshfv(EKKfactinfo *fact,
     /* Also multiply U elements by - reciprocal of pivot element */
     /* Also decrement mcstrt/hincol to give "real" sizes */
     for (i = 1; i <= nrow; ++i) {
-      int kx = --mcstrt[i];
+      CoinBigIndex kx = --mcstrt[i];
       nel = --hincol[i];
       hrowi[kx] = nel;
       dluval[kx] = dvalpv[i];
 #ifndef NO_SHIFT
-      for (int j = kx + 1; j <= kx + nel; j++)
+      for (CoinBigIndex j = kx + 1; j <= kx + nel; j++)
         hrowi[j] = SHIFT_INDEX(hrowi[j]);
 #endif
     }
 
     /* sort dense part */
     for (i = nrow - ndenuc + 1; i <= nrow; i++) {
-      int kx = mcstrt[i] + 1; /* "real" entries start after pivot */
+      CoinBigIndex kx = mcstrt[i] + 1; /* "real" entries start after pivot */
       int nel = hincol[i];
       c_ekk_sort2(&hrowi[kx], &dluval[kx], nel);
     }
@@ -2116,9 +2133,9 @@ void c_ekkshfv(EKKfactinfo *fact,
     /*       For each row compute reciprocal of pivot element and */
     /*       take out of U */
     /*       Also use HLINK(1 to permute column numbers */
-    int ninbas = 0;
-    int ilast; /* last available entry */
-    int spareSpace;
+    CoinBigIndex ninbas = 0;
+    CoinBigIndex ilast; /* last available entry */
+    CoinBigIndex spareSpace;
     double *dluval2;
     /*int * hlink2 = ihlink+nrow;
       int * mrstrt2 = hlink2+nrow;*/
@@ -2135,7 +2152,7 @@ void c_ekkshfv(EKKfactinfo *fact,
     spareSpace = ilast - nnentu;
     need_more_space = false;
     /*     save clean row copy if enough room */
-    nroom = (spareSpace) / nrow;
+    nroom = static_cast< int >(CoinMin(spareSpace / nrow, static_cast< CoinBigIndex >(COIN_INT_MAX)));
     if (nrow < 10000) {
       if (nroom < 10) {
         need_more_space = true;
@@ -2150,19 +2167,19 @@ void c_ekkshfv(EKKfactinfo *fact,
     }
     if (need_more_space) {
       if (if_sparse_update) {
-        int i1 = fact->eta_size + 10 * nrow;
-        fact->eta_size = static_cast< int >(1.2 * fact->eta_size);
+        CoinBigIndex i1 = fact->eta_size + 10 * nrow;
+        fact->eta_size = static_cast< CoinBigIndex >(1.2 * fact->eta_size);
         if (i1 > fact->eta_size) {
           fact->eta_size = i1;
         }
       } else {
-        fact->eta_size = static_cast< int >(1.05 * fact->eta_size);
+        fact->eta_size = static_cast< CoinBigIndex >(1.05 * fact->eta_size);
       }
     } else {
       if (nroom < 11) {
         if (if_sparse_update) {
-          int i1 = fact->eta_size + (11 - nroom) * nrow;
-          fact->eta_size = static_cast< int >(1.2 * fact->eta_size);
+          CoinBigIndex i1 = fact->eta_size + (11 - nroom) * nrow;
+          fact->eta_size = static_cast< CoinBigIndex >(1.2 * fact->eta_size);
           if (i1 > fact->eta_size) {
             fact->eta_size = i1;
           }
@@ -2224,7 +2241,7 @@ void c_ekkshfv(EKKfactinfo *fact,
       eta_next[last] = nrow + 1;
       eta_last[nrow + 1] = last;
       eta_next[nrow + 1] = nrow + 2;
-      c_ekkscpy(nrow, &temp[1], &mrstrt[1]);
+      CoinMemcpyN(&temp[1], nrow, &mrstrt[1]);
       c_ekkscpy(nrow, &temp2[1], &hinrow[1]);
       i = eta_last[nrow + 1];
       ninbas = mrstrt[i] + hinrow[i] - 1;
@@ -2242,15 +2259,14 @@ void c_ekkshfv(EKKfactinfo *fact,
           abort();
       }
 #endif
-      for (i = 1; i <= ninbas; ++i) {
-        k = hcoli[i];
-        k = ihlink[k];
+      for (k = 1; k <= ninbas; ++k) {
+        int jcol = ihlink[hcoli[k]];
 #ifdef DEBUG
-        if (k <= 0 || k > nrow)
+        if (jcol <= 0 || jcol > nrow)
           abort();
 #endif
-        hcoli[i] = k;
-        hincol[k]++;
+        hcoli[k] = jcol;
+        hincol[jcol]++;
       }
 #ifdef DEBUG
       for (i = nrow; i > 0; i--) {
@@ -2281,12 +2297,12 @@ void c_ekkshfv(EKKfactinfo *fact,
       mcstrt[nrow + 4] = nnentu + 1;
       /* create column copy */
       for (i = nrow; i > 0; i--) {
-        int krs = mrstrt[i];
-        int kre = krs + hinrow[i];
+        CoinBigIndex krs = mrstrt[i];
+        CoinBigIndex kre = krs + hinrow[i];
         hinrow[i]--;
         mrstrt[i]++;
         {
-          int kx = mcstrt[i];
+          CoinBigIndex kx = mcstrt[i];
           /*nel = hincol[i];
 	    if (hrowi[kx]!=nel) abort();
 	    hrowi[kx] = nel-1;*/
@@ -2294,9 +2310,9 @@ void c_ekkshfv(EKKfactinfo *fact,
           /*hincol[i]=0;*/
           for (kk = krs + 1; kk < kre; ++kk) {
             int j = hcoli[kk];
-            int iput = hincol[j] + 1;
-            hincol[j] = iput;
-            iput += mcstrt[j];
+            int nput = hincol[j] + 1;
+            hincol[j] = nput;
+            CoinBigIndex iput = nput + mcstrt[j];
             hrowi[iput] = SHIFT_INDEX(i);
             dluval2[iput] = dluval[kk];
           }
@@ -2308,7 +2324,7 @@ void c_ekkshfv(EKKfactinfo *fact,
         /* move first down */
         i = eta_next[0];
         {
-          int krs = mrstrt[i];
+          CoinBigIndex krs = mrstrt[i];
           nel = hinrow[i];
           for (j = 1; j <= nel; j++) {
             hcoli[j] = hcoli[j + krs - 1];
@@ -2324,8 +2340,8 @@ void c_ekkshfv(EKKfactinfo *fact,
         fact->xe2adr = address;
         if (nnentl) {
           int n = xnetal - nrow - maxinv - 5;
-          int j1, j2;
-          int *mcstrt2 = mcstrt + nrow + maxinv + 4;
+          CoinBigIndex j1, j2;
+          CoinBigIndex *mcstrt2 = mcstrt + nrow + maxinv + 4;
           j2 = mcstrt2[1];
           j1 = mcstrt2[n + 1] + 1;
 #if 0
@@ -2348,7 +2364,7 @@ void c_ekkshfv(EKKfactinfo *fact,
       }
       /* sort dense part */
       for (i = nrow - ndenuc + 1; i <= nrow; i++) {
-        int kx = mcstrt[i] + 1;
+        CoinBigIndex kx = mcstrt[i] + 1;
         int nel = hincol[i];
         c_ekk_sort2(&hrowi[kx], &dluval[kx], nel);
       }
@@ -2357,7 +2373,7 @@ void c_ekkshfv(EKKfactinfo *fact,
   }
   /* Find first non slack */
   for (i = 1; i <= nrow; ++i) {
-    int kcs = mcstrt[i];
+    CoinBigIndex kcs = mcstrt[i];
     if (hincol[i] != 0 || dluval[kcs] != SLACK_VALUE) {
       break;
     }
@@ -2392,17 +2408,18 @@ void c_ekkshfv(EKKfactinfo *fact,
   {
     const int lstart = nrow + maxinv + 5;
     int n = xnetal - lstart; /* number of L entries */
-    int add, iel;
+    int add;
+    CoinBigIndex iel;
     int *hpivco_L = &hpivco[lstart];
-    int *mcstrt_L = &mcstrt[lstart];
+    CoinBigIndex *mcstrt_L = &mcstrt[lstart];
     if (nnentl) {
       /* elements of L were stored in descending order in dluval/hcoli */
-      int kle = mcstrt_L[0];
-      int kls = mcstrt_L[n] + 1;
+      CoinBigIndex kle = mcstrt_L[0];
+      CoinBigIndex kls = mcstrt_L[n] + 1;
 
       if (if_sparse_update) {
-        int i2, iel;
-        int *mrstrt2 = &mrstrt[nrow];
+        CoinBigIndex i2, iel;
+        CoinBigIndex *mrstrt2 = &mrstrt[nrow];
 
         /* need row copy of L */
         /* hpivro is spare for counts; just used as a temp buffer */
@@ -2415,7 +2432,7 @@ void c_ekkshfv(EKKfactinfo *fact,
           hrowi[iel] = SHIFT_INDEX(jrow);
         }
         {
-          int ibase = nnetas - nnentl + 1;
+          CoinBigIndex ibase = nnetas - nnentl + 1;
           int firstDoRow = 0;
           for (i = 1; i <= nrow; i++) {
             mrstrt2[i] = ibase;
@@ -2423,7 +2440,7 @@ void c_ekkshfv(EKKfactinfo *fact,
               firstDoRow = i;
             }
             ibase += hpivro[i];
-            hpivro[i] = mrstrt2[i];
+            temp[i] = mrstrt2[i];
           }
           if (!firstDoRow) {
             firstDoRow = nrow + 1;
@@ -2433,14 +2450,14 @@ void c_ekkshfv(EKKfactinfo *fact,
         }
         i2 = mcstrt_L[n];
         for (i = n - 1; i >= 0; --i) {
-          int i1 = mcstrt_L[i];
+          CoinBigIndex i1 = mcstrt_L[i];
           int ipiv = hpivco_L[i];
           ipiv = mpermu[ipiv];
           hpivco_L[i] = ipiv;
           for (iel = i2; iel < i1; iel++) {
             int irow = UNSHIFT_INDEX(hrowi[iel + 1]);
-            int iput = hpivro[irow];
-            hpivro[irow] = iput + 1;
+            CoinBigIndex iput = temp[irow];
+            temp[irow] = iput + 1;
             hcoli[iput] = ipiv;
             de2val[iput] = dluval[iel + 1];
           }
@@ -2462,7 +2479,7 @@ void c_ekkshfv(EKKfactinfo *fact,
       if (add) {
         int i;
         int last = hpivco_L[n - 1];
-        int laststart = mcstrt_L[n];
+        CoinBigIndex laststart = mcstrt_L[n];
         int base = hpivco_L[0] - 1;
         /* adjust so numbers match */
         mcstrt_L -= base;
@@ -2532,13 +2549,14 @@ void c_ekkshfv(EKKfactinfo *fact,
 
 } /* c_ekkshfv */
 
-static void c_ekkclcp1(const int *hcol, const int *mrstrt,
-  int *hrow, int *mcstrt,
+static void c_ekkclcp1(const int *hcol, const CoinBigIndex *mrstrt,
+  int *hrow, CoinBigIndex *mcstrt,
   int *hincol, int nnrow, int nncol,
-  int ninbas)
+  CoinBigIndex ninbas)
 {
-  int i, j, kc, kr, kre, krs, icol;
-  int iput;
+  int i, j, icol;
+  CoinBigIndex kc, kr, kre, krs;
+  CoinBigIndex iput;
 
   /* Create columnwise storage of row indices */
 
@@ -2555,20 +2573,20 @@ static void c_ekkclcp1(const int *hcol, const int *mrstrt,
     kre = mrstrt[i + 1] - 1;
     for (kr = krs; kr <= kre; ++kr) {
       icol = hcol[kr];
-      iput = hincol[icol];
-      hincol[icol] = iput + 1;
-      iput += mcstrt[icol];
+      iput = mcstrt[icol] + hincol[icol];
+      hincol[icol]++;
       hrow[iput] = i;
     }
   }
 } /* c_ekkclcp */
-inline void c_ekkclcp2(const int *hcol, const double *dels, const int *mrstrt,
-  int *hrow, double *dels2, int *mcstrt,
+inline void c_ekkclcp2(const int *hcol, const double *dels, const CoinBigIndex *mrstrt,
+  int *hrow, double *dels2, CoinBigIndex *mcstrt,
   int *hincol, int nnrow, int nncol,
-  int ninbas)
+  CoinBigIndex ninbas)
 {
-  int i, j, kc, kr, kre, krs, icol;
-  int iput;
+  int i, j, icol;
+  CoinBigIndex kc, kr, kre, krs;
+  CoinBigIndex iput;
 
   /* Create columnwise storage of row indices */
 
@@ -2585,33 +2603,33 @@ inline void c_ekkclcp2(const int *hcol, const double *dels, const int *mrstrt,
     kre = mrstrt[i + 1] - 1;
     for (kr = krs; kr <= kre; ++kr) {
       icol = hcol[kr];
-      iput = hincol[icol];
-      hincol[icol] = iput + 1;
-      iput += mcstrt[icol];
+      iput = mcstrt[icol] + hincol[icol];
+      hincol[icol]++;
       hrow[iput] = i;
       dels2[iput] = dels[kr];
     }
   }
 } /* c_ekkclcp */
-int c_ekkslcf(register const EKKfactinfo *fact)
+CoinBigIndex c_ekkslcf(register const EKKfactinfo *fact)
 {
   int *hrow = fact->xeradr;
   int *hcol = fact->xecadr;
   double *dels = fact->xeeadr;
   int *hinrow = fact->xrnadr;
   int *hincol = fact->xcnadr;
-  int *mrstrt = fact->xrsadr;
-  int *mcstrt = fact->xcsadr;
+  CoinBigIndex *mrstrt = fact->xrsadr;
+  CoinBigIndex *mcstrt = fact->xcsadr;
   const int nrow = fact->nrow;
-  int ninbas;
+  CoinBigIndex ninbas;
   /* space for etas */
-  const int nnetas = fact->nnetas;
+  const CoinBigIndex nnetas = fact->nnetas;
   ninbas = mcstrt[nrow + 1] - 1;
 
   /* Now sort */
   if (ninbas << 1 > nnetas) {
     /* Put it in row order */
-    int i, k;
+    int i;
+    CoinBigIndex k;
     c_ekkrowq(hrow, hcol, dels, mrstrt, hinrow, nrow, ninbas);
     k = 1;
     for (i = 1; i <= nrow; ++i) {
@@ -2760,17 +2778,17 @@ int c_ekktria(EKKfactinfo *fact,
   EKKHlink *rlink,
   EKKHlink *clink,
   int *nsingp,
-  int *xnewcop, int *xnewrop,
+  CoinBigIndex *xnewcop, CoinBigIndex *xnewrop,
   int *ncompactionsp,
-  const int ninbas)
+  const CoinBigIndex ninbas)
 {
   const int nrow = fact->nrow;
   const int maxinv = fact->maxinv;
   int *hcoli = fact->xecadr;
   double *dluval = fact->xeeadr;
-  int *mrstrt = fact->xrsadr;
+  CoinBigIndex *mrstrt = fact->xrsadr;
   int *hrowi = fact->xeradr;
-  int *mcstrt = fact->xcsadr;
+  CoinBigIndex *mcstrt = fact->xcsadr;
   int *hinrow = fact->xrnadr;
   int *hincol = fact->xcnadr;
   int *stack = fact->krpadr; /* normally hpivro */
@@ -2783,27 +2801,29 @@ int c_ekktria(EKKfactinfo *fact,
   /*      Use NUSPIK to keep sum of deactivated row counts */
   fact->nuspike = 0;
   int xnetal = nrow + maxinv + 4;
-  int xnewro = mrstrt[nrow] + hinrow[nrow] - 1;
-  int xnewco = xnewro;
-  int kmxeta = ninbas;
+  CoinBigIndex xnewro = mrstrt[nrow] + hinrow[nrow] - 1;
+  CoinBigIndex xnewco = xnewro;
+  CoinBigIndex kmxeta = ninbas;
   int ncompactions = 0;
 
-  int i, j, k, kc, kce, kcs, npr;
+  int i, j, npr;
+  CoinBigIndex k, kc, kce, kcs;
   double pivot;
-  int kipis, kipie, kjpis, kjpie, knprs, knpre;
+  CoinBigIndex kipis, kipie, kjpis, kjpie, knprs, knpre;
   int ipivot, jpivot, stackc, stackr;
 #ifndef NDEBUG
-  int kpivot = -1;
+  CoinBigIndex kpivot = -1;
 #else
-  int kpivot = -1;
+  CoinBigIndex kpivot = -1;
 #endif
-  int epivco, kstart, maxstk;
+  int epivco, maxstk;
+  CoinBigIndex kstart;
   int irtcod = 0;
   int lastSlack = 0;
 
-  int lstart = fact->nnetas + 1;
+  CoinBigIndex lstart = fact->nnetas + 1;
   /*int nnentu	= ninbas; */
-  int lstart_minus_nnentu = lstart - ninbas;
+  CoinBigIndex lstart_minus_nnentu = lstart - ninbas;
   /* do initial column singletons - as can do faster */
   for (jpivot = 1; jpivot <= nrow; ++jpivot) {
     if (hincol[jpivot] == 1) {
@@ -2945,7 +2965,7 @@ int c_ekktria(EKKfactinfo *fact,
             hrowi[kstart] = hrowi[k];
           }
         }
-        hincol[j] = kstart - mcstrt[j] + 1;
+        hincol[j] = static_cast< int >(kstart - mcstrt[j] + 1);
       }
     }
     xnewco = kstart;
@@ -3001,7 +3021,7 @@ int c_ekktria(EKKfactinfo *fact,
 
         /* (12) */
         if (!(xnewro + epivco < lstart)) {
-          int kstart;
+          CoinBigIndex kstart;
 
           if (!(epivco < lstart_minus_nnentu)) {
             irtcod = -5;
@@ -3104,7 +3124,6 @@ int c_ekktria(EKKfactinfo *fact,
 
   return (irtcod);
 } /* c_ekktria */
-#endif
 
 /* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
 */
@@ -19,7 +19,11 @@
 #include "CoinPackedVectorBase.hpp"
 #endif
 #include "CoinFloatEqual.hpp"
+#include "CoinIndexedVector.hpp"
+#include "CoinMatrixTimes.hpp"
 #include "CoinPackedMatrix.hpp"
+#include "CoinParallel.hpp"
+#include "CoinSimd.hpp"
 
 #if !defined(COIN_COINUTILS_CHECKLEVEL)
 #define COIN_COINUTILS_CHECKLEVEL 0
@@ -36,6 +40,21 @@ CoinLengthWithExtra(T len, double extraGap)
 
 //#############################################################################
 
+/* Minor-dimension vectors staged by addMinorAppend, in the same layout as
+   the arguments of appendMinorFast.  The arrays are kept from one round to
+   the next and doubled when full.
+*/
+struct CoinPackedMatrixStaging {
+  int numberVectors;
+  int maximumVectors;
+  CoinBigIndex maximumElements;
+  CoinBigIndex *start;
+  int *index;
+  double *element;
+};
+
+//#############################################################################
+
 static inline void
 CoinTestSortedIndexSet(const int num, const int *sorted, const int maxEntry,
   const char *testingMethod)
@@ -112,6 +131,7 @@ void CoinPackedMatrix::reserve(const int newMaxMajorDim, const CoinBigIndex newM
 
 void CoinPackedMatrix::clear()
 {
+  dropMinorStaged();
   majorDim_ = 0;
   minorDim_ = 0;
   size_ = 0;
@@ -731,6 +751,7 @@ void CoinPackedMatrix::submatrixOf(const CoinPackedMatrix &matrix,
   const int *sortedInd = sortedIndPtr == 0 ? indMajor : sortedIndPtr;
 
   gutsOfDestructor();
+  dropMinorStaged();
 
   // Count how many nonzeros there'll be
   CoinBigIndex nzcnt = 0;
@@ -780,6 +801,7 @@ void CoinPackedMatrix::submatrixOfWithDuplicates(const CoinPackedMatrix &matrix,
   }
 #endif
   gutsOfDestructor();
+  dropMinorStaged();
   // Get rid of gaps
   extraMajor_ = 0;
   extraGap_ = 0;
@@ -826,6 +848,7 @@ void CoinPackedMatrix::copyOf(const CoinPackedMatrix &rhs)
 {
   if (this != &rhs) {
     gutsOfDestructor();
+    dropMinorStaged();
     gutsOfCopyOf(rhs.colOrdered_,
       rhs.minorDim_, rhs.majorDim_, rhs.size_,
       rhs.element_, rhs.index_, rhs.start_, rhs.length_,
@@ -843,6 +866,7 @@ void CoinPackedMatrix::copyOf(const bool colordered,
   const double extraMajor, const double extraGap)
 {
   gutsOfDestructor();
+  dropMinorStaged();
   gutsOfCopyOf(colordered, minor, major, numels, elem, ind, start, len,
     extraMajor, extraGap);
 }
@@ -854,6 +878,7 @@ void CoinPackedMatrix::copyReuseArrays(const CoinPackedMatrix &rhs)
 {
   assert(colOrdered_ == rhs.colOrdered_);
   if (maxMajorDim_ >= rhs.majorDim_ && maxSize_ >= rhs.size_) {
+    dropMinorStaged();
     majorDim_ = rhs.majorDim_;
     minorDim_ = rhs.minorDim_;
     size_ = rhs.size_;
@@ -880,15 +905,144 @@ void CoinPackedMatrix::copyReuseArrays(const CoinPackedMatrix &rhs)
 
 //#############################################################################
 
+namespace {
+// Matrices with fewer elements than this are copied in one pass
+const CoinBigIndex minimumBlockedElements = 1 << 20;
+// or with fewer major vectors unless threads are used
+const int minimumBlockedMajor = 1 << 18;
+// About this many elements go into each block of new major vectors
+const CoinBigIndex blockElements = 1 << 15;
+// At most this many blocks (each is a separate stream of writes)
+const int maximumBlocks = 1024;
+
+/* Shared by the tasks of one blocked reverseOrderedCopyOf.
+
+   First the old major vectors are split into pieces and each piece puts
+   its elements, in order, into the part of the new arrays belonging to
+   the block of new major vectors they are going to (with the new major
+   index kept in target).  Then each block is sorted into its major
+   vectors.  As every block gets the pieces in order the result is the
+   same as one pass through the old major vectors.
+*/
+typedef struct {
+  // old matrix
+  const CoinBigIndex *start;
+  const int *length;
+  const int *index;
+  const double *element;
+  // new matrix
+  const CoinBigIndex *newStart;
+  const int *newLength;
+  int *newIndex;
+  double *newElement;
+  int newMajorDim;
+  // new major index of each element while in blocks
+  int *target;
+  // new major vectors (1 << shift) in each block
+  int shift;
+  int numberBlocks;
+  // first old major vector of each piece and one past last
+  int *first;
+  // next position in each block for each piece
+  CoinBigIndex *put;
+} CoinPackedMatrixReverse;
+
+// Task for CoinParallelRun - counts elements of a piece in each block
+void countBlocksTask(void *infoPointer, int whichTask)
+{
+  const CoinPackedMatrixReverse *info = static_cast< const CoinPackedMatrixReverse * >(infoPointer);
+  const CoinBigIndex *COIN_RESTRICT start = info->start;
+  const int *COIN_RESTRICT length = info->length;
+  const int *COIN_RESTRICT index = info->index;
+  const int shift = info->shift;
+  CoinBigIndex *COIN_RESTRICT count = info->put + whichTask * info->numberBlocks;
+  CoinZeroN(count, info->numberBlocks);
+  for (int i = info->first[whichTask]; i < info->first[whichTask + 1]; i++) {
+    const CoinBigIndex last = start[i] + length[i];
+    for (CoinBigIndex j = start[i]; j < last; j++)
+      count[index[j] >> shift]++;
+  }
+}
+
+// Task for CoinParallelRun - puts elements of a piece into blocks
+void fillBlocksTask(void *infoPointer, int whichTask)
+{
+  const CoinPackedMatrixReverse *info = static_cast< const CoinPackedMatrixReverse * >(infoPointer);
+  const CoinBigIndex *COIN_RESTRICT start = info->start;
+  const int *COIN_RESTRICT length = info->length;
+  const int *COIN_RESTRICT index = info->index;
+  const double *COIN_RESTRICT element = info->element;
+  int *COIN_RESTRICT newIndex = info->newIndex;
+  double *COIN_RESTRICT newElement = info->newElement;
+  int *COIN_RESTRICT target = info->target;
+  const int shift = info->shift;
+  CoinBigIndex *COIN_RESTRICT put = info->put + whichTask * info->numberBlocks;
+  for (int i = info->first[whichTask]; i < info->first[whichTask + 1]; i++) {
+    const CoinBigIndex last = start[i] + length[i];
+    for (CoinBigIndex j = start[i]; j < last; j++) {
+      const int ind = index[j];
+      const CoinBigIndex where = put[ind >> shift]++;
+      target[where] = ind;
+      newIndex[where] = i;
+      newElement[where] = element[j];
+    }
+  }
+}
+
+// Task for CoinParallelRun - sorts one block into its major vectors
+void sortBlockTask(void *infoPointer, int whichBlock)
+{
+  const CoinPackedMatrixReverse *info = static_cast< const CoinPackedMatrixReverse * >(infoPointer);
+  const CoinBigIndex *COIN_RESTRICT newStart = info->newStart;
+  const int *COIN_RESTRICT newLength = info->newLength;
+  int *COIN_RESTRICT newIndex = info->newIndex;
+  double *COIN_RESTRICT newElement = info->newElement;
+  const int firstMajor = whichBlock << info->shift;
+  const int lastMajor = CoinMin(firstMajor + (1 << info->shift), info->newMajorDim);
+  const CoinBigIndex base = newStart[firstMajor];
+  int number = 0;
+  for (int i = firstMajor; i < lastMajor; i++)
+    number += newLength[i];
+  if (!number)
+    return;
+  // take block out then put back in place
+  int *COIN_RESTRICT target = new int[2 * number];
+  int *COIN_RESTRICT blockIndex = target + number;
+  double *COIN_RESTRICT blockElement = new double[number];
+  CoinMemcpyN(info->target + base, number, target);
+  CoinMemcpyN(newIndex + base, number, blockIndex);
+  CoinMemcpyN(newElement + base, number, blockElement);
+  CoinBigIndex *COIN_RESTRICT put = new CoinBigIndex[lastMajor - firstMajor];
+  CoinMemcpyN(newStart + firstMajor, lastMajor - firstMajor, put);
+  put -= firstMajor;
+  for (int k = 0; k < number; k++) {
+    const CoinBigIndex where = put[target[k]]++;
+    newIndex[where] = blockIndex[k];
+    newElement[where] = blockElement[k];
+  }
+  put += firstMajor;
+  delete[] put;
+  delete[] blockElement;
+  delete[] target;
+}
+} // end file-local namespace
+
 // This method is essentially the same as minorAppendOrthoOrdered(). However,
 // since we start from an empty matrix, lots of fluff can be avoided.
 
 void CoinPackedMatrix::reverseOrderedCopyOf(const CoinPackedMatrix &rhs)
+{
+  reverseOrderedCopyOf(rhs, 1);
+}
+
+void CoinPackedMatrix::reverseOrderedCopyOf(const CoinPackedMatrix &rhs,
+  int numberThreads)
 {
   if (this == &rhs) {
-    reverseOrdering();
+    reverseOrdering(numberThreads);
     return;
   }
+  dropMinorStaged();
 
   int i;
   colOrdered_ = !rhs.colOrdered_;
@@ -962,6 +1116,10 @@ void CoinPackedMatrix::reverseOrderedCopyOf(const CoinPackedMatrix &rhs)
   const int *COIN_RESTRICT length = rhs.length_;
   const double *COIN_RESTRICT element = rhs.element_;
   assert(start[0] == 0);
+  if (size_ >= minimumBlockedElements && (majorDim_ >= minimumBlockedMajor || (numberThreads > 1 && CoinParallelAvailable()))) {
+    reverseBlocked(rhs, numberThreads);
+    return;
+  }
   CoinBigIndex first = 0;
   for (i = 0; i < minorDim_; ++i) {
     CoinBigIndex last = first + length[i];
@@ -1006,6 +1164,67 @@ void CoinPackedMatrix::reverseOrderedCopyOf(const CoinPackedMatrix &rhs)
   }
 }
 
+//-----------------------------------------------------------------------------
+
+/* Second half of reverseOrderedCopyOf for big matrices.  Start and length
+   are set up.  Elements are put in by blocks of new major vectors so each
+   block's part of the arrays can stay in cache.
+*/
+void CoinPackedMatrix::reverseBlocked(const CoinPackedMatrix &rhs,
+  int numberThreads)
+{
+  CoinPackedMatrixReverse info;
+  info.start = rhs.start_;
+  info.length = rhs.length_;
+  info.index = rhs.index_;
+  info.element = rhs.element_;
+  info.newStart = start_;
+  info.newLength = length_;
+  info.newIndex = index_;
+  info.newElement = element_;
+  info.newMajorDim = majorDim_;
+  // blocks of 1 << shift major vectors
+  int shift = 0;
+  while ((static_cast< CoinBigIndex >(majorDim_ - 1) >> shift) >= maximumBlocks
+    || (static_cast< double >(size_) * (1 << shift)) < static_cast< double >(blockElements) * majorDim_)
+    shift++;
+  info.shift = shift;
+  info.numberBlocks = ((majorDim_ - 1) >> shift) + 1;
+  // split old major vectors into pieces of about same number of elements
+  int numberTasks = 1;
+  if (numberThreads > 1 && CoinParallelAvailable())
+    numberTasks = static_cast< int >(CoinMin(static_cast< CoinBigIndex >(numberThreads),
+      CoinMax(static_cast< CoinBigIndex >(1), size_ / minimumBlockedElements)));
+  info.first = new int[numberTasks + 1];
+  info.first[0] = 0;
+  int iTask = 1;
+  CoinBigIndex sum = 0;
+  for (int i = 0; i < minorDim_ && iTask < numberTasks; i++) {
+    sum += rhs.length_[i];
+    while (iTask < numberTasks && static_cast< double >(sum) * numberTasks >= static_cast< double >(size_) * iTask)
+      info.first[iTask++] = i + 1;
+  }
+  while (iTask <= numberTasks)
+    info.first[iTask++] = minorDim_;
+  info.target = new int[getLastStart()];
+  info.put = new CoinBigIndex[numberTasks * info.numberBlocks];
+  CoinParallelRun(numberTasks, numberTasks, countBlocksTask, &info);
+  // counts to positions - each block gets pieces in order
+  for (int iBlock = 0; iBlock < info.numberBlocks; iBlock++) {
+    CoinBigIndex put = start_[iBlock << shift];
+    for (iTask = 0; iTask < numberTasks; iTask++) {
+      CoinBigIndex number = info.put[iTask * info.numberBlocks + iBlock];
+      info.put[iTask * info.numberBlocks + iBlock] = put;
+      put += number;
+    }
+  }
+  CoinParallelRun(numberTasks, numberTasks, fillBlocksTask, &info);
+  CoinParallelRun(info.numberBlocks, numberTasks, sortBlockTask, &info);
+  delete[] info.put;
+  delete[] info.target;
+  delete[] info.first;
+}
+
 //#############################################################################
 
 void CoinPackedMatrix::assignMatrix(const bool colordered,
@@ -1016,6 +1235,7 @@ void CoinPackedMatrix::assignMatrix(const bool colordered,
   const int maxmajor, const CoinBigIndex maxsize)
 {
   gutsOfDestructor();
+  dropMinorStaged();
   colOrdered_ = colordered;
   element_ = elem;
   index_ = ind;
@@ -1046,6 +1266,7 @@ CoinPackedMatrix::operator=(const CoinPackedMatrix &rhs)
 {
   if (this != &rhs) {
     gutsOfDestructor();
+    dropMinorStaged();
     extraGap_ = rhs.extraGap_;
     extraMajor_ = rhs.extraMajor_;
     gutsOfOpEqual(rhs.colOrdered_,
@@ -1059,10 +1280,17 @@ CoinPackedMatrix::operator=(const CoinPackedMatrix &rhs)
 
 void CoinPackedMatrix::reverseOrdering()
 {
+  reverseOrdering(1);
+}
+
+void CoinPackedMatrix::reverseOrdering(int numberThreads)
+{
+  // staged vectors are of this ordering
+  commitMinorAppend();
   CoinPackedMatrix m;
   m.extraGap_ = extraMajor_;
   m.extraMajor_ = extraGap_;
-  m.reverseOrderedCopyOf(*this);
+  m.reverseOrderedCopyOf(*this, numberThreads);
   swap(m);
 }
 
@@ -1070,6 +1298,8 @@ void CoinPackedMatrix::reverseOrdering()
 
 void CoinPackedMatrix::transpose()
 {
+  // staged vectors are of this ordering
+  commitMinorAppend();
   colOrdered_ = !colOrdered_;
 }
 
@@ -1089,17 +1319,26 @@ void CoinPackedMatrix::swap(CoinPackedMatrix &m)
   std::swap(size_, m.size_);
   std::swap(maxMajorDim_, m.maxMajorDim_);
   std::swap(maxSize_, m.maxSize_);
+  std::swap(staging_, m.staging_);
 }
 
 //#############################################################################
 //#############################################################################
 
 void CoinPackedMatrix::times(const double *x, double *y) const
+{
+  times(x, y, 1);
+}
+
+//-----------------------------------------------------------------------------
+
+void CoinPackedMatrix::times(const double *x, double *y,
+  int numberThreads) const
 {
   if (colOrdered_)
-    timesMajor(x, y);
+    timesMajor(x, y, numberThreads);
   else
-    timesMinor(x, y);
+    timesMinor(x, y, numberThreads);
 }
 
 //-----------------------------------------------------------------------------
@@ -1114,12 +1353,38 @@ void CoinPackedMatrix::times(const CoinPackedVectorBase &x, double *y) const
 #endif
 //-----------------------------------------------------------------------------
 
+void CoinPackedMatrix::times(const CoinIndexedVector &x, double *y) const
+{
+  times(x, y, 1);
+}
+
+//-----------------------------------------------------------------------------
+
+void CoinPackedMatrix::times(const CoinIndexedVector &x, double *y,
+  int numberThreads) const
+{
+  if (colOrdered_)
+    timesMajor(x, y, numberThreads);
+  else
+    timesMinor(x, y, numberThreads);
+}
+
+//-----------------------------------------------------------------------------
+
 void CoinPackedMatrix::transposeTimes(const double *x, double *y) const
+{
+  transposeTimes(x, y, 1);
+}
+
+//-----------------------------------------------------------------------------
+
+void CoinPackedMatrix::transposeTimes(const double *x, double *y,
+  int numberThreads) const
 {
   if (colOrdered_)
-    timesMinor(x, y);
+    timesMinor(x, y, numberThreads);
   else
-    timesMajor(x, y);
+    timesMajor(x, y, numberThreads);
 }
 
 //-----------------------------------------------------------------------------
@@ -1132,6 +1397,23 @@ void CoinPackedMatrix::transposeTimes(const CoinPackedVectorBase &x, double *y)
     timesMajor(x, y);
 }
 #endif
+//-----------------------------------------------------------------------------
+
+void CoinPackedMatrix::transposeTimes(const CoinIndexedVector &x, double *y) const
+{
+  transposeTimes(x, y, 1);
+}
+
+//-----------------------------------------------------------------------------
+
+void CoinPackedMatrix::transposeTimes(const CoinIndexedVector &x, double *y,
+  int numberThreads) const
+{
+  if (colOrdered_)
+    timesMinor(x, y, numberThreads);
+  else
+    timesMajor(x, y, numberThreads);
+}
 //#############################################################################
 //#############################################################################
 /* Count the number of entries in every minor-dimension vector and
@@ -1762,17 +2044,70 @@ void CoinPackedMatrix::deleteMinorVectors(const int numDel,
 //#############################################################################
 //#############################################################################
 
+namespace {
+// Major vectors for CoinTimesPieces
+struct CoinPackedVectors {
+  const CoinBigIndex *start;
+  const int *length;
+  const int *index;
+  const double *element;
+  inline CoinBigIndex size(int i) const
+  {
+    return length[i];
+  }
+  inline void scatter(int i, double x_i, double *COIN_RESTRICT y) const
+  {
+    const int *COIN_RESTRICT index2 = index;
+    const double *COIN_RESTRICT element2 = element;
+    const CoinBigIndex last = start[i] + length[i];
+    for (CoinBigIndex j = start[i]; j < last; ++j)
+      y[index2[j]] += x_i * element2[j];
+  }
+  inline double dot(int i, const double *x) const
+  {
+    // same additions, in same order, as y_i += x[index[j]] * element[j]
+    return 0.0 - CoinSimdGatherSubtract(0.0, element + start[i], index + start[i], x, length[i]);
+  }
+};
+} // end file-local namespace
+
 void CoinPackedMatrix::timesMajor(const double *x, double *y) const
 {
-  memset(y, 0, minorDim_ * sizeof(double));
-  for (int i = majorDim_ - 1; i >= 0; --i) {
-    const double x_i = x[i];
-    if (x_i != 0.0) {
-      const CoinBigIndex last = getVectorLast(i);
-      for (CoinBigIndex j = getVectorFirst(i); j < last; ++j)
-        y[index_[j]] += x_i * element_[j];
-    }
-  }
+  timesMajor(x, y, 1);
+}
+
+//-----------------------------------------------------------------------------
+
+void CoinPackedMatrix::timesMajor(const double *x, double *y,
+  int numberThreads) const
+{
+  CoinPackedVectors vectors = { start_, length_, index_, element_ };
+  CoinTimesPieces< CoinPackedVectors > pieces(vectors);
+  pieces.scatter(x, NULL, false, majorDim_, getNumElements(), y, minorDim_,
+    numberThreads);
+}
+
+//-----------------------------------------------------------------------------
+
+void CoinPackedMatrix::timesMajor(const CoinIndexedVector &x, double *y) const
+{
+  timesMajor(x, y, 1);
+}
+
+//-----------------------------------------------------------------------------
+
+void CoinPackedMatrix::timesMajor(const CoinIndexedVector &x, double *y,
+  int numberThreads) const
+{
+  int number = x.getNumElements();
+  const int *which = x.getIndices();
+  CoinBigIndex total = 0;
+  for (int k = 0; k < number; k++)
+    total += length_[which[k]];
+  CoinPackedVectors vectors = { start_, length_, index_, element_ };
+  CoinTimesPieces< CoinPackedVectors > pieces(vectors);
+  pieces.scatter(x.denseVector(), which, x.packedMode(), number, total, y,
+    minorDim_, numberThreads);
 }
 
 //-----------------------------------------------------------------------------
@@ -1795,14 +2130,34 @@ void CoinPackedMatrix::timesMajor(const CoinPackedVectorBase &x, double *y) cons
 
 void CoinPackedMatrix::timesMinor(const double *x, double *y) const
 {
-  memset(y, 0, majorDim_ * sizeof(double));
-  for (int i = majorDim_ - 1; i >= 0; --i) {
-    double y_i = 0;
-    const CoinBigIndex last = getVectorLast(i);
-    for (CoinBigIndex j = getVectorFirst(i); j < last; ++j)
-      y_i += x[index_[j]] * element_[j];
-    y[i] = y_i;
-  }
+  timesMinor(x, y, 1);
+}
+
+//-----------------------------------------------------------------------------
+
+void CoinPackedMatrix::timesMinor(const double *x, double *y,
+  int numberThreads) const
+{
+  CoinPackedVectors vectors = { start_, length_, index_, element_ };
+  CoinTimesPieces< CoinPackedVectors > pieces(vectors);
+  pieces.dot(x, majorDim_, getNumElements(), y, numberThreads);
+}
+
+//-----------------------------------------------------------------------------
+
+void CoinPackedMatrix::timesMinor(const CoinIndexedVector &x, double *y) const
+{
+  timesMinor(x, y, 1);
+}
+
+//-----------------------------------------------------------------------------
+
+void CoinPackedMatrix::timesMinor(const CoinIndexedVector &x, double *y,
+  int numberThreads) const
+{
+  double *scratch;
+  timesMinor(CoinTimesDense(x, minorDim_, scratch), y, numberThreads);
+  delete[] scratch;
 }
 
 //-----------------------------------------------------------------------------
@@ -1834,6 +2189,7 @@ CoinPackedMatrix::CoinPackedMatrix()
   , size_(0)
   , maxMajorDim_(0)
   , maxSize_(0)
+  , staging_(NULL)
 {
   start_ = new CoinBigIndex[1];
   start_[0] = 0;
@@ -1855,6 +2211,7 @@ CoinPackedMatrix::CoinPackedMatrix(const bool colordered,
   , size_(0)
   , maxMajorDim_(0)
   , maxSize_(0)
+  , staging_(NULL)
 {
   start_ = new CoinBigIndex[1];
   start_[0] = 0;
@@ -1881,6 +2238,7 @@ CoinPackedMatrix::CoinPackedMatrix(const bool colordered,
   , size_(0)
   , maxMajorDim_(0)
   , maxSize_(0)
+  , staging_(NULL)
 {
   gutsOfOpEqual(colordered, minor, major, numels, elem, ind, start, len);
 }
@@ -1904,6 +2262,7 @@ CoinPackedMatrix::CoinPackedMatrix(const bool colordered,
   , size_(0)
   , maxMajorDim_(0)
   , maxSize_(0)
+  , staging_(NULL)
 {
   gutsOfOpEqual(colordered, minor, major, numels, elem, ind, start, len);
 }
@@ -1962,6 +2321,7 @@ CoinPackedMatrix::CoinPackedMatrix(
   , size_(0)
   , maxMajorDim_(0)
   , maxSize_(0)
+  , staging_(NULL)
 {
   CoinAbsFltEq eq;
   int *colIndices = new int[numberElements];
@@ -2126,6 +2486,7 @@ CoinPackedMatrix::CoinPackedMatrix(const CoinPackedMatrix &rhs)
   , size_(0)
   , maxMajorDim_(0)
   , maxSize_(0)
+  , staging_(NULL)
 {
   bool hasGaps = rhs.size_ < rhs.start_[rhs.majorDim_];
   if (!hasGaps && !rhs.extraMajor_) {
@@ -2161,6 +2522,7 @@ CoinPackedMatrix::CoinPackedMatrix(const CoinPackedMatrix &rhs,
   , size_(rhs.size_)
   , maxMajorDim_(0)
   , maxSize_(0)
+  , staging_(NULL)
 {
   if (!reverseOrdering) {
     if (extraForMajor >= 0) {
@@ -2306,6 +2668,7 @@ CoinPackedMatrix::CoinPackedMatrix(const CoinPackedMatrix &rhs,
   , size_(0)
   , maxMajorDim_(0)
   , maxSize_(0)
+  , staging_(NULL)
 {
   if (numberRows <= 0 || numberColumns <= 0) {
     start_ = new CoinBigIndex[1];
@@ -2505,12 +2868,26 @@ CoinPackedMatrix::CoinPackedMatrix(const CoinPackedMatrix &rhs,
 CoinPackedMatrix::~CoinPackedMatrix()
 {
   gutsOfDestructor();
+  if (staging_) {
+    delete[] staging_->start;
+    delete[] staging_->index;
+    delete[] staging_->element;
+    delete staging_;
+  }
 }
 
 //#############################################################################
 //#############################################################################
 //#############################################################################
 
+void CoinPackedMatrix::dropMinorStaged()
+{
+  if (staging_)
+    staging_->numberVectors = 0;
+}
+
+//-----------------------------------------------------------------------------
+
 void CoinPackedMatrix::gutsOfDestructor()
 {
   delete[] length_;
@@ -3452,6 +3829,131 @@ void CoinPackedMatrix::appendMinorFast(const int number,
 #endif
 }
 
+void CoinPackedMatrix::beginMinorAppend()
+{
+  if (!staging_) {
+    staging_ = new CoinPackedMatrixStaging;
+    staging_->maximumVectors = 16;
+    staging_->maximumElements = 256;
+    staging_->start = new CoinBigIndex[staging_->maximumVectors + 1];
+    staging_->index = new int[staging_->maximumElements];
+    staging_->element = new double[staging_->maximumElements];
+  }
+  staging_->numberVectors = 0;
+  staging_->start[0] = 0;
+}
+
+void CoinPackedMatrix::addMinorAppend(const int vecsize, const int *vecind,
+  const double *vecelem)
+{
+  if (!staging_)
+    beginMinorAppend();
+  CoinPackedMatrixStaging &staging = *staging_;
+  const int number = staging.numberVectors;
+  const CoinBigIndex put = staging.start[number];
+  if (number == staging.maximumVectors) {
+    staging.maximumVectors *= 2;
+    CoinBigIndex *temp = CoinCopyOfArrayPartial(staging.start,
+      staging.maximumVectors + 1, number + 1);
+    delete[] staging.start;
+    staging.start = temp;
+  }
+  if (put + vecsize > staging.maximumElements) {
+    staging.maximumElements = CoinMax(2 * staging.maximumElements,
+      put + vecsize);
+    int *tempIndex = CoinCopyOfArrayPartial(staging.index,
+      staging.maximumElements, put);
+    double *tempElement = CoinCopyOfArrayPartial(staging.element,
+      staging.maximumElements, put);
+    delete[] staging.index;
+    delete[] staging.element;
+    staging.index = tempIndex;
+    staging.element = tempElement;
+  }
+  CoinMemcpyN(vecind, vecsize, staging.index + put);
+  CoinMemcpyN(vecelem, vecsize, staging.element + put);
+  staging.start[number + 1] = put + vecsize;
+  staging.numberVectors++;
+}
+
+int CoinPackedMatrix::numberMinorStaged() const
+{
+  return staging_ ? staging_->numberVectors : 0;
+}
+
+/* Puts the staged vectors at the end of the matrix.  If some major
+   vectors have no room the matrix is moved once, every vector getting room
+   for half as much again as its new length (gaps are never made smaller).
+   Growing them all, not just the ones which ran out, means one short
+   vector does not move the matrix every round.
+*/
+void CoinPackedMatrix::commitMinorAppend()
+{
+  if (!staging_ || !staging_->numberVectors)
+    return;
+  const int number = staging_->numberVectors;
+  const CoinBigIndex *starts = staging_->start;
+  const int *index = staging_->index;
+  const double *element = staging_->element;
+  const CoinBigIndex numberAdded = starts[number];
+  int *addedEntries = new int[majorDim_];
+  CoinZeroN(addedEntries, majorDim_);
+  for (CoinBigIndex j = 0; j < numberAdded; j++) {
+    int iIndex = index[j];
+#if COIN_COINUTILS_CHECKLEVEL > 3
+    if (iIndex < 0 || iIndex >= majorDim_) {
+      delete[] addedEntries;
+      throw CoinError("out of range index",
+        "commitMinorAppend", "CoinPackedMatrix");
+    }
+#endif
+    addedEntries[iIndex]++;
+  }
+  bool fits = true;
+  for (int i = 0; i < majorDim_; i++) {
+    if (start_[i] + length_[i] + addedEntries[i] > start_[i + 1]) {
+      fits = false;
+      break;
+    }
+  }
+  if (!fits) {
+    CoinBigIndex *newStart = new CoinBigIndex[maxMajorDim_ + 1];
+    newStart[0] = 0;
+    for (int i = 0; i < majorDim_; i++) {
+      const CoinBigIndex needed = length_[i] + addedEntries[i];
+      const CoinBigIndex room = CoinMax(start_[i + 1] - start_[i],
+        CoinMax(CoinLengthWithExtra(needed, extraGap_),
+          needed + (needed >> 1) + 1));
+      newStart[i + 1] = newStart[i] + room;
+    }
+    maxSize_ = CoinMax(maxSize_, newStart[majorDim_]);
+    int *newIndex = new int[maxSize_];
+    double *newElement = new double[maxSize_];
+    for (int i = 0; i < majorDim_; i++) {
+      CoinMemcpyN(index_ + start_[i], length_[i], newIndex + newStart[i]);
+      CoinMemcpyN(element_ + start_[i], length_[i], newElement + newStart[i]);
+    }
+    delete[] start_;
+    delete[] index_;
+    delete[] element_;
+    start_ = newStart;
+    index_ = newIndex;
+    element_ = newElement;
+  }
+  delete[] addedEntries;
+  // same order as appendMinorVectors
+  for (int i = 0; i < number; i++) {
+    for (CoinBigIndex j = starts[i + 1] - 1; j >= starts[i]; j--) {
+      const int iIndex = index[j];
+      element_[start_[iIndex] + length_[iIndex]] = element[j];
+      index_[start_[iIndex] + (length_[iIndex]++)] = minorDim_;
+    }
+    ++minorDim_;
+  }
+  size_ += numberAdded;
+  staging_->numberVectors = 0;
+}
+
 /*
   Utility to scan a packed matrix for corruption and inconsistencies. Not
   exhaustive, but useful. By default, the method counts coefficients of zero
@@ -14,6 +14,8 @@
 #else
 class CoinRelFltEq;
 #endif
+class CoinIndexedVector;
+struct CoinPackedMatrixStaging;
 
 /** Sparse Matrix Base Class
 
@@ -410,8 +412,15 @@ public:
       vector orientation changed from row (column) to column (row).
       The extra space parameters are also copied and reversed.
       (Cf. #reverseOrdering, which does the same thing in place.)
+
+      Big matrices are done a block of new major vectors at a time.
     */
   void reverseOrderedCopyOf(const CoinPackedMatrix &rhs);
+  /** Same as the previous method, the blocks split between up to
+      \p numberThreads threads.  The result is exactly the same however
+      many threads are used. */
+  void reverseOrderedCopyOf(const CoinPackedMatrix &rhs,
+    int numberThreads);
 
   /** Assign the arguments to the matrix. If <code>len</code> is a NULL
 	pointer then the matrix is assumed to have no gaps in it and
@@ -439,6 +448,9 @@ public:
       the same thing but produces a new matrix.)
     */
   void reverseOrdering();
+  /** Same as the previous method, split between up to
+      \p numberThreads threads as in #reverseOrderedCopyOf. */
+  void reverseOrdering(int numberThreads);
 
   /*! \brief Transpose the matrix.
 
@@ -451,32 +463,60 @@ public:
     */
   void transpose();
 
-  /*! \brief Swap the content of two packed matrices. */
+  /*! \brief Swap the content of two packed matrices (including any staged
+      minor-dimension vectors). */
   void swap(CoinPackedMatrix &matrix);
 
   //@}
 
   //---------------------------------------------------------------------------
-  /**@name Matrix times vector methods */
+  /**@name Matrix times vector methods
+
+     Large products may be split between up to \p numberThreads threads -
+     see timesMajor and timesMinor for what that changes.
+  */
   //@{
   /** Return <code>A * x</code> in <code>y</code>.
         @pre <code>x</code> must be of size <code>numColumns()</code>
         @pre <code>y</code> must be of size <code>numRows()</code> */
   void times(const double *x, double *y) const;
+  /** Same as the previous method, split between up to
+        <code>numberThreads</code> threads. */
+  void times(const double *x, double *y, int numberThreads) const;
 #ifndef CLP_NO_VECTOR
   /** Return <code>A * x</code> in <code>y</code>. Same as the previous
         method, just <code>x</code> is given in the form of a packed vector. */
   void times(const CoinPackedVectorBase &x, double *y) const;
 #endif
+  /** Return <code>A * x</code> in <code>y</code>. Same as the first
+        method, just <code>x</code> is given as an indexed vector (packed or
+        not) so only its nonzeros are looked at when the matrix is column
+        ordered. */
+  void times(const CoinIndexedVector &x, double *y) const;
+  /** Same as the previous method, split between up to
+        <code>numberThreads</code> threads. */
+  void times(const CoinIndexedVector &x, double *y, int numberThreads) const;
   /** Return <code>x * A</code> in <code>y</code>.
         @pre <code>x</code> must be of size <code>numRows()</code>
         @pre <code>y</code> must be of size <code>numColumns()</code> */
   void transposeTimes(const double *x, double *y) const;
+  /** Same as the previous method, split between up to
+        <code>numberThreads</code> threads. */
+  void transposeTimes(const double *x, double *y, int numberThreads) const;
 #ifndef CLP_NO_VECTOR
   /** Return <code>x * A</code> in <code>y</code>. Same as the previous
         method, just <code>x</code> is given in the form of a packed vector. */
   void transposeTimes(const CoinPackedVectorBase &x, double *y) const;
 #endif
+  /** Return <code>x * A</code> in <code>y</code>. Same as the first
+        method, just <code>x</code> is given as an indexed vector (packed or
+        not) so only its nonzeros are looked at when the matrix is row
+        ordered. */
+  void transposeTimes(const CoinIndexedVector &x, double *y) const;
+  /** Same as the previous method, split between up to
+        <code>numberThreads</code> threads. */
+  void transposeTimes(const CoinIndexedVector &x, double *y,
+    int numberThreads) const;
   //@}
 
   //---------------------------------------------------------------------------
@@ -572,6 +612,39 @@ public:
   void appendMinorFast(const int number,
     const CoinBigIndex *starts, const int *index,
     const double *element);
+
+  /*! \brief Start collecting minor-dimension vectors to append together.
+
+      Minor-dimension vectors (rows of a column ordered matrix) given to
+      #addMinorAppend are kept in a staging buffer and put into the matrix
+      in one pass by #commitMinorAppend.  If a major-dimension vector has
+      no room for its new entries the matrix is moved and every major
+      vector is given room for half as many again as its new length (or as
+      the extra gap gives if that is more), so a matrix that has rows added
+      round after round only moves now and then.
+      Vectors already staged are dropped.  The buffer is kept for the next
+      round.
+
+      Staged vectors belong to the matrix as it is.  reverseOrdering and
+      transpose commit them first, swap exchanges them with the matrices,
+      and anything that replaces the matrix (operator=, copyOf,
+      reverseOrderedCopyOf, assignMatrix, submatrixOf, clear) drops them.
+      They are never copied.
+    */
+  void beginMinorAppend();
+  /** Stage a minor-dimension vector for #commitMinorAppend.
+
+      Indices must fit the major dimension at the time of the commit.
+    */
+  void addMinorAppend(const int vecsize, const int *vecind,
+    const double *vecelem);
+  /// Number of minor-dimension vectors staged
+  int numberMinorStaged() const;
+  /** Append the staged vectors to the end of the matrix.
+
+      The entries end up in the same order as from #appendMinorVectors.
+    */
+  void commitMinorAppend();
   //@}
 
   //-------------------------------------------------------------------------
@@ -625,19 +698,51 @@ public:
   /** Return <code>A * x</code> (multiplied from the "right" direction) in
 	  <code>y</code>.
 	  @pre <code>x</code> must be of size <code>majorDim()</code>
-	  @pre <code>y</code> must be of size <code>minorDim()</code> */
+	  @pre <code>y</code> must be of size <code>minorDim()</code>
+
+	  With more than one thread the major vectors are split into pieces
+	  with about the same number of elements, each added into its own
+	  copy of <code>y</code>.  As the copies are then added together the
+	  result can differ in the last bits from a one thread run.  Pieces
+	  are never smaller than <code>minorDim()</code> elements. */
   void timesMajor(const double *x, double *y) const;
+  /** Same as the previous method, split between up to
+	  <code>numberThreads</code> threads. */
+  void timesMajor(const double *x, double *y, int numberThreads) const;
 #ifndef CLP_NO_VECTOR
   /** Return <code>A * x</code> (multiplied from the "right" direction) in
 	  <code>y</code>. Same as the previous method, just <code>x</code> is
 	  given in the form of a packed vector. */
   void timesMajor(const CoinPackedVectorBase &x, double *y) const;
 #endif
+  /** Return <code>A * x</code> (multiplied from the "right" direction) in
+	  <code>y</code>. Same as the first method, just only the nonzeros of
+	  indexed vector <code>x</code> are looked at. */
+  void timesMajor(const CoinIndexedVector &x, double *y) const;
+  /** Same as the previous method, split between up to
+	  <code>numberThreads</code> threads. */
+  void timesMajor(const CoinIndexedVector &x, double *y,
+    int numberThreads) const;
   /** Return <code>A * x</code> (multiplied from the "right" direction) in
 	  <code>y</code>.
 	  @pre <code>x</code> must be of size <code>minorDim()</code>
-	  @pre <code>y</code> must be of size <code>majorDim()</code> */
+	  @pre <code>y</code> must be of size <code>majorDim()</code>
+
+	  Each entry of <code>y</code> is a dot product done with the vector
+	  kernels of CoinSimd.hpp, so results are exactly the same however
+	  many threads are used. */
   void timesMinor(const double *x, double *y) const;
+  /** Same as the previous method, split between up to
+	  <code>numberThreads</code> threads. */
+  void timesMinor(const double *x, double *y, int numberThreads) const;
+  /** Return <code>A * x</code> (multiplied from the "right" direction) in
+	  <code>y</code>. Same as the previous method, just <code>x</code> is
+	  given as an indexed vector. */
+  void timesMinor(const CoinIndexedVector &x, double *y) const;
+  /** Same as the previous method, split between up to
+	  <code>numberThreads</code> threads. */
+  void timesMinor(const CoinIndexedVector &x, double *y,
+    int numberThreads) const;
 #ifndef CLP_NO_VECTOR
   /** Return <code>A * x</code> (multiplied from the "right" direction) in
 	  <code>y</code>. Same as the previous method, just <code>x</code> is
@@ -850,6 +955,8 @@ public:
   //--------------------------------------------------------------------------
 protected:
   void gutsOfDestructor();
+  /// Drops any staged minor-dimension vectors (matrix is being replaced)
+  void dropMinorStaged();
   void gutsOfCopyOf(const bool colordered,
     const int minor, const int major, const CoinBigIndex numels,
     const double *elem, const int *ind,
@@ -897,6 +1004,8 @@ private:
   {
     return majorDim_ == 0 ? 0 : start_[majorDim_];
   }
+  /// Puts in elements for reverseOrderedCopyOf of a big matrix
+  void reverseBlocked(const CoinPackedMatrix &rhs, int numberThreads);
 
   //--------------------------------------------------------------------------
 protected:
@@ -937,6 +1046,8 @@ protected:
   int maxMajorDim_;
   /// max space allocated for entries
   CoinBigIndex maxSize_;
+  /// minor-dimension vectors waiting for commitMinorAppend (not copied)
+  CoinPackedMatrixStaging *staging_;
   //@}
 };
 
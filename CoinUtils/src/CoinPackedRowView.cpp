@@ -0,0 +1,282 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinPackedRowView.hpp"
+
+//#############################################################################
+
+CoinPackedRowView::CoinPackedRowView(const CoinPackedMatrix &matrix,
+  int rowsPerChunk)
+  : matrix_(&matrix)
+  , colOrdered_(true)
+  , numberRows_(0)
+  , numberColumns_(0)
+  , rowsPerChunk_(CoinMax(rowsPerChunk, 1))
+  , numberChunks_(0)
+  , numberMade_(0)
+  , start_(NULL)
+  , index_(NULL)
+  , element_(NULL)
+{
+  reset();
+}
+
+CoinPackedRowView::~CoinPackedRowView()
+{
+  gutsOfDestructor();
+}
+
+void CoinPackedRowView::gutsOfDestructor()
+{
+  for (int iChunk = 0; iChunk < numberChunks_; iChunk++) {
+    delete[] start_[iChunk];
+    delete[] index_[iChunk];
+    delete[] element_[iChunk];
+  }
+  delete[] start_;
+  delete[] index_;
+  delete[] element_;
+  start_ = NULL;
+  index_ = NULL;
+  element_ = NULL;
+  numberChunks_ = 0;
+  numberMade_ = 0;
+}
+
+void CoinPackedRowView::reset()
+{
+  gutsOfDestructor();
+  colOrdered_ = matrix_->isColOrdered();
+  numberRows_ = matrix_->getNumRows();
+  numberColumns_ = matrix_->getNumCols();
+  if (colOrdered_) {
+    numberChunks_ = (numberRows_ + rowsPerChunk_ - 1) / rowsPerChunk_;
+    start_ = new CoinBigIndex *[numberChunks_];
+    index_ = new int *[numberChunks_];
+    element_ = new double *[numberChunks_];
+    CoinZeroN(start_, numberChunks_);
+    CoinZeroN(index_, numberChunks_);
+    CoinZeroN(element_, numberChunks_);
+  }
+}
+
+int CoinPackedRowView::chunkRows(int iChunk) const
+{
+  return CoinMin(rowsPerChunk_, numberRows_ - iChunk * rowsPerChunk_);
+}
+
+void CoinPackedRowView::checkColumns(const char *methodName) const
+{
+  if (matrix_->getNumCols() != numberColumns_ || matrix_->getNumRows() != numberRows_)
+    throw CoinError("matrix does not match view", methodName,
+      "CoinPackedRowView");
+}
+
+/* Makes chunk iChunk as reverseOrderedCopyOf would make those rows - count
+   the entries of each row, then one pass through the columns putting each
+   entry in place.  Once a quarter of the chunks are made all the others
+   are made in the same pass.
+*/
+void CoinPackedRowView::makeChunks(int iChunk)
+{
+  const bool all = 4 * (numberMade_ + 1) >= numberChunks_;
+  char *make = new char[numberChunks_];
+  for (int jChunk = 0; jChunk < numberChunks_; jChunk++) {
+    make[jChunk] = (!start_[jChunk] && (all || jChunk == iChunk)) ? 1 : 0;
+    if (make[jChunk]) {
+      const int numberInChunk = chunkRows(jChunk);
+      start_[jChunk] = new CoinBigIndex[numberInChunk + 1];
+      CoinZeroN(start_[jChunk], numberInChunk + 1);
+    }
+  }
+  const CoinBigIndex *columnStart = matrix_->getVectorStarts();
+  const int *columnLength = matrix_->getVectorLengths();
+  const int *row = matrix_->getIndices();
+  const double *element = matrix_->getElements();
+  // count
+  for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    for (CoinBigIndex j = columnStart[iColumn];
+         j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+      const int iRow = row[j];
+      const int jChunk = iRow / rowsPerChunk_;
+      if (make[jChunk])
+        start_[jChunk][iRow - jChunk * rowsPerChunk_ + 1]++;
+    }
+  }
+  for (int jChunk = 0; jChunk < numberChunks_; jChunk++) {
+    if (make[jChunk]) {
+      CoinBigIndex *start = start_[jChunk];
+      const int numberInChunk = chunkRows(jChunk);
+      for (int i = 0; i < numberInChunk; i++)
+        start[i + 1] += start[i];
+      index_[jChunk] = new int[start[numberInChunk]];
+      element_[jChunk] = new double[start[numberInChunk]];
+      numberMade_++;
+    }
+  }
+  // put in, using start as next place in each row
+  for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    for (CoinBigIndex j = columnStart[iColumn];
+         j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+      const int iRow = row[j];
+      const int jChunk = iRow / rowsPerChunk_;
+      if (make[jChunk]) {
+        const CoinBigIndex put = start_[jChunk][iRow - jChunk * rowsPerChunk_]++;
+        index_[jChunk][put] = iColumn;
+        element_[jChunk][put] = element[j];
+      }
+    }
+  }
+  for (int jChunk = 0; jChunk < numberChunks_; jChunk++) {
+    if (make[jChunk]) {
+      CoinBigIndex *start = start_[jChunk];
+      for (int i = chunkRows(jChunk); i > 0; i--)
+        start[i] = start[i - 1];
+      start[0] = 0;
+    }
+  }
+  delete[] make;
+}
+
+void CoinPackedRowView::deleteCols(const int numDel, const int *indDel)
+{
+  if (!colOrdered_) {
+    numberColumns_ = matrix_->getNumCols();
+    return;
+  }
+  // new number of each column (-1 if deleted)
+  int *newColumn = new int[numberColumns_];
+  CoinZeroN(newColumn, numberColumns_);
+  for (int i = 0; i < numDel; i++) {
+    const int iColumn = indDel[i];
+    if (iColumn < 0 || iColumn >= numberColumns_) {
+      delete[] newColumn;
+      throw CoinError("bad index", "deleteCols", "CoinPackedRowView");
+    }
+    newColumn[iColumn] = -1;
+  }
+  int numberKept = 0;
+  for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    if (!newColumn[iColumn])
+      newColumn[iColumn] = numberKept++;
+  }
+  numberColumns_ = numberKept;
+  checkColumns("deleteCols");
+  // squeeze rows made (order is kept)
+  for (int iChunk = 0; iChunk < numberChunks_; iChunk++) {
+    CoinBigIndex *start = start_[iChunk];
+    if (!start)
+      continue;
+    int *index = index_[iChunk];
+    double *element = element_[iChunk];
+    const int numberInChunk = chunkRows(iChunk);
+    CoinBigIndex put = 0;
+    CoinBigIndex begin = 0;
+    for (int i = 0; i < numberInChunk; i++) {
+      const CoinBigIndex end = start[i + 1];
+      for (CoinBigIndex j = begin; j < end; j++) {
+        const int iColumn = newColumn[index[j]];
+        if (iColumn >= 0) {
+          index[put] = iColumn;
+          element[put++] = element[j];
+        }
+      }
+      start[i + 1] = put;
+      begin = end;
+    }
+  }
+  delete[] newColumn;
+}
+
+void CoinPackedRowView::appendCols(const int numberAdded)
+{
+  const int firstNew = numberColumns_;
+  numberColumns_ += numberAdded;
+  if (!colOrdered_) {
+    checkColumns("appendCols");
+    return;
+  }
+  if (matrix_->getNumRows() != numberRows_) {
+    // rows added as well - start again
+    reset();
+    return;
+  }
+  checkColumns("appendCols");
+  if (!numberMade_ || !numberAdded)
+    return;
+  const CoinBigIndex *columnStart = matrix_->getVectorStarts();
+  const int *columnLength = matrix_->getVectorLengths();
+  const int *row = matrix_->getIndices();
+  const double *element = matrix_->getElements();
+  // count new entries in rows made
+  int *addedEntries = new int[numberRows_];
+  CoinZeroN(addedEntries, numberRows_);
+  for (int iColumn = firstNew; iColumn < numberColumns_; iColumn++) {
+    for (CoinBigIndex j = columnStart[iColumn];
+         j < columnStart[iColumn] + columnLength[iColumn]; j++)
+      addedEntries[row[j]]++;
+  }
+  /* make room in chunks which get entries, leaving start as the next
+     place in each row */
+  char *grown = new char[numberChunks_];
+  for (int iChunk = 0; iChunk < numberChunks_; iChunk++) {
+    grown[iChunk] = 0;
+    CoinBigIndex *start = start_[iChunk];
+    if (!start)
+      continue;
+    const int numberInChunk = chunkRows(iChunk);
+    const int *added = addedEntries + iChunk * rowsPerChunk_;
+    CoinBigIndex numberNew = 0;
+    for (int i = 0; i < numberInChunk; i++)
+      numberNew += added[i];
+    if (!numberNew)
+      continue;
+    grown[iChunk] = 1;
+    const int *index = index_[iChunk];
+    const double *oldElement = element_[iChunk];
+    int *newIndex = new int[start[numberInChunk] + numberNew];
+    double *newElement = new double[start[numberInChunk] + numberNew];
+    CoinBigIndex put = 0;
+    for (int i = 0; i < numberInChunk; i++) {
+      const CoinBigIndex length = start[i + 1] - start[i];
+      CoinMemcpyN(index + start[i], length, newIndex + put);
+      CoinMemcpyN(oldElement + start[i], length, newElement + put);
+      start[i] = put + length;
+      put += length + added[i];
+    }
+    start[numberInChunk] = put;
+    delete[] index_[iChunk];
+    delete[] element_[iChunk];
+    index_[iChunk] = newIndex;
+    element_[iChunk] = newElement;
+  }
+  delete[] addedEntries;
+  // new columns go on the end of each row
+  for (int iColumn = firstNew; iColumn < numberColumns_; iColumn++) {
+    for (CoinBigIndex j = columnStart[iColumn];
+         j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+      const int iRow = row[j];
+      const int iChunk = iRow / rowsPerChunk_;
+      if (grown[iChunk]) {
+        const CoinBigIndex put = start_[iChunk][iRow - iChunk * rowsPerChunk_]++;
+        index_[iChunk][put] = iColumn;
+        element_[iChunk][put] = element[j];
+      }
+    }
+  }
+  // start now holds the start of the next row
+  for (int iChunk = 0; iChunk < numberChunks_; iChunk++) {
+    if (grown[iChunk]) {
+      CoinBigIndex *start = start_[iChunk];
+      for (int i = chunkRows(iChunk); i > 0; i--)
+        start[i] = start[i - 1];
+      start[0] = 0;
+    }
+  }
+  delete[] grown;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,166 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CoinPackedRowView_H
+#define CoinPackedRowView_H
+
+#include "CoinError.hpp"
+#include "CoinPackedMatrix.hpp"
+
+/** Rows of a CoinPackedMatrix, made only when asked for.
+
+    Gives the rows of a column ordered matrix without making a row copy of
+    all of it.  Rows are made a chunk at a time (rowsPerChunk rows, in one
+    pass through the matrix) the first time one of them is asked for and
+    kept.  Once a quarter of the chunks have been made the rest are made
+    together, so asking for every row costs little more than
+    reverseOrderedCopyOf.  The entries of a row are in increasing column
+    order, as in a row copy.
+
+    For a row ordered matrix the rows are just those of the matrix.
+
+    The view keeps a pointer to the matrix, which must outlive it.  Rows
+    already made are kept up to date by calling deleteCols or appendCols
+    after doing the same to the matrix.  After any other change to the
+    matrix call reset.
+
+    Asking for a row may make a chunk, so the row methods are not const and
+    one view should not be used by several threads at once.
+*/
+class CoinPackedRowView {
+
+public:
+  /**@name Constructor and destructor */
+  //@{
+  /// View of matrix
+  explicit CoinPackedRowView(const CoinPackedMatrix &matrix,
+    int rowsPerChunk = 256);
+  /// Destructor
+  ~CoinPackedRowView();
+  //@}
+
+  /**@name Rows */
+  //@{
+  /// Number of rows
+  inline int getNumRows() const
+  {
+    return numberRows_;
+  }
+  /// Number of columns
+  inline int getNumCols() const
+  {
+    return numberColumns_;
+  }
+  /// Number of entries in row i
+  inline int getRowSize(int i)
+  {
+    if (!colOrdered_)
+      return matrix_->getVectorSize(i);
+    const int iChunk = chunkOf(i);
+    const CoinBigIndex *start = start_[iChunk] + (i - iChunk * rowsPerChunk_);
+    return static_cast< int >(start[1] - start[0]);
+  }
+  /// Column indices of row i
+  inline const int *getRowIndices(int i)
+  {
+    if (!colOrdered_)
+      return matrix_->getIndices() + matrix_->getVectorFirst(i);
+    const int iChunk = chunkOf(i);
+    return index_[iChunk] + start_[iChunk][i - iChunk * rowsPerChunk_];
+  }
+  /// Elements of row i
+  inline const double *getRowElements(int i)
+  {
+    if (!colOrdered_)
+      return matrix_->getElements() + matrix_->getVectorFirst(i);
+    const int iChunk = chunkOf(i);
+    return element_[iChunk] + start_[iChunk][i - iChunk * rowsPerChunk_];
+  }
+#ifndef CLP_NO_VECTOR
+  /// Row i
+  inline const CoinShallowPackedVector getRow(int i)
+  {
+    if (!colOrdered_)
+      return matrix_->getVector(i);
+    const int iChunk = chunkOf(i);
+    const CoinBigIndex *start = start_[iChunk] + (i - iChunk * rowsPerChunk_);
+    return CoinShallowPackedVector(static_cast< int >(start[1] - start[0]),
+      index_[iChunk] + start[0], element_[iChunk] + start[0], false);
+  }
+#endif
+  /// Number of chunks of rows made so far
+  inline int numberChunksMade() const
+  {
+    return numberMade_;
+  }
+  //@}
+
+  /**@name Keeping up with the matrix */
+  //@{
+  /** Call after <code>matrix.deleteCols(numDel, indDel)</code>.
+
+      Rows already made lose those columns and are renumbered.
+  */
+  void deleteCols(const int numDel, const int *indDel);
+  /** Call after appending numberAdded columns to the matrix.
+
+      The new columns are added to the end of rows already made.
+  */
+  void appendCols(const int numberAdded);
+  /// Forget all rows (call after any other change to the matrix)
+  void reset();
+  //@}
+
+private:
+  /// Not copied
+  CoinPackedRowView(const CoinPackedRowView &);
+  /// Not assigned
+  CoinPackedRowView &operator=(const CoinPackedRowView &);
+  /// Chunk holding row i (made if need be)
+  inline int chunkOf(int i)
+  {
+#ifndef COIN_FAST_CODE
+    if (i < 0 || i >= numberRows_)
+      throw CoinError("bad index", "row", "CoinPackedRowView");
+#endif
+    const int iChunk = i / rowsPerChunk_;
+    if (!start_[iChunk])
+      makeChunks(iChunk);
+    return iChunk;
+  }
+  /// Makes chunk iChunk (and all others if enough are made)
+  void makeChunks(int iChunk);
+  /// Number of rows in chunk iChunk
+  int chunkRows(int iChunk) const;
+  /// Frees chunks
+  void gutsOfDestructor();
+  /// Checks matrix still has the columns expected
+  void checkColumns(const char *methodName) const;
+
+  /// The matrix
+  const CoinPackedMatrix *matrix_;
+  /// Whether the matrix is column ordered
+  bool colOrdered_;
+  /// Number of rows
+  int numberRows_;
+  /// Number of columns
+  int numberColumns_;
+  /// Rows in each chunk
+  int rowsPerChunk_;
+  /// Number of chunks
+  int numberChunks_;
+  /// Number of chunks made
+  int numberMade_;
+  /// Row starts for each chunk (NULL if not made)
+  CoinBigIndex **start_;
+  /// Column indices for each chunk
+  int **index_;
+  /// Elements for each chunk
+  double **element_;
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,97 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinUtilsConfig.h"
+#include "CoinParallel.hpp"
+
+#ifdef COINUTILS_PTHREADS
+#include <pthread.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#ifdef COINUTILS_PTHREADS
+namespace {
+// Shared by all threads working for one CoinParallelRun call
+typedef struct {
+  CoinParallelTask task;
+  void *info;
+  int numberTasks;
+  int nextTask;
+  pthread_mutex_t mutex;
+} CoinParallelWork;
+
+void *doParallelWork(void *arg)
+{
+  CoinParallelWork *work = static_cast< CoinParallelWork * >(arg);
+  while (true) {
+    pthread_mutex_lock(&work->mutex);
+    int iTask = work->nextTask++;
+    pthread_mutex_unlock(&work->mutex);
+    if (iTask >= work->numberTasks)
+      break;
+    work->task(work->info, iTask);
+  }
+  return NULL;
+}
+} // end file-local namespace
+#endif
+
+void CoinParallelRun(int numberTasks, int numberThreads,
+  CoinParallelTask task, void *info)
+{
+#ifdef COINUTILS_PTHREADS
+  if (numberThreads > numberTasks)
+    numberThreads = numberTasks;
+  if (numberThreads > 1) {
+    CoinParallelWork work;
+    work.task = task;
+    work.info = info;
+    work.numberTasks = numberTasks;
+    work.nextTask = 0;
+    pthread_mutex_init(&work.mutex, NULL);
+    pthread_t *threads = new pthread_t[numberThreads - 1];
+    int numberStarted = 0;
+    for (int i = 0; i < numberThreads - 1; i++) {
+      if (pthread_create(threads + numberStarted, NULL, doParallelWork, &work))
+        break; // just do it with fewer threads
+      numberStarted++;
+    }
+    doParallelWork(&work);
+    for (int i = 0; i < numberStarted; i++)
+      pthread_join(threads[i], NULL);
+    delete[] threads;
+    pthread_mutex_destroy(&work.mutex);
+    return;
+  }
+#else
+  (void)numberThreads;
+#endif
+  for (int i = 0; i < numberTasks; i++)
+    task(info, i);
+}
+
+bool CoinParallelAvailable()
+{
+#ifdef COINUTILS_PTHREADS
+  return true;
+#else
+  return false;
+#endif
+}
+
+int CoinNumberProcessors()
+{
+  int number = 1;
+#if defined(HAVE_UNISTD_H) && defined(_SC_NPROCESSORS_ONLN)
+  long value = sysconf(_SC_NPROCESSORS_ONLN);
+  if (value > 1)
+    number = static_cast< int >(value);
+#endif
+  return number;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,43 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CoinParallel_H
+#define CoinParallel_H
+
+/** \file CoinParallel.hpp
+    \brief Minimal support for running independent pieces of work in parallel.
+
+    Threads are only used if CoinUtils was configured with
+    --enable-coinutils-threads.  Otherwise everything runs on the calling
+    thread, in order, so callers never need to have two code paths.
+*/
+
+/** Type of a task for CoinParallelRun.
+
+    The task is called with the \p info pointer given to CoinParallelRun and
+    the number of the piece of work to do (0 .. numberTasks-1).
+*/
+typedef void (*CoinParallelTask)(void *info, int whichTask);
+
+/** Run task(info,i) for i = 0 .. numberTasks-1 on up to numberThreads threads.
+
+    Tasks are handed out in increasing order to whichever thread is free, so
+    tasks should be of roughly equal size or more numerous than threads.
+    Returns when all tasks are finished.  The calling thread does work as
+    well, so numberThreads <= 1 (or a build without thread support) just
+    runs the tasks one after another.
+*/
+void CoinParallelRun(int numberTasks, int numberThreads,
+  CoinParallelTask task, void *info);
+
+/// Returns true if CoinParallelRun can really use more than one thread
+bool CoinParallelAvailable();
+
+/// Returns the number of processors available (1 if not known)
+int CoinNumberProcessors();
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,267 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinUtilsConfig.h"
+#include "CoinSimd.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define COIN_SIMD_X86
+#if !defined(__clang__)
+// Turn off gcc warning about undefined source in gather intrinsics
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#include <immintrin.h>
+/* Multiplies and subtracts must not be fused into FMA instructions (which
+   round once instead of twice) or results would differ from plain loops.
+   Targeting AVX2 alone does not allow FMA, AVX-512 does.
+*/
+#define COIN_TARGET_AVX2 __attribute__((target("avx2")))
+#ifdef __clang__
+// clang has no optimize attribute so turn contraction off for the file
+#pragma clang fp contract(off)
+#define COIN_TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define COIN_TARGET_AVX512 __attribute__((target("avx512f"), optimize("fp-contract=off")))
+#endif
+#endif
+
+namespace {
+int detectLevel()
+{
+#ifdef COIN_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f"))
+    return COIN_SIMD_AVX512;
+  if (__builtin_cpu_supports("avx2"))
+    return COIN_SIMD_AVX2;
+#endif
+  return COIN_SIMD_SCALAR;
+}
+
+const int availableLevel = detectLevel();
+
+#ifdef COIN_SIMD_X86
+// There is no AVX2 scatter so values are stored one at a time
+COIN_TARGET_AVX2 void scatterSubtractAvx2(double *region, const int *index,
+  const double *element, int number, double multiplier)
+{
+  __m256d multiply = _mm256_set1_pd(multiplier);
+  double result[4];
+  int j = 0;
+  for (; j + 4 <= number; j += 4) {
+    __m128i rows = _mm_loadu_si128(reinterpret_cast< const __m128i * >(index + j));
+    __m256d old = _mm256_i32gather_pd(region, rows, 8);
+    __m256d product = _mm256_mul_pd(_mm256_loadu_pd(element + j), multiply);
+    _mm256_storeu_pd(result, _mm256_sub_pd(old, product));
+    region[index[j]] = result[0];
+    region[index[j + 1]] = result[1];
+    region[index[j + 2]] = result[2];
+    region[index[j + 3]] = result[3];
+  }
+  for (; j < number; j++)
+    region[index[j]] -= element[j] * multiplier;
+}
+
+COIN_TARGET_AVX2 void scatterSubtractIndirectAvx2(double *region,
+  const int *index, const int *which, const double *element, int number,
+  double multiplier)
+{
+  __m256d multiply = _mm256_set1_pd(multiplier);
+  double result[4];
+  int j = 0;
+  for (; j + 4 <= number; j += 4) {
+    __m128i rows = _mm_loadu_si128(reinterpret_cast< const __m128i * >(index + j));
+    __m128i elements = _mm_loadu_si128(reinterpret_cast< const __m128i * >(which + j));
+    __m256d old = _mm256_i32gather_pd(region, rows, 8);
+    __m256d product = _mm256_mul_pd(_mm256_i32gather_pd(element, elements, 8), multiply);
+    _mm256_storeu_pd(result, _mm256_sub_pd(old, product));
+    region[index[j]] = result[0];
+    region[index[j + 1]] = result[1];
+    region[index[j + 2]] = result[2];
+    region[index[j + 3]] = result[3];
+  }
+  for (; j < number; j++)
+    region[index[j]] -= element[which[j]] * multiplier;
+}
+
+// Products together, sum in order
+COIN_TARGET_AVX2 double gatherSubtractAvx2(double value, const double *element,
+  const int *index, const double *region, int number)
+{
+  double product[4];
+  int j = 0;
+  for (; j + 4 <= number; j += 4) {
+    __m128i rows = _mm_loadu_si128(reinterpret_cast< const __m128i * >(index + j));
+    _mm256_storeu_pd(product, _mm256_mul_pd(_mm256_loadu_pd(element + j),
+                                _mm256_i32gather_pd(region, rows, 8)));
+    value -= product[0];
+    value -= product[1];
+    value -= product[2];
+    value -= product[3];
+  }
+  for (; j < number; j++)
+    value -= element[j] * region[index[j]];
+  return value;
+}
+
+COIN_TARGET_AVX2 void subtractAvx2(double *region, const double *element,
+  int number, double multiplier)
+{
+  __m256d multiply = _mm256_set1_pd(multiplier);
+  int j = 0;
+  for (; j + 4 <= number; j += 4) {
+    __m256d product = _mm256_mul_pd(multiply, _mm256_loadu_pd(element + j));
+    _mm256_storeu_pd(region + j, _mm256_sub_pd(_mm256_loadu_pd(region + j), product));
+  }
+  for (; j < number; j++)
+    region[j] -= multiplier * element[j];
+}
+
+COIN_TARGET_AVX512 void scatterSubtractAvx512(double *region, const int *index,
+  const double *element, int number, double multiplier)
+{
+  __m512d multiply = _mm512_set1_pd(multiplier);
+  int j = 0;
+  for (; j + 8 <= number; j += 8) {
+    __m256i rows = _mm256_loadu_si256(reinterpret_cast< const __m256i * >(index + j));
+    __m512d old = _mm512_i32gather_pd(rows, region, 8);
+    __m512d product = _mm512_mul_pd(_mm512_loadu_pd(element + j), multiply);
+    _mm512_i32scatter_pd(region, rows, _mm512_sub_pd(old, product), 8);
+  }
+  for (; j < number; j++)
+    region[index[j]] -= element[j] * multiplier;
+}
+
+COIN_TARGET_AVX512 void scatterSubtractIndirectAvx512(double *region,
+  const int *index, const int *which, const double *element, int number,
+  double multiplier)
+{
+  __m512d multiply = _mm512_set1_pd(multiplier);
+  int j = 0;
+  for (; j + 8 <= number; j += 8) {
+    __m256i rows = _mm256_loadu_si256(reinterpret_cast< const __m256i * >(index + j));
+    __m256i elements = _mm256_loadu_si256(reinterpret_cast< const __m256i * >(which + j));
+    __m512d old = _mm512_i32gather_pd(rows, region, 8);
+    __m512d product = _mm512_mul_pd(_mm512_i32gather_pd(elements, element, 8), multiply);
+    _mm512_i32scatter_pd(region, rows, _mm512_sub_pd(old, product), 8);
+  }
+  for (; j < number; j++)
+    region[index[j]] -= element[which[j]] * multiplier;
+}
+
+COIN_TARGET_AVX512 double gatherSubtractAvx512(double value,
+  const double *element, const int *index, const double *region, int number)
+{
+  double product[8];
+  int j = 0;
+  for (; j + 8 <= number; j += 8) {
+    __m256i rows = _mm256_loadu_si256(reinterpret_cast< const __m256i * >(index + j));
+    _mm512_storeu_pd(product, _mm512_mul_pd(_mm512_loadu_pd(element + j),
+                                _mm512_i32gather_pd(rows, region, 8)));
+    for (int k = 0; k < 8; k++)
+      value -= product[k];
+  }
+  for (; j < number; j++)
+    value -= element[j] * region[index[j]];
+  return value;
+}
+
+COIN_TARGET_AVX512 void subtractAvx512(double *region, const double *element,
+  int number, double multiplier)
+{
+  __m512d multiply = _mm512_set1_pd(multiplier);
+  int j = 0;
+  for (; j + 8 <= number; j += 8) {
+    __m512d product = _mm512_mul_pd(multiply, _mm512_loadu_pd(element + j));
+    _mm512_storeu_pd(region + j, _mm512_sub_pd(_mm512_loadu_pd(region + j), product));
+  }
+  for (; j < number; j++)
+    region[j] -= multiplier * element[j];
+}
+#endif
+} // end file-local namespace
+
+int CoinSimdCurrentLevel = availableLevel;
+
+int CoinSimdAvailable()
+{
+  return availableLevel;
+}
+
+int CoinSetSimdLevel(int level)
+{
+  if (level < COIN_SIMD_SCALAR)
+    level = COIN_SIMD_SCALAR;
+  else if (level > availableLevel)
+    level = availableLevel;
+  CoinSimdCurrentLevel = level;
+  return level;
+}
+
+void CoinSimdScatterSubtractVector(double *region, const int *index,
+  const double *element, int number, double multiplier)
+{
+#ifdef COIN_SIMD_X86
+  if (CoinSimdCurrentLevel == COIN_SIMD_AVX512) {
+    scatterSubtractAvx512(region, index, element, number, multiplier);
+    return;
+  } else if (CoinSimdCurrentLevel == COIN_SIMD_AVX2) {
+    scatterSubtractAvx2(region, index, element, number, multiplier);
+    return;
+  }
+#endif
+  for (int j = 0; j < number; j++)
+    region[index[j]] -= element[j] * multiplier;
+}
+
+void CoinSimdScatterSubtractIndirectVector(double *region, const int *index,
+  const int *which, const double *element, int number, double multiplier)
+{
+#ifdef COIN_SIMD_X86
+  if (CoinSimdCurrentLevel == COIN_SIMD_AVX512) {
+    scatterSubtractIndirectAvx512(region, index, which, element, number,
+      multiplier);
+    return;
+  } else if (CoinSimdCurrentLevel == COIN_SIMD_AVX2) {
+    scatterSubtractIndirectAvx2(region, index, which, element, number,
+      multiplier);
+    return;
+  }
+#endif
+  for (int j = 0; j < number; j++)
+    region[index[j]] -= element[which[j]] * multiplier;
+}
+
+double CoinSimdGatherSubtractVector(double value, const double *element,
+  const int *index, const double *region, int number)
+{
+#ifdef COIN_SIMD_X86
+  if (CoinSimdCurrentLevel == COIN_SIMD_AVX512)
+    return gatherSubtractAvx512(value, element, index, region, number);
+  else if (CoinSimdCurrentLevel == COIN_SIMD_AVX2)
+    return gatherSubtractAvx2(value, element, index, region, number);
+#endif
+  for (int j = 0; j < number; j++)
+    value -= element[j] * region[index[j]];
+  return value;
+}
+
+void CoinSimdSubtractVector(double *region, const double *element,
+  int number, double multiplier)
+{
+#ifdef COIN_SIMD_X86
+  if (CoinSimdCurrentLevel == COIN_SIMD_AVX512) {
+    subtractAvx512(region, element, number, multiplier);
+    return;
+  } else if (CoinSimdCurrentLevel == COIN_SIMD_AVX2) {
+    subtractAvx2(region, element, number, multiplier);
+    return;
+  }
+#endif
+  for (int j = 0; j < number; j++)
+    region[j] -= multiplier * element[j];
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
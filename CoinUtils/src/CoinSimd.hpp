@@ -0,0 +1,161 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CoinSimd_H
+#define CoinSimd_H
+
+/** \file CoinSimd.hpp
+    \brief Vector kernels for the dense loops of CoinFactorization.
+
+    The kernels are chosen at run time from what the processor supports
+    (AVX2 or AVX-512 on x86 when compiled with gcc or clang, otherwise plain
+    loops).  Whichever is used the results are exactly the same as from the
+    plain loops - a multiply and subtract are never fused and sums are added
+    up in the same order - so only the loads, stores and multiplies are done
+    several at a time.  Short loops are always done inline.
+*/
+
+#include "CoinTypes.hpp"
+
+/// Kernels in use
+enum CoinSimdLevel {
+  COIN_SIMD_SCALAR = 0,
+  COIN_SIMD_AVX2,
+  COIN_SIMD_AVX512
+};
+
+/// Loops shorter than this are never passed to a vector kernel
+#define COIN_SIMD_MINIMUM 8
+
+/// Level in use (do not set directly - see CoinSetSimdLevel)
+extern int CoinSimdCurrentLevel;
+
+/// Best level this processor supports
+int CoinSimdAvailable();
+
+/** Sets level to use (never more than CoinSimdAvailable()).
+
+    Mainly for timing and testing as the best available is used by
+    default.  Returns the level now in use.  Not to be called while
+    another thread is factorizing.
+*/
+int CoinSetSimdLevel(int level);
+
+/**@name Vector kernels (use the inline versions below) */
+//@{
+void CoinSimdScatterSubtractVector(double *region, const int *index,
+  const double *element, int number, double multiplier);
+void CoinSimdScatterSubtractIndirectVector(double *region, const int *index,
+  const int *which, const double *element, int number, double multiplier);
+double CoinSimdGatherSubtractVector(double value, const double *element,
+  const int *index, const double *region, int number);
+void CoinSimdSubtractVector(double *region, const double *element,
+  int number, double multiplier);
+//@}
+
+/** region[index[j]] -= element[j] * multiplier for j = 0 .. number-1.
+
+    Entries of index must all be different.
+*/
+inline void CoinSimdScatterSubtract(double *region, const int *index,
+  const double *element, int number, double multiplier)
+{
+  if (number >= COIN_SIMD_MINIMUM && CoinSimdCurrentLevel) {
+    CoinSimdScatterSubtractVector(region, index, element, number, multiplier);
+  } else {
+    for (int j = 0; j < number; j++) {
+      int iRow = index[j];
+      region[iRow] -= element[j] * multiplier;
+    }
+  }
+}
+
+/** region[index[j]] -= element[which[j]] * multiplier for j = 0 .. number-1.
+
+    Entries of index must all be different.
+*/
+inline void CoinSimdScatterSubtractIndirect(double *region, const int *index,
+  const int *which, const double *element, int number, double multiplier)
+{
+  if (number >= COIN_SIMD_MINIMUM && CoinSimdCurrentLevel) {
+    CoinSimdScatterSubtractIndirectVector(region, index, which, element,
+      number, multiplier);
+  } else {
+    for (int j = 0; j < number; j++) {
+      int iRow = index[j];
+      region[iRow] -= element[which[j]] * multiplier;
+    }
+  }
+}
+
+/// Returns value after value -= element[j] * region[index[j]] for j in order
+inline double CoinSimdGatherSubtract(double value, const double *element,
+  const int *index, const double *region, int number)
+{
+  if (number >= COIN_SIMD_MINIMUM && CoinSimdCurrentLevel)
+    return CoinSimdGatherSubtractVector(value, element, index, region, number);
+  for (int j = 0; j < number; j++)
+    value -= element[j] * region[index[j]];
+  return value;
+}
+
+/// region[j] -= multiplier * element[j] for j = 0 .. number-1
+inline void CoinSimdSubtract(double *region, const double *element,
+  int number, double multiplier)
+{
+  if (number >= COIN_SIMD_MINIMUM && CoinSimdCurrentLevel) {
+    CoinSimdSubtractVector(region, element, number, multiplier);
+  } else {
+    for (int j = 0; j < number; j++)
+      region[j] -= multiplier * element[j];
+  }
+}
+
+#if COIN_BIG_DOUBLE == 1
+/**@name Plain loops for long double factorization elements */
+//@{
+inline void CoinSimdScatterSubtract(double *region, const int *index,
+  const long double *element, int number, long double multiplier)
+{
+  for (int j = 0; j < number; j++) {
+    int iRow = index[j];
+    region[iRow] -= element[j] * multiplier;
+  }
+}
+inline void CoinSimdScatterSubtractIndirect(double *region, const int *index,
+  const int *which, const long double *element, int number,
+  long double multiplier)
+{
+  for (int j = 0; j < number; j++) {
+    int iRow = index[j];
+    region[iRow] -= element[which[j]] * multiplier;
+  }
+}
+inline long double CoinSimdGatherSubtract(long double value,
+  const long double *element, const int *index, const double *region,
+  int number)
+{
+  for (int j = 0; j < number; j++)
+    value -= element[j] * region[index[j]];
+  return value;
+}
+inline void CoinSimdSubtract(double *region, const double *element,
+  int number, long double multiplier)
+{
+  for (int j = 0; j < number; j++)
+    region[j] -= multiplier * element[j];
+}
+//@}
+#endif
+
+//#############################################################################
+/** A function that tests the vector kernels against the plain loops and
+    that factorizations solve the same with every level.  Not compiled into
+    the library so it can be compiled with debugging. */
+void CoinSimdUnitTest();
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -654,8 +654,8 @@ void CoinSimpFactorization::gutsOfCopy(const CoinSimpFactorization &other)
 //called by constructors
 void CoinSimpFactorization::getAreas(int numberOfRows,
   int numberOfColumns,
-  int,
-  int)
+  CoinBigIndex,
+  CoinBigIndex)
 {
 
   numberRows_ = numberOfRows;
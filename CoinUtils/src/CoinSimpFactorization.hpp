@@ -58,8 +58,8 @@ public:
   /// Gets space for a factorization
   virtual void getAreas(int numberRows,
     int numberColumns,
-    int maximumL,
-    int maximumU);
+    CoinBigIndex maximumL,
+    CoinBigIndex maximumU);
 
   /// PreProcesses column ordered copy of basis
   virtual void preProcess();
@@ -78,9 +78,9 @@ public:
   /**@name general stuff such as status */
   //@{
   /// Total number of elements in factorization
-  virtual inline int numberElements() const
+  virtual inline CoinBigIndex numberElements() const
   {
-    return numberRows_ * (numberColumns_ + numberPivots_);
+    return static_cast< CoinBigIndex >(numberRows_) * (numberColumns_ + numberPivots_);
   }
   /// Returns maximum absolute value in factorization
   double maximumCoefficient() const;
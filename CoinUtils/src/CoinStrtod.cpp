@@ -0,0 +1,762 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinUtilsConfig.h"
+#include "CoinStrtod.hpp"
+
+#include <cassert>
+#include <cfloat>
+#include <cstring>
+#include <limits>
+
+/*
+  The fast path follows D. Lemire, "Number parsing at a gigabyte per
+  second" (2021) and N. Mushtak and D. Lemire, "Fast number parsing without
+  fallback" (2023), as used in the fast_float library.  A 19 digit decimal
+  significand is multiplied by a 128 bit approximation of the power of
+  five, which is enough to decide the correctly rounded result.
+*/
+
+namespace {
+
+typedef unsigned long long CoinUInt64Bits;
+
+#define COIN_U64(x) x##ULL
+
+// 5^q for q = -342 ... 308, truncated to 128 bits with top bit set (high word first)
+const CoinUInt64Bits powerOfFive128[] = {
+  COIN_U64(0xeef453d6923bd65a), COIN_U64(0x113faa2906a13b3f), COIN_U64(0x9558b4661b6565f8), COIN_U64(0x4ac7ca59a424c507),
+  COIN_U64(0xbaaee17fa23ebf76), COIN_U64(0x5d79bcf00d2df649), COIN_U64(0xe95a99df8ace6f53), COIN_U64(0xf4d82c2c107973dc),
+  COIN_U64(0x91d8a02bb6c10594), COIN_U64(0x79071b9b8a4be869), COIN_U64(0xb64ec836a47146f9), COIN_U64(0x9748e2826cdee284),
+  COIN_U64(0xe3e27a444d8d98b7), COIN_U64(0xfd1b1b2308169b25), COIN_U64(0x8e6d8c6ab0787f72), COIN_U64(0xfe30f0f5e50e20f7),
+  COIN_U64(0xb208ef855c969f4f), COIN_U64(0xbdbd2d335e51a935), COIN_U64(0xde8b2b66b3bc4723), COIN_U64(0xad2c788035e61382),
+  COIN_U64(0x8b16fb203055ac76), COIN_U64(0x4c3bcb5021afcc31), COIN_U64(0xaddcb9e83c6b1793), COIN_U64(0xdf4abe242a1bbf3d),
+  COIN_U64(0xd953e8624b85dd78), COIN_U64(0xd71d6dad34a2af0d), COIN_U64(0x87d4713d6f33aa6b), COIN_U64(0x8672648c40e5ad68),
+  COIN_U64(0xa9c98d8ccb009506), COIN_U64(0x680efdaf511f18c2), COIN_U64(0xd43bf0effdc0ba48), COIN_U64(0x0212bd1b2566def2),
+  COIN_U64(0x84a57695fe98746d), COIN_U64(0x014bb630f7604b57), COIN_U64(0xa5ced43b7e3e9188), COIN_U64(0x419ea3bd35385e2d),
+  COIN_U64(0xcf42894a5dce35ea), COIN_U64(0x52064cac828675b9), COIN_U64(0x818995ce7aa0e1b2), COIN_U64(0x7343efebd1940993),
+  COIN_U64(0xa1ebfb4219491a1f), COIN_U64(0x1014ebe6c5f90bf8), COIN_U64(0xca66fa129f9b60a6), COIN_U64(0xd41a26e077774ef6),
+  COIN_U64(0xfd00b897478238d0), COIN_U64(0x8920b098955522b4), COIN_U64(0x9e20735e8cb16382), COIN_U64(0x55b46e5f5d5535b0),
+  COIN_U64(0xc5a890362fddbc62), COIN_U64(0xeb2189f734aa831d), COIN_U64(0xf712b443bbd52b7b), COIN_U64(0xa5e9ec7501d523e4),
+  COIN_U64(0x9a6bb0aa55653b2d), COIN_U64(0x47b233c92125366e), COIN_U64(0xc1069cd4eabe89f8), COIN_U64(0x999ec0bb696e840a),
+  COIN_U64(0xf148440a256e2c76), COIN_U64(0xc00670ea43ca250d), COIN_U64(0x96cd2a865764dbca), COIN_U64(0x380406926a5e5728),
+  COIN_U64(0xbc807527ed3e12bc), COIN_U64(0xc605083704f5ecf2), COIN_U64(0xeba09271e88d976b), COIN_U64(0xf7864a44c633682e),
+  COIN_U64(0x93445b8731587ea3), COIN_U64(0x7ab3ee6afbe0211d), COIN_U64(0xb8157268fdae9e4c), COIN_U64(0x5960ea05bad82964),
+  COIN_U64(0xe61acf033d1a45df), COIN_U64(0x6fb92487298e33bd), COIN_U64(0x8fd0c16206306bab), COIN_U64(0xa5d3b6d479f8e056),
+  COIN_U64(0xb3c4f1ba87bc8696), COIN_U64(0x8f48a4899877186c), COIN_U64(0xe0b62e2929aba83c), COIN_U64(0x331acdabfe94de87),
+  COIN_U64(0x8c71dcd9ba0b4925), COIN_U64(0x9ff0c08b7f1d0b14), COIN_U64(0xaf8e5410288e1b6f), COIN_U64(0x07ecf0ae5ee44dd9),
+  COIN_U64(0xdb71e91432b1a24a), COIN_U64(0xc9e82cd9f69d6150), COIN_U64(0x892731ac9faf056e), COIN_U64(0xbe311c083a225cd2),
+  COIN_U64(0xab70fe17c79ac6ca), COIN_U64(0x6dbd630a48aaf406), COIN_U64(0xd64d3d9db981787d), COIN_U64(0x092cbbccdad5b108),
+  COIN_U64(0x85f0468293f0eb4e), COIN_U64(0x25bbf56008c58ea5), COIN_U64(0xa76c582338ed2621), COIN_U64(0xaf2af2b80af6f24e),
+  COIN_U64(0xd1476e2c07286faa), COIN_U64(0x1af5af660db4aee1), COIN_U64(0x82cca4db847945ca), COIN_U64(0x50d98d9fc890ed4d),
+  COIN_U64(0xa37fce126597973c), COIN_U64(0xe50ff107bab528a0), COIN_U64(0xcc5fc196fefd7d0c), COIN_U64(0x1e53ed49a96272c8),
+  COIN_U64(0xff77b1fcbebcdc4f), COIN_U64(0x25e8e89c13bb0f7a), COIN_U64(0x9faacf3df73609b1), COIN_U64(0x77b191618c54e9ac),
+  COIN_U64(0xc795830d75038c1d), COIN_U64(0xd59df5b9ef6a2417), COIN_U64(0xf97ae3d0d2446f25), COIN_U64(0x4b0573286b44ad1d),
+  COIN_U64(0x9becce62836ac577), COIN_U64(0x4ee367f9430aec32), COIN_U64(0xc2e801fb244576d5), COIN_U64(0x229c41f793cda73f),
+  COIN_U64(0xf3a20279ed56d48a), COIN_U64(0x6b43527578c1110f), COIN_U64(0x9845418c345644d6), COIN_U64(0x830a13896b78aaa9),
+  COIN_U64(0xbe5691ef416bd60c), COIN_U64(0x23cc986bc656d553), COIN_U64(0xedec366b11c6cb8f), COIN_U64(0x2cbfbe86b7ec8aa8),
+  COIN_U64(0x94b3a202eb1c3f39), COIN_U64(0x7bf7d71432f3d6a9), COIN_U64(0xb9e08a83a5e34f07), COIN_U64(0xdaf5ccd93fb0cc53),
+  COIN_U64(0xe858ad248f5c22c9), COIN_U64(0xd1b3400f8f9cff68), COIN_U64(0x91376c36d99995be), COIN_U64(0x23100809b9c21fa1),
+  COIN_U64(0xb58547448ffffb2d), COIN_U64(0xabd40a0c2832a78a), COIN_U64(0xe2e69915b3fff9f9), COIN_U64(0x16c90c8f323f516c),
+  COIN_U64(0x8dd01fad907ffc3b), COIN_U64(0xae3da7d97f6792e3), COIN_U64(0xb1442798f49ffb4a), COIN_U64(0x99cd11cfdf41779c),
+  COIN_U64(0xdd95317f31c7fa1d), COIN_U64(0x40405643d711d583), COIN_U64(0x8a7d3eef7f1cfc52), COIN_U64(0x482835ea666b2572),
+  COIN_U64(0xad1c8eab5ee43b66), COIN_U64(0xda3243650005eecf), COIN_U64(0xd863b256369d4a40), COIN_U64(0x90bed43e40076a82),
+  COIN_U64(0x873e4f75e2224e68), COIN_U64(0x5a7744a6e804a291), COIN_U64(0xa90de3535aaae202), COIN_U64(0x711515d0a205cb36),
+  COIN_U64(0xd3515c2831559a83), COIN_U64(0x0d5a5b44ca873e03), COIN_U64(0x8412d9991ed58091), COIN_U64(0xe858790afe9486c2),
+  COIN_U64(0xa5178fff668ae0b6), COIN_U64(0x626e974dbe39a872), COIN_U64(0xce5d73ff402d98e3), COIN_U64(0xfb0a3d212dc8128f),
+  COIN_U64(0x80fa687f881c7f8e), COIN_U64(0x7ce66634bc9d0b99), COIN_U64(0xa139029f6a239f72), COIN_U64(0x1c1fffc1ebc44e80),
+  COIN_U64(0xc987434744ac874e), COIN_U64(0xa327ffb266b56220), COIN_U64(0xfbe9141915d7a922), COIN_U64(0x4bf1ff9f0062baa8),
+  COIN_U64(0x9d71ac8fada6c9b5), COIN_U64(0x6f773fc3603db4a9), COIN_U64(0xc4ce17b399107c22), COIN_U64(0xcb550fb4384d21d3),
+  COIN_U64(0xf6019da07f549b2b), COIN_U64(0x7e2a53a146606a48), COIN_U64(0x99c102844f94e0fb), COIN_U64(0x2eda7444cbfc426d),
+  COIN_U64(0xc0314325637a1939), COIN_U64(0xfa911155fefb5308), COIN_U64(0xf03d93eebc589f88), COIN_U64(0x793555ab7eba27ca),
+  COIN_U64(0x96267c7535b763b5), COIN_U64(0x4bc1558b2f3458de), COIN_U64(0xbbb01b9283253ca2), COIN_U64(0x9eb1aaedfb016f16),
+  COIN_U64(0xea9c227723ee8bcb), COIN_U64(0x465e15a979c1cadc), COIN_U64(0x92a1958a7675175f), COIN_U64(0x0bfacd89ec191ec9),
+  COIN_U64(0xb749faed14125d36), COIN_U64(0xcef980ec671f667b), COIN_U64(0xe51c79a85916f484), COIN_U64(0x82b7e12780e7401a),
+  COIN_U64(0x8f31cc0937ae58d2), COIN_U64(0xd1b2ecb8b0908810), COIN_U64(0xb2fe3f0b8599ef07), COIN_U64(0x861fa7e6dcb4aa15),
+  COIN_U64(0xdfbdcece67006ac9), COIN_U64(0x67a791e093e1d49a), COIN_U64(0x8bd6a141006042bd), COIN_U64(0xe0c8bb2c5c6d24e0),
+  COIN_U64(0xaecc49914078536d), COIN_U64(0x58fae9f773886e18), COIN_U64(0xda7f5bf590966848), COIN_U64(0xaf39a475506a899e),
+  COIN_U64(0x888f99797a5e012d), COIN_U64(0x6d8406c952429603), COIN_U64(0xaab37fd7d8f58178), COIN_U64(0xc8e5087ba6d33b83),
+  COIN_U64(0xd5605fcdcf32e1d6), COIN_U64(0xfb1e4a9a90880a64), COIN_U64(0x855c3be0a17fcd26), COIN_U64(0x5cf2eea09a55067f),
+  COIN_U64(0xa6b34ad8c9dfc06f), COIN_U64(0xf42faa48c0ea481e), COIN_U64(0xd0601d8efc57b08b), COIN_U64(0xf13b94daf124da26),
+  COIN_U64(0x823c12795db6ce57), COIN_U64(0x76c53d08d6b70858), COIN_U64(0xa2cb1717b52481ed), COIN_U64(0x54768c4b0c64ca6e),
+  COIN_U64(0xcb7ddcdda26da268), COIN_U64(0xa9942f5dcf7dfd09), COIN_U64(0xfe5d54150b090b02), COIN_U64(0xd3f93b35435d7c4c),
+  COIN_U64(0x9efa548d26e5a6e1), COIN_U64(0xc47bc5014a1a6daf), COIN_U64(0xc6b8e9b0709f109a), COIN_U64(0x359ab6419ca1091b),
+  COIN_U64(0xf867241c8cc6d4c0), COIN_U64(0xc30163d203c94b62), COIN_U64(0x9b407691d7fc44f8), COIN_U64(0x79e0de63425dcf1d),
+  COIN_U64(0xc21094364dfb5636), COIN_U64(0x985915fc12f542e4), COIN_U64(0xf294b943e17a2bc4), COIN_U64(0x3e6f5b7b17b2939d),
+  COIN_U64(0x979cf3ca6cec5b5a), COIN_U64(0xa705992ceecf9c42), COIN_U64(0xbd8430bd08277231), COIN_U64(0x50c6ff782a838353),
+  COIN_U64(0xece53cec4a314ebd), COIN_U64(0xa4f8bf5635246428), COIN_U64(0x940f4613ae5ed136), COIN_U64(0x871b7795e136be99),
+  COIN_U64(0xb913179899f68584), COIN_U64(0x28e2557b59846e3f), COIN_U64(0xe757dd7ec07426e5), COIN_U64(0x331aeada2fe589cf),
+  COIN_U64(0x9096ea6f3848984f), COIN_U64(0x3ff0d2c85def7621), COIN_U64(0xb4bca50b065abe63), COIN_U64(0x0fed077a756b53a9),
+  COIN_U64(0xe1ebce4dc7f16dfb), COIN_U64(0xd3e8495912c62894), COIN_U64(0x8d3360f09cf6e4bd), COIN_U64(0x64712dd7abbbd95c),
+  COIN_U64(0xb080392cc4349dec), COIN_U64(0xbd8d794d96aacfb3), COIN_U64(0xdca04777f541c567), COIN_U64(0xecf0d7a0fc5583a0),
+  COIN_U64(0x89e42caaf9491b60), COIN_U64(0xf41686c49db57244), COIN_U64(0xac5d37d5b79b6239), COIN_U64(0x311c2875c522ced5),
+  COIN_U64(0xd77485cb25823ac7), COIN_U64(0x7d633293366b828b), COIN_U64(0x86a8d39ef77164bc), COIN_U64(0xae5dff9c02033197),
+  COIN_U64(0xa8530886b54dbdeb), COIN_U64(0xd9f57f830283fdfc), COIN_U64(0xd267caa862a12d66), COIN_U64(0xd072df63c324fd7b),
+  COIN_U64(0x8380dea93da4bc60), COIN_U64(0x4247cb9e59f71e6d), COIN_U64(0xa46116538d0deb78), COIN_U64(0x52d9be85f074e608),
+  COIN_U64(0xcd795be870516656), COIN_U64(0x67902e276c921f8b), COIN_U64(0x806bd9714632dff6), COIN_U64(0x00ba1cd8a3db53b6),
+  COIN_U64(0xa086cfcd97bf97f3), COIN_U64(0x80e8a40eccd228a4), COIN_U64(0xc8a883c0fdaf7df0), COIN_U64(0x6122cd128006b2cd),
+  COIN_U64(0xfad2a4b13d1b5d6c), COIN_U64(0x796b805720085f81), COIN_U64(0x9cc3a6eec6311a63), COIN_U64(0xcbe3303674053bb0),
+  COIN_U64(0xc3f490aa77bd60fc), COIN_U64(0xbedbfc4411068a9c), COIN_U64(0xf4f1b4d515acb93b), COIN_U64(0xee92fb5515482d44),
+  COIN_U64(0x991711052d8bf3c5), COIN_U64(0x751bdd152d4d1c4a), COIN_U64(0xbf5cd54678eef0b6), COIN_U64(0xd262d45a78a0635d),
+  COIN_U64(0xef340a98172aace4), COIN_U64(0x86fb897116c87c34), COIN_U64(0x9580869f0e7aac0e), COIN_U64(0xd45d35e6ae3d4da0),
+  COIN_U64(0xbae0a846d2195712), COIN_U64(0x8974836059cca109), COIN_U64(0xe998d258869facd7), COIN_U64(0x2bd1a438703fc94b),
+  COIN_U64(0x91ff83775423cc06), COIN_U64(0x7b6306a34627ddcf), COIN_U64(0xb67f6455292cbf08), COIN_U64(0x1a3bc84c17b1d542),
+  COIN_U64(0xe41f3d6a7377eeca), COIN_U64(0x20caba5f1d9e4a93), COIN_U64(0x8e938662882af53e), COIN_U64(0x547eb47b7282ee9c),
+  COIN_U64(0xb23867fb2a35b28d), COIN_U64(0xe99e619a4f23aa43), COIN_U64(0xdec681f9f4c31f31), COIN_U64(0x6405fa00e2ec94d4),
+  COIN_U64(0x8b3c113c38f9f37e), COIN_U64(0xde83bc408dd3dd04), COIN_U64(0xae0b158b4738705e), COIN_U64(0x9624ab50b148d445),
+  COIN_U64(0xd98ddaee19068c76), COIN_U64(0x3badd624dd9b0957), COIN_U64(0x87f8a8d4cfa417c9), COIN_U64(0xe54ca5d70a80e5d6),
+  COIN_U64(0xa9f6d30a038d1dbc), COIN_U64(0x5e9fcf4ccd211f4c), COIN_U64(0xd47487cc8470652b), COIN_U64(0x7647c3200069671f),
+  COIN_U64(0x84c8d4dfd2c63f3b), COIN_U64(0x29ecd9f40041e073), COIN_U64(0xa5fb0a17c777cf09), COIN_U64(0xf468107100525890),
+  COIN_U64(0xcf79cc9db955c2cc), COIN_U64(0x7182148d4066eeb4), COIN_U64(0x81ac1fe293d599bf), COIN_U64(0xc6f14cd848405530),
+  COIN_U64(0xa21727db38cb002f), COIN_U64(0xb8ada00e5a506a7c), COIN_U64(0xca9cf1d206fdc03b), COIN_U64(0xa6d90811f0e4851c),
+  COIN_U64(0xfd442e4688bd304a), COIN_U64(0x908f4a166d1da663), COIN_U64(0x9e4a9cec15763e2e), COIN_U64(0x9a598e4e043287fe),
+  COIN_U64(0xc5dd44271ad3cdba), COIN_U64(0x40eff1e1853f29fd), COIN_U64(0xf7549530e188c128), COIN_U64(0xd12bee59e68ef47c),
+  COIN_U64(0x9a94dd3e8cf578b9), COIN_U64(0x82bb74f8301958ce), COIN_U64(0xc13a148e3032d6e7), COIN_U64(0xe36a52363c1faf01),
+  COIN_U64(0xf18899b1bc3f8ca1), COIN_U64(0xdc44e6c3cb279ac1), COIN_U64(0x96f5600f15a7b7e5), COIN_U64(0x29ab103a5ef8c0b9),
+  COIN_U64(0xbcb2b812db11a5de), COIN_U64(0x7415d448f6b6f0e7), COIN_U64(0xebdf661791d60f56), COIN_U64(0x111b495b3464ad21),
+  COIN_U64(0x936b9fcebb25c995), COIN_U64(0xcab10dd900beec34), COIN_U64(0xb84687c269ef3bfb), COIN_U64(0x3d5d514f40eea742),
+  COIN_U64(0xe65829b3046b0afa), COIN_U64(0x0cb4a5a3112a5112), COIN_U64(0x8ff71a0fe2c2e6dc), COIN_U64(0x47f0e785eaba72ab),
+  COIN_U64(0xb3f4e093db73a093), COIN_U64(0x59ed216765690f56), COIN_U64(0xe0f218b8d25088b8), COIN_U64(0x306869c13ec3532c),
+  COIN_U64(0x8c974f7383725573), COIN_U64(0x1e414218c73a13fb), COIN_U64(0xafbd2350644eeacf), COIN_U64(0xe5d1929ef90898fa),
+  COIN_U64(0xdbac6c247d62a583), COIN_U64(0xdf45f746b74abf39), COIN_U64(0x894bc396ce5da772), COIN_U64(0x6b8bba8c328eb783),
+  COIN_U64(0xab9eb47c81f5114f), COIN_U64(0x066ea92f3f326564), COIN_U64(0xd686619ba27255a2), COIN_U64(0xc80a537b0efefebd),
+  COIN_U64(0x8613fd0145877585), COIN_U64(0xbd06742ce95f5f36), COIN_U64(0xa798fc4196e952e7), COIN_U64(0x2c48113823b73704),
+  COIN_U64(0xd17f3b51fca3a7a0), COIN_U64(0xf75a15862ca504c5), COIN_U64(0x82ef85133de648c4), COIN_U64(0x9a984d73dbe722fb),
+  COIN_U64(0xa3ab66580d5fdaf5), COIN_U64(0xc13e60d0d2e0ebba), COIN_U64(0xcc963fee10b7d1b3), COIN_U64(0x318df905079926a8),
+  COIN_U64(0xffbbcfe994e5c61f), COIN_U64(0xfdf17746497f7052), COIN_U64(0x9fd561f1fd0f9bd3), COIN_U64(0xfeb6ea8bedefa633),
+  COIN_U64(0xc7caba6e7c5382c8), COIN_U64(0xfe64a52ee96b8fc0), COIN_U64(0xf9bd690a1b68637b), COIN_U64(0x3dfdce7aa3c673b0),
+  COIN_U64(0x9c1661a651213e2d), COIN_U64(0x06bea10ca65c084e), COIN_U64(0xc31bfa0fe5698db8), COIN_U64(0x486e494fcff30a62),
+  COIN_U64(0xf3e2f893dec3f126), COIN_U64(0x5a89dba3c3efccfa), COIN_U64(0x986ddb5c6b3a76b7), COIN_U64(0xf89629465a75e01c),
+  COIN_U64(0xbe89523386091465), COIN_U64(0xf6bbb397f1135823), COIN_U64(0xee2ba6c0678b597f), COIN_U64(0x746aa07ded582e2c),
+  COIN_U64(0x94db483840b717ef), COIN_U64(0xa8c2a44eb4571cdc), COIN_U64(0xba121a4650e4ddeb), COIN_U64(0x92f34d62616ce413),
+  COIN_U64(0xe896a0d7e51e1566), COIN_U64(0x77b020baf9c81d17), COIN_U64(0x915e2486ef32cd60), COIN_U64(0x0ace1474dc1d122e),
+  COIN_U64(0xb5b5ada8aaff80b8), COIN_U64(0x0d819992132456ba), COIN_U64(0xe3231912d5bf60e6), COIN_U64(0x10e1fff697ed6c69),
+  COIN_U64(0x8df5efabc5979c8f), COIN_U64(0xca8d3ffa1ef463c1), COIN_U64(0xb1736b96b6fd83b3), COIN_U64(0xbd308ff8a6b17cb2),
+  COIN_U64(0xddd0467c64bce4a0), COIN_U64(0xac7cb3f6d05ddbde), COIN_U64(0x8aa22c0dbef60ee4), COIN_U64(0x6bcdf07a423aa96b),
+  COIN_U64(0xad4ab7112eb3929d), COIN_U64(0x86c16c98d2c953c6), COIN_U64(0xd89d64d57a607744), COIN_U64(0xe871c7bf077ba8b7),
+  COIN_U64(0x87625f056c7c4a8b), COIN_U64(0x11471cd764ad4972), COIN_U64(0xa93af6c6c79b5d2d), COIN_U64(0xd598e40d3dd89bcf),
+  COIN_U64(0xd389b47879823479), COIN_U64(0x4aff1d108d4ec2c3), COIN_U64(0x843610cb4bf160cb), COIN_U64(0xcedf722a585139ba),
+  COIN_U64(0xa54394fe1eedb8fe), COIN_U64(0xc2974eb4ee658828), COIN_U64(0xce947a3da6a9273e), COIN_U64(0x733d226229feea32),
+  COIN_U64(0x811ccc668829b887), COIN_U64(0x0806357d5a3f525f), COIN_U64(0xa163ff802a3426a8), COIN_U64(0xca07c2dcb0cf26f7),
+  COIN_U64(0xc9bcff6034c13052), COIN_U64(0xfc89b393dd02f0b5), COIN_U64(0xfc2c3f3841f17c67), COIN_U64(0xbbac2078d443ace2),
+  COIN_U64(0x9d9ba7832936edc0), COIN_U64(0xd54b944b84aa4c0d), COIN_U64(0xc5029163f384a931), COIN_U64(0x0a9e795e65d4df11),
+  COIN_U64(0xf64335bcf065d37d), COIN_U64(0x4d4617b5ff4a16d5), COIN_U64(0x99ea0196163fa42e), COIN_U64(0x504bced1bf8e4e45),
+  COIN_U64(0xc06481fb9bcf8d39), COIN_U64(0xe45ec2862f71e1d6), COIN_U64(0xf07da27a82c37088), COIN_U64(0x5d767327bb4e5a4c),
+  COIN_U64(0x964e858c91ba2655), COIN_U64(0x3a6a07f8d510f86f), COIN_U64(0xbbe226efb628afea), COIN_U64(0x890489f70a55368b),
+  COIN_U64(0xeadab0aba3b2dbe5), COIN_U64(0x2b45ac74ccea842e), COIN_U64(0x92c8ae6b464fc96f), COIN_U64(0x3b0b8bc90012929d),
+  COIN_U64(0xb77ada0617e3bbcb), COIN_U64(0x09ce6ebb40173744), COIN_U64(0xe55990879ddcaabd), COIN_U64(0xcc420a6a101d0515),
+  COIN_U64(0x8f57fa54c2a9eab6), COIN_U64(0x9fa946824a12232d), COIN_U64(0xb32df8e9f3546564), COIN_U64(0x47939822dc96abf9),
+  COIN_U64(0xdff9772470297ebd), COIN_U64(0x59787e2b93bc56f7), COIN_U64(0x8bfbea76c619ef36), COIN_U64(0x57eb4edb3c55b65a),
+  COIN_U64(0xaefae51477a06b03), COIN_U64(0xede622920b6b23f1), COIN_U64(0xdab99e59958885c4), COIN_U64(0xe95fab368e45eced),
+  COIN_U64(0x88b402f7fd75539b), COIN_U64(0x11dbcb0218ebb414), COIN_U64(0xaae103b5fcd2a881), COIN_U64(0xd652bdc29f26a119),
+  COIN_U64(0xd59944a37c0752a2), COIN_U64(0x4be76d3346f0495f), COIN_U64(0x857fcae62d8493a5), COIN_U64(0x6f70a4400c562ddb),
+  COIN_U64(0xa6dfbd9fb8e5b88e), COIN_U64(0xcb4ccd500f6bb952), COIN_U64(0xd097ad07a71f26b2), COIN_U64(0x7e2000a41346a7a7),
+  COIN_U64(0x825ecc24c873782f), COIN_U64(0x8ed400668c0c28c8), COIN_U64(0xa2f67f2dfa90563b), COIN_U64(0x728900802f0f32fa),
+  COIN_U64(0xcbb41ef979346bca), COIN_U64(0x4f2b40a03ad2ffb9), COIN_U64(0xfea126b7d78186bc), COIN_U64(0xe2f610c84987bfa8),
+  COIN_U64(0x9f24b832e6b0f436), COIN_U64(0x0dd9ca7d2df4d7c9), COIN_U64(0xc6ede63fa05d3143), COIN_U64(0x91503d1c79720dbb),
+  COIN_U64(0xf8a95fcf88747d94), COIN_U64(0x75a44c6397ce912a), COIN_U64(0x9b69dbe1b548ce7c), COIN_U64(0xc986afbe3ee11aba),
+  COIN_U64(0xc24452da229b021b), COIN_U64(0xfbe85badce996168), COIN_U64(0xf2d56790ab41c2a2), COIN_U64(0xfae27299423fb9c3),
+  COIN_U64(0x97c560ba6b0919a5), COIN_U64(0xdccd879fc967d41a), COIN_U64(0xbdb6b8e905cb600f), COIN_U64(0x5400e987bbc1c920),
+  COIN_U64(0xed246723473e3813), COIN_U64(0x290123e9aab23b68), COIN_U64(0x9436c0760c86e30b), COIN_U64(0xf9a0b6720aaf6521),
+  COIN_U64(0xb94470938fa89bce), COIN_U64(0xf808e40e8d5b3e69), COIN_U64(0xe7958cb87392c2c2), COIN_U64(0xb60b1d1230b20e04),
+  COIN_U64(0x90bd77f3483bb9b9), COIN_U64(0xb1c6f22b5e6f48c2), COIN_U64(0xb4ecd5f01a4aa828), COIN_U64(0x1e38aeb6360b1af3),
+  COIN_U64(0xe2280b6c20dd5232), COIN_U64(0x25c6da63c38de1b0), COIN_U64(0x8d590723948a535f), COIN_U64(0x579c487e5a38ad0e),
+  COIN_U64(0xb0af48ec79ace837), COIN_U64(0x2d835a9df0c6d851), COIN_U64(0xdcdb1b2798182244), COIN_U64(0xf8e431456cf88e65),
+  COIN_U64(0x8a08f0f8bf0f156b), COIN_U64(0x1b8e9ecb641b58ff), COIN_U64(0xac8b2d36eed2dac5), COIN_U64(0xe272467e3d222f3f),
+  COIN_U64(0xd7adf884aa879177), COIN_U64(0x5b0ed81dcc6abb0f), COIN_U64(0x86ccbb52ea94baea), COIN_U64(0x98e947129fc2b4e9),
+  COIN_U64(0xa87fea27a539e9a5), COIN_U64(0x3f2398d747b36224), COIN_U64(0xd29fe4b18e88640e), COIN_U64(0x8eec7f0d19a03aad),
+  COIN_U64(0x83a3eeeef9153e89), COIN_U64(0x1953cf68300424ac), COIN_U64(0xa48ceaaab75a8e2b), COIN_U64(0x5fa8c3423c052dd7),
+  COIN_U64(0xcdb02555653131b6), COIN_U64(0x3792f412cb06794d), COIN_U64(0x808e17555f3ebf11), COIN_U64(0xe2bbd88bbee40bd0),
+  COIN_U64(0xa0b19d2ab70e6ed6), COIN_U64(0x5b6aceaeae9d0ec4), COIN_U64(0xc8de047564d20a8b), COIN_U64(0xf245825a5a445275),
+  COIN_U64(0xfb158592be068d2e), COIN_U64(0xeed6e2f0f0d56712), COIN_U64(0x9ced737bb6c4183d), COIN_U64(0x55464dd69685606b),
+  COIN_U64(0xc428d05aa4751e4c), COIN_U64(0xaa97e14c3c26b886), COIN_U64(0xf53304714d9265df), COIN_U64(0xd53dd99f4b3066a8),
+  COIN_U64(0x993fe2c6d07b7fab), COIN_U64(0xe546a8038efe4029), COIN_U64(0xbf8fdb78849a5f96), COIN_U64(0xde98520472bdd033),
+  COIN_U64(0xef73d256a5c0f77c), COIN_U64(0x963e66858f6d4440), COIN_U64(0x95a8637627989aad), COIN_U64(0xdde7001379a44aa8),
+  COIN_U64(0xbb127c53b17ec159), COIN_U64(0x5560c018580d5d52), COIN_U64(0xe9d71b689dde71af), COIN_U64(0xaab8f01e6e10b4a6),
+  COIN_U64(0x9226712162ab070d), COIN_U64(0xcab3961304ca70e8), COIN_U64(0xb6b00d69bb55c8d1), COIN_U64(0x3d607b97c5fd0d22),
+  COIN_U64(0xe45c10c42a2b3b05), COIN_U64(0x8cb89a7db77c506a), COIN_U64(0x8eb98a7a9a5b04e3), COIN_U64(0x77f3608e92adb242),
+  COIN_U64(0xb267ed1940f1c61c), COIN_U64(0x55f038b237591ed3), COIN_U64(0xdf01e85f912e37a3), COIN_U64(0x6b6c46dec52f6688),
+  COIN_U64(0x8b61313bbabce2c6), COIN_U64(0x2323ac4b3b3da015), COIN_U64(0xae397d8aa96c1b77), COIN_U64(0xabec975e0a0d081a),
+  COIN_U64(0xd9c7dced53c72255), COIN_U64(0x96e7bd358c904a21), COIN_U64(0x881cea14545c7575), COIN_U64(0x7e50d64177da2e54),
+  COIN_U64(0xaa242499697392d2), COIN_U64(0xdde50bd1d5d0b9e9), COIN_U64(0xd4ad2dbfc3d07787), COIN_U64(0x955e4ec64b44e864),
+  COIN_U64(0x84ec3c97da624ab4), COIN_U64(0xbd5af13bef0b113e), COIN_U64(0xa6274bbdd0fadd61), COIN_U64(0xecb1ad8aeacdd58e),
+  COIN_U64(0xcfb11ead453994ba), COIN_U64(0x67de18eda5814af2), COIN_U64(0x81ceb32c4b43fcf4), COIN_U64(0x80eacf948770ced7),
+  COIN_U64(0xa2425ff75e14fc31), COIN_U64(0xa1258379a94d028d), COIN_U64(0xcad2f7f5359a3b3e), COIN_U64(0x096ee45813a04330),
+  COIN_U64(0xfd87b5f28300ca0d), COIN_U64(0x8bca9d6e188853fc), COIN_U64(0x9e74d1b791e07e48), COIN_U64(0x775ea264cf55347e),
+  COIN_U64(0xc612062576589dda), COIN_U64(0x95364afe032a819e), COIN_U64(0xf79687aed3eec551), COIN_U64(0x3a83ddbd83f52205),
+  COIN_U64(0x9abe14cd44753b52), COIN_U64(0xc4926a9672793543), COIN_U64(0xc16d9a0095928a27), COIN_U64(0x75b7053c0f178294),
+  COIN_U64(0xf1c90080baf72cb1), COIN_U64(0x5324c68b12dd6339), COIN_U64(0x971da05074da7bee), COIN_U64(0xd3f6fc16ebca5e04),
+  COIN_U64(0xbce5086492111aea), COIN_U64(0x88f4bb1ca6bcf585), COIN_U64(0xec1e4a7db69561a5), COIN_U64(0x2b31e9e3d06c32e6),
+  COIN_U64(0x9392ee8e921d5d07), COIN_U64(0x3aff322e62439fd0), COIN_U64(0xb877aa3236a4b449), COIN_U64(0x09befeb9fad487c3),
+  COIN_U64(0xe69594bec44de15b), COIN_U64(0x4c2ebe687989a9b4), COIN_U64(0x901d7cf73ab0acd9), COIN_U64(0x0f9d37014bf60a11),
+  COIN_U64(0xb424dc35095cd80f), COIN_U64(0x538484c19ef38c95), COIN_U64(0xe12e13424bb40e13), COIN_U64(0x2865a5f206b06fba),
+  COIN_U64(0x8cbccc096f5088cb), COIN_U64(0xf93f87b7442e45d4), COIN_U64(0xafebff0bcb24aafe), COIN_U64(0xf78f69a51539d749),
+  COIN_U64(0xdbe6fecebdedd5be), COIN_U64(0xb573440e5a884d1c), COIN_U64(0x89705f4136b4a597), COIN_U64(0x31680a88f8953031),
+  COIN_U64(0xabcc77118461cefc), COIN_U64(0xfdc20d2b36ba7c3e), COIN_U64(0xd6bf94d5e57a42bc), COIN_U64(0x3d32907604691b4d),
+  COIN_U64(0x8637bd05af6c69b5), COIN_U64(0xa63f9a49c2c1b110), COIN_U64(0xa7c5ac471b478423), COIN_U64(0x0fcf80dc33721d54),
+  COIN_U64(0xd1b71758e219652b), COIN_U64(0xd3c36113404ea4a9), COIN_U64(0x83126e978d4fdf3b), COIN_U64(0x645a1cac083126ea),
+  COIN_U64(0xa3d70a3d70a3d70a), COIN_U64(0x3d70a3d70a3d70a4), COIN_U64(0xcccccccccccccccc), COIN_U64(0xcccccccccccccccd),
+  COIN_U64(0x8000000000000000), COIN_U64(0x0000000000000000), COIN_U64(0xa000000000000000), COIN_U64(0x0000000000000000),
+  COIN_U64(0xc800000000000000), COIN_U64(0x0000000000000000), COIN_U64(0xfa00000000000000), COIN_U64(0x0000000000000000),
+  COIN_U64(0x9c40000000000000), COIN_U64(0x0000000000000000), COIN_U64(0xc350000000000000), COIN_U64(0x0000000000000000),
+  COIN_U64(0xf424000000000000), COIN_U64(0x0000000000000000), COIN_U64(0x9896800000000000), COIN_U64(0x0000000000000000),
+  COIN_U64(0xbebc200000000000), COIN_U64(0x0000000000000000), COIN_U64(0xee6b280000000000), COIN_U64(0x0000000000000000),
+  COIN_U64(0x9502f90000000000), COIN_U64(0x0000000000000000), COIN_U64(0xba43b74000000000), COIN_U64(0x0000000000000000),
+  COIN_U64(0xe8d4a51000000000), COIN_U64(0x0000000000000000), COIN_U64(0x9184e72a00000000), COIN_U64(0x0000000000000000),
+  COIN_U64(0xb5e620f480000000), COIN_U64(0x0000000000000000), COIN_U64(0xe35fa931a0000000), COIN_U64(0x0000000000000000),
+  COIN_U64(0x8e1bc9bf04000000), COIN_U64(0x0000000000000000), COIN_U64(0xb1a2bc2ec5000000), COIN_U64(0x0000000000000000),
+  COIN_U64(0xde0b6b3a76400000), COIN_U64(0x0000000000000000), COIN_U64(0x8ac7230489e80000), COIN_U64(0x0000000000000000),
+  COIN_U64(0xad78ebc5ac620000), COIN_U64(0x0000000000000000), COIN_U64(0xd8d726b7177a8000), COIN_U64(0x0000000000000000),
+  COIN_U64(0x878678326eac9000), COIN_U64(0x0000000000000000), COIN_U64(0xa968163f0a57b400), COIN_U64(0x0000000000000000),
+  COIN_U64(0xd3c21bcecceda100), COIN_U64(0x0000000000000000), COIN_U64(0x84595161401484a0), COIN_U64(0x0000000000000000),
+  COIN_U64(0xa56fa5b99019a5c8), COIN_U64(0x0000000000000000), COIN_U64(0xcecb8f27f4200f3a), COIN_U64(0x0000000000000000),
+  COIN_U64(0x813f3978f8940984), COIN_U64(0x4000000000000000), COIN_U64(0xa18f07d736b90be5), COIN_U64(0x5000000000000000),
+  COIN_U64(0xc9f2c9cd04674ede), COIN_U64(0xa400000000000000), COIN_U64(0xfc6f7c4045812296), COIN_U64(0x4d00000000000000),
+  COIN_U64(0x9dc5ada82b70b59d), COIN_U64(0xf020000000000000), COIN_U64(0xc5371912364ce305), COIN_U64(0x6c28000000000000),
+  COIN_U64(0xf684df56c3e01bc6), COIN_U64(0xc732000000000000), COIN_U64(0x9a130b963a6c115c), COIN_U64(0x3c7f400000000000),
+  COIN_U64(0xc097ce7bc90715b3), COIN_U64(0x4b9f100000000000), COIN_U64(0xf0bdc21abb48db20), COIN_U64(0x1e86d40000000000),
+  COIN_U64(0x96769950b50d88f4), COIN_U64(0x1314448000000000), COIN_U64(0xbc143fa4e250eb31), COIN_U64(0x17d955a000000000),
+  COIN_U64(0xeb194f8e1ae525fd), COIN_U64(0x5dcfab0800000000), COIN_U64(0x92efd1b8d0cf37be), COIN_U64(0x5aa1cae500000000),
+  COIN_U64(0xb7abc627050305ad), COIN_U64(0xf14a3d9e40000000), COIN_U64(0xe596b7b0c643c719), COIN_U64(0x6d9ccd05d0000000),
+  COIN_U64(0x8f7e32ce7bea5c6f), COIN_U64(0xe4820023a2000000), COIN_U64(0xb35dbf821ae4f38b), COIN_U64(0xdda2802c8a800000),
+  COIN_U64(0xe0352f62a19e306e), COIN_U64(0xd50b2037ad200000), COIN_U64(0x8c213d9da502de45), COIN_U64(0x4526f422cc340000),
+  COIN_U64(0xaf298d050e4395d6), COIN_U64(0x9670b12b7f410000), COIN_U64(0xdaf3f04651d47b4c), COIN_U64(0x3c0cdd765f114000),
+  COIN_U64(0x88d8762bf324cd0f), COIN_U64(0xa5880a69fb6ac800), COIN_U64(0xab0e93b6efee0053), COIN_U64(0x8eea0d047a457a00),
+  COIN_U64(0xd5d238a4abe98068), COIN_U64(0x72a4904598d6d880), COIN_U64(0x85a36366eb71f041), COIN_U64(0x47a6da2b7f864750),
+  COIN_U64(0xa70c3c40a64e6c51), COIN_U64(0x999090b65f67d924), COIN_U64(0xd0cf4b50cfe20765), COIN_U64(0xfff4b4e3f741cf6d),
+  COIN_U64(0x82818f1281ed449f), COIN_U64(0xbff8f10e7a8921a4), COIN_U64(0xa321f2d7226895c7), COIN_U64(0xaff72d52192b6a0d),
+  COIN_U64(0xcbea6f8ceb02bb39), COIN_U64(0x9bf4f8a69f764490), COIN_U64(0xfee50b7025c36a08), COIN_U64(0x02f236d04753d5b4),
+  COIN_U64(0x9f4f2726179a2245), COIN_U64(0x01d762422c946590), COIN_U64(0xc722f0ef9d80aad6), COIN_U64(0x424d3ad2b7b97ef5),
+  COIN_U64(0xf8ebad2b84e0d58b), COIN_U64(0xd2e0898765a7deb2), COIN_U64(0x9b934c3b330c8577), COIN_U64(0x63cc55f49f88eb2f),
+  COIN_U64(0xc2781f49ffcfa6d5), COIN_U64(0x3cbf6b71c76b25fb), COIN_U64(0xf316271c7fc3908a), COIN_U64(0x8bef464e3945ef7a),
+  COIN_U64(0x97edd871cfda3a56), COIN_U64(0x97758bf0e3cbb5ac), COIN_U64(0xbde94e8e43d0c8ec), COIN_U64(0x3d52eeed1cbea317),
+  COIN_U64(0xed63a231d4c4fb27), COIN_U64(0x4ca7aaa863ee4bdd), COIN_U64(0x945e455f24fb1cf8), COIN_U64(0x8fe8caa93e74ef6a),
+  COIN_U64(0xb975d6b6ee39e436), COIN_U64(0xb3e2fd538e122b44), COIN_U64(0xe7d34c64a9c85d44), COIN_U64(0x60dbbca87196b616),
+  COIN_U64(0x90e40fbeea1d3a4a), COIN_U64(0xbc8955e946fe31cd), COIN_U64(0xb51d13aea4a488dd), COIN_U64(0x6babab6398bdbe41),
+  COIN_U64(0xe264589a4dcdab14), COIN_U64(0xc696963c7eed2dd1), COIN_U64(0x8d7eb76070a08aec), COIN_U64(0xfc1e1de5cf543ca2),
+  COIN_U64(0xb0de65388cc8ada8), COIN_U64(0x3b25a55f43294bcb), COIN_U64(0xdd15fe86affad912), COIN_U64(0x49ef0eb713f39ebe),
+  COIN_U64(0x8a2dbf142dfcc7ab), COIN_U64(0x6e3569326c784337), COIN_U64(0xacb92ed9397bf996), COIN_U64(0x49c2c37f07965404),
+  COIN_U64(0xd7e77a8f87daf7fb), COIN_U64(0xdc33745ec97be906), COIN_U64(0x86f0ac99b4e8dafd), COIN_U64(0x69a028bb3ded71a3),
+  COIN_U64(0xa8acd7c0222311bc), COIN_U64(0xc40832ea0d68ce0c), COIN_U64(0xd2d80db02aabd62b), COIN_U64(0xf50a3fa490c30190),
+  COIN_U64(0x83c7088e1aab65db), COIN_U64(0x792667c6da79e0fa), COIN_U64(0xa4b8cab1a1563f52), COIN_U64(0x577001b891185938),
+  COIN_U64(0xcde6fd5e09abcf26), COIN_U64(0xed4c0226b55e6f86), COIN_U64(0x80b05e5ac60b6178), COIN_U64(0x544f8158315b05b4),
+  COIN_U64(0xa0dc75f1778e39d6), COIN_U64(0x696361ae3db1c721), COIN_U64(0xc913936dd571c84c), COIN_U64(0x03bc3a19cd1e38e9),
+  COIN_U64(0xfb5878494ace3a5f), COIN_U64(0x04ab48a04065c723), COIN_U64(0x9d174b2dcec0e47b), COIN_U64(0x62eb0d64283f9c76),
+  COIN_U64(0xc45d1df942711d9a), COIN_U64(0x3ba5d0bd324f8394), COIN_U64(0xf5746577930d6500), COIN_U64(0xca8f44ec7ee36479),
+  COIN_U64(0x9968bf6abbe85f20), COIN_U64(0x7e998b13cf4e1ecb), COIN_U64(0xbfc2ef456ae276e8), COIN_U64(0x9e3fedd8c321a67e),
+  COIN_U64(0xefb3ab16c59b14a2), COIN_U64(0xc5cfe94ef3ea101e), COIN_U64(0x95d04aee3b80ece5), COIN_U64(0xbba1f1d158724a12),
+  COIN_U64(0xbb445da9ca61281f), COIN_U64(0x2a8a6e45ae8edc97), COIN_U64(0xea1575143cf97226), COIN_U64(0xf52d09d71a3293bd),
+  COIN_U64(0x924d692ca61be758), COIN_U64(0x593c2626705f9c56), COIN_U64(0xb6e0c377cfa2e12e), COIN_U64(0x6f8b2fb00c77836c),
+  COIN_U64(0xe498f455c38b997a), COIN_U64(0x0b6dfb9c0f956447), COIN_U64(0x8edf98b59a373fec), COIN_U64(0x4724bd4189bd5eac),
+  COIN_U64(0xb2977ee300c50fe7), COIN_U64(0x58edec91ec2cb657), COIN_U64(0xdf3d5e9bc0f653e1), COIN_U64(0x2f2967b66737e3ed),
+  COIN_U64(0x8b865b215899f46c), COIN_U64(0xbd79e0d20082ee74), COIN_U64(0xae67f1e9aec07187), COIN_U64(0xecd8590680a3aa11),
+  COIN_U64(0xda01ee641a708de9), COIN_U64(0xe80e6f4820cc9495), COIN_U64(0x884134fe908658b2), COIN_U64(0x3109058d147fdcdd),
+  COIN_U64(0xaa51823e34a7eede), COIN_U64(0xbd4b46f0599fd415), COIN_U64(0xd4e5e2cdc1d1ea96), COIN_U64(0x6c9e18ac7007c91a),
+  COIN_U64(0x850fadc09923329e), COIN_U64(0x03e2cf6bc604ddb0), COIN_U64(0xa6539930bf6bff45), COIN_U64(0x84db8346b786151c),
+  COIN_U64(0xcfe87f7cef46ff16), COIN_U64(0xe612641865679a63), COIN_U64(0x81f14fae158c5f6e), COIN_U64(0x4fcb7e8f3f60c07e),
+  COIN_U64(0xa26da3999aef7749), COIN_U64(0xe3be5e330f38f09d), COIN_U64(0xcb090c8001ab551c), COIN_U64(0x5cadf5bfd3072cc5),
+  COIN_U64(0xfdcb4fa002162a63), COIN_U64(0x73d9732fc7c8f7f6), COIN_U64(0x9e9f11c4014dda7e), COIN_U64(0x2867e7fddcdd9afa),
+  COIN_U64(0xc646d63501a1511d), COIN_U64(0xb281e1fd541501b8), COIN_U64(0xf7d88bc24209a565), COIN_U64(0x1f225a7ca91a4226),
+  COIN_U64(0x9ae757596946075f), COIN_U64(0x3375788de9b06958), COIN_U64(0xc1a12d2fc3978937), COIN_U64(0x0052d6b1641c83ae),
+  COIN_U64(0xf209787bb47d6b84), COIN_U64(0xc0678c5dbd23a49a), COIN_U64(0x9745eb4d50ce6332), COIN_U64(0xf840b7ba963646e0),
+  COIN_U64(0xbd176620a501fbff), COIN_U64(0xb650e5a93bc3d898), COIN_U64(0xec5d3fa8ce427aff), COIN_U64(0xa3e51f138ab4cebe),
+  COIN_U64(0x93ba47c980e98cdf), COIN_U64(0xc66f336c36b10137), COIN_U64(0xb8a8d9bbe123f017), COIN_U64(0xb80b0047445d4184),
+  COIN_U64(0xe6d3102ad96cec1d), COIN_U64(0xa60dc059157491e5), COIN_U64(0x9043ea1ac7e41392), COIN_U64(0x87c89837ad68db2f),
+  COIN_U64(0xb454e4a179dd1877), COIN_U64(0x29babe4598c311fb), COIN_U64(0xe16a1dc9d8545e94), COIN_U64(0xf4296dd6fef3d67a),
+  COIN_U64(0x8ce2529e2734bb1d), COIN_U64(0x1899e4a65f58660c), COIN_U64(0xb01ae745b101e9e4), COIN_U64(0x5ec05dcff72e7f8f),
+  COIN_U64(0xdc21a1171d42645d), COIN_U64(0x76707543f4fa1f73), COIN_U64(0x899504ae72497eba), COIN_U64(0x6a06494a791c53a8),
+  COIN_U64(0xabfa45da0edbde69), COIN_U64(0x0487db9d17636892), COIN_U64(0xd6f8d7509292d603), COIN_U64(0x45a9d2845d3c42b6),
+  COIN_U64(0x865b86925b9bc5c2), COIN_U64(0x0b8a2392ba45a9b2), COIN_U64(0xa7f26836f282b732), COIN_U64(0x8e6cac7768d7141e),
+  COIN_U64(0xd1ef0244af2364ff), COIN_U64(0x3207d795430cd926), COIN_U64(0x8335616aed761f1f), COIN_U64(0x7f44e6bd49e807b8),
+  COIN_U64(0xa402b9c5a8d3a6e7), COIN_U64(0x5f16206c9c6209a6), COIN_U64(0xcd036837130890a1), COIN_U64(0x36dba887c37a8c0f),
+  COIN_U64(0x802221226be55a64), COIN_U64(0xc2494954da2c9789), COIN_U64(0xa02aa96b06deb0fd), COIN_U64(0xf2db9baa10b7bd6c),
+  COIN_U64(0xc83553c5c8965d3d), COIN_U64(0x6f92829494e5acc7), COIN_U64(0xfa42a8b73abbf48c), COIN_U64(0xcb772339ba1f17f9),
+  COIN_U64(0x9c69a97284b578d7), COIN_U64(0xff2a760414536efb), COIN_U64(0xc38413cf25e2d70d), COIN_U64(0xfef5138519684aba),
+  COIN_U64(0xf46518c2ef5b8cd1), COIN_U64(0x7eb258665fc25d69), COIN_U64(0x98bf2f79d5993802), COIN_U64(0xef2f773ffbd97a61),
+  COIN_U64(0xbeeefb584aff8603), COIN_U64(0xaafb550ffacfd8fa), COIN_U64(0xeeaaba2e5dbf6784), COIN_U64(0x95ba2a53f983cf38),
+  COIN_U64(0x952ab45cfa97a0b2), COIN_U64(0xdd945a747bf26183), COIN_U64(0xba756174393d88df), COIN_U64(0x94f971119aeef9e4),
+  COIN_U64(0xe912b9d1478ceb17), COIN_U64(0x7a37cd5601aab85d), COIN_U64(0x91abb422ccb812ee), COIN_U64(0xac62e055c10ab33a),
+  COIN_U64(0xb616a12b7fe617aa), COIN_U64(0x577b986b314d6009), COIN_U64(0xe39c49765fdf9d94), COIN_U64(0xed5a7e85fda0b80b),
+  COIN_U64(0x8e41ade9fbebc27d), COIN_U64(0x14588f13be847307), COIN_U64(0xb1d219647ae6b31c), COIN_U64(0x596eb2d8ae258fc8),
+  COIN_U64(0xde469fbd99a05fe3), COIN_U64(0x6fca5f8ed9aef3bb), COIN_U64(0x8aec23d680043bee), COIN_U64(0x25de7bb9480d5854),
+  COIN_U64(0xada72ccc20054ae9), COIN_U64(0xaf561aa79a10ae6a), COIN_U64(0xd910f7ff28069da4), COIN_U64(0x1b2ba1518094da04),
+  COIN_U64(0x87aa9aff79042286), COIN_U64(0x90fb44d2f05d0842), COIN_U64(0xa99541bf57452b28), COIN_U64(0x353a1607ac744a53),
+  COIN_U64(0xd3fa922f2d1675f2), COIN_U64(0x42889b8997915ce8), COIN_U64(0x847c9b5d7c2e09b7), COIN_U64(0x69956135febada11),
+  COIN_U64(0xa59bc234db398c25), COIN_U64(0x43fab9837e699095), COIN_U64(0xcf02b2c21207ef2e), COIN_U64(0x94f967e45e03f4bb),
+  COIN_U64(0x8161afb94b44f57d), COIN_U64(0x1d1be0eebac278f5), COIN_U64(0xa1ba1ba79e1632dc), COIN_U64(0x6462d92a69731732),
+  COIN_U64(0xca28a291859bbf93), COIN_U64(0x7d7b8f7503cfdcfe), COIN_U64(0xfcb2cb35e702af78), COIN_U64(0x5cda735244c3d43e),
+  COIN_U64(0x9defbf01b061adab), COIN_U64(0x3a0888136afa64a7), COIN_U64(0xc56baec21c7a1916), COIN_U64(0x088aaa1845b8fdd0),
+  COIN_U64(0xf6c69a72a3989f5b), COIN_U64(0x8aad549e57273d45), COIN_U64(0x9a3c2087a63f6399), COIN_U64(0x36ac54e2f678864b),
+  COIN_U64(0xc0cb28a98fcf3c7f), COIN_U64(0x84576a1bb416a7dd), COIN_U64(0xf0fdf2d3f3c30b9f), COIN_U64(0x656d44a2a11c51d5),
+  COIN_U64(0x969eb7c47859e743), COIN_U64(0x9f644ae5a4b1b325), COIN_U64(0xbc4665b596706114), COIN_U64(0x873d5d9f0dde1fee),
+  COIN_U64(0xeb57ff22fc0c7959), COIN_U64(0xa90cb506d155a7ea), COIN_U64(0x9316ff75dd87cbd8), COIN_U64(0x09a7f12442d588f2),
+  COIN_U64(0xb7dcbf5354e9bece), COIN_U64(0x0c11ed6d538aeb2f), COIN_U64(0xe5d3ef282a242e81), COIN_U64(0x8f1668c8a86da5fa),
+  COIN_U64(0x8fa475791a569d10), COIN_U64(0xf96e017d694487bc), COIN_U64(0xb38d92d760ec4455), COIN_U64(0x37c981dcc395a9ac),
+  COIN_U64(0xe070f78d3927556a), COIN_U64(0x85bbe253f47b1417), COIN_U64(0x8c469ab843b89562), COIN_U64(0x93956d7478ccec8e),
+  COIN_U64(0xaf58416654a6babb), COIN_U64(0x387ac8d1970027b2), COIN_U64(0xdb2e51bfe9d0696a), COIN_U64(0x06997b05fcc0319e),
+  COIN_U64(0x88fcf317f22241e2), COIN_U64(0x441fece3bdf81f03), COIN_U64(0xab3c2fddeeaad25a), COIN_U64(0xd527e81cad7626c3),
+  COIN_U64(0xd60b3bd56a5586f1), COIN_U64(0x8a71e223d8d3b074), COIN_U64(0x85c7056562757456), COIN_U64(0xf6872d5667844e49),
+  COIN_U64(0xa738c6bebb12d16c), COIN_U64(0xb428f8ac016561db), COIN_U64(0xd106f86e69d785c7), COIN_U64(0xe13336d701beba52),
+  COIN_U64(0x82a45b450226b39c), COIN_U64(0xecc0024661173473), COIN_U64(0xa34d721642b06084), COIN_U64(0x27f002d7f95d0190),
+  COIN_U64(0xcc20ce9bd35c78a5), COIN_U64(0x31ec038df7b441f4), COIN_U64(0xff290242c83396ce), COIN_U64(0x7e67047175a15271),
+  COIN_U64(0x9f79a169bd203e41), COIN_U64(0x0f0062c6e984d386), COIN_U64(0xc75809c42c684dd1), COIN_U64(0x52c07b78a3e60868),
+  COIN_U64(0xf92e0c3537826145), COIN_U64(0xa7709a56ccdf8a82), COIN_U64(0x9bbcc7a142b17ccb), COIN_U64(0x88a66076400bb691),
+  COIN_U64(0xc2abf989935ddbfe), COIN_U64(0x6acff893d00ea435), COIN_U64(0xf356f7ebf83552fe), COIN_U64(0x0583f6b8c4124d43),
+  COIN_U64(0x98165af37b2153de), COIN_U64(0xc3727a337a8b704a), COIN_U64(0xbe1bf1b059e9a8d6), COIN_U64(0x744f18c0592e4c5c),
+  COIN_U64(0xeda2ee1c7064130c), COIN_U64(0x1162def06f79df73), COIN_U64(0x9485d4d1c63e8be7), COIN_U64(0x8addcb5645ac2ba8),
+  COIN_U64(0xb9a74a0637ce2ee1), COIN_U64(0x6d953e2bd7173692), COIN_U64(0xe8111c87c5c1ba99), COIN_U64(0xc8fa8db6ccdd0437),
+  COIN_U64(0x910ab1d4db9914a0), COIN_U64(0x1d9c9892400a22a2), COIN_U64(0xb54d5e4a127f59c8), COIN_U64(0x2503beb6d00cab4b),
+  COIN_U64(0xe2a0b5dc971f303a), COIN_U64(0x2e44ae64840fd61d), COIN_U64(0x8da471a9de737e24), COIN_U64(0x5ceaecfed289e5d2),
+  COIN_U64(0xb10d8e1456105dad), COIN_U64(0x7425a83e872c5f47), COIN_U64(0xdd50f1996b947518), COIN_U64(0xd12f124e28f77719),
+  COIN_U64(0x8a5296ffe33cc92f), COIN_U64(0x82bd6b70d99aaa6f), COIN_U64(0xace73cbfdc0bfb7b), COIN_U64(0x636cc64d1001550b),
+  COIN_U64(0xd8210befd30efa5a), COIN_U64(0x3c47f7e05401aa4e), COIN_U64(0x8714a775e3e95c78), COIN_U64(0x65acfaec34810a71),
+  COIN_U64(0xa8d9d1535ce3b396), COIN_U64(0x7f1839a741a14d0d), COIN_U64(0xd31045a8341ca07c), COIN_U64(0x1ede48111209a050),
+  COIN_U64(0x83ea2b892091e44d), COIN_U64(0x934aed0aab460432), COIN_U64(0xa4e4b66b68b65d60), COIN_U64(0xf81da84d5617853f),
+  COIN_U64(0xce1de40642e3f4b9), COIN_U64(0x36251260ab9d668e), COIN_U64(0x80d2ae83e9ce78f3), COIN_U64(0xc1d72b7c6b426019),
+  COIN_U64(0xa1075a24e4421730), COIN_U64(0xb24cf65b8612f81f), COIN_U64(0xc94930ae1d529cfc), COIN_U64(0xdee033f26797b627),
+  COIN_U64(0xfb9b7cd9a4a7443c), COIN_U64(0x169840ef017da3b1), COIN_U64(0x9d412e0806e88aa5), COIN_U64(0x8e1f289560ee864e),
+  COIN_U64(0xc491798a08a2ad4e), COIN_U64(0xf1a6f2bab92a27e2), COIN_U64(0xf5b5d7ec8acb58a2), COIN_U64(0xae10af696774b1db),
+  COIN_U64(0x9991a6f3d6bf1765), COIN_U64(0xacca6da1e0a8ef29), COIN_U64(0xbff610b0cc6edd3f), COIN_U64(0x17fd090a58d32af3),
+  COIN_U64(0xeff394dcff8a948e), COIN_U64(0xddfc4b4cef07f5b0), COIN_U64(0x95f83d0a1fb69cd9), COIN_U64(0x4abdaf101564f98e),
+  COIN_U64(0xbb764c4ca7a4440f), COIN_U64(0x9d6d1ad41abe37f1), COIN_U64(0xea53df5fd18d5513), COIN_U64(0x84c86189216dc5ed),
+  COIN_U64(0x92746b9be2f8552c), COIN_U64(0x32fd3cf5b4e49bb4), COIN_U64(0xb7118682dbb66a77), COIN_U64(0x3fbc8c33221dc2a1),
+  COIN_U64(0xe4d5e82392a40515), COIN_U64(0x0fabaf3feaa5334a), COIN_U64(0x8f05b1163ba6832d), COIN_U64(0x29cb4d87f2a7400e),
+  COIN_U64(0xb2c71d5bca9023f8), COIN_U64(0x743e20e9ef511012), COIN_U64(0xdf78e4b2bd342cf6), COIN_U64(0x914da9246b255416),
+  COIN_U64(0x8bab8eefb6409c1a), COIN_U64(0x1ad089b6c2f7548e), COIN_U64(0xae9672aba3d0c320), COIN_U64(0xa184ac2473b529b1),
+  COIN_U64(0xda3c0f568cc4f3e8), COIN_U64(0xc9e5d72d90a2741e), COIN_U64(0x8865899617fb1871), COIN_U64(0x7e2fa67c7a658892),
+  COIN_U64(0xaa7eebfb9df9de8d), COIN_U64(0xddbb901b98feeab7), COIN_U64(0xd51ea6fa85785631), COIN_U64(0x552a74227f3ea565),
+  COIN_U64(0x8533285c936b35de), COIN_U64(0xd53a88958f87275f), COIN_U64(0xa67ff273b8460356), COIN_U64(0x8a892abaf368f137),
+  COIN_U64(0xd01fef10a657842c), COIN_U64(0x2d2b7569b0432d85), COIN_U64(0x8213f56a67f6b29b), COIN_U64(0x9c3b29620e29fc73),
+  COIN_U64(0xa298f2c501f45f42), COIN_U64(0x8349f3ba91b47b8f), COIN_U64(0xcb3f2f7642717713), COIN_U64(0x241c70a936219a73),
+  COIN_U64(0xfe0efb53d30dd4d7), COIN_U64(0xed238cd383aa0110), COIN_U64(0x9ec95d1463e8a506), COIN_U64(0xf4363804324a40aa),
+  COIN_U64(0xc67bb4597ce2ce48), COIN_U64(0xb143c6053edcd0d5), COIN_U64(0xf81aa16fdc1b81da), COIN_U64(0xdd94b7868e94050a),
+  COIN_U64(0x9b10a4e5e9913128), COIN_U64(0xca7cf2b4191c8326), COIN_U64(0xc1d4ce1f63f57d72), COIN_U64(0xfd1c2f611f63a3f0),
+  COIN_U64(0xf24a01a73cf2dccf), COIN_U64(0xbc633b39673c8cec), COIN_U64(0x976e41088617ca01), COIN_U64(0xd5be0503e085d813),
+  COIN_U64(0xbd49d14aa79dbc82), COIN_U64(0x4b2d8644d8a74e18), COIN_U64(0xec9c459d51852ba2), COIN_U64(0xddf8e7d60ed1219e),
+  COIN_U64(0x93e1ab8252f33b45), COIN_U64(0xcabb90e5c942b503), COIN_U64(0xb8da1662e7b00a17), COIN_U64(0x3d6a751f3b936243),
+  COIN_U64(0xe7109bfba19c0c9d), COIN_U64(0x0cc512670a783ad4), COIN_U64(0x906a617d450187e2), COIN_U64(0x27fb2b80668b24c5),
+  COIN_U64(0xb484f9dc9641e9da), COIN_U64(0xb1f9f660802dedf6), COIN_U64(0xe1a63853bbd26451), COIN_U64(0x5e7873f8a0396973),
+  COIN_U64(0x8d07e33455637eb2), COIN_U64(0xdb0b487b6423e1e8), COIN_U64(0xb049dc016abc5e5f), COIN_U64(0x91ce1a9a3d2cda62),
+  COIN_U64(0xdc5c5301c56b75f7), COIN_U64(0x7641a140cc7810fb), COIN_U64(0x89b9b3e11b6329ba), COIN_U64(0xa9e904c87fcb0a9d),
+  COIN_U64(0xac2820d9623bf429), COIN_U64(0x546345fa9fbdcd44), COIN_U64(0xd732290fbacaf133), COIN_U64(0xa97c177947ad4095),
+  COIN_U64(0x867f59a9d4bed6c0), COIN_U64(0x49ed8eabcccc485d), COIN_U64(0xa81f301449ee8c70), COIN_U64(0x5c68f256bfff5a74),
+  COIN_U64(0xd226fc195c6a2f8c), COIN_U64(0x73832eec6fff3111), COIN_U64(0x83585d8fd9c25db7), COIN_U64(0xc831fd53c5ff7eab),
+  COIN_U64(0xa42e74f3d032f525), COIN_U64(0xba3e7ca8b77f5e55), COIN_U64(0xcd3a1230c43fb26f), COIN_U64(0x28ce1bd2e55f35eb),
+  COIN_U64(0x80444b5e7aa7cf85), COIN_U64(0x7980d163cf5b81b3), COIN_U64(0xa0555e361951c366), COIN_U64(0xd7e105bcc332621f),
+  COIN_U64(0xc86ab5c39fa63440), COIN_U64(0x8dd9472bf3fefaa7), COIN_U64(0xfa856334878fc150), COIN_U64(0xb14f98f6f0feb951),
+  COIN_U64(0x9c935e00d4b9d8d2), COIN_U64(0x6ed1bf9a569f33d3), COIN_U64(0xc3b8358109e84f07), COIN_U64(0x0a862f80ec4700c8),
+  COIN_U64(0xf4a642e14c6262c8), COIN_U64(0xcd27bb612758c0fa), COIN_U64(0x98e7e9cccfbd7dbd), COIN_U64(0x8038d51cb897789c),
+  COIN_U64(0xbf21e44003acdd2c), COIN_U64(0xe0470a63e6bd56c3), COIN_U64(0xeeea5d5004981478), COIN_U64(0x1858ccfce06cac74),
+  COIN_U64(0x95527a5202df0ccb), COIN_U64(0x0f37801e0c43ebc8), COIN_U64(0xbaa718e68396cffd), COIN_U64(0xd30560258f54e6ba),
+  COIN_U64(0xe950df20247c83fd), COIN_U64(0x47c6b82ef32a2069), COIN_U64(0x91d28b7416cdd27e), COIN_U64(0x4cdc331d57fa5441),
+  COIN_U64(0xb6472e511c81471d), COIN_U64(0xe0133fe4adf8e952), COIN_U64(0xe3d8f9e563a198e5), COIN_U64(0x58180fddd97723a6),
+  COIN_U64(0x8e679c2f5e44ff8f), COIN_U64(0x570f09eaa7ea7648),
+};
+
+const int smallestPowerOfTen = -342;
+const int largestPowerOfTen = 308;
+const int mantissaBits = 52;
+const int infinitePower = 0x7ff;
+// At most this many digits are needed to decide halfway cases exactly
+const int maximumDigits = 780;
+
+typedef struct {
+  CoinUInt64Bits low;
+  CoinUInt64Bits high;
+} CoinValue128;
+
+inline CoinValue128 fullMultiplication(CoinUInt64Bits a, CoinUInt64Bits b)
+{
+  CoinValue128 answer;
+#ifdef __SIZEOF_INT128__
+  unsigned __int128 product = static_cast< unsigned __int128 >(a) * b;
+  answer.low = static_cast< CoinUInt64Bits >(product);
+  answer.high = static_cast< CoinUInt64Bits >(product >> 64);
+#else
+  CoinUInt64Bits aLow = a & 0xffffffff;
+  CoinUInt64Bits aHigh = a >> 32;
+  CoinUInt64Bits bLow = b & 0xffffffff;
+  CoinUInt64Bits bHigh = b >> 32;
+  CoinUInt64Bits lowLow = aLow * bLow;
+  CoinUInt64Bits lowHigh = aLow * bHigh;
+  CoinUInt64Bits highLow = aHigh * bLow;
+  CoinUInt64Bits highHigh = aHigh * bHigh;
+  CoinUInt64Bits middle = (lowLow >> 32) + (lowHigh & 0xffffffff) + (highLow & 0xffffffff);
+  answer.low = (middle << 32) | (lowLow & 0xffffffff);
+  answer.high = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+#endif
+  return answer;
+}
+
+inline int leadingZeros(CoinUInt64Bits value)
+{
+#ifdef __GNUC__
+  return __builtin_clzll(value);
+#else
+  int n = 0;
+  while (!(value & (COIN_U64(1) << 63))) {
+    value <<= 1;
+    n++;
+  }
+  return n;
+#endif
+}
+
+/* Returns bits of double nearest to w * 10^q.
+   w must be nonzero.
+*/
+CoinUInt64Bits computeFloat(int q, CoinUInt64Bits w)
+{
+  if (q < smallestPowerOfTen)
+    return 0;
+  if (q > largestPowerOfTen)
+    return static_cast< CoinUInt64Bits >(infinitePower) << mantissaBits;
+  int lz = leadingZeros(w);
+  w <<= lz;
+  // need 55 bits of product to be right - second multiply if in doubt
+  const int index = 2 * (q - smallestPowerOfTen);
+  const CoinUInt64Bits precisionMask = COIN_U64(0xffffffffffffffff) >> (mantissaBits + 3);
+  CoinValue128 product = fullMultiplication(w, powerOfFive128[index]);
+  if ((product.high & precisionMask) == precisionMask) {
+    CoinValue128 second = fullMultiplication(w, powerOfFive128[index + 1]);
+    product.low += second.high;
+    if (second.high > product.low)
+      product.high++;
+  }
+  int upperBit = static_cast< int >(product.high >> 63);
+  int shift = upperBit + 64 - mantissaBits - 3;
+  CoinUInt64Bits mantissa = product.high >> shift;
+  // floor(log2(10^q)) + 63 + bias
+  int power2 = ((217706 * q) >> 16) + 63 + upperBit - lz + 1023;
+  if (power2 <= 0) {
+    // subnormal (or zero)
+    if (-power2 + 1 >= 64)
+      return 0;
+    mantissa >>= -power2 + 1;
+    mantissa += (mantissa & 1);
+    mantissa >>= 1;
+    // rounding may have made it normal - then bits are right anyway
+    return mantissa;
+  }
+  // exactly half way can only happen for small powers
+  if (product.low <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1) {
+    if ((mantissa << shift) == product.high)
+      mantissa &= ~COIN_U64(1);
+  }
+  mantissa += (mantissa & 1);
+  mantissa >>= 1;
+  if (mantissa >= (COIN_U64(2) << mantissaBits)) {
+    mantissa = COIN_U64(1) << mantissaBits;
+    power2++;
+  }
+  mantissa &= ~(COIN_U64(1) << mantissaBits);
+  if (power2 >= infinitePower) {
+    power2 = infinitePower;
+    mantissa = 0;
+  }
+  return mantissa | (static_cast< CoinUInt64Bits >(power2) << mantissaBits);
+}
+
+// Fixed size big integer for slow path (enough for 780 digits times powers)
+const int bigLimbs = 256;
+typedef struct {
+  int size;
+  unsigned int limb[bigLimbs];
+} CoinBigNumber;
+
+void bigSet(CoinBigNumber &a, CoinUInt64Bits value)
+{
+  a.size = 0;
+  while (value) {
+    a.limb[a.size++] = static_cast< unsigned int >(value & 0xffffffff);
+    value >>= 32;
+  }
+}
+
+// a = a * multiplier + add
+void bigMultiplyAdd(CoinBigNumber &a, unsigned int multiplier, unsigned int add)
+{
+  CoinUInt64Bits carry = add;
+  for (int i = 0; i < a.size; i++) {
+    CoinUInt64Bits result = static_cast< CoinUInt64Bits >(a.limb[i]) * multiplier + carry;
+    a.limb[i] = static_cast< unsigned int >(result & 0xffffffff);
+    carry = result >> 32;
+  }
+  if (carry) {
+    assert(a.size < bigLimbs);
+    a.limb[a.size++] = static_cast< unsigned int >(carry);
+  }
+}
+
+void bigMultiplyPowerOfFive(CoinBigNumber &a, int n)
+{
+  static const unsigned int smallPower[13] = { 1, 5, 25, 125, 625, 3125, 15625,
+    78125, 390625, 1953125, 9765625, 48828125, 244140625 };
+  while (n >= 13) {
+    bigMultiplyAdd(a, 1220703125, 0);
+    n -= 13;
+  }
+  if (n)
+    bigMultiplyAdd(a, smallPower[n], 0);
+}
+
+void bigShiftLeft(CoinBigNumber &a, int n)
+{
+  if (!a.size || !n)
+    return;
+  int words = n / 32;
+  int bits = n % 32;
+  if (bits) {
+    unsigned int carry = 0;
+    for (int i = 0; i < a.size; i++) {
+      unsigned int value = a.limb[i];
+      a.limb[i] = (value << bits) | carry;
+      carry = value >> (32 - bits);
+    }
+    if (carry) {
+      assert(a.size < bigLimbs);
+      a.limb[a.size++] = carry;
+    }
+  }
+  if (words) {
+    assert(a.size + words <= bigLimbs);
+    memmove(a.limb + words, a.limb, a.size * sizeof(unsigned int));
+    memset(a.limb, 0, words * sizeof(unsigned int));
+    a.size += words;
+  }
+}
+
+int bigCompare(const CoinBigNumber &a, const CoinBigNumber &b)
+{
+  if (a.size != b.size)
+    return a.size > b.size ? 1 : -1;
+  for (int i = a.size - 1; i >= 0; i--) {
+    if (a.limb[i] != b.limb[i])
+      return a.limb[i] > b.limb[i] ? 1 : -1;
+  }
+  return 0;
+}
+
+/* Slow path - digits from first to last (may include point) and q is
+   the power of ten for the first 19 digits.  The answer is candidate or
+   the next double up, depending on which side of half way the exact
+   value is.
+*/
+CoinUInt64Bits slowPath(const char *first, const char *last, int q,
+  CoinUInt64Bits candidate)
+{
+  static const unsigned int powerOfTen[10] = { 1, 10, 100, 1000, 10000,
+    100000, 1000000, 10000000, 100000000, 1000000000 };
+  CoinBigNumber exact;
+  exact.size = 0;
+  int numberDigits = 0;
+  unsigned int chunk = 0;
+  int chunkDigits = 0;
+  bool sticky = false;
+  for (const char *p = first; p < last; p++) {
+    if (*p == '.')
+      continue;
+    unsigned int digit = static_cast< unsigned int >(*p - '0');
+    if (numberDigits < maximumDigits) {
+      chunk = chunk * 10 + digit;
+      numberDigits++;
+      if (++chunkDigits == 9) {
+        bigMultiplyAdd(exact, powerOfTen[9], chunk);
+        chunk = 0;
+        chunkDigits = 0;
+      }
+    } else if (digit) {
+      sticky = true;
+    }
+  }
+  if (sticky) {
+    // more nonzero digits - just make sure it is not equal to half way
+    chunk = chunk * 10 + 1;
+    numberDigits++;
+    chunkDigits++;
+  }
+  if (chunkDigits)
+    bigMultiplyAdd(exact, powerOfTen[chunkDigits], chunk);
+  // power of ten of last digit
+  int k = q - (numberDigits - 19);
+  // candidate is m * 2^e, half way up is (2m+1) * 2^(e-1)
+  int biased = static_cast< int >(candidate >> mantissaBits);
+  CoinUInt64Bits m = candidate & ((COIN_U64(1) << mantissaBits) - 1);
+  int e;
+  if (biased) {
+    m |= COIN_U64(1) << mantissaBits;
+    e = biased - 1075;
+  } else {
+    e = -1074;
+  }
+  CoinBigNumber halfWay;
+  bigSet(halfWay, 2 * m + 1);
+  int eHalf = e - 1;
+  if (k >= 0) {
+    // exact * 5^k * 2^k against halfWay * 2^eHalf
+    bigMultiplyPowerOfFive(exact, k);
+    if (k >= eHalf)
+      bigShiftLeft(exact, k - eHalf);
+    else
+      bigShiftLeft(halfWay, eHalf - k);
+  } else {
+    // exact against halfWay * 5^-k * 2^(eHalf-k)
+    bigMultiplyPowerOfFive(halfWay, -k);
+    if (eHalf >= k)
+      bigShiftLeft(halfWay, eHalf - k);
+    else
+      bigShiftLeft(exact, k - eHalf);
+  }
+  int compare = bigCompare(exact, halfWay);
+  if (compare > 0 || (compare == 0 && (candidate & 1)))
+    candidate++;
+  return candidate;
+}
+
+// Exact powers of ten for Clinger's fast path
+const double exactPowerOfTen[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+  1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19,
+  1e20, 1e21, 1e22 };
+
+// Case insensitive match of lower case word
+inline bool matchWord(const char *p, const char *word)
+{
+  for (; *word; p++, word++) {
+    if (*p != *word && *p != *word - 'a' + 'A')
+      return false;
+  }
+  return true;
+}
+} // end file-local namespace
+
+double CoinStrtod(const char *string, char **end)
+{
+  const char *p = string;
+  while (*p == ' ' || (*p >= '\t' && *p <= '\r'))
+    p++;
+  bool negative = false;
+  if (*p == '-') {
+    negative = true;
+    p++;
+  } else if (*p == '+') {
+    p++;
+  }
+  // First 19 significant digits go in w, rest just adjust exponent
+  CoinUInt64Bits w = 0;
+  int numberDigits = 0;
+  int exponent = 0;
+  bool anyDigits = false;
+  bool truncated = false;
+  const char *firstSignificant = NULL;
+  while (*p >= '0' && *p <= '9') {
+    unsigned int digit = static_cast< unsigned int >(*p - '0');
+    anyDigits = true;
+    if (numberDigits < 19) {
+      if (digit || numberDigits) {
+        if (!numberDigits)
+          firstSignificant = p;
+        w = w * 10 + digit;
+        numberDigits++;
+      }
+    } else {
+      exponent++;
+      if (digit)
+        truncated = true;
+    }
+    p++;
+  }
+  if (*p == '.') {
+    p++;
+    while (*p >= '0' && *p <= '9') {
+      unsigned int digit = static_cast< unsigned int >(*p - '0');
+      anyDigits = true;
+      if (numberDigits < 19) {
+        if (digit || numberDigits) {
+          if (!numberDigits)
+            firstSignificant = p;
+          w = w * 10 + digit;
+          numberDigits++;
+        }
+        exponent--;
+      } else if (digit) {
+        truncated = true;
+      }
+      p++;
+    }
+  }
+  double value;
+  if (!anyDigits) {
+    if (matchWord(p, "inf")) {
+      p += 3;
+      if (matchWord(p, "inity"))
+        p += 5;
+      value = std::numeric_limits< double >::infinity();
+    } else if (matchWord(p, "nan")) {
+      p += 3;
+      if (*p == '(') {
+        const char *q = p + 1;
+        while ((*q >= '0' && *q <= '9') || (*q >= 'a' && *q <= 'z') || (*q >= 'A' && *q <= 'Z') || *q == '_')
+          q++;
+        if (*q == ')')
+          p = q + 1;
+      }
+      value = std::numeric_limits< double >::quiet_NaN();
+    } else {
+      // no number
+      if (end)
+        *end = const_cast< char * >(string);
+      return 0.0;
+    }
+    if (end)
+      *end = const_cast< char * >(p);
+    return negative ? -value : value;
+  }
+  const char *lastDigit = p;
+  if (*p == 'e' || *p == 'E') {
+    const char *q = p + 1;
+    bool negativeExponent = false;
+    if (*q == '-') {
+      negativeExponent = true;
+      q++;
+    } else if (*q == '+') {
+      q++;
+    }
+    if (*q >= '0' && *q <= '9') {
+      int explicitExponent = 0;
+      while (*q >= '0' && *q <= '9') {
+        // anything this big is zero or infinity anyway
+        if (explicitExponent < 100000)
+          explicitExponent = explicitExponent * 10 + (*q - '0');
+        q++;
+      }
+      exponent += negativeExponent ? -explicitExponent : explicitExponent;
+      p = q;
+    }
+  }
+  if (end)
+    *end = const_cast< char * >(p);
+  if (!w) {
+    value = 0.0;
+  } else {
+#if (defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0) || (defined(__FLT_EVAL_METHOD__) && __FLT_EVAL_METHOD__ == 0)
+    // both exact so one correctly rounded operation
+    if (!truncated && w <= (COIN_U64(1) << 53) && exponent >= -22 && exponent <= 22) {
+      value = static_cast< double >(w);
+      if (exponent < 0)
+        value /= exactPowerOfTen[-exponent];
+      else
+        value *= exactPowerOfTen[exponent];
+      return negative ? -value : value;
+    }
+#endif
+    CoinUInt64Bits bits = computeFloat(exponent, w);
+    if (truncated && bits != computeFloat(exponent, w + 1))
+      bits = slowPath(firstSignificant, lastDigit, exponent, bits);
+    memcpy(&value, &bits, sizeof(double));
+  }
+  return negative ? -value : value;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,34 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CoinStrtod_H
+#define CoinStrtod_H
+
+/** \file CoinStrtod.hpp
+    \brief Fast, locale independent conversion of text to double.
+*/
+
+/** Converts the start of \p string to a double, like strtod in the "C"
+    locale.
+
+    Leading white space, a sign, decimal digits with an optional decimal
+    point and an optional exponent are accepted, as are "inf", "infinity"
+    and "nan" in any case.  Hexadecimal input is not.  The result is
+    correctly rounded (round to nearest, ties to even); values too large
+    give +-infinity and values too small give (signed) zero.
+
+    Most numbers are converted using one or two 64 bit by 128 bit
+    multiplications (Eisel-Lemire).  Only numbers with more than 19
+    significant digits which are very close to half way between two doubles
+    need the exact (but still allocation free) slow path.
+
+    If \p end is not NULL it is set to the first character not used, or to
+    \p string if no conversion was possible (in which case 0.0 is returned).
+*/
+double CoinStrtod(const char *string, char **end);
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
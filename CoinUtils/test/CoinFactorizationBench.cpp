@@ -0,0 +1,839 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+// Compares CoinFactorization with the CoinOtherFactorization
+// implementations (CoinDenseFactorization, CoinSimpFactorization and
+// CoinOslFactorization) on the same bases and the same updates.
+//
+// factorBench [-pivots n] [-updates n] [-dense n] [-basis file.bas] [file.mps ...]
+//
+// For each problem three starting bases are used - all slacks, a
+// triangular crash and a recorded basis (a CoinWarmStartBasis read with
+// -basis or else the one reached from the crash basis by the updates).
+// Each basis is first made nonsingular with CoinFactorization.
+// CoinFactorization then chooses -updates updates (default 200) - a random
+// nonbasic column comes in and the basic variable with the largest entry
+// in its FTRAN goes out - and that sequence (by variable) is replayed on
+// each implementation with a refactorization every -pivots updates
+// (default 100).  After each update one dense FTRAN and one dense BTRAN
+// are done and their residuals against the basis are found.
+// CoinDenseFactorization and CoinSimpFactorization keep a dense matrix so
+// are only used up to -dense rows (default 2000).  With no files random
+// sparse problems are used.
+//
+// Output is comma separated with a header line and then one line for each
+// problem, basis and implementation -
+//   factorSeconds  average cpu seconds for a factorization
+//   ftran, btran   average microseconds for a dense solve
+//   update         average microseconds for FTRAN of the incoming column
+//                  plus replaceColumn
+//   fill           factorElements over basisElements at last
+//                  factorization - factorElements is numberElements() for
+//                  the CoinOtherFactorization ones which counts their
+//                  whole dense area
+//   peakBytes      most memory got by operator new during the replay (-1
+//                  for CoinOslFactorization which uses malloc, or without
+//                  glibc)
+//   ftranError, btranError  largest residual over largest right hand side
+//   refactor       refactorizations forced by replaceColumn status or a
+//                  small pivot (CoinOslFactorization says 3 one update
+//                  before -pivots)
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "CoinDenseFactorization.hpp"
+#include "CoinFactorization.hpp"
+#include "CoinIndexedVector.hpp"
+#include "CoinMpsIO.hpp"
+#include "CoinOslFactorization.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "CoinSimpFactorization.hpp"
+#include "CoinTime.hpp"
+#include "CoinWarmStartBasis.hpp"
+
+#ifdef __GLIBC__
+#include <malloc.h>
+// Blocks are measured with malloc_usable_size so nothing is put in front
+#define COIN_BENCH_COUNT_HEAP
+#endif
+
+namespace {
+
+// Heap got by operator new
+size_t heapInUse = 0;
+size_t heapPeak = 0;
+
+#ifdef COIN_BENCH_COUNT_HEAP
+/* Every operator new and delete goes through these.  Not inlined so gcc
+   does not pair malloc and free with new and delete expressions and warn
+   about a mismatch */
+#ifdef __GNUC__
+__attribute__((noinline))
+#endif
+void *
+countedMalloc(std::size_t size)
+{
+  void *pointer = malloc(size ? size : 1);
+  if (!pointer)
+    throw std::bad_alloc();
+  heapInUse += malloc_usable_size(pointer);
+  if (heapInUse > heapPeak)
+    heapPeak = heapInUse;
+  return pointer;
+}
+
+#ifdef __GNUC__
+__attribute__((noinline))
+#endif
+void
+countedFree(void *pointer)
+{
+  if (pointer) {
+    heapInUse -= malloc_usable_size(pointer);
+    free(pointer);
+  }
+}
+#endif
+
+} // end file-local namespace
+
+#ifdef COIN_BENCH_COUNT_HEAP
+void *operator new(std::size_t size)
+#if __cplusplus < 201103L
+  throw(std::bad_alloc)
+#endif
+{
+  return countedMalloc(size);
+}
+
+void *operator new[](std::size_t size)
+#if __cplusplus < 201103L
+  throw(std::bad_alloc)
+#endif
+{
+  return countedMalloc(size);
+}
+
+void operator delete(void *pointer)
+#if __cplusplus < 201103L
+  throw()
+#else
+  noexcept
+#endif
+{
+  countedFree(pointer);
+}
+
+void operator delete[](void *pointer)
+#if __cplusplus < 201103L
+  throw()
+#else
+  noexcept
+#endif
+{
+  countedFree(pointer);
+}
+
+#if __cplusplus >= 201402L
+void operator delete(void *pointer, std::size_t) noexcept
+{
+  countedFree(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept
+{
+  countedFree(pointer);
+}
+#endif
+#endif
+
+namespace {
+
+unsigned long long seed = 1234567;
+
+unsigned long long nextRandom()
+{
+  seed = 6364136223846793005ULL * seed + 1442695040888963407ULL;
+  return seed >> 33;
+}
+
+double randomValue()
+{
+  return static_cast< double >(nextRandom() % 1000000) / 1000000.0 - 0.5;
+}
+
+int maximumPivots = 100;
+int numberUpdates = 200;
+int denseLimit = 2000;
+
+/* Basic variables in pivot order - structurals are 0 to numberColumns-1
+   and slack for row i is numberColumns+i.
+*/
+typedef std::vector< int > Basis;
+
+// One update - variable coming in and variable going out
+struct Update {
+  int in;
+  int out;
+};
+
+/* Factorizes basis with CoinFactorization.  On success basis is reordered
+   so basis[i] is variable in pivot position i.  Returns status.
+*/
+int factorBasis(CoinFactorization &factorization, const CoinPackedMatrix &matrix,
+  Basis &basis)
+{
+  const int numberRows = matrix.getNumRows();
+  const int numberColumns = matrix.getNumCols();
+  std::vector< int > rowIsBasic(numberRows, -1);
+  std::vector< int > columnIsBasic(numberColumns, -1);
+  for (int i = 0; i < numberRows; i++) {
+    int iSequence = basis[i];
+    if (iSequence < numberColumns)
+      columnIsBasic[iSequence] = 1;
+    else
+      rowIsBasic[iSequence - numberColumns] = 1;
+  }
+  const std::vector< int > saveRows(rowIsBasic);
+  const std::vector< int > saveColumns(columnIsBasic);
+  double areaFactor = 0.0;
+  int status;
+  // more space until there is enough (as a simplex code would)
+  while (true) {
+    status = factorization.factorize(matrix, &rowIsBasic[0], &columnIsBasic[0],
+      areaFactor);
+    if (status != -99 || areaFactor > 100.0)
+      break;
+    areaFactor = areaFactor ? 2.0 * areaFactor : 2.0;
+    rowIsBasic = saveRows;
+    columnIsBasic = saveColumns;
+  }
+  if (!status) {
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+      if (columnIsBasic[iColumn] >= 0)
+        basis[columnIsBasic[iColumn]] = iColumn;
+    }
+    for (int iRow = 0; iRow < numberRows; iRow++) {
+      if (rowIsBasic[iRow] >= 0)
+        basis[rowIsBasic[iRow]] = iRow + numberColumns;
+    }
+  }
+  return status;
+}
+
+/* Factorizes basis with a CoinOtherFactorization - filling in its areas
+   as CoinOslFactorization::factorize does.  On success basis is reordered
+   so basis[i] is variable in pivot position i.  Returns status.
+*/
+int factorBasis(CoinOtherFactorization &factorization, const CoinPackedMatrix &matrix,
+  Basis &basis)
+{
+  const int numberRows = matrix.getNumRows();
+  const int numberColumns = matrix.getNumCols();
+  const CoinBigIndex *columnStart = matrix.getVectorStarts();
+  const int *columnLength = matrix.getVectorLengths();
+  const int *row = matrix.getIndices();
+  const double *element = matrix.getElements();
+  CoinBigIndex numberElements = 0;
+  for (int i = 0; i < numberRows; i++) {
+    int iSequence = basis[i];
+    numberElements += (iSequence < numberColumns) ? columnLength[iSequence] : 1;
+  }
+  numberElements = 3 * numberRows + 3 * numberElements + 20000;
+  factorization.setUsefulInformation(&numberRows, 0);
+  factorization.getAreas(numberRows, numberRows, numberElements,
+    2 * numberElements);
+  CoinFactorizationDouble *elementU = factorization.elements();
+  int *indexRowU = factorization.indices();
+  CoinBigIndex *startColumnU = factorization.starts();
+  int *numberInRow = factorization.numberInRow();
+  int *numberInColumn = factorization.numberInColumn();
+  CoinZeroN(numberInRow, numberRows);
+  CoinZeroN(numberInColumn, numberRows);
+  numberElements = 0;
+  for (int i = 0; i < numberRows; i++) {
+    int iSequence = basis[i];
+    startColumnU[i] = numberElements;
+    if (iSequence < numberColumns) {
+      for (CoinBigIndex j = columnStart[iSequence];
+           j < columnStart[iSequence] + columnLength[iSequence]; j++) {
+        int iRow = row[j];
+        numberInRow[iRow]++;
+        indexRowU[numberElements] = iRow;
+        elementU[numberElements++] = element[j];
+      }
+      numberInColumn[i] = columnLength[iSequence];
+    } else {
+      int iRow = iSequence - numberColumns;
+      numberInRow[iRow]++;
+      indexRowU[numberElements] = iRow;
+      elementU[numberElements++] = -1.0;
+      numberInColumn[i] = 1;
+    }
+  }
+  startColumnU[numberRows] = numberElements;
+  factorization.preProcess();
+  factorization.factor();
+  int status = factorization.status();
+  if (!status) {
+    const Basis sequence(basis);
+    factorization.postProcess(&sequence[0], &basis[0]);
+  }
+  return status;
+}
+
+int numberInFactorization(const CoinFactorization &factorization)
+{
+  return factorization.numberElementsL() + factorization.numberElementsU();
+}
+
+int numberInFactorization(const CoinOtherFactorization &factorization)
+{
+  return static_cast< int >(factorization.numberElements());
+}
+
+int replace(CoinFactorization &factorization, CoinIndexedVector &work,
+  CoinIndexedVector &, int, int pivotRow, double pivotValue)
+{
+  return factorization.replaceColumn(&work, pivotRow, pivotValue);
+}
+
+/* As a simplex code would - CoinOslFactorization wants to know what is
+   coming in and some want column from FTRAN rather than work region.
+*/
+int replace(CoinOtherFactorization &factorization, CoinIndexedVector &work,
+  CoinIndexedVector &column, int sequenceIn, int pivotRow, double pivotValue)
+{
+  int info[2] = { factorization.pivots(), sequenceIn };
+  factorization.setUsefulInformation(info, 1);
+  CoinIndexedVector *region = factorization.wantsTableauColumn() ? &column : &work;
+  return factorization.replaceColumn(region, pivotRow, pivotValue);
+}
+
+// Variable as packed vector (as CoinOslFactorization::updateColumnFT wants)
+void unpack(const CoinPackedMatrix &matrix, int iSequence,
+  CoinIndexedVector &vector)
+{
+  const int numberColumns = matrix.getNumCols();
+  if (iSequence < numberColumns) {
+    const CoinBigIndex start = matrix.getVectorFirst(iSequence);
+    vector.createPacked(matrix.getVectorSize(iSequence),
+      matrix.getIndices() + start, matrix.getElements() + start);
+  } else {
+    int iRow = iSequence - numberColumns;
+    double value = -1.0;
+    vector.createPacked(1, &iRow, &value);
+  }
+}
+
+// Value in packed vector for index (zero if not there)
+double packedValue(const CoinIndexedVector &vector, int index)
+{
+  for (int i = 0; i < vector.getNumElements(); i++) {
+    if (vector.getIndices()[i] == index)
+      return vector.denseVector()[i];
+  }
+  return 0.0;
+}
+
+// Largest |B*x-b| (FTRAN) or |B'*x-b| (BTRAN) relative to largest b
+double residual(const CoinPackedMatrix &matrix, const Basis &basis,
+  const std::vector< double > &rhs, const double *solution, bool transpose)
+{
+  const int numberRows = matrix.getNumRows();
+  const int numberColumns = matrix.getNumCols();
+  const int *row = matrix.getIndices();
+  const double *element = matrix.getElements();
+  std::vector< double > product(numberRows, 0.0);
+  for (int i = 0; i < numberRows; i++) {
+    int iSequence = basis[i];
+    if (iSequence < numberColumns) {
+      const CoinBigIndex start = matrix.getVectorFirst(iSequence);
+      const CoinBigIndex end = matrix.getVectorLast(iSequence);
+      if (transpose) {
+        for (CoinBigIndex j = start; j < end; j++)
+          product[i] += element[j] * solution[row[j]];
+      } else {
+        for (CoinBigIndex j = start; j < end; j++)
+          product[row[j]] += element[j] * solution[i];
+      }
+    } else {
+      int iRow = iSequence - numberColumns;
+      if (transpose)
+        product[i] -= solution[iRow];
+      else
+        product[iRow] -= solution[i];
+    }
+  }
+  double largestError = 0.0;
+  double largest = 1.0e-100;
+  for (int i = 0; i < numberRows; i++) {
+    largestError = CoinMax(largestError, fabs(product[i] - rhs[i]));
+    largest = CoinMax(largest, fabs(rhs[i]));
+  }
+  return largestError / largest;
+}
+
+/* Replays updates from basis and prints one line.  heapCounted false if
+   implementation gets its memory with malloc.
+*/
+template < class Factorization >
+void replay(Factorization &factorization, const char *method,
+  bool heapCounted, const char *problem, const char *start,
+  const CoinPackedMatrix &matrix, Basis basis,
+  const std::vector< Update > &updates)
+{
+  const int numberRows = matrix.getNumRows();
+  const int numberColumns = matrix.getNumCols();
+#ifndef COIN_BENCH_COUNT_HEAP
+  heapCounted = false;
+#endif
+  const size_t heapBase = heapInUse;
+  heapPeak = heapInUse;
+  std::vector< int > position(numberColumns + numberRows, -1);
+  int numberFactorizations = 0;
+  int numberForced = 0;
+  double factorTime = 0.0;
+  double ftranTime = 0.0;
+  double btranTime = 0.0;
+  double updateTime = 0.0;
+  int numberReplaced = 0;
+  int basisElements = 0;
+  int factorElements = 0;
+  double ftranError = 0.0;
+  double btranError = 0.0;
+  int status = 0;
+  bool refactorize = true;
+  CoinIndexedVector work(numberRows + maximumPivots + 1);
+  CoinIndexedVector column(numberRows + maximumPivots + 1);
+  std::vector< double > rhs(numberRows);
+  std::vector< double > solution(numberRows);
+  std::vector< int > allRows(numberRows);
+  for (int i = 0; i < numberRows; i++)
+    allRows[i] = i;
+  for (size_t k = 0; k <= updates.size(); k++) {
+    if (refactorize) {
+      double startTime = CoinCpuTime();
+      status = factorBasis(factorization, matrix, basis);
+      factorTime += CoinCpuTime() - startTime;
+      numberFactorizations++;
+      if (status)
+        break;
+      std::fill(position.begin(), position.end(), -1);
+      basisElements = 0;
+      for (int i = 0; i < numberRows; i++) {
+        position[basis[i]] = i;
+        basisElements += (basis[i] < numberColumns) ? matrix.getVectorSize(basis[i]) : 1;
+      }
+      factorElements = numberInFactorization(factorization);
+      refactorize = false;
+    }
+    // dense FTRAN and BTRAN
+    for (int i = 0; i < numberRows; i++) {
+      rhs[i] = randomValue();
+      column.insert(i, rhs[i]);
+    }
+    double startTime = CoinCpuTime();
+    factorization.updateColumn(&work, &column);
+    ftranTime += CoinCpuTime() - startTime;
+    ftranError = CoinMax(ftranError,
+      residual(matrix, basis, rhs, column.denseVector(), false));
+    column.clear();
+    // BTRAN in packed form (CoinOslFactorization only does that)
+    column.createPacked(numberRows, &allRows[0], &rhs[0]);
+    startTime = CoinCpuTime();
+    factorization.updateColumnTranspose(&work, &column);
+    btranTime += CoinCpuTime() - startTime;
+    std::fill(solution.begin(), solution.end(), 0.0);
+    for (int i = 0; i < column.getNumElements(); i++)
+      solution[column.getIndices()[i]] = column.denseVector()[i];
+    btranError = CoinMax(btranError,
+      residual(matrix, basis, rhs, &solution[0], true));
+    column.clear();
+    if (k == updates.size())
+      break;
+    // update
+    const int in = updates[k].in;
+    const int pivotRow = position[updates[k].out];
+    unpack(matrix, in, column);
+    startTime = CoinCpuTime();
+    factorization.updateColumnFT(&work, &column);
+    double pivotValue = packedValue(column, pivotRow);
+    int replaceStatus = 1;
+    if (fabs(pivotValue) > 1.0e-9) {
+      replaceStatus = replace(factorization, work, column, in, pivotRow,
+        pivotValue);
+    }
+    updateTime += CoinCpuTime() - startTime;
+    work.clear();
+    column.clear();
+    numberReplaced++;
+    position[updates[k].out] = -1;
+    position[in] = pivotRow;
+    basis[pivotRow] = in;
+    if (replaceStatus) {
+      numberForced++;
+      refactorize = true;
+    } else if (factorization.pivots() >= maximumPivots) {
+      refactorize = true;
+    }
+  }
+  const int numberSolves = numberReplaced + 1;
+  printf("%s,%s,%s,%d,%d,%d,%g,%.6g,%.3f,%.3f,%.3f,%d,%d,%d,%ld,%.3g,%.3g\n",
+    problem, start, method, numberRows, basisElements, factorElements,
+    basisElements ? static_cast< double >(factorElements) / basisElements : 0.0,
+    numberFactorizations ? factorTime / numberFactorizations : 0.0,
+    1.0e6 * ftranTime / numberSolves, 1.0e6 * btranTime / numberSolves,
+    numberReplaced ? 1.0e6 * updateTime / numberReplaced : 0.0,
+    numberReplaced, numberFactorizations, numberForced,
+    heapCounted ? static_cast< long >(heapPeak - heapBase) : -1L,
+    ftranError, btranError);
+  if (status)
+    printf("# %s %s %s factorization failed with status %d\n", problem,
+      start, method, status);
+}
+
+/* Completes basis given by rowIsBasic and columnIsBasic (1 for basic) to
+   a nonsingular one by dropping dependent columns and putting in slacks.
+*/
+Basis makeNonsingular(const CoinPackedMatrix &matrix,
+  std::vector< int > rowIsBasic, std::vector< int > columnIsBasic)
+{
+  const int numberRows = matrix.getNumRows();
+  const int numberColumns = matrix.getNumCols();
+  for (int pass = 0; pass < 10; pass++) {
+    // correct count
+    int numberBasic = 0;
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+      if (columnIsBasic[iColumn] >= 0) {
+        if (numberBasic < numberRows)
+          numberBasic++;
+        else
+          columnIsBasic[iColumn] = -1;
+      }
+    }
+    for (int iRow = 0; iRow < numberRows; iRow++) {
+      if (rowIsBasic[iRow] >= 0)
+        numberBasic++;
+    }
+    for (int iRow = 0; iRow < numberRows && numberBasic > numberRows; iRow++) {
+      if (rowIsBasic[iRow] >= 0) {
+        rowIsBasic[iRow] = -1;
+        numberBasic--;
+      }
+    }
+    for (int iRow = 0; iRow < numberRows && numberBasic < numberRows; iRow++) {
+      if (rowIsBasic[iRow] < 0) {
+        rowIsBasic[iRow] = 1;
+        numberBasic++;
+      }
+    }
+    CoinFactorization factorization;
+    std::vector< int > rows(rowIsBasic), columns(columnIsBasic);
+    int status = factorization.factorize(matrix, &rows[0], &columns[0], 4.0);
+    if (status != -1)
+      break;
+    const int *permute = factorization.permute();
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+      if (columns[iColumn] < 0)
+        columnIsBasic[iColumn] = -1;
+    }
+    for (int iRow = 0; iRow < numberRows; iRow++) {
+      if (rows[iRow] < 0)
+        rowIsBasic[iRow] = -1;
+      if (permute[iRow] < 0)
+        rowIsBasic[iRow] = 1;
+    }
+  }
+  Basis basis;
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    if (columnIsBasic[iColumn] >= 0)
+      basis.push_back(iColumn);
+  }
+  for (int iRow = 0; iRow < numberRows; iRow++) {
+    if (rowIsBasic[iRow] >= 0)
+      basis.push_back(iRow + numberColumns);
+  }
+  return basis;
+}
+
+Basis fromWarmStart(const CoinPackedMatrix &matrix,
+  const CoinWarmStartBasis &warmStart)
+{
+  const int numberRows = matrix.getNumRows();
+  const int numberColumns = matrix.getNumCols();
+  std::vector< int > rowIsBasic(numberRows, -1);
+  std::vector< int > columnIsBasic(numberColumns, -1);
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    if (warmStart.getStructStatus(iColumn) == CoinWarmStartBasis::basic)
+      columnIsBasic[iColumn] = 1;
+  }
+  for (int iRow = 0; iRow < numberRows; iRow++) {
+    if (warmStart.getArtifStatus(iRow) == CoinWarmStartBasis::basic)
+      rowIsBasic[iRow] = 1;
+  }
+  return makeNonsingular(matrix, rowIsBasic, columnIsBasic);
+}
+
+/* Triangular crash - shortest columns first, each taking the uncovered
+   row where it has its largest element if that is not too small.
+*/
+Basis crash(const CoinPackedMatrix &matrix)
+{
+  const int numberRows = matrix.getNumRows();
+  const int numberColumns = matrix.getNumCols();
+  const int *row = matrix.getIndices();
+  const double *element = matrix.getElements();
+  std::vector< int > rowIsBasic(numberRows, 1);
+  std::vector< int > columnIsBasic(numberColumns, -1);
+  std::vector< std::pair< int, int > > order;
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    if (matrix.getVectorSize(iColumn))
+      order.push_back(std::pair< int, int >(matrix.getVectorSize(iColumn), iColumn));
+  }
+  std::sort(order.begin(), order.end());
+  for (size_t k = 0; k < order.size(); k++) {
+    int iColumn = order[k].second;
+    double largest = 0.0;
+    double largestFree = 0.0;
+    int pivotRow = -1;
+    for (CoinBigIndex j = matrix.getVectorFirst(iColumn); j < matrix.getVectorLast(iColumn); j++) {
+      double value = fabs(element[j]);
+      largest = CoinMax(largest, value);
+      if (rowIsBasic[row[j]] >= 0 && value > largestFree) {
+        largestFree = value;
+        pivotRow = row[j];
+      }
+    }
+    if (pivotRow >= 0 && largestFree >= 0.1 * largest) {
+      columnIsBasic[iColumn] = 1;
+      rowIsBasic[pivotRow] = -1;
+    }
+  }
+  return makeNonsingular(matrix, rowIsBasic, columnIsBasic);
+}
+
+/* Chooses updates from basis with CoinFactorization - random nonbasic
+   column in and largest element of its FTRAN out.  Basis is left as at
+   end.
+*/
+std::vector< Update > chooseUpdates(const CoinPackedMatrix &matrix, Basis &basis)
+{
+  const int numberRows = matrix.getNumRows();
+  const int numberColumns = matrix.getNumCols();
+  std::vector< Update > updates;
+  CoinFactorization factorization;
+  factorization.maximumPivots(maximumPivots);
+  if (factorBasis(factorization, matrix, basis))
+    return updates;
+  std::vector< char > isBasic(numberColumns + numberRows, 0);
+  for (int i = 0; i < numberRows; i++)
+    isBasic[basis[i]] = 1;
+  CoinIndexedVector work(numberRows + maximumPivots + 1);
+  CoinIndexedVector column(numberRows + maximumPivots + 1);
+  for (int tries = 0; tries < 10 * numberUpdates && static_cast< int >(updates.size()) < numberUpdates; tries++) {
+    int in = static_cast< int >(nextRandom() % numberColumns);
+    if (isBasic[in] || !matrix.getVectorSize(in))
+      continue;
+    unpack(matrix, in, column);
+    factorization.updateColumnFT(&work, &column);
+    const double *packed = column.denseVector();
+    int pivotRow = -1;
+    double pivotValue = 0.0;
+    for (int i = 0; i < column.getNumElements(); i++) {
+      if (fabs(packed[i]) > CoinMax(fabs(pivotValue), 1.0e-3)) {
+        pivotValue = packed[i];
+        pivotRow = column.getIndices()[i];
+      }
+    }
+    if (pivotRow >= 0) {
+      Update update;
+      update.in = in;
+      update.out = basis[pivotRow];
+      updates.push_back(update);
+      isBasic[update.out] = 0;
+      isBasic[in] = 1;
+      basis[pivotRow] = in;
+      if (factorization.replaceColumn(&work, pivotRow, pivotValue)
+        || factorization.pivots() >= maximumPivots) {
+        if (factorBasis(factorization, matrix, basis))
+          break;
+      }
+    }
+    work.clear();
+    column.clear();
+  }
+  return updates;
+}
+
+void runBasis(const char *problem, const char *start,
+  const CoinPackedMatrix &matrix, const Basis &basis)
+{
+  Basis endBasis(basis);
+  const std::vector< Update > updates = chooseUpdates(matrix, endBasis);
+  {
+    CoinFactorization factorization;
+    factorization.maximumPivots(maximumPivots);
+    replay(factorization, "CoinFactorization", true, problem, start, matrix,
+      basis, updates);
+  }
+  if (matrix.getNumRows() <= denseLimit) {
+    CoinDenseFactorization dense;
+    dense.maximumPivots(maximumPivots);
+    replay(dense, "CoinDenseFactorization", true, problem, start, matrix,
+      basis, updates);
+    CoinSimpFactorization simp;
+    simp.maximumPivots(maximumPivots);
+    replay(simp, "CoinSimpFactorization", true, problem, start, matrix,
+      basis, updates);
+  }
+#if COIN_BIG_INDEX == 0
+  CoinOslFactorization osl;
+  osl.maximumPivots(maximumPivots);
+  replay(osl, "CoinOslFactorization", false, problem, start, matrix, basis,
+    updates);
+#endif
+}
+
+void runProblem(const char *problem, const CoinPackedMatrix &matrix,
+  const CoinWarmStartBasis *warmStart)
+{
+  const int numberRows = matrix.getNumRows();
+  const int numberColumns = matrix.getNumCols();
+  Basis slack;
+  for (int iRow = 0; iRow < numberRows; iRow++)
+    slack.push_back(iRow + numberColumns);
+  runBasis(problem, "slack", matrix, slack);
+  Basis crashBasis = crash(matrix);
+  runBasis(problem, "crash", matrix, crashBasis);
+  Basis recorded;
+  if (warmStart) {
+    recorded = fromWarmStart(matrix, *warmStart);
+  } else {
+    // basis reached by updates recorded in a CoinWarmStartBasis
+    chooseUpdates(matrix, crashBasis);
+    CoinWarmStartBasis reached;
+    reached.setSize(numberColumns, numberRows);
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+      reached.setStructStatus(iColumn, CoinWarmStartBasis::atLowerBound);
+    for (int iRow = 0; iRow < numberRows; iRow++)
+      reached.setArtifStatus(iRow, CoinWarmStartBasis::atLowerBound);
+    for (int i = 0; i < numberRows; i++) {
+      int iSequence = crashBasis[i];
+      if (iSequence < numberColumns)
+        reached.setStructStatus(iSequence, CoinWarmStartBasis::basic);
+      else
+        reached.setArtifStatus(iSequence - numberColumns, CoinWarmStartBasis::basic);
+    }
+    recorded = fromWarmStart(matrix, reached);
+  }
+  runBasis(problem, "recorded", matrix, recorded);
+}
+
+// Random sparse problem with numberRows rows and three times as many columns
+void synthetic(int numberRows, int numberPerColumn)
+{
+  std::vector< int > rows;
+  std::vector< int > columns;
+  std::vector< double > elements;
+  const int numberColumns = 3 * numberRows;
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    std::vector< char > used(numberRows, 0);
+    for (int k = 0; k < numberPerColumn; k++) {
+      int iRow = static_cast< int >(nextRandom() % numberRows);
+      if (used[iRow])
+        continue;
+      used[iRow] = 1;
+      rows.push_back(iRow);
+      columns.push_back(iColumn);
+      elements.push_back((k ? 0.5 : 1.0) + randomValue());
+    }
+  }
+  CoinPackedMatrix matrix(true, &rows[0], &columns[0], &elements[0],
+    static_cast< CoinBigIndex >(elements.size()));
+  char problem[100];
+  sprintf(problem, "random%d_%d", numberRows, numberPerColumn);
+  runProblem(problem, matrix, NULL);
+}
+
+void fromFile(const char *fileName, const char *basisName)
+{
+  CoinMpsIO model;
+  model.messageHandler()->setLogLevel(0);
+  if (model.readMps(fileName, "")) {
+    printf("# unable to read %s\n", fileName);
+    return;
+  }
+  const CoinPackedMatrix &matrix = *model.getMatrixByCol();
+  const int numberRows = matrix.getNumRows();
+  const int numberColumns = matrix.getNumCols();
+  CoinWarmStartBasis *warmStart = NULL;
+  if (basisName) {
+    std::vector< std::string > rowNames;
+    std::vector< std::string > columnNames;
+    for (int iRow = 0; iRow < numberRows; iRow++)
+      rowNames.push_back(model.rowName(iRow));
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+      columnNames.push_back(model.columnName(iColumn));
+    std::vector< unsigned char > rowStatus(numberRows);
+    std::vector< unsigned char > columnStatus(numberColumns);
+    if (model.readBasis(basisName, "", NULL, &rowStatus[0], &columnStatus[0],
+          columnNames, numberColumns, rowNames, numberRows)
+      < 0) {
+      printf("# unable to read basis %s\n", basisName);
+    } else {
+      warmStart = new CoinWarmStartBasis();
+      warmStart->setSize(numberColumns, numberRows);
+      for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+        warmStart->setStructStatus(iColumn,
+          static_cast< CoinWarmStartBasis::Status >(columnStatus[iColumn] & 3));
+      for (int iRow = 0; iRow < numberRows; iRow++)
+        warmStart->setArtifStatus(iRow,
+          static_cast< CoinWarmStartBasis::Status >(rowStatus[iRow] & 3));
+    }
+  }
+  std::string problem(fileName);
+  size_t slash = problem.find_last_of("/\\");
+  if (slash != std::string::npos)
+    problem = problem.substr(slash + 1);
+  runProblem(problem.c_str(), matrix, warmStart);
+  delete warmStart;
+}
+} // end file-local namespace
+
+int main(int argc, const char *argv[])
+{
+  const char *basisName = NULL;
+  int numberFiles = 0;
+  printf("problem,basis,method,rows,basisElements,factorElements,fill,"
+         "factorSeconds,ftran,btran,update,updates,factorizations,refactor,"
+         "peakBytes,ftranError,btranError\n");
+  for (int i = 1; i < argc; i++) {
+    if (i + 1 < argc && !strcmp(argv[i], "-pivots")) {
+      maximumPivots = atoi(argv[++i]);
+    } else if (i + 1 < argc && !strcmp(argv[i], "-updates")) {
+      numberUpdates = atoi(argv[++i]);
+    } else if (i + 1 < argc && !strcmp(argv[i], "-dense")) {
+      denseLimit = atoi(argv[++i]);
+    } else if (i + 1 < argc && !strcmp(argv[i], "-basis")) {
+      basisName = argv[++i];
+    } else {
+      fromFile(argv[i], basisName);
+      numberFiles++;
+    }
+  }
+  if (!numberFiles) {
+    synthetic(200, 4);
+    synthetic(1000, 4);
+    synthetic(5000, 3);
+  }
+  return 0;
+}
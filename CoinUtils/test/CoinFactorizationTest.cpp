@@ -0,0 +1,886 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#  pragma warning(disable:4786)
+#endif
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+#include "CoinDenseLU.hpp"
+#include "CoinFactorization.hpp"
+#include "CoinIndexedVector.hpp"
+#include "CoinOslFactorization.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "CoinParallel.hpp"
+#include "CoinSimd.hpp"
+
+namespace {
+
+unsigned int seed = 12345;
+
+double randomValue()
+{
+  seed = 1664525u * seed + 1013904223u;
+  return static_cast<double>(seed >> 8) / 16777216.0 - 0.5;
+}
+
+int randomInt(int n)
+{
+  seed = 1664525u * seed + 1013904223u;
+  return static_cast<int>((seed >> 8) % static_cast<unsigned int>(n));
+}
+
+// Square matrix with a large diagonal and numberPerColumn other entries
+CoinPackedMatrix randomBasis(int n, int numberPerColumn)
+{
+  std::vector<int> rows, columns;
+  std::vector<double> elements;
+  for (int j = 0; j < n; j++) {
+    rows.push_back(j);
+    columns.push_back(j);
+    elements.push_back(4.0 + randomValue());
+    for (int k = 0; k < numberPerColumn; k++) {
+      rows.push_back((j + 1 + (n / numberPerColumn) * k + randomInt(5)) % n);
+      columns.push_back(j);
+      elements.push_back(randomValue());
+    }
+  }
+  CoinPackedMatrix matrix(true, &rows[0], &columns[0], &elements[0],
+    static_cast<CoinBigIndex>(elements.size()));
+  return matrix;
+}
+
+// Right hand side with number entries (all if number >= n)
+void randomVector(CoinIndexedVector &vector, int n, int number, bool packed)
+{
+  std::vector<int> index;
+  std::vector<double> value;
+  std::vector<char> used(n, 0);
+  for (int i = 0; i < number && i < n; i++) {
+    int iRow = (number >= n) ? i : randomInt(n);
+    if (used[iRow])
+      continue;
+    used[iRow] = 1;
+    index.push_back(iRow);
+    value.push_back(randomValue());
+  }
+  vector.clear();
+  if (packed) {
+    vector.createPacked(static_cast<int>(index.size()), &index[0], &value[0]);
+  } else {
+    for (size_t i = 0; i < index.size(); i++)
+      vector.insert(index[i], value[i]);
+  }
+}
+
+// Returns vector as full array and checks it is tidy
+std::vector<double> fullVector(const CoinIndexedVector &vector, int n, bool packed)
+{
+  std::vector<double> full(n, 0.0);
+  const double *dense = vector.denseVector();
+  const int *index = vector.getIndices();
+  int number = vector.getNumElements();
+  assert( vector.packedMode() == (packed && number > 0) );
+  for (int i = 0; i < number; i++) {
+    int iRow = index[i];
+    assert( iRow >= 0 && iRow < n );
+    assert( !full[iRow] );
+    full[iRow] = packed ? dense[i] : dense[iRow];
+    assert( full[iRow] );
+  }
+  if (!packed) {
+    for (int i = 0; i < n; i++)
+      assert( dense[i] == full[i] );
+  }
+  return full;
+}
+
+bool sameVector(const std::vector<double> &a, const std::vector<double> &b)
+{
+  for (size_t i = 0; i < a.size(); i++) {
+    if (fabs(a[i] - b[i]) > 1.0e-9 * (1.0 + fabs(a[i])))
+      return false;
+  }
+  return true;
+}
+
+// Several columns at once must give what one at a time gives
+void testManyColumns(CoinFactorization &factorization, int n)
+{
+  const int numberRegions = 12;
+  const int capacity = n + factorization.maximumPivots() + 1;
+  CoinIndexedVector work;
+  work.reserve(capacity);
+  std::vector<CoinIndexedVector> regions(numberRegions);
+  std::vector<CoinIndexedVector *> pointers(numberRegions);
+  for (int transpose = 0; transpose < 2; transpose++) {
+    std::vector<std::vector<double> > expected(numberRegions);
+    unsigned int saveSeed = seed;
+    for (int k = 0; k < numberRegions; k++) {
+      regions[k].reserve(capacity);
+      // half dense, half with a few entries, some packed
+      randomVector(regions[k], n, (k & 1) ? 3 : n, (k % 3) == 0);
+      if (transpose)
+        factorization.updateColumnTranspose(&work, &regions[k]);
+      else
+        factorization.updateColumn(&work, &regions[k]);
+      expected[k] = fullVector(regions[k], n, (k % 3) == 0);
+    }
+    for (int strategy = 0; strategy < 3; strategy++) {
+      for (int numberThreads = 1; numberThreads <= 4; numberThreads += 3) {
+        seed = saveSeed;
+        for (int k = 0; k < numberRegions; k++) {
+          randomVector(regions[k], n, (k & 1) ? 3 : n, (k % 3) == 0);
+          pointers[k] = &regions[k];
+        }
+        if (transpose)
+          factorization.updateColumnsTranspose(&work, &pointers[0],
+            numberRegions, strategy, numberThreads);
+        else
+          factorization.updateColumns(&work, &pointers[0], numberRegions,
+            strategy, numberThreads);
+        for (int k = 0; k < numberRegions; k++)
+          assert( sameVector(fullVector(regions[k], n, (k % 3) == 0), expected[k]) );
+        // work region must be left clean
+        assert( !work.getNumElements() );
+        for (int i = 0; i < capacity; i++)
+          assert( !work.denseVector()[i] );
+      }
+    }
+  }
+}
+
+// Same answers (to the last bit) must come with reach sets kept
+bool identical(const CoinIndexedVector &a, const CoinIndexedVector &b, int n)
+{
+  if (a.getNumElements() != b.getNumElements())
+    return false;
+  for (int i = 0; i < a.getNumElements(); i++) {
+    if (a.getIndices()[i] != b.getIndices()[i])
+      return false;
+  }
+  for (int i = 0; i < n; i++) {
+    if (a.denseVector()[i] != b.denseVector()[i])
+      return false;
+  }
+  return true;
+}
+
+void testReachCache(const CoinPackedMatrix &matrix, int n)
+{
+  CoinFactorization plain;
+  CoinFactorization cached;
+  std::vector<int> rowIsBasic(n, -1), columnIsBasic(n, 1);
+  assert( !plain.factorize(matrix, &rowIsBasic[0], &columnIsBasic[0]) );
+  rowIsBasic.assign(n, -1);
+  columnIsBasic.assign(n, 1);
+  assert( !cached.factorize(matrix, &rowIsBasic[0], &columnIsBasic[0]) );
+  plain.goSparse();
+  cached.goSparse();
+  assert( plain.sparseThreshold() && !cached.reachCache() );
+  cached.setReachCache(8);
+  assert( cached.reachCache() == 8 );
+  const int capacity = n + plain.maximumPivots() + 1;
+  CoinIndexedVector work, a, b;
+  work.reserve(capacity);
+  a.reserve(capacity);
+  b.reserve(capacity);
+  // more patterns than are kept (each may need a set for L and for U)
+  const int numberPatterns = 6;
+  std::vector<std::vector<int> > patterns(numberPatterns);
+  for (int k = 0; k < numberPatterns; k++) {
+    for (int i = 0; i < 1 + k % 3; i++) {
+      int iRow = randomInt(n);
+      bool used = false;
+      for (size_t j = 0; j < patterns[k].size(); j++)
+        used = used || patterns[k][j] == iRow;
+      if (!used)
+        patterns[k].push_back(iRow);
+    }
+  }
+  for (int pass = 0; pass < 4; pass++) {
+    int hits = cached.reachCacheHits();
+    for (int k = 0; k < 40; k++) {
+      // first few patterns over and over then all
+      const std::vector<int> &pattern =
+        patterns[k < 20 ? k % 3 : (k * 5 + pass) % numberPatterns];
+      for (size_t i = 0; i < pattern.size(); i++) {
+        double value = randomValue();
+        a.insert(pattern[i], value);
+        b.insert(pattern[i], value);
+      }
+      plain.updateColumn(&work, &a);
+      cached.updateColumn(&work, &b);
+      assert( identical(a, b, capacity) );
+      a.clear();
+      b.clear();
+    }
+    assert( cached.reachCacheHits() > hits );
+    // new column in basis (invalidates sets for U)
+    for (int k = 0; k < 5; k++) {
+      int iRow = randomInt(n);
+      if (!a.denseVector()[iRow]) {
+        double value = randomValue();
+        a.insert(iRow, value);
+        b.insert(iRow, value);
+      }
+    }
+    plain.updateColumnFT(&work, &a);
+    cached.updateColumnFT(&work, &b);
+    assert( identical(a, b, capacity) );
+    int pivotRow = a.getIndices()[0];
+    for (int i = 1; i < a.getNumElements(); i++) {
+      int iRow = a.getIndices()[i];
+      if (fabs(a.denseVector()[iRow]) > fabs(a.denseVector()[pivotRow]))
+        pivotRow = iRow;
+    }
+    assert( !plain.replaceColumn(&work, pivotRow, a.denseVector()[pivotRow]) );
+    assert( !cached.replaceColumn(&work, pivotRow, b.denseVector()[pivotRow]) );
+    work.clear();
+    a.clear();
+    b.clear();
+  }
+  assert( cached.reachCacheMisses() > 0 );
+  assert( !plain.reachCacheHits() && !plain.reachCacheMisses() );
+  // a copy keeps what it has found
+  CoinFactorization copyPlain(plain);
+  CoinFactorization copy(cached);
+  int hits = copy.reachCacheHits();
+  for (int k = 0; k < 2; k++) {
+    for (size_t i = 0; i < patterns[0].size(); i++) {
+      double value = randomValue();
+      a.insert(patterns[0][i], value);
+      b.insert(patterns[0][i], value);
+    }
+    copyPlain.updateColumn(&work, &a);
+    copy.updateColumn(&work, &b);
+    assert( identical(a, b, capacity) );
+    a.clear();
+    b.clear();
+  }
+  assert( copy.reachCacheHits() > hits );
+  // and refactorizing starts again
+  rowIsBasic.assign(n, -1);
+  columnIsBasic.assign(n, 1);
+  assert( !copy.factorize(matrix, &rowIsBasic[0], &columnIsBasic[0]) );
+  copy.goSparse();
+  copy.resetStatistics();
+  assert( !copy.reachCacheHits() && !copy.reachCacheMisses() );
+  for (size_t i = 0; i < patterns[0].size(); i++)
+    b.insert(patterns[0][i], randomValue());
+  copy.updateColumn(&work, &b);
+  assert( !copy.reachCacheHits() && copy.reachCacheMisses() );
+  b.clear();
+  copy.setReachCache(0);
+  assert( !copy.reachCache() );
+}
+
+// Threads must give exactly the same factorization
+void testThreads(const CoinPackedMatrix &matrix, int n)
+{
+  for (int dense = 0; dense < 2; dense++) {
+    CoinFactorization one;
+    CoinFactorization several;
+    several.setNumberThreads(4);
+    assert( several.numberThreads() == 4 );
+    if (!dense) {
+      // so large pivots are done by sparse code
+      one.setDenseThreshold(0);
+      several.setDenseThreshold(0);
+    }
+    // lots of fill so give more room
+    std::vector<int> rowIsBasic(n, -1), columnIsBasic(n, 1);
+    assert( !one.factorize(matrix, &rowIsBasic[0], &columnIsBasic[0], 20.0) );
+    rowIsBasic.assign(n, -1);
+    columnIsBasic.assign(n, 1);
+    assert( !several.factorize(matrix, &rowIsBasic[0], &columnIsBasic[0], 20.0) );
+    assert( one.numberElementsL() == several.numberElementsL() );
+    assert( one.numberElementsU() == several.numberElementsU() );
+    for (int i = 0; i < n; i++)
+      assert( one.permute()[i] == several.permute()[i] );
+    const int capacity = n + one.maximumPivots() + 1;
+    CoinIndexedVector work, a, b;
+    work.reserve(capacity);
+    a.reserve(capacity);
+    b.reserve(capacity);
+    for (int k = 0; k < 4; k++) {
+      randomVector(a, n, (k & 1) ? 5 : n, false);
+      for (int i = 0; i < a.getNumElements(); i++) {
+        int iRow = a.getIndices()[i];
+        b.insert(iRow, a.denseVector()[iRow]);
+      }
+      if (k < 2) {
+        one.updateColumn(&work, &a);
+        several.updateColumn(&work, &b);
+      } else {
+        one.updateColumnTranspose(&work, &a);
+        several.updateColumnTranspose(&work, &b);
+      }
+      assert( identical(a, b, capacity) );
+      a.clear();
+      b.clear();
+    }
+  }
+}
+
+/* Block triangular matrix with numberBlocks blocks of size each (with rows
+   and columns shuffled).  Each block is strongly connected and its columns
+   have entries in rows of earlier blocks.
+*/
+CoinPackedMatrix blockBasis(int numberBlocks, int size)
+{
+  const int n = numberBlocks * size;
+  std::vector<int> rowShuffle(n), columnShuffle(n);
+  for (int i = 0; i < n; i++) {
+    rowShuffle[i] = i;
+    columnShuffle[i] = i;
+  }
+  for (int i = n - 1; i > 0; i--) {
+    std::swap(rowShuffle[i], rowShuffle[randomInt(i + 1)]);
+    std::swap(columnShuffle[i], columnShuffle[randomInt(i + 1)]);
+  }
+  std::vector<int> rows, columns;
+  std::vector<double> elements;
+  for (int j = 0; j < n; j++) {
+    int first = (j / size) * size;
+    std::vector<int> inColumn;
+    inColumn.push_back(j);
+    inColumn.push_back(first + (j - first + 1) % size);
+    for (int k = 0; k < 2; k++)
+      inColumn.push_back(first + randomInt(size));
+    for (int k = 0; first && k < 3; k++)
+      inColumn.push_back(randomInt(first));
+    std::vector<char> used(n, 0);
+    for (size_t k = 0; k < inColumn.size(); k++) {
+      int iRow = inColumn[k];
+      if (used[iRow])
+        continue;
+      used[iRow] = 1;
+      rows.push_back(rowShuffle[iRow]);
+      columns.push_back(columnShuffle[j]);
+      elements.push_back(iRow == j ? 4.0 + randomValue() : randomValue());
+    }
+  }
+  CoinPackedMatrix matrix(true, &rows[0], &columns[0], &elements[0],
+    static_cast<CoinBigIndex>(elements.size()));
+  return matrix;
+}
+
+// Pivoting inside diagonal blocks must solve the same equations
+void testBlockTriangular(int numberBlocks, int size)
+{
+  const int n = numberBlocks * size;
+  CoinPackedMatrix matrix = blockBasis(numberBlocks, size);
+  CoinFactorization plain;
+  CoinFactorization blocks;
+  assert( !blocks.blockTriangular() );
+  blocks.setBlockTriangular(1);
+  std::vector<int> rowIsBasic(n, -1), plainColumns(n, 1), blockColumns(n, 1);
+  assert( !plain.factorize(matrix, &rowIsBasic[0], &plainColumns[0]) );
+  rowIsBasic.assign(n, -1);
+  assert( !blocks.factorize(matrix, &rowIsBasic[0], &blockColumns[0]) );
+  assert( !plain.numberDiagonalBlocks() );
+  assert( blocks.numberDiagonalBlocks() == numberBlocks );
+  // no fill outside blocks
+  assert( blocks.numberElementsL() < plain.numberElementsL() );
+  const int capacity = n + plain.maximumPivots() + 1;
+  CoinIndexedVector work, a, b;
+  work.reserve(capacity);
+  a.reserve(capacity);
+  b.reserve(capacity);
+  for (int k = 0; k < 4; k++) {
+    randomVector(a, n, (k & 1) ? 5 : n, false);
+    for (int i = 0; i < a.getNumElements(); i++) {
+      int iRow = a.getIndices()[i];
+      b.insert(iRow, a.denseVector()[iRow]);
+    }
+    plain.updateColumn(&work, &a);
+    blocks.updateColumn(&work, &b);
+    // solutions are in order of pivots so compare by column
+    std::vector<double> x(n), y(n);
+    for (int j = 0; j < n; j++) {
+      x[j] = a.denseVector()[plainColumns[j]];
+      y[j] = b.denseVector()[blockColumns[j]];
+    }
+    assert( sameVector(x, y) );
+    a.clear();
+    b.clear();
+  }
+  // copy keeps setting
+  CoinFactorization copy(blocks);
+  assert( copy.blockTriangular() == 1 );
+  assert( copy.numberDiagonalBlocks() == numberBlocks );
+  // two columns with only the same row is structurally singular
+  std::vector<int> rows, columns;
+  std::vector<double> elements;
+  for (int j = 2; j < n; j++) {
+    for (CoinBigIndex k = matrix.getVectorFirst(j); k < matrix.getVectorLast(j); k++) {
+      rows.push_back(matrix.getIndices()[k]);
+      columns.push_back(j);
+      elements.push_back(matrix.getElements()[k]);
+    }
+  }
+  for (int j = 0; j < 2; j++) {
+    rows.push_back(0);
+    columns.push_back(j);
+    elements.push_back(2.0 + j);
+  }
+  CoinPackedMatrix singular(true, &rows[0], &columns[0], &elements[0],
+    static_cast<CoinBigIndex>(elements.size()));
+  rowIsBasic.assign(n, -1);
+  blockColumns.assign(n, 1);
+  assert( blocks.factorize(singular, &rowIsBasic[0], &blockColumns[0]) == -1 );
+  assert( !blocks.numberDiagonalBlocks() );
+}
+
+// Built in dense LU must solve both ways with panels and tiles
+void testDenseLU(int n)
+{
+  std::vector<double> matrix(n * n), a(n * n);
+  for (int i = 0; i < n * n; i++)
+    matrix[i] = randomValue();
+  a = matrix;
+  std::vector<int> pivot(n);
+  assert( !CoinDenseLUFactor(n, &a[0], n, &pivot[0]) );
+  for (int transpose = 0; transpose < 2; transpose++) {
+    std::vector<double> b(n), x(n);
+    for (int i = 0; i < n; i++)
+      b[i] = randomValue();
+    x = b;
+    CoinDenseLUSolve(transpose != 0, n, &a[0], n, &pivot[0], &x[0]);
+    for (int i = 0; i < n; i++) {
+      double value = 0.0;
+      for (int j = 0; j < n; j++)
+        value += (transpose ? matrix[i * n + j] : matrix[j * n + i]) * x[j];
+      assert( fabs(value - b[i]) < 1.0e-8 );
+    }
+  }
+  // zero column is found
+  for (int i = 0; i < n * n; i++)
+    a[i] = (i / n == 7) ? 0.0 : matrix[i];
+  assert( CoinDenseLUFactor(n, &a[0], n, &pivot[0]) == 8 );
+}
+
+/* Many updates - solves must stay right and be exactly the same with every
+   level of vector kernels
+*/
+void testManyUpdates(int n, int numberUpdates)
+{
+  CoinPackedMatrix matrix = randomBasis(n, 8);
+  CoinFactorization factorization;
+  factorization.maximumPivots(numberUpdates + 10);
+  std::vector<int> rowIsBasic(n, -1), columnIsBasic(n, 1);
+  assert( !factorization.factorize(matrix, &rowIsBasic[0], &columnIsBasic[0], 4.0) );
+  factorization.goSparse();
+  const int capacity = n + factorization.maximumPivots() + 1;
+  // column in each position
+  std::vector<std::vector<int> > inIndex(n);
+  std::vector<std::vector<double> > inValue(n);
+  for (int j = 0; j < n; j++) {
+    int iPosition = columnIsBasic[j];
+    for (CoinBigIndex k = matrix.getVectorFirst(j); k < matrix.getVectorLast(j); k++) {
+      inIndex[iPosition].push_back(matrix.getIndices()[k]);
+      inValue[iPosition].push_back(matrix.getElements()[k]);
+    }
+  }
+  CoinIndexedVector work, column;
+  work.reserve(capacity);
+  column.reserve(capacity);
+  for (int iPivot = 0; iPivot < numberUpdates; iPivot++) {
+    std::vector<int> index;
+    std::vector<double> value;
+    column.clear();
+    for (int k = 0; k < 20; k++) {
+      int iRow = randomInt(n);
+      if (!column.denseVector()[iRow]) {
+        double element = randomValue();
+        column.insert(iRow, element);
+        index.push_back(iRow);
+        value.push_back(element);
+      }
+    }
+    factorization.updateColumnFT(&work, &column);
+    const double *dense = column.denseVector();
+    int pivotRow = -1;
+    double largest = 0.0;
+    for (int i = 0; i < column.getNumElements(); i++) {
+      int iRow = column.getIndices()[i];
+      if (fabs(dense[iRow]) > largest) {
+        largest = fabs(dense[iRow]);
+        pivotRow = iRow;
+      }
+    }
+    assert( pivotRow >= 0 );
+    assert( !factorization.replaceColumn(&work, pivotRow, dense[pivotRow]) );
+    inIndex[pivotRow] = index;
+    inValue[pivotRow] = value;
+    work.clear();
+    column.clear();
+  }
+  assert( factorization.pivots() == numberUpdates );
+  // each column must come back as unit vector
+  for (int iPosition = 0; iPosition < n; iPosition++) {
+    for (size_t k = 0; k < inIndex[iPosition].size(); k++)
+      column.insert(inIndex[iPosition][k], inValue[iPosition][k]);
+    factorization.updateColumn(&work, &column);
+    const double *dense = column.denseVector();
+    for (int i = 0; i < column.getNumElements(); i++) {
+      int iRow = column.getIndices()[i];
+      assert( fabs(dense[iRow] - (iRow == iPosition ? 1.0 : 0.0)) < 1.0e-8 );
+    }
+    assert( dense[iPosition] );
+    column.clear();
+  }
+  // vector kernels must not change anything
+  int saveLevel = CoinSimdCurrentLevel;
+  CoinIndexedVector a, b;
+  a.reserve(capacity);
+  b.reserve(capacity);
+  for (int k = 0; k < 4; k++) {
+    randomVector(a, n, (k & 1) ? 5 : n, false);
+    for (int i = 0; i < a.getNumElements(); i++) {
+      int iRow = a.getIndices()[i];
+      b.insert(iRow, a.denseVector()[iRow]);
+    }
+    CoinSetSimdLevel(COIN_SIMD_SCALAR);
+    if (k < 2)
+      factorization.updateColumn(&work, &a);
+    else
+      factorization.updateColumnTranspose(&work, &a);
+    CoinSetSimdLevel(CoinSimdAvailable());
+    if (k < 2)
+      factorization.updateColumn(&work, &b);
+    else
+      factorization.updateColumnTranspose(&work, &b);
+    assert( identical(a, b, capacity) );
+    a.clear();
+    b.clear();
+  }
+  CoinSetSimdLevel(saveLevel);
+}
+
+// Solves done by threads sharing one factorization
+struct WorkspaceInfo {
+  const CoinFactorization *factorization;
+  int n;
+  int numberRegions;
+  // right hand sides and what ordinary solves give
+  const std::vector<CoinIndexedVector> *input;
+  const std::vector<CoinIndexedVector> *expected;
+  std::vector<int> *wrong;
+};
+
+void workspaceTask(void *info, int whichTask)
+{
+  const WorkspaceInfo *workspaceInfo = static_cast<const WorkspaceInfo *>(info);
+  const CoinFactorization *factorization = workspaceInfo->factorization;
+  const int capacity = workspaceInfo->n + factorization->maximumPivots() + 1;
+  CoinFactorizationWorkspace workspace;
+  CoinIndexedVector work, region;
+  work.reserve(capacity);
+  region.reserve(capacity);
+  int wrong = 0;
+  // each task does all columns several times in its own order
+  for (int pass = 0; pass < 5; pass++) {
+    for (int j = 0; j < workspaceInfo->numberRegions; j++) {
+      int k = (j * (2 * whichTask + 1) + pass) % workspaceInfo->numberRegions;
+      region = (*workspaceInfo->input)[k];
+      region.reserve(capacity);
+      if (k & 1)
+        factorization->updateColumnTranspose(&work, &region, workspace);
+      else
+        factorization->updateColumn(&work, &region, workspace);
+      if (!identical(region, (*workspaceInfo->expected)[k], capacity))
+        wrong++;
+      if (work.getNumElements())
+        wrong++;
+    }
+  }
+  (*workspaceInfo->wrong)[whichTask] = wrong;
+}
+
+void testWorkspace(const CoinPackedMatrix &matrix, int n)
+{
+  CoinFactorization factorization;
+  std::vector<int> rowIsBasic(n, -1), columnIsBasic(n, 1);
+  assert( !factorization.factorize(matrix, &rowIsBasic[0], &columnIsBasic[0]) );
+  factorization.goSparse();
+  factorization.setReachCache(8);
+  const int capacity = n + factorization.maximumPivots() + 1;
+  CoinIndexedVector work, column;
+  work.reserve(capacity);
+  column.reserve(capacity);
+  // some updates so R is used
+  for (int iPivot = 0; iPivot < 10; iPivot++) {
+    for (int k = 0; k < 6; k++) {
+      int iRow = randomInt(n);
+      if (!column.denseVector()[iRow])
+        column.insert(iRow, randomValue());
+    }
+    factorization.updateColumnFT(&work, &column);
+    const double *dense = column.denseVector();
+    int pivotRow = column.getIndices()[0];
+    for (int i = 1; i < column.getNumElements(); i++) {
+      int iRow = column.getIndices()[i];
+      if (fabs(dense[iRow]) > fabs(dense[pivotRow]))
+        pivotRow = iRow;
+    }
+    assert( !factorization.replaceColumn(&work, pivotRow, dense[pivotRow]) );
+    work.clear();
+    column.clear();
+  }
+  // odd ones are BTRAN - sparse, sparsish and dense
+  const int numberRegions = 12;
+  std::vector<CoinIndexedVector> input(numberRegions), expected(numberRegions);
+  for (int k = 0; k < numberRegions; k++) {
+    input[k].reserve(capacity);
+    randomVector(input[k], n, (k % 3 == 0) ? 2 : ((k % 3 == 1) ? 40 : n),
+      k % 4 == 3);
+    expected[k] = input[k];
+    expected[k].reserve(capacity);
+    if (k & 1)
+      factorization.updateColumnTranspose(&work, &expected[k]);
+    else
+      factorization.updateColumn(&work, &expected[k]);
+  }
+  int hits = factorization.reachCacheHits();
+  int misses = factorization.reachCacheMisses();
+  std::vector<int> wrong(4, -1);
+  WorkspaceInfo info;
+  info.factorization = &factorization;
+  info.n = n;
+  info.numberRegions = numberRegions;
+  info.input = &input;
+  info.expected = &expected;
+  info.wrong = &wrong;
+  CoinParallelRun(4, 4, workspaceTask, &info);
+  for (int i = 0; i < 4; i++)
+    assert( !wrong[i] );
+  // factorization was only read
+  assert( factorization.reachCacheHits() == hits );
+  assert( factorization.reachCacheMisses() == misses );
+  // and ordinary solves still give same
+  for (int k = 0; k < numberRegions; k++) {
+    column = input[k];
+    column.reserve(capacity);
+    if (k & 1)
+      factorization.updateColumnTranspose(&work, &column);
+    else
+      factorization.updateColumn(&work, &column);
+    assert( identical(column, expected[k], capacity) );
+  }
+}
+} // end file-local namespace
+
+//--------------------------------------------------------------------------
+void
+CoinFactorizationUnitTest(const std::string &mpsDir)
+{
+  const int n = 600;
+  CoinPackedMatrix matrix = randomBasis(n, 8);
+
+  // Several columns at once
+  {
+    CoinFactorization factorization;
+    std::vector<int> rowIsBasic(n, -1), columnIsBasic(n, 1);
+    assert( !factorization.factorize(matrix, &rowIsBasic[0], &columnIsBasic[0]) );
+    factorization.goSparse();
+    assert( factorization.sparseThreshold() );
+    testManyColumns(factorization, n);
+    // and with sparse code switched off
+    int saveThreshold = factorization.sparseThreshold();
+    factorization.sparseThreshold(0);
+    testManyColumns(factorization, n);
+    factorization.sparseThreshold(saveThreshold);
+    // and after some updates (so R is used)
+    CoinIndexedVector work, column;
+    work.reserve(n + factorization.maximumPivots() + 1);
+    column.reserve(n + factorization.maximumPivots() + 1);
+    for (int iPivot = 0; iPivot < 10; iPivot++) {
+      column.clear();
+      for (int k = 0; k < 6; k++) {
+        int iRow = randomInt(n);
+        if (!column.denseVector()[iRow])
+          column.insert(iRow, randomValue());
+      }
+      factorization.updateColumnFT(&work, &column);
+      // pivot on largest
+      const double *dense = column.denseVector();
+      int pivotRow = -1;
+      double largest = 0.0;
+      for (int i = 0; i < column.getNumElements(); i++) {
+        int iRow = column.getIndices()[i];
+        if (fabs(dense[iRow]) > largest) {
+          largest = fabs(dense[iRow]);
+          pivotRow = iRow;
+        }
+      }
+      assert( pivotRow >= 0 );
+      assert( !factorization.replaceColumn(&work, pivotRow, dense[pivotRow]) );
+      work.clear();
+      column.clear();
+    }
+    assert( factorization.pivots() == 10 );
+    testManyColumns(factorization, n);
+  }
+
+  // Reach sets kept for sparse FTRAN
+  testReachCache(randomBasis(n, 2), n);
+
+  // Factorization using threads
+  testThreads(randomBasis(n, 40), n);
+
+  // Threads solving with one factorization
+  testWorkspace(randomBasis(n, 2), n);
+
+  // Block triangular form
+  testBlockTriangular(20, 30);
+  testBlockTriangular(200, 3);
+
+  // Long run of updates
+  testManyUpdates(n, 300);
+
+  // Dense LU for when no LAPACK
+  testDenseLU(300);
+  {
+    // going dense sooner
+    CoinPackedMatrix dense = randomBasis(n, 40);
+    CoinFactorization sooner;
+    CoinFactorization later;
+    sooner.setDenseMultiplier(4.0);
+    assert( sooner.denseMultiplier() == 4.0 );
+    std::vector<int> rowIsBasic(n, -1), columnIsBasic(n, 1);
+    assert( !sooner.factorize(dense, &rowIsBasic[0], &columnIsBasic[0], 20.0) );
+    rowIsBasic.assign(n, -1);
+    columnIsBasic.assign(n, 1);
+    assert( !later.factorize(dense, &rowIsBasic[0], &columnIsBasic[0], 20.0) );
+    assert( sooner.numberDense() > later.numberDense() );
+  }
+}
+
+//--------------------------------------------------------------------------
+/* CoinOslFactorization - solves after many updates and the eta area sizes
+   from getAreas, which must also be right with a 64-bit CoinBigIndex */
+void
+CoinOslFactorizationUnitTest(const std::string &)
+{
+  const int n = 400;
+  const int numberUpdates = 60;
+  CoinPackedMatrix matrix = randomBasis(n, 6);
+  CoinOslFactorization factorization;
+  factorization.maximumPivots(numberUpdates + 10);
+  std::vector<int> rowIsBasic(n, -1), columnIsBasic(n, 1);
+  assert( !factorization.factorize(matrix, &rowIsBasic[0], &columnIsBasic[0]) );
+  const int capacity = n + numberUpdates + 11;
+  // column in each position
+  std::vector<std::vector<int> > inIndex(n);
+  std::vector<std::vector<double> > inValue(n);
+  for (int j = 0; j < n; j++) {
+    int iPosition = columnIsBasic[j];
+    for (CoinBigIndex k = matrix.getVectorFirst(j); k < matrix.getVectorLast(j); k++) {
+      inIndex[iPosition].push_back(matrix.getIndices()[k]);
+      inValue[iPosition].push_back(matrix.getElements()[k]);
+    }
+  }
+  CoinIndexedVector work, column;
+  work.reserve(capacity);
+  column.reserve(capacity);
+  for (int iPivot = 0; iPivot < numberUpdates; iPivot++) {
+    std::vector<int> index;
+    std::vector<double> value;
+    std::vector<char> used(n, 0);
+    for (int k = 0; k < 20; k++) {
+      int iRow = randomInt(n);
+      if (!used[iRow]) {
+        used[iRow] = 1;
+        index.push_back(iRow);
+        value.push_back(randomValue());
+      }
+    }
+    // updateColumnFT wants the incoming column packed
+    column.createPacked(static_cast<int>(index.size()), &index[0], &value[0]);
+    factorization.updateColumnFT(&work, &column);
+    int pivotRow = -1;
+    double pivotValue = 0.0;
+    for (int i = 0; i < column.getNumElements(); i++) {
+      if (fabs(column.denseVector()[i]) > fabs(pivotValue)) {
+        pivotValue = column.denseVector()[i];
+        pivotRow = column.getIndices()[i];
+      }
+    }
+    assert( pivotRow >= 0 );
+    int info[2] = { factorization.pivots(), n + iPivot };
+    factorization.setUsefulInformation(info, 1);
+    CoinIndexedVector *region = factorization.wantsTableauColumn() ? &column : &work;
+    assert( !factorization.replaceColumn(region, pivotRow, pivotValue) );
+    inIndex[pivotRow] = index;
+    inValue[pivotRow] = value;
+    work.clear();
+    column.clear();
+  }
+  assert( factorization.pivots() == numberUpdates );
+  // each column must come back as unit vector
+  for (int iPosition = 0; iPosition < n; iPosition++) {
+    for (size_t k = 0; k < inIndex[iPosition].size(); k++)
+      column.insert(inIndex[iPosition][k], inValue[iPosition][k]);
+    factorization.updateColumn(&work, &column);
+    const double *dense = column.denseVector();
+    for (int i = 0; i < column.getNumElements(); i++) {
+      int iRow = column.getIndices()[i];
+      assert( fabs(dense[iRow] - (iRow == iPosition ? 1.0 : 0.0)) < 1.0e-8 );
+    }
+    assert( dense[iPosition] );
+    column.clear();
+  }
+  // and BTRAN (packed) gives y with y'column = rhs for each position
+  randomVector(column, n, n, true);
+  std::vector<double> rhs = fullVector(column, n, true);
+  factorization.updateColumnTranspose(&work, &column);
+  std::vector<double> y(n, 0.0);
+  for (int i = 0; i < column.getNumElements(); i++)
+    y[column.getIndices()[i]] = column.denseVector()[i];
+  for (int iPosition = 0; iPosition < n; iPosition++) {
+    double sum = 0.0;
+    for (size_t k = 0; k < inIndex[iPosition].size(); k++)
+      sum += y[inIndex[iPosition][k]] * inValue[iPosition][k];
+    assert( fabs(sum - rhs[iPosition]) < 1.0e-8 );
+  }
+  column.clear();
+
+  // getAreas - near maxNNetas goes straight to it
+  {
+    CoinOslFactorization areas;
+    areas.factInfo_.maxNNetas = 100000;
+    areas.getAreas(100, 100, 40000, 40000);
+    assert( areas.factInfo_.eta_size == 100000 );
+    // well below grows by a tenth
+    CoinOslFactorization small;
+    small.factInfo_.maxNNetas = 100000;
+    small.getAreas(100, 100, 10000, 10000);
+    assert( small.factInfo_.eta_size == 22000 );
+    // sizes at the top of the index range are clamped, not overflowed
+    // (getAreas allocates, so keep maxNNetas small)
+    CoinOslFactorization huge;
+    huge.factInfo_.maxNNetas = 100000;
+    huge.getAreas(100, 100, COIN_BIG_INDEX_MAX, COIN_BIG_INDEX_MAX);
+    assert( huge.factInfo_.eta_size == 100000 );
+    if (sizeof(CoinBigIndex) > 4) {
+      // more than 2^32 etas asked for - must not wrap as an int would
+      CoinBigIndex large = static_cast<CoinBigIndex>(1.5 * COIN_INT_MAX);
+      CoinOslFactorization big;
+      big.factInfo_.maxNNetas = 200000;
+      big.getAreas(100, 100, large, large);
+      assert( big.factInfo_.eta_size == 200000 );
+    }
+  }
+}
@@ -66,16 +66,14 @@ CoinLpIOUnitTest(const std::string& lpDir)
                assert(!strcmp(im.names_[1][i], imC1.names_[1][i]));
             }
 
-            for (int i = 0; i < im.maxHash_[0]; i++) {
-               // check hash value for row name
-               assert(im.hash_[0][i].next  == imC1.hash_[0][i].next);
-               assert(im.hash_[0][i].index == imC1.hash_[0][i].index);
+            for (int i = 0; i < imC1.numberHash_[0]; i++) {
+               // check hash table for row name
+               assert(imC1.findHash(im.names_[0][i], 0) == i);
             }
 
-            for (int i = 0; i < im.maxHash_[1]; i++) {
-               // check hash value for column name
-               assert(im.hash_[1][i].next == imC1.hash_[1][i].next);
-               assert(im.hash_[1][i].index == imC1.hash_[1][i].index);
+            for (int i = 0; i < imC1.numberHash_[1]; i++) {
+               // check hash table for column name
+               assert(imC1.findHash(im.names_[1][i], 1) == i);
             }
 
             CoinLpIO imC2(im);
@@ -95,16 +93,14 @@ CoinLpIOUnitTest(const std::string& lpDir)
                assert(!strcmp(lhs.names_[1][i], imC2.names_[1][i]));
             }
 
-            for (int i = 0; i < imC2.maxHash_[0]; i++) {
-               // check hash value for row name
-               assert(lhs.hash_[0][i].next  == imC2.hash_[0][i].next);
-               assert(lhs.hash_[0][i].index == imC2.hash_[0][i].index);
+            for (int i = 0; i < imC2.numberHash_[0]; i++) {
+               // check hash table for row name
+               assert(lhs.findHash(imC2.names_[0][i], 0) == i);
             }
 
-            for (int i = 0; i < im.maxHash_[1]; i++) {
-               // check hash value for column name
-               assert(lhs.hash_[1][i].next == imC2.hash_[1][i].next);
-               assert(lhs.hash_[1][i].index == imC2.hash_[1][i].index);
+            for (int i = 0; i < imC2.numberHash_[1]; i++) {
+               // check hash table for column name
+               assert(lhs.findHash(imC2.names_[1][i], 1) == i);
             }
          }
          // Test that lhs has correct values even though rhs has gone out of scope
@@ -362,4 +358,49 @@ CoinLpIOUnitTest(const std::string& lpDir)
          }
       }
    }
+   // Constraints read in parallel must give the same as read serially
+   {
+      FILE *fp = fopen("CoinLpIoThreads.lp", "w");
+      assert( fp != NULL );
+      fprintf(fp, "\\ comment\nMaximize\n obj: x0 + 2 x1 - x2\nSubject To\n");
+      for (int i = 0; i < 500; i++) {
+         const char *sense = (i % 3 == 0) ? "<=" : ((i % 3 == 1) ? "=" : ">=");
+         if (i % 4 == 0)
+            fprintf(fp, " c%d : ", i);
+         else if (i % 4 == 1)
+            fprintf(fp, " r%d:", i);
+         fprintf(fp, "%g x%d - y%d\n", 1.5 + i, i % 37, i % 11);
+         if (i % 5 == 0)
+            fprintf(fp, "  / comment <= 1\n  + \n 3.25 z%d", i);
+         fprintf(fp, " + v%d %s %d\n", (i + 7) % 41, sense, i);
+      }
+      fprintf(fp, "Bounds\n x0 <= 4\n w >= -1\nIntegers\n x1 y2\nEnd\n");
+      fclose(fp);
+      CoinLpIO serial;
+      serial.readLp("CoinLpIoThreads.lp");
+      for (int numberThreads = 2; numberThreads <= 8; numberThreads *= 2) {
+         CoinLpIO m;
+         m.setNumberThreads(numberThreads);
+         assert( m.getNumberThreads() == numberThreads );
+         m.readLp("CoinLpIoThreads.lp");
+         int numberRows = serial.getNumRows();
+         int numberColumns = serial.getNumCols();
+         assert( m.getNumRows() == numberRows );
+         assert( m.getNumCols() == numberColumns );
+         for (int i = 0; i < numberRows; i++) {
+            assert( !strcmp(m.rowName(i), serial.rowName(i)) );
+            assert( m.getRowLower()[i] == serial.getRowLower()[i] );
+            assert( m.getRowUpper()[i] == serial.getRowUpper()[i] );
+         }
+         for (int i = 0; i < numberColumns; i++) {
+            assert( !strcmp(m.columnName(i), serial.columnName(i)) );
+            assert( m.getColLower()[i] == serial.getColLower()[i] );
+            assert( m.getColUpper()[i] == serial.getColUpper()[i] );
+            assert( m.getObjCoefficients()[i] == serial.getObjCoefficients()[i] );
+            assert( m.isInteger(i) == serial.isInteger(i) );
+         }
+         assert( m.getMatrixByRow()->isEquivalent(*serial.getMatrixByRow()) );
+      }
+      remove("CoinLpIoThreads.lp");
+   }
 }
@@ -12,9 +12,12 @@
 #endif
 
 #include <cassert>
+#include <cstdio>
+#include <cstring>
 
 #include "CoinMpsIO.hpp"
 #include "CoinModel.hpp"
+#include "CoinNameArena.hpp"
 #include "CoinHelperFunctions.hpp"
 #include "CoinTime.hpp"
 
@@ -503,6 +506,56 @@ CoinModelUnitTest(const std::string & mpsDir,
     }
     // write out
     model.writeMps("byColumn.mps");
+    // and as binary snapshot which should read back the same
+    int returnCode = model.writeBinary("byColumn.bin");
+    assert (!returnCode);
+    CoinModel temp("byColumn.bin");
+    assert (!model.differentModel(temp,false));
+  }
+
+  // generated style names which clash are changed when written
+  {
+    CoinModel small;
+    int column[2] = {0, 1};
+    double value[2] = {1.0, 2.0};
+    for (int i = 0; i < 3; i++)
+      small.addRow(2, column, value, 0.0, 1.0);
+    small.setRowName(2, "R0000000");
+    // column 0 has no name so would be written as C0000000
+    small.setColumnName(1, "C0000000");
+    small.setLogLevel(0);
+    small.writeMps("CoinModelUnique.mps");
+    CoinMpsIO m;
+    m.messageHandler()->setLogLevel(0);
+    assert (!m.readMps("CoinModelUnique.mps", ""));
+    assert (m.getNumCols() == 2);
+    assert (m.getNumElements() == 6);
+    assert (!strcmp(m.rowName(2), "R0000000"));
+    assert (!strcmp(m.columnName(0), "C0000000"));
+    assert (!strcmp(m.columnName(1), "C0000001"));
+  }
+
+  // renaming again and again does not keep taking more space
+  {
+    CoinModel renamed;
+    int column[1] = {0};
+    double value[1] = {1.0};
+    for (int i = 0; i < 100; i++)
+      renamed.addRow(1, column, value, 0.0, 1.0);
+    char name[20];
+    size_t mostUsed = 0;
+    for (int pass = 0; pass < 20000; pass++) {
+      // same row a few times running then others
+      int iRow = (pass / 3 * 37) % 100;
+      sprintf(name, "row%d_%d", iRow, pass);
+      renamed.setRowName(iRow, name);
+      assert (!strcmp(renamed.getRowName(iRow), name));
+      assert (renamed.row(name) == iRow);
+      mostUsed = CoinMax(mostUsed, renamed.rowNames()->arena()->bytesUsed());
+    }
+    assert (mostUsed < 8192);
+    for (int i = 0; i < 100; i++)
+      assert (renamed.row(renamed.getRowName(i)) == i);
   }
 
   // model was created by column - play around
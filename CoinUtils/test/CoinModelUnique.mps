@@ -0,0 +1,18 @@
+NAME          BLANK   
+ROWS
+ N  OBJROW
+ L  r0000000
+ L  r0000001
+ L  R0000000
+COLUMNS
+    C0000000  r0000000  1              r0000001  1           
+    C0000000  R0000000  1           
+    C0000001  r0000000  2              r0000001  2           
+    C0000001  R0000000  2           
+RHS
+    RHS       r0000000  1              r0000001  1           
+    RHS       R0000000  1           
+RANGES
+    RANGE     r0000000  1              r0000001  1           
+    RANGE     R0000000  1           
+ENDATA
@@ -12,12 +12,73 @@
 #endif
 
 #include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <vector>
 
 #include "CoinMpsIO.hpp"
 #include "CoinFloatEqual.hpp"
+#include "CoinStrtod.hpp"
+#include "CoinDtoa.hpp"
+#include "CoinNameArena.hpp"
+#include "CoinNameHash.hpp"
 
 //#############################################################################
 
+// Generates columns of a banded model without storing them
+class CoinMpsTestColumns : public CoinMpsColumnSource {
+public:
+  CoinMpsTestColumns(int numberRows, int numberColumns)
+    : numberRows_(numberRows), numberColumns_(numberColumns) {}
+  virtual int numberColumns() const { return numberColumns_; }
+  virtual int getColumn(int iColumn, int *rows, double *elements)
+  {
+    if (iColumn % 10 == 9)
+      return 0;
+    // out of order on purpose
+    rows[0] = (iColumn + 1) % numberRows_;
+    elements[0] = -1.0;
+    rows[1] = iColumn % numberRows_;
+    elements[1] = 1.0 + iColumn % 3;
+    return 2;
+  }
+  virtual void getColumnData(int iColumn, double &lower, double &upper,
+    double &objective, char &type)
+  {
+    lower = 0.0;
+    upper = (iColumn % 4) ? COIN_DBL_MAX : 5.0;
+    objective = (iColumn % 10 == 9) ? 0.0 : 0.5;
+    type = static_cast< char >(iColumn % 7 == 0);
+  }
+  virtual const char *columnName(int iColumn)
+  {
+    if (iColumn % 2)
+      return NULL;
+    sprintf(name_, "named%d", iColumn);
+    return name_;
+  }
+private:
+  int numberRows_;
+  int numberColumns_;
+  char name_[20];
+};
+
+// Whole file as a string
+static std::string
+fileContents(const char *fileName)
+{
+  std::string contents;
+  FILE *fp = fopen(fileName, "r");
+  if (fp) {
+    char buffer[4096];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), fp)) > 0)
+      contents.append(buffer, n);
+    fclose(fp);
+  }
+  return contents;
+}
+
 //--------------------------------------------------------------------------
 // test import methods
 void
@@ -397,7 +458,7 @@ CoinMpsIOUnitTest(const std::string & mpsDir)
 			assert (weights[1] == 40);
 		}
 
-		int * columnStart = NULL;
+		CoinBigIndex * columnStart = NULL;
 		int * columnIdx = NULL;
 		double * elements = NULL;
 		status = m_MpsData.readQuadraticMps(NULL, columnStart, columnIdx, elements, 0);
@@ -646,5 +707,590 @@ CoinMpsIOUnitTest(const std::string & mpsDir)
 #endif
   }
 
+  // Test reading COLUMNS section with several threads gives same answer
+  {
+    const int numberRows = 150;
+    const int numberColumns = 400;
+    std::vector< int > rows;
+    std::vector< int > columns;
+    std::vector< double > elements;
+    unsigned int seed = 12345;
+    for (int j = 0; j < numberColumns; j++) {
+      for (int k = 0; k < 1 + j % 7; k++) {
+        seed = 1664525 * seed + 1013904223;
+        rows.push_back(static_cast< int >((seed >> 8) % numberRows));
+        columns.push_back(j);
+        elements.push_back(static_cast< double >(seed % 100000) / 7.0 - 5000.0);
+      }
+    }
+    CoinPackedMatrix matrix(true, &rows[0], &columns[0], &elements[0],
+      static_cast< CoinBigIndex >(elements.size()));
+    std::vector< double > collb(numberColumns, 0.0);
+    std::vector< double > colub(numberColumns, 10.0);
+    std::vector< double > obj(numberColumns);
+    std::vector< char > integrality(numberColumns, 0);
+    std::vector< std::string > colnames(numberColumns);
+    for (int j = 0; j < numberColumns; j++) {
+      char name[40];
+      // one long name part way through switches off embedded blanks
+      if (j == 250)
+        sprintf(name, "LONGCOLUMNNAME%d", j);
+      else
+        sprintf(name, "C%d", j);
+      colnames[j] = name;
+      obj[j] = 1.0 + j % 13;
+      integrality[j] = static_cast< char >(j % 5 == 0);
+    }
+    std::vector< double > rowlb(numberRows, -1.0);
+    std::vector< double > rowub(numberRows, 100.0);
+    std::vector< std::string > rownames(numberRows);
+    for (int i = 0; i < numberRows; i++) {
+      char name[40];
+      sprintf(name, "R%d", i);
+      rownames[i] = name;
+    }
+    CoinMpsIO model;
+    model.setMpsData(matrix, COIN_DBL_MAX, &collb[0], &colub[0], &obj[0],
+      &integrality[0], &rowlb[0], &rowub[0], colnames, rownames);
+    model.writeMps("CoinMpsIoThreads.mps");
+
+    CoinMpsIO serial;
+    serial.messageHandler()->setLogLevel(0);
+    int numErr = serial.readMps("CoinMpsIoThreads.mps", "");
+    assert( numErr == 0 );
+    for (int numberThreads = 2; numberThreads <= 8; numberThreads *= 2) {
+      CoinMpsIO parallel;
+      parallel.messageHandler()->setLogLevel(0);
+      parallel.setNumberThreads(numberThreads);
+      assert( parallel.numberThreads() == numberThreads );
+      numErr = parallel.readMps("CoinMpsIoThreads.mps", "");
+      assert( numErr == 0 );
+      assert( parallel.getNumCols() == numberColumns );
+      assert( parallel.getNumRows() == numberRows );
+      assert( parallel.getNumElements() == serial.getNumElements() );
+      const CoinPackedMatrix *a = serial.getMatrixByCol();
+      const CoinPackedMatrix *b = parallel.getMatrixByCol();
+      assert( a->isEquivalent(*b) );
+      for (int j = 0; j < numberColumns; j++) {
+        assert( !strcmp(serial.columnName(j), parallel.columnName(j)) );
+        assert( serial.getObjCoefficients()[j] == parallel.getObjCoefficients()[j] );
+        assert( serial.getColLower()[j] == parallel.getColLower()[j] );
+        assert( serial.getColUpper()[j] == parallel.getColUpper()[j] );
+        assert( serial.isInteger(j) == parallel.isInteger(j) );
+      }
+    }
+    // and binary snapshot
+    {
+      assert( serial.writeBinary("CoinMpsIoThreads.bin") == 0 );
+      assert( CoinMpsIO::isBinaryFile("CoinMpsIoThreads.bin") );
+      assert( !CoinMpsIO::isBinaryFile("CoinMpsIoThreads.mps") );
+      CoinMpsIO binary;
+      binary.messageHandler()->setLogLevel(0);
+      numErr = binary.readBinary("CoinMpsIoThreads.bin");
+      assert( numErr == 0 );
+      assert( binary.getNumCols() == numberColumns );
+      assert( binary.getNumRows() == numberRows );
+      assert( binary.getNumElements() == serial.getNumElements() );
+      assert( serial.getMatrixByCol()->isEquivalent(*binary.getMatrixByCol()) );
+      assert( !strcmp(serial.getProblemName(), binary.getProblemName()) );
+      assert( binary.objectiveOffset() == serial.objectiveOffset() );
+      for (int i = 0; i < numberRows; i++) {
+        assert( !strcmp(serial.rowName(i), binary.rowName(i)) );
+        assert( serial.getRowLower()[i] == binary.getRowLower()[i] );
+        assert( serial.getRowUpper()[i] == binary.getRowUpper()[i] );
+      }
+      for (int j = 0; j < numberColumns; j++) {
+        assert( !strcmp(serial.columnName(j), binary.columnName(j)) );
+        assert( serial.getObjCoefficients()[j] == binary.getObjCoefficients()[j] );
+        assert( serial.getColLower()[j] == binary.getColLower()[j] );
+        assert( serial.getColUpper()[j] == binary.getColUpper()[j] );
+        assert( serial.isInteger(j) == binary.isInteger(j) );
+      }
+      // a text file is not accepted
+      CoinMpsIO notBinary;
+      notBinary.messageHandler()->setLogLevel(0);
+      assert( notBinary.readBinary("CoinMpsIoThreads.mps") == -2 );
+      // nor are damaged copies
+      std::vector< char > good;
+      FILE *fp = fopen("CoinMpsIoThreads.bin", "rb");
+      assert( fp );
+      char buffer[4096];
+      size_t n;
+      while ((n = fread(buffer, 1, sizeof(buffer), fp)) > 0)
+        good.insert(good.end(), buffer, buffer + n);
+      fclose(fp);
+      // header, then column starts and row indices each padded to 8 bytes
+      const size_t headerSize = 88;
+      const size_t offsetElements = 40;
+      size_t startSize = (numberColumns + 1) * sizeof(CoinBigIndex);
+      startSize += (8 - startSize % 8) % 8;
+      for (int kind = 0; kind < 6; kind++) {
+        std::vector< char > bad(good);
+        CoinBigIndex start[2];
+        int row;
+        if (kind == 0) {
+          // truncated
+          bad.resize(good.size() / 2);
+        } else if (kind == 1) {
+          // starts go down
+          memcpy(start, &bad[headerSize + sizeof(CoinBigIndex)], 2 * sizeof(CoinBigIndex));
+          start[0] = start[1] + 1;
+          memcpy(&bad[headerSize + sizeof(CoinBigIndex)], start, sizeof(CoinBigIndex));
+        } else if (kind == 2) {
+          // last start not number of elements
+          memcpy(start, &bad[headerSize + numberColumns * sizeof(CoinBigIndex)], sizeof(CoinBigIndex));
+          start[0]--;
+          memcpy(&bad[headerSize + numberColumns * sizeof(CoinBigIndex)], start, sizeof(CoinBigIndex));
+        } else if (kind == 3) {
+          // row out of range
+          row = numberRows;
+          memcpy(&bad[headerSize + startSize], &row, sizeof(int));
+        } else if (kind == 4) {
+          // too many elements for CoinBigIndex
+          if (sizeof(CoinBigIndex) > 4)
+            continue;
+          CoinInt64 numberElements = static_cast< CoinInt64 >(1) << 40;
+          memcpy(&bad[offsetElements], &numberElements, sizeof(CoinInt64));
+        } else {
+          // far more elements than the file has
+          CoinInt64 numberElements = COIN_INT_MAX;
+          memcpy(&bad[offsetElements], &numberElements, sizeof(CoinInt64));
+        }
+        fp = fopen("CoinMpsIoCorrupt.bin", "wb");
+        assert( fp );
+        assert( fwrite(&bad[0], 1, bad.size(), fp) == bad.size() );
+        fclose(fp);
+        CoinMpsIO corrupt;
+        corrupt.messageHandler()->setLogLevel(0);
+        assert( corrupt.readBinary("CoinMpsIoCorrupt.bin") == -3 );
+        assert( !corrupt.getNumCols() );
+        assert( !corrupt.getNumElements() );
+      }
+      // a bad header is found before the problem is freed
+      assert( binary.readBinary("CoinMpsIoCorrupt.bin") == -3 );
+      assert( binary.getNumCols() == numberColumns );
+      assert( binary.getNumElements() == serial.getNumElements() );
+    }
+    // and fixed format
+    {
+      std::string fn = mpsDir + "exmip1";
+      CoinMpsIO fixed1;
+      fixed1.messageHandler()->setLogLevel(0);
+      numErr = fixed1.readMps(fn.c_str(), "mps");
+      assert( numErr == 0 );
+      CoinMpsIO fixed2;
+      fixed2.messageHandler()->setLogLevel(0);
+      fixed2.setNumberThreads(2);
+      numErr = fixed2.readMps(fn.c_str(), "mps");
+      assert( numErr == 0 );
+      assert( fixed1.getMatrixByCol()->isEquivalent(*fixed2.getMatrixByCol()) );
+      for (int j = 0; j < fixed1.getNumCols(); j++) {
+        assert( !strcmp(fixed1.columnName(j), fixed2.columnName(j)) );
+        assert( fixed1.getObjCoefficients()[j] == fixed2.getObjCoefficients()[j] );
+        assert( fixed1.isInteger(j) == fixed2.isInteger(j) );
+      }
+    }
+    // and with errors
+    {
+      FILE *fp = fopen("CoinMpsIoThreads2.mps", "w");
+      fprintf(fp, "NAME          BAD\nROWS\n N  OBJ\n L  R1\n");
+      fprintf(fp, "COLUMNS\n    X1        OBJ                1.   R1                 1.\n");
+      fprintf(fp, "* comment\n    X2        OBJ                1.   R9                 1.\n");
+      fprintf(fp, "    X2        R1                 1.   R1                 2.\n");
+      fprintf(fp, "RHS\n    RHS       R1                 1.\nENDATA\n");
+      fclose(fp);
+      CoinMpsIO good;
+      good.messageHandler()->setLogLevel(0);
+      int serialErr = good.readMps("CoinMpsIoThreads2.mps", "");
+      CoinMpsIO bad;
+      bad.messageHandler()->setLogLevel(0);
+      bad.setNumberThreads(3);
+      int parallelErr = bad.readMps("CoinMpsIoThreads2.mps", "");
+      assert( serialErr == 2 );
+      assert( parallelErr == serialErr );
+      assert( bad.getNumCols() == 2 );
+      assert( bad.getNumElements() == 2 );
+    }
+  }
+
+  // Test file input gives same lines as fgets (mapped or not)
+  {
+    CoinFileInput *input = CoinFileInput::create("CoinMpsIoThreads.mps");
+    FILE *fp = fopen("CoinMpsIoThreads.mps", "r");
+    char line1[100];
+    char line2[100];
+    int numberLines = 0;
+    while (true) {
+      // short buffer so long lines get split
+      char *got1 = fgets(line1, 20, fp);
+      char *got2;
+      int length;
+      const char *inPlace = input->getsInPlace(20, length);
+      if (inPlace) {
+        memcpy(line2, inPlace, length);
+        line2[length] = '\0';
+        got2 = line2;
+      } else if (length < 0) {
+        got2 = input->gets(line2, 20);
+      } else {
+        got2 = NULL;
+      }
+      assert( (got1 == NULL) == (got2 == NULL) );
+      if (!got1)
+        break;
+      assert( !strcmp(line1, line2) );
+      numberLines++;
+    }
+    assert( numberLines > 400 );
+    fclose(fp);
+    delete input;
+    if (CoinMappedFileInput::available()) {
+      CoinMappedFileInput mapped("CoinMpsIoThreads.mps");
+      char buffer[8];
+      assert( mapped.read(buffer, 8) == 8 );
+      assert( !strncmp(buffer, "NAME", 4) );
+    }
+  }
+
+  // Test compressed input gives same lines whether or not decompressed
+  // in background
+  if (CoinFileInput::haveGzipSupport()
+    && CoinFileOutput::compressionSupported(CoinFileOutput::COMPRESS_GZIP)) {
+    // many copies so several buffers are needed
+    std::string text;
+    {
+      FILE *fp = fopen("CoinMpsIoThreads.mps", "r");
+      char line[200];
+      while (fgets(line, 200, fp))
+        text += line;
+      fclose(fp);
+      std::string copies;
+      for (int i = 0; i < 40; i++)
+        copies += text;
+      text = copies;
+      CoinFileOutput *output = CoinFileOutput::create("CoinMpsIoThreads.mps.gz",
+        CoinFileOutput::COMPRESS_GZIP);
+      output->puts(text);
+      delete output;
+    }
+    bool saveBackground = CoinFileInput::backgroundDecompression();
+    for (int background = 0; background < 2; background++) {
+      CoinFileInput::setBackgroundDecompression(background != 0);
+      // lines (short buffer so long lines get split)
+      CoinFileInput *input = CoinFileInput::create("CoinMpsIoThreads.mps.gz");
+      std::string got;
+      char line[20];
+      int numberInPlace = 0;
+      while (true) {
+        int length;
+        const char *inPlace = input->getsInPlace(20, length);
+        if (inPlace) {
+          got.append(inPlace, length);
+          numberInPlace++;
+        } else if (input->gets(line, 20)) {
+          got += line;
+        } else {
+          break;
+        }
+      }
+      assert( got == text );
+      assert( numberInPlace > 0 );
+      delete input;
+      // blocks of odd sizes
+      input = CoinFileInput::create("CoinMpsIoThreads.mps.gz");
+      got.clear();
+      std::vector< char > block(100000);
+      int size = 1;
+      while (true) {
+        int n = input->read(&block[0], size);
+        if (n <= 0)
+          break;
+        got.append(&block[0], n);
+        size = (size * 7 + 3) % 99991 + 1;
+      }
+      assert( got == text );
+      delete input;
+      // stop part way through
+      input = CoinFileInput::create("CoinMpsIoThreads.mps.gz");
+      assert( input->gets(line, 20) );
+      delete input;
+    }
+    CoinFileInput::setBackgroundDecompression(saveBackground);
+  }
+
+  // Test number conversion gives same answer as strtod (bit for bit)
+  {
+    char buffer[1000];
+    char *end1;
+    char *end2;
+    unsigned long long random = 12345;
+    for (int i = 0; i < 400000; i++) {
+      random ^= random << 13;
+      random ^= random >> 7;
+      random ^= random << 17;
+      if (i & 1) {
+        // any finite double printed shortest exact or shorter
+        double value;
+        memcpy(&value, &random, sizeof(double));
+        if (value != value || value - value != 0.0)
+          continue;
+        sprintf(buffer, "%.*g", (i & 2) ? 17 : static_cast< int >(random % 17) + 1, value);
+      } else {
+        // random digits (often more than 19) and exponent
+        int length = static_cast< int >(random % 40) + 1;
+        int point = static_cast< int >((random >> 8) % (length + 1));
+        char *put = buffer;
+        unsigned long long digits = random;
+        for (int j = 0; j < length; j++) {
+          if (j == point)
+            *put++ = '.';
+          if (j % 16 == 15)
+            digits = digits * 6364136223846793005ULL + 1442695040888963407ULL;
+          *put++ = static_cast< char >('0' + (digits >> (4 * (j % 16))) % 10);
+        }
+        sprintf(put, "e%d", static_cast< int >((random >> 20) % 700) - 360);
+      }
+      double value1 = strtod(buffer, &end1);
+      double value2 = CoinStrtod(buffer, &end2);
+      assert( !memcmp(&value1, &value2, sizeof(double)) );
+      assert( end1 == end2 );
+    }
+    // close to or exactly half way, subnormals, overflow, odd forms
+    std::string halfWay = "9007199254740993";
+    std::string longHalfWay = halfWay + "." + std::string(800, '0');
+    std::string longAbove = longHalfWay + "1";
+    const char *cases[] = { halfWay.c_str(), longHalfWay.c_str(), longAbove.c_str(),
+      "9007199254740995", "2.2250738585072011e-308", "2.2250738585072012e-308",
+      "4.9406564584124654e-324", "2.4703282292062327e-324",
+      "2.4703282292062328e-324", "1.7976931348623157e308",
+      "1.7976931348623159e308", "1e400", "1e-400", "0.000000000000000000000000001",
+      "123456789012345678901234567890", "  -0.0", "+.5e+1", "1e", "1e+x", "5.",
+      "inf", "-Infinity", "NaN", ".", "-", "x" };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+      double value1 = strtod(cases[i], &end1);
+      double value2 = CoinStrtod(cases[i], &end2);
+      assert( end1 == end2 );
+      if (value1 == value1)
+        assert( !memcmp(&value1, &value2, sizeof(double)) );
+      else
+        assert( value2 != value2 );
+    }
+    assert( CoinStrtod("0.1", NULL) == 0.1 );
+  }
+
+  // Test shortest formatting reads back exactly and is short
+  {
+    char buffer[400];
+    char check[40];
+    unsigned long long random = 54321;
+    for (int i = 0; i < 200000; i++) {
+      random ^= random << 13;
+      random ^= random >> 7;
+      random ^= random << 17;
+      double value;
+      memcpy(&value, &random, sizeof(double));
+      if (value != value || value - value != 0.0)
+        continue;
+      int length = CoinDtoa(value, buffer);
+      assert( length == static_cast< int >(strlen(buffer)) && length <= 24 );
+      double back = CoinStrtod(buffer, NULL);
+      assert( !memcmp(&back, &value, sizeof(double)) );
+      // no printf precision which reads back has fewer digits
+      char digits[20];
+      int exponent10;
+      int numberDigits = CoinDtoaDigits(value, digits, exponent10);
+      if (numberDigits > 1) {
+        sprintf(check, "%.*e", numberDigits - 2, value);
+        assert( strtod(check, NULL) != value );
+      }
+      // fixed form rounds as printf does (when more digits are needed)
+      int decimals = static_cast< int >(random % 12);
+      if (fabs(value) < 1.0e30 && -exponent10 > decimals
+        && CoinDtoaFixed(value, decimals, buffer, sizeof(buffer)) >= 0) {
+        sprintf(check, "%.*f", decimals, value);
+        assert( CoinStrtod(check, NULL) == CoinStrtod(buffer, NULL) );
+      }
+    }
+    const double values[] = { 0.1, 1.0e-5, 1500.0, 1.0e21, -0.0, 5.0e-324,
+      1.7976931348623157e308, 1.0 / 3.0, 123456789012.0 };
+    const char *expected[] = { "0.1", "1e-5", "1500", "1e21", "-0", "5e-324",
+      "1.7976931348623157e308", "0.3333333333333333", "123456789012" };
+    for (int i = 0; i < 9; i++) {
+      CoinDtoa(values[i], buffer);
+      assert( !strcmp(buffer, expected[i]) );
+    }
+    assert( CoinDtoaFixed(0.1, 9, buffer, 40) == 3 && !strcmp(buffer, "0.1") );
+    assert( CoinDtoaFixed(2.0 / 3.0, 3, buffer, 40) == 5 && !strcmp(buffer, "0.667") );
+    assert( CoinDtoaFixed(-0.0004, 3, buffer, 40) == 1 && !strcmp(buffer, "0") );
+    assert( CoinDtoaFixed(-0.9999, 2, buffer, 40) == 2 && !strcmp(buffer, "-1") );
+    assert( CoinDtoaFixed(1.0e20, 0, buffer, 20) < 0 );
+
+    // Model written with extra accuracy reads back exactly
+    const int numberRows = 20;
+    const int numberColumns = 60;
+    std::vector< int > rows;
+    std::vector< int > columns;
+    std::vector< double > elements;
+    for (int j = 0; j < numberColumns; j++) {
+      for (int k = 0; k < 3; k++) {
+        random ^= random << 13;
+        random ^= random >> 7;
+        random ^= random << 17;
+        rows.push_back((j + 7 * k) % numberRows);
+        columns.push_back(j);
+        elements.push_back(ldexp(static_cast< double >(random >> 11),
+          static_cast< int >(random % 120) - 110));
+      }
+    }
+    CoinPackedMatrix matrix(true, &rows[0], &columns[0], &elements[0],
+      static_cast< CoinBigIndex >(elements.size()));
+    std::vector< double > collb(numberColumns, 0.0);
+    std::vector< double > colub(numberColumns, 1.0 / 3.0);
+    std::vector< double > obj(numberColumns, 0.1);
+    std::vector< double > rowlb(numberRows, -COIN_DBL_MAX);
+    std::vector< double > rowub(numberRows, 2.0 / 7.0);
+    CoinMpsIO model;
+    model.setMpsData(matrix, COIN_DBL_MAX, &collb[0], &colub[0], &obj[0],
+      NULL, &rowlb[0], &rowub[0], static_cast< char ** >(NULL),
+      static_cast< char ** >(NULL));
+    for (int formatType = 0; formatType < 2; formatType++) {
+      model.writeMps("CoinMpsIoExact.mps", 0, formatType);
+      CoinMpsIO exact;
+      exact.messageHandler()->setLogLevel(0);
+      int numErr = exact.readMps("CoinMpsIoExact.mps", "");
+      assert( numErr == 0 );
+      assert( exact.getObjCoefficients()[0] == 0.1 );
+      if (formatType == 1) {
+        // 0 only has 12 characters
+        assert( exact.getColUpper()[0] == 1.0 / 3.0 );
+        assert( exact.getRowUpper()[0] == 2.0 / 7.0 );
+        assert( exact.getMatrixByCol()->isEquivalent(*model.getMatrixByCol(),
+          CoinAbsFltEq(0.0)) );
+      }
+    }
+  }
+
+
+  // Streaming writer
+  {
+    CoinMpsIO m;
+    m.messageHandler()->setLogLevel(0);
+    std::string fn = mpsDir + "exmip1";
+    int numErr = m.readMps(fn.c_str(), "mps");
+    assert( numErr == 0 );
+    m.writeMps("CoinMpsIoStream1.mps");
+    int numberRows = m.getNumRows();
+    int numberColumns = m.getNumCols();
+    std::vector< const char * > rowNames(numberRows);
+    std::vector< const char * > columnNames(numberColumns);
+    for (int i = 0; i < numberRows; i++)
+      rowNames[i] = m.rowName(i);
+    for (int j = 0; j < numberColumns; j++)
+      columnNames[j] = m.columnName(j);
+    // row ordered matrix is turned round
+    CoinMpsPackedColumns columns(*m.getMatrixByRow(), m.getColLower(),
+      m.getColUpper(), m.getObjCoefficients(), m.integerColumns(),
+      &columnNames[0]);
+    assert( columns.numberColumns() == numberColumns );
+    assert( m.writeMps("CoinMpsIoStream2.mps", 0, 0, 2, numberRows,
+      m.getRowLower(), m.getRowUpper(), &rowNames[0], columns) == 0 );
+    std::string written = fileContents("CoinMpsIoStream1.mps");
+    assert( written.size() && written == fileContents("CoinMpsIoStream2.mps") );
+
+    // Generated columns straight to a compressed file
+    const int numberGenerated = 1000;
+    CoinMpsTestColumns generated(numberGenerated / 2, numberGenerated);
+    std::vector< double > rowLower(numberGenerated / 2, 1.0);
+    std::vector< double > rowUpper(numberGenerated / 2, 1.0);
+    rowLower[0] = -COIN_DBL_MAX;
+    CoinMpsIO writer;
+    assert( writer.writeMps("CoinMpsIoStream3.mps", 1, 0, 2,
+      numberGenerated / 2, &rowLower[0], &rowUpper[0], NULL,
+      generated) == 0 );
+    CoinMpsIO reader;
+    reader.messageHandler()->setLogLevel(0);
+    std::string name = CoinFileInput::haveGzipSupport() ?
+      "CoinMpsIoStream3.mps.gz" : "CoinMpsIoStream3.mps";
+    numErr = reader.readMps(name.c_str(), "");
+    assert( numErr == 0 );
+    assert( reader.getNumRows() == numberGenerated / 2 );
+    assert( reader.getNumCols() == numberGenerated - numberGenerated / 10 );
+    assert( reader.getNumElements() == 2 * reader.getNumCols() );
+    assert( !strcmp(reader.rowName(3), "R0000003") );
+    assert( !strcmp(reader.columnName(0), "named0") );
+    assert( !strcmp(reader.columnName(1), "C0000001") );
+    assert( reader.getRowSense()[0] == 'L' && reader.getRowSense()[1] == 'E' );
+    assert( reader.isInteger(7) && !reader.isInteger(8) );
+    assert( reader.getColUpper()[4] == 5.0 );
+    assert( reader.getColUpper()[5] > 1.0e30 );
+    assert( reader.getMatrixByCol()->getCoefficient(2, 2) == 3.0 );
+  }
+
+  // Name hash
+  {
+    std::vector< std::string > nameSet;
+    char name[20];
+    for (int i = 0; i < 10000; i++) {
+      sprintf(name, "N%d", i < 5000 ? i % 4000 : i);
+      nameSet.push_back(name);
+    }
+    std::vector< const char * > names(nameSet.size());
+    for (size_t i = 0; i < nameSet.size(); i++)
+      names[i] = nameSet[i].c_str();
+    CoinNameHash hash;
+    assert( hash.find("N1") == -1 );
+    assert( hash.build(&names[0], 5000) == 1000 );
+    assert( hash.numberEntries() == 4000 );
+    assert( hash.find("N4001") == -1 && hash.find("N") == -1 && hash.find("") == -1 );
+    for (int i = 0; i < 5000; i++)
+      assert( hash.find(names[i]) == i % 4000 );
+    // grows as names are added
+    CoinNameHash copy(hash);
+    for (int i = 5000; i < 10000; i++)
+      assert( copy.insert(i) == i );
+    assert( copy.insert(0) == 0 && copy.numberEntries() == 9000 );
+    assert( copy.find("N9999") == 9999 && copy.find("N3999") == 3999 );
+    assert( hash.find("N9999") == -1 );
+  }
+
+  // Name arena
+  {
+    CoinNameArena *arena = new CoinNameArena();
+    char *first = arena->add("first");
+    assert( !strcmp(first, "first") && arena->owns(first) );
+    assert( arena->add(first) == first && arena->numberNames() == 1 );
+    char *extra = arena->add("extra");
+    assert( arena->takeBack(extra) && !arena->takeBack(first) );
+    assert( arena->add("again") == extra && arena->bytesUsed() == 12 );
+    // names stay where they are as arena grows
+    char name[20];
+    for (int i = 0; i < 100000; i++) {
+      sprintf(name, "x%d", i);
+      arena->add(name);
+    }
+    assert( !strcmp(first, "first") && arena->owns(first) && !arena->owns(name) );
+    CoinNameArena *other = arena->share();
+    CoinNameArena::release(arena);
+    assert( !arena && other->referenceCount() == 1 && !strcmp(extra, "again") );
+    CoinNameArena::release(other);
+
+    // copies of CoinMpsIO share names
+    int rowIndex[] = { 0, 1 };
+    int columnIndex[] = { 0, 1 };
+    double element[] = { 1.0, 2.0 };
+    CoinPackedMatrix matrix(true, rowIndex, columnIndex, element, 2);
+    double lower[] = { 0.0, 0.0 };
+    double upper[] = { 1.0, 1.0 };
+    const char *rowNames[] = { "r0", NULL };
+    const char *columnNames[] = { "c0", "c1" };
+    CoinMpsIO writer;
+    writer.setMpsData(matrix, COIN_DBL_MAX, lower, upper, lower, NULL,
+      lower, upper, columnNames, rowNames);
+    assert( !strcmp(writer.rowName(1), "R0000001") );
+    CoinMpsIO copy(writer);
+    assert( copy.rowName(0) == writer.rowName(0) && copy.columnName(1) == writer.columnName(1) );
+    assert( writer.nameArena(0)->referenceCount() == 2 );
+    assert( writer.nameArena(1)->numberNames() == 2 );
+  }
 }
 
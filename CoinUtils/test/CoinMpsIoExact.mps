@@ -0,0 +1,212 @@
+NAME          BLANK     FREE
+ROWS
+ N  OBJROW
+ L  R0000000
+ L  R0000001
+ L  R0000002
+ L  R0000003
+ L  R0000004
+ L  R0000005
+ L  R0000006
+ L  R0000007
+ L  R0000008
+ L  R0000009
+ L  R0000010
+ L  R0000011
+ L  R0000012
+ L  R0000013
+ L  R0000014
+ L  R0000015
+ L  R0000016
+ L  R0000017
+ L  R0000018
+ L  R0000019
+COLUMNS
+    C0000000 OBJROW 0.1 R0000000 1947.671685737012
+    C0000000 R0000007 150752576371535.8 R0000014 7334316283.763794
+    C0000001 OBJROW 0.1 R0000001 9.334897957855239e-4
+    C0000001 R0000008 9.285977575864157e-8 R0000015 0.1268254628997877
+    C0000002 OBJROW 0.1 R0000002 21693238157084.062
+    C0000002 R0000016 28453.045031670248
+    C0000003 OBJROW 0.1 R0000003 10202641968299598
+    C0000004 OBJROW 0.1 R0000011 1.1926620351053891e-4
+    C0000004 R0000018 4749.598282183135
+    C0000005 OBJROW 0.1 R0000005 96.04214946390135
+    C0000005 R0000012 1516266.8078158535
+    C0000006 OBJROW 0.1 R0000006 50676.52271385265
+    C0000006 R0000013 2.026169360452191
+    C0000007 OBJROW 0.1 R0000001 63640410.77964006
+    C0000007 R0000007 1.1102520363603523e-4
+    C0000008 OBJROW 0.1 R0000002 19945.11434528578
+    C0000008 R0000008 6.001387924219455e-5
+    C0000009 OBJROW 0.1 R0000003 4.069736372672709e-6
+    C0000009 R0000009 212573.20178715794 R0000016 0.002258327008246106
+    C0000010 OBJROW 0.1 R0000004 9.867976779566631e-6
+    C0000011 OBJROW 0.1 R0000011 1.316577499890381e-5
+    C0000011 R0000018 272326957121153.56
+    C0000012 OBJROW 0.1 R0000012 7621199816736032
+    C0000012 R0000019 2498912488363.82
+    C0000013 OBJROW 0.1 R0000000 1.4235562382191078e-4
+    C0000013 R0000007 3965397590.4904695
+    C0000014 OBJROW 0.1 R0000001 0.013905378590101176
+    C0000014 R0000008 52468949.214498654 R0000014 299432312175.9844
+    C0000015 OBJROW 0.1 R0000002 7.516947346774666e-4
+    C0000015 R0000009 742535957741465.2 R0000015 1091.356887015685
+    C0000016 OBJROW 0.1 R0000003 5.157045077489777e-6
+    C0000016 R0000010 27287.845245540142 R0000016 3966910133102502
+    C0000017 OBJROW 0.1 R0000004 0.10631340210272022
+    C0000017 R0000011 0.32751476062676843 R0000017 0.06600446198009835
+    C0000018 OBJROW 0.1 R0000012 3.0023100067179285e-9
+    C0000018 R0000018 8.076082492124131e-7
+    C0000019 OBJROW 0.1 R0000006 0.020436907259775428
+    C0000019 R0000013 1.5564834730262303e-8 R0000019 2914.9562648120163
+    C0000020 OBJROW 0.1 R0000000 2.4284893955574052e-9
+    C0000020 R0000007 0.3691996352088818
+    C0000021 OBJROW 0.1 R0000001 0.43972482215338504
+    C0000021 R0000008 1257472025075340
+    C0000022 OBJROW 0.1 R0000002 27.503645890675088
+    C0000022 R0000016 8.698608427994176e-10
+    C0000023 OBJROW 0.1 R0000003 3.815162275111291
+    C0000023 R0000010 3297271152839006 R0000017 8.085748593938911e-8
+    C0000024 OBJROW 0.1 R0000011 364255968.7754259
+    C0000024 R0000018 1.9412174604742447e-10
+    C0000025 OBJROW 0.1 R0000005 11281475691548.148
+    C0000025 R0000012 25172670.458568335 R0000019 59667190389969460
+    C0000026 OBJROW 0.1 R0000000 1.4000009215368616e-9
+    C0000026 R0000006 335.6332336864795 R0000013 7462.097793778579
+    C0000027 OBJROW 0.1 R0000014 1.736576866362046e-5
+    C0000028 OBJROW 0.1 R0000002 106185460300.59628
+    C0000028 R0000008 2.2950580513052713e-6 R0000015 1528189.6094241142
+    C0000029 OBJROW 0.1 R0000003 8.506142892170718e-9
+    C0000029 R0000016 0.9264987584236486
+    C0000030 OBJROW 0.1 R0000004 133764671140658.33
+    C0000030 R0000010 26070395703.908417 R0000017 6.738534911447959e-9
+    C0000031 OBJROW 0.1 R0000005 185536422641.60806
+    C0000031 R0000011 11784954144948.09 R0000018 501.54289427467427
+    C0000032 OBJROW 0.1 R0000006 0.007083940056836036
+    C0000032 R0000012 2.364354260846788e-4 R0000019 27998800032090.293
+    C0000033 OBJROW 0.1 R0000007 1485164449007981.2
+    C0000033 R0000013 910.0144012117566
+    C0000034 OBJROW 0.1 R0000001 118975.19338899618
+    C0000034 R0000008 1.6030158534125383e-5 R0000014 0.002995156207520156
+    C0000035 OBJROW 0.1 R0000009 129787538.51177226
+    C0000035 R0000015 0.0031285220965267175
+    C0000036 OBJROW 0.1 R0000003 3.217780238149845e-4
+    C0000036 R0000010 7958292670.899271 R0000016 0.0015476015411585217
+    C0000037 OBJROW 0.1 R0000011 1.4929682738251666e-8
+    C0000037 R0000017 2032871554028.3193
+    C0000038 OBJROW 0.1 R0000005 784027177389984300
+    C0000038 R0000012 1.610593672663688e-7 R0000018 394827339763305200
+    C0000039 OBJROW 0.1 R0000006 220448528892278200
+    C0000039 R0000013 1.7144588894887074e-7 R0000019 11667042.554981869
+    C0000040 OBJROW 0.1 R0000000 2012485109.9341507
+    C0000040 R0000007 29310953498083240 R0000014 1.856711338488865e-7
+    C0000041 OBJROW 0.1 R0000001 1.0954976969904045e-9
+    C0000041 R0000008 28462948950975.77
+    C0000042 OBJROW 0.1 R0000002 1.7131572339083723e-4
+    C0000042 R0000009 851.0353571557471 R0000016 16553367586361216
+    C0000043 OBJROW 0.1 R0000003 3857990691932183600
+    C0000043 R0000017 9.193770605858023e-7
+    C0000044 OBJROW 0.1 R0000004 8.417271726402303
+    C0000044 R0000018 4.983239145140468e-9
+    C0000045 OBJROW 0.1 R0000005 128279752395410.16
+    C0000045 R0000019 3737.361571105757
+    C0000046 OBJROW 0.1 R0000000 4.312965674735803e-4
+    C0000046 R0000006 201697113022178.8 R0000013 879.9199038213801
+    C0000047 OBJROW 0.1 R0000007 702471154.0209379
+    C0000048 OBJROW 0.1 R0000002 4271384.215097461
+    C0000048 R0000015 766.0123453987387
+    C0000049 OBJROW 0.1 R0000003 708.6104297359686
+    C0000049 R0000009 120071305.53224277 R0000016 26457.675132589437
+    C0000050 OBJROW 0.1 R0000004 276468920364753.12
+    C0000051 OBJROW 0.1 R0000005 12.977604836918665
+    C0000051 R0000011 3.0909671025772254e-6 R0000018 3759240242265312.5
+    C0000052 OBJROW 0.1 R0000012 732525472981114900
+    C0000052 R0000019 6094146604.282368
+    C0000053 OBJROW 0.1 R0000000 14605530133.6886
+    C0000053 R0000007 2.986580786557545e-7 R0000013 164.40929631092354
+    C0000054 OBJROW 0.1 R0000001 1314080173565377
+    C0000054 R0000008 77857864.11184303 R0000014 97.8669832147404
+    C0000055 OBJROW 0.1 R0000002 1.0862490038227297e-6
+    C0000055 R0000009 1.6444624792975121e-9 R0000015 123038.88664889518
+    C0000056 OBJROW 0.1 R0000003 208218049.59167933
+    C0000056 R0000010 889697.3766162964 R0000016 1.1767101551626441e-9
+    C0000057 OBJROW 0.1 R0000004 15508578.297256261
+    C0000057 R0000011 1413056859.0085373 R0000017 9.962686886654494e-10
+    C0000058 OBJROW 0.1 R0000005 61636975484118.72
+    C0000058 R0000012 0.03051559800305467
+    C0000059 OBJROW 0.1 R0000006 269184.67610020004
+    C0000059 R0000013 15173.604421751385 R0000019 50020819615410.94
+RHS
+    RHS R0000000 0.2857142857142857 R0000001 0.2857142857142857
+    RHS R0000002 0.2857142857142857 R0000003 0.2857142857142857
+    RHS R0000004 0.2857142857142857 R0000005 0.2857142857142857
+    RHS R0000006 0.2857142857142857 R0000007 0.2857142857142857
+    RHS R0000008 0.2857142857142857 R0000009 0.2857142857142857
+    RHS R0000010 0.2857142857142857 R0000011 0.2857142857142857
+    RHS R0000012 0.2857142857142857 R0000013 0.2857142857142857
+    RHS R0000014 0.2857142857142857 R0000015 0.2857142857142857
+    RHS R0000016 0.2857142857142857 R0000017 0.2857142857142857
+    RHS R0000018 0.2857142857142857 R0000019 0.2857142857142857
+BOUNDS
+ UP BOUND C0000000 0.3333333333333333
+ UP BOUND C0000001 0.3333333333333333
+ UP BOUND C0000002 0.3333333333333333
+ UP BOUND C0000003 0.3333333333333333
+ UP BOUND C0000004 0.3333333333333333
+ UP BOUND C0000005 0.3333333333333333
+ UP BOUND C0000006 0.3333333333333333
+ UP BOUND C0000007 0.3333333333333333
+ UP BOUND C0000008 0.3333333333333333
+ UP BOUND C0000009 0.3333333333333333
+ UP BOUND C0000010 0.3333333333333333
+ UP BOUND C0000011 0.3333333333333333
+ UP BOUND C0000012 0.3333333333333333
+ UP BOUND C0000013 0.3333333333333333
+ UP BOUND C0000014 0.3333333333333333
+ UP BOUND C0000015 0.3333333333333333
+ UP BOUND C0000016 0.3333333333333333
+ UP BOUND C0000017 0.3333333333333333
+ UP BOUND C0000018 0.3333333333333333
+ UP BOUND C0000019 0.3333333333333333
+ UP BOUND C0000020 0.3333333333333333
+ UP BOUND C0000021 0.3333333333333333
+ UP BOUND C0000022 0.3333333333333333
+ UP BOUND C0000023 0.3333333333333333
+ UP BOUND C0000024 0.3333333333333333
+ UP BOUND C0000025 0.3333333333333333
+ UP BOUND C0000026 0.3333333333333333
+ UP BOUND C0000027 0.3333333333333333
+ UP BOUND C0000028 0.3333333333333333
+ UP BOUND C0000029 0.3333333333333333
+ UP BOUND C0000030 0.3333333333333333
+ UP BOUND C0000031 0.3333333333333333
+ UP BOUND C0000032 0.3333333333333333
+ UP BOUND C0000033 0.3333333333333333
+ UP BOUND C0000034 0.3333333333333333
+ UP BOUND C0000035 0.3333333333333333
+ UP BOUND C0000036 0.3333333333333333
+ UP BOUND C0000037 0.3333333333333333
+ UP BOUND C0000038 0.3333333333333333
+ UP BOUND C0000039 0.3333333333333333
+ UP BOUND C0000040 0.3333333333333333
+ UP BOUND C0000041 0.3333333333333333
+ UP BOUND C0000042 0.3333333333333333
+ UP BOUND C0000043 0.3333333333333333
+ UP BOUND C0000044 0.3333333333333333
+ UP BOUND C0000045 0.3333333333333333
+ UP BOUND C0000046 0.3333333333333333
+ UP BOUND C0000047 0.3333333333333333
+ UP BOUND C0000048 0.3333333333333333
+ UP BOUND C0000049 0.3333333333333333
+ UP BOUND C0000050 0.3333333333333333
+ UP BOUND C0000051 0.3333333333333333
+ UP BOUND C0000052 0.3333333333333333
+ UP BOUND C0000053 0.3333333333333333
+ UP BOUND C0000054 0.3333333333333333
+ UP BOUND C0000055 0.3333333333333333
+ UP BOUND C0000056 0.3333333333333333
+ UP BOUND C0000057 0.3333333333333333
+ UP BOUND C0000058 0.3333333333333333
+ UP BOUND C0000059 0.3333333333333333
+ENDATA
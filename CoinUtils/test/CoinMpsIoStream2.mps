@@ -0,0 +1,34 @@
+NAME          EXAMPLE 
+ROWS
+ N  OBJ
+ G  ROW01
+ L  ROW02
+ E  ROW03
+ L  ROW04
+ L  ROW05
+COLUMNS
+    COL01     OBJ       1              ROW01     3           
+    COL01     ROW05     5.6         
+    COL02     ROW01     1              ROW02     2           
+    COL03     ROW02     1.1            ROW03     1           
+    COL04     ROW01     -2             ROW04     2.8         
+    COL05     OBJ       2              ROW01     -1          
+    COL05     ROW05     1           
+    COL06     ROW03     1           
+    COL07     ROW04     -1.2        
+    COL08     OBJ       -1             ROW01     -1          
+    COL08     ROW05     1.9         
+RHS
+    RHS       ROW01     2.5            ROW02     2.1         
+    RHS       ROW03     4              ROW04     5           
+    RHS       ROW05     15          
+RANGES
+    RANGE     ROW04     3.2            ROW05     12          
+BOUNDS
+ LO BOUND     COL01     2.5         
+ UI BOUND     COL02     4.1         
+ BV BOUND     COL03     1           
+ LO BOUND     COL05     0.5         
+ UP BOUND     COL05     4           
+ UP BOUND     COL08     4.3         
+ENDATA
@@ -0,0 +1,1786 @@
+NAME          BLANK     FREE
+ROWS
+ N  OBJROW
+ L  R0
+ L  R1
+ L  R2
+ L  R3
+ L  R4
+ L  R5
+ L  R6
+ L  R7
+ L  R8
+ L  R9
+ L  R10
+ L  R11
+ L  R12
+ L  R13
+ L  R14
+ L  R15
+ L  R16
+ L  R17
+ L  R18
+ L  R19
+ L  R20
+ L  R21
+ L  R22
+ L  R23
+ L  R24
+ L  R25
+ L  R26
+ L  R27
+ L  R28
+ L  R29
+ L  R30
+ L  R31
+ L  R32
+ L  R33
+ L  R34
+ L  R35
+ L  R36
+ L  R37
+ L  R38
+ L  R39
+ L  R40
+ L  R41
+ L  R42
+ L  R43
+ L  R44
+ L  R45
+ L  R46
+ L  R47
+ L  R48
+ L  R49
+ L  R50
+ L  R51
+ L  R52
+ L  R53
+ L  R54
+ L  R55
+ L  R56
+ L  R57
+ L  R58
+ L  R59
+ L  R60
+ L  R61
+ L  R62
+ L  R63
+ L  R64
+ L  R65
+ L  R66
+ L  R67
+ L  R68
+ L  R69
+ L  R70
+ L  R71
+ L  R72
+ L  R73
+ L  R74
+ L  R75
+ L  R76
+ L  R77
+ L  R78
+ L  R79
+ L  R80
+ L  R81
+ L  R82
+ L  R83
+ L  R84
+ L  R85
+ L  R86
+ L  R87
+ L  R88
+ L  R89
+ L  R90
+ L  R91
+ L  R92
+ L  R93
+ L  R94
+ L  R95
+ L  R96
+ L  R97
+ L  R98
+ L  R99
+ L  R100
+ L  R101
+ L  R102
+ L  R103
+ L  R104
+ L  R105
+ L  R106
+ L  R107
+ L  R108
+ L  R109
+ L  R110
+ L  R111
+ L  R112
+ L  R113
+ L  R114
+ L  R115
+ L  R116
+ L  R117
+ L  R118
+ L  R119
+ L  R120
+ L  R121
+ L  R122
+ L  R123
+ L  R124
+ L  R125
+ L  R126
+ L  R127
+ L  R128
+ L  R129
+ L  R130
+ L  R131
+ L  R132
+ L  R133
+ L  R134
+ L  R135
+ L  R136
+ L  R137
+ L  R138
+ L  R139
+ L  R140
+ L  R141
+ L  R142
+ L  R143
+ L  R144
+ L  R145
+ L  R146
+ L  R147
+ L  R148
+ L  R149
+COLUMNS
+    C0 OBJROW 1            R0 -876        
+    C1 OBJROW 2            R126 5352.4285714
+    C1 R142 196.28571429
+    C2 OBJROW 3            R11 1714.2857143
+    C2 R93  -2258.42857 R122 8165.2857143
+    C3 OBJROW 4            R43  -888.857143
+    C3 R66 8416.4285714 R100  -641.714286
+    C3 R117 764.71428571
+    C4 OBJROW 5            R86 9239.8571429
+    C4 R94 5427.1428571 R106 7697.4285714
+    C4 R113 -4725        R142  -2193.14286
+    C5 OBJROW 6            R4 1917.8571429
+    C5 R6  -2722.28571 R51 8555.1428571
+    C5 R95  -3207.57143 R130 7984.7142857
+    C5 R139 6961.7142857
+    C6 OBJROW 7            R10  -1759.71429
+    C6 R18 5269.4285714 R43 6428        
+    C6 R63 -1541        R85 4999.2857143
+    C6 R93 3564.7142857 R97 5318.7142857
+    C7 OBJROW 8            R100 3710.8571429
+    C8 OBJROW 9            R46 3322.1428571
+    C8 R103 2323.7142857
+    C9 OBJROW 10           R66 760.57142857
+    C9 R94 1786.7142857 R125 4727        
+    C10 OBJROW 11           R21 -1687       
+    C10 R31 1988.2857143 R116  -1659.42857
+    C10 R125 1765.2857143
+    C11 OBJROW 12           R0 4832.8571429
+    C11 R56 4367         R89 999.42857143
+    C11 R96  -3967.57143 R127 1369.4285714
+    C12 OBJROW 13           R10 -4970       
+    C12 R12 7560.5714286 R40 1067        
+    C12 R66 3713         R115 2896.1428571
+    C12 R139 2483.4285714
+    C13 OBJROW 1            R27 2749.4285714
+    C13 R64  -921.142857 R66 1646        
+    C13 R93 6891.2857143 R109  -2835.85714
+    C13 R132  -2661.57143 R136 5117        
+    C14 OBJROW 2            R16 7826.8571429
+    C15 OBJROW 3            R106  -207.571429
+    C15 R141  -2209.42857
+    C16 OBJROW 4            R25  -1217.14286
+    C16 R58  -4234.42857 R148  -1627.85714
+    C17 OBJROW 5            R1  -1744.57143
+    C17 R6 3122.4285714 R41 1645        
+    C17 R61 1459.7142857
+    C18 OBJROW 6            R57 891.28571429
+    C18 R64  -2395.42857 R92 -3202       
+    C18 R132 8997.2857143 R149 5375.7142857
+    C19 OBJROW 7            R29 7397.7142857
+    C19 R47 -4763        R105 3778.8571429
+    C19 R121 6652.2857143 R132 1313.8571429
+    C19 R139 1692.7142857
+    C20 OBJROW 8            R16 -511        
+    C20 R52  -115.857143 R70 3304.5714286
+    C20 R79  -3938.14286 R96 6858.7142857
+    C20 R111  -592.285714 R133 1265.4285714
+    C21 OBJROW 9            R99 7545.1428571
+    C22 OBJROW 10           R48  -4843.57143
+    C22 R137 2779.7142857
+    C23 OBJROW 11           R38 9111.4285714
+    C23 R97 -2337        R142 3170.7142857
+    C24 OBJROW 12           R15  -3859.71429
+    C24 R23 1932.5714286 R70 8666.1428571
+    C24 R81 5983.5714286
+    C25 OBJROW 13           R46  -4798.28571
+    C25 R57 1106.4285714 R58  -1255.71429
+    C25 R68 6664.8571429 R131 4255.2857143
+    C26 OBJROW 1            R4 5331.5714286
+    C26 R61  -2737.57143 R102 1590.7142857
+    C26 R110 3719.4285714 R115 6998.8571429
+    C26 R118  -4550.57143
+    C27 OBJROW 2            R5 2970.5714286
+    C27 R38  -1775.85714 R60  -2453.71429
+    C27 R64 -4351        R69 851.14285714
+    C27 R119  -4185.57143 R125 5865.5714286
+    C28 OBJROW 3            R105 4456.5714286
+    C29 OBJROW 4            R92 8907.1428571
+    C29 R94 7818.7142857
+    C30 OBJROW 5            R59 1059        
+    C30 R82 6461.5714286 R123 2045.7142857
+    C31 OBJROW 6            R29 4987.7142857
+    C31 R57  -4950.28571 R94 6586.4285714
+    C31 R106  -884.142857
+    C32 OBJROW 7            R4  -1415.71429
+    C32 R66 6810.1428571 R69  -3955.71429
+    C32 R70  -362.285714 R96 -2949       
+    C33 OBJROW 8            R10 6249.2857143
+    C33 R30 8676.5714286 R44 6465.7142857
+    C33 R84 165.28571429 R104  -603.714286
+    C33 R143 5270.1428571
+    C34 OBJROW 9            R41  -1887.57143
+    C34 R60 971.71428571 R74 5511.4285714
+    C34 R82 1301.        R104 3497        
+    C34 R147 51.571428571
+    C35 OBJROW 10           R10  -3802.28571
+    C36 OBJROW 11           R26 1121        
+    C36 R103 6426.5714286
+    C37 OBJROW 12           R23 5108.7142857
+    C37 R74 5720.4285714 R108 3981.1428571
+    C38 OBJROW 13           R10 7499.4285714
+    C38 R14  -1049.28571 R34 8949.2857143
+    C38 R84 943.71428571
+    C39 OBJROW 1            R12 7354        
+    C39 R78 2204         R102 8218.4285714
+    C39 R130 8455.2857143 R138 539.71428571
+    C40 OBJROW 2            R5 6529.4285714
+    C40 R25 1316.1428571 R83 5037.8571429
+    C40 R91  -2579.42857 R97 504.57142857
+    C40 R120 7418.1428571
+    C41 OBJROW 3            R8 3186        
+    C41 R90  -4999.85714 R115 6206        
+    C41 R128  -2020.71429 R130 4457.8571429
+    C41 R147 1878.1428571
+    C42 OBJROW 4            R133 8226.8571429
+    C43 OBJROW 5            R57 -1755       
+    C43 R84  -3391.14286
+    C44 OBJROW 6            R25  -1324.57143
+    C44 R79  -953.571429 R92 -3775       
+    C45 OBJROW 7            R26  -716.142857
+    C45 R62 1511         R74 5846.2857143
+    C45 R108 4232.2857143
+    C46 OBJROW 8            R12 9167.8571429
+    C46 R22 9083.7142857 R70 4532.2857143
+    C46 R121  -683.428571 R135 -1981       
+    C47 OBJROW 9            R20 1575.7142857
+    C47 R86  -566.285714 R91  -3242.28571
+    C47 R109 1164.7142857 R116 3147.8571429
+    C47 R128 7716.1428571
+    C48 OBJROW 10           R3  -3031.14286
+    C48 R74 6541.8571429 R88 4847.4285714
+    C48 R96 8716.4285714 R125 1878.1428571
+    C48 R127 224.71428571 R141  -4510.57143
+    C49 OBJROW 11           R45 1577.1428571
+    C50 OBJROW 12           R4 7277.5714286
+    C50 R91 2800.2857143
+    C51 OBJROW 13           R14  -4024.57143
+    C51 R47 4746.4285714 R71 7561.5714286
+    C52 OBJROW 1            R42 659.14285714
+    C52 R98 5331.4285714 R108 9043.2857143
+    C52 R130  -2398.14286
+    C53 OBJROW 2            R21 6065.7142857
+    C53 R55 8006.5714286 R70  -256.857143
+    C53 R82 3050.7142857 R101  -1058.14286
+    C54 OBJROW 3            R8  -678.142857
+    C54 R26  -144.142857 R75  -1542.85714
+    C54 R97 2450.8571429 R128 8949.8571429
+    C54 R130 -3666       
+    C55 OBJROW 4            R12 2299        
+    C55 R78 4154.2857143 R83 8894.7142857
+    C55 R102 3419.5714286 R105 6273.4285714
+    C55 R116  -2790.42857 R146 7198.5714286
+    C56 OBJROW 5            R38 5556        
+    C57 OBJROW 6            R3 49.571428571
+    C57 R21  -4900.85714
+    C58 OBJROW 7            R10  -859.428571
+    C58 R30 4681.8571429 R142 8671.8571429
+    C59 OBJROW 8            R39  -372.285714
+    C59 R40 9063.4285714 R67 2391.2857143
+    C59 R72 6693.8571429
+    C60 OBJROW 9            R53 6801.4285714
+    C60 R71  -2600.28571 R88 2588.5714286
+    C60 R121 2763         R129 865         
+    C61 OBJROW 10           R36  -2287.85714
+    C61 R53 6548.2857143 R120 3987.8571429
+    C61 R121 5173.2857143 R133 6984.5714286
+    C61 R134 4944        
+    C62 OBJROW 11           R18  -2280.57143
+    C62 R21  -2029.42857 R33  -1834.14286
+    C62 R70 7989         R79  -3474.71429
+    C62 R125  -4860.85714 R136 3083.2857143
+    C63 OBJROW 12           R73  -2099.42857
+    C64 OBJROW 13           R5 1703.8571429
+    C64 R10 4193.4285714
+    C65 OBJROW 1            R101 6723.8571429
+    C65 R115  -3643.28571 R125  -304.571429
+    C66 OBJROW 2            R13  -178.571429
+    C66 R79 192.71428571 R102 6070.8571429
+    C66 R118  -3972.71429
+    C67 OBJROW 3            R35 4298        
+    C67 R68 4368.2857143 R83 1136.5714286
+    C67 R98 2355.5714286 R147  -3821.28571
+    C68 OBJROW 4            R7 -3816       
+    C68 R61 -4703        R127  -2734.57143
+    C68 R130 -4789        R136 -1948       
+    C68 R147 5890.4285714
+    C69 OBJROW 5            R4 7852.7142857
+    C69 R10 4883.8571429 R13  -2008.42857
+    C69 R49  -3990.57143 R54 5689        
+    C69 R83 2265.1428571 R112 7128.8571429
+    C70 OBJROW 6            R36 4000.5714286
+    C71 OBJROW 7            R52  -436.142857
+    C71 R57  -1761.42857
+    C72 OBJROW 8            R97 4172.5714286
+    C72 R128  -763.857143 R147  -184.142857
+    C73 OBJROW 9            R38 8175.1428571
+    C73 R99 255.28571429 R109 276         
+    C73 R148 8082.4285714
+    C74 OBJROW 10           R7 8640        
+    C74 R18 8252.1428571 R32  -390.571429
+    C74 R72 8635.2857143 R102 1270.5714286
+    C75 OBJROW 11           R33 -3643       
+    C75 R61 8549.8571429 R77  -4465.42857
+    C75 R78 6766.8571429 R88 1534.2857143
+    C75 R117  -2.71428571
+    C76 OBJROW 12           R48  -3554.14286
+    C76 R58 2499         R77  -3662.57143
+    C76 R124  -331.714286 R135 4851.8571429
+    C76 R137  -782.285714 R139 1354.1428571
+    C77 OBJROW 13           R47  -4171.42857
+    C78 OBJROW 1            R40 1753        
+    C78 R125  -424.857143
+    C79 OBJROW 2            R13  -3242.14286
+    C79 R57 1429         R85  -3478.28571
+    C80 OBJROW 3            R21  -2843.85714
+    C80 R52  -3292.85714 R88 6915.4285714
+    C80 R133  -3091.57143
+    C81 OBJROW 4            R19 -2345       
+    C81 R54  -167.714286 R72 3121.5714286
+    C81 R90 7681.7142857 R136 6043.1428571
+    C82 OBJROW 5            R15  -4187.42857
+    C82 R43 9063.1428571 R76  -2299.57143
+    C82 R78 9061.8571429 R113 -2669       
+    C82 R130 464.57142857
+    C83 OBJROW 6            R0  -4996.14286
+    C83 R22 6463.1428571 R74 2872        
+    C83 R102 10060.428571 R135 -4959       
+    C83 R139 -3573       
+    C84 OBJROW 7            R49 -1692       
+    C85 OBJROW 8            R32 -4510       
+    C85 R85  -400.714286
+    C86 OBJROW 9            R60 8290.2857143
+    C86 R121 1948        
+    C87 OBJROW 10           R20 2043.7142857
+    C87 R29  -847.571429 R76 209.28571429
+    C87 R107 2034.8571429
+    C88 OBJROW 11           R25  -3493.85714
+    C88 R32  -1979.85714 R56  -1103.14286
+    C88 R82 9118.8571429 R107  -4835.14286
+    C89 OBJROW 12           R3  -4885.14286
+    C89 R102  -2838.14286 R112 8260.7142857
+    C89 R128 2102.8571429 R131 8626        
+    C89 R138  -4060.14286
+    C90 OBJROW 13           R1 7382.7142857
+    C90 R15 6416.5714286 R16  -1087.14286
+    C90 R62  -898.714286 R105 7653.8571429
+    C90 R106 2085         R141 7719.1428571
+    C91 OBJROW 1            R55 5592        
+    C92 OBJROW 2            R45  -4817.28571
+    C92 R86 2390        
+    C93 OBJROW 3            R89  -710.714286
+    C93 R131 5057.5714286 R140 8708        
+    C94 OBJROW 4            R20  -4824.42857
+    C94 R69 3151.7142857 R96  -2027.42857
+    C94 R135 5199.8571429
+    C95 OBJROW 5            R1  -3809.85714
+    C95 R49 2083.5714286 R60  -1183.42857
+    C95 R74 3655.7142857 R134 4942        
+    C96 OBJROW 6            R49 1732.1428571
+    C96 R77  -2844.71429 R81 382.85714286
+    C96 R117 6374         R119 8865.7142857
+    C96 R145 5129.2857143
+    C97 OBJROW 7            R25 3950.4285714
+    C97 R40  -775.857143 R41 7019.7142857
+    C97 R69 2902.8571429 R97 740.28571429
+    C97 R113 3369         R126  -951.571429
+    C98 OBJROW 8            R7 7975.4285714
+    C99 OBJROW 9            R19  -3468.85714
+    C99 R64 -2075       
+    C100 OBJROW 10           R17 774.42857143
+    C100 R137 6551.8571429 R141 8074.2857143
+    C101 OBJROW 11           R37  -4432.71429
+    C101 R79  -2336.57143 R106 1515.5714286
+    C101 R124 7537.4285714
+    C102 OBJROW 12           R37  -1236.71429
+    C102 R59 143.71428571 R71 2530.2857143
+    C102 R95  -3219.85714 R123 8334        
+    C103 OBJROW 13           R4 -1304       
+    C103 R15 -3649        R93 2440.2857143
+    C103 R104 5576.7142857 R139  -129.857143
+    C104 OBJROW 1            R2 3676.8571429
+    C104 R54 8777.2857143 R65  -2364.71429
+    C104 R76 538.71428571 R111 5124.2857143
+    C104 R113  -1206.14286 R116 6228        
+    C105 OBJROW 2            R51  -4475.42857
+    C106 OBJROW 3            R84  -2013.42857
+    C106 R147  -3497.28571
+    C107 OBJROW 4            R23  -1621.57143
+    C107 R102  -2278.28571 R138 4635.8571429
+    C108 OBJROW 5            R3 5313        
+    C108 R6 8494.8571429 R16  -4286.14286
+    C108 R77 2181.4285714
+    C109 OBJROW 6            R21 5508        
+    C109 R119 8852.7142857 R129  -624.285714
+    C109 R143 12160.714286
+    C110 OBJROW 7            R12 6303        
+    C110 R24 226.28571429 R35 8882.8571429
+    C110 R56 3701.2857143 R139 1476.8571429
+    C110 R147 733.57142857
+    C111 OBJROW 8            R0 3715.4285714
+    C111 R5 6302.7142857 R18 5962.5714286
+    C111 R31  -3046.42857 R57 4891.5714286
+    C111 R143  -992.428571 R149  -4563.71429
+    C112 OBJROW 9            R5 3297.7142857
+    C113 OBJROW 10           R58 8237.4285714
+    C113 R138  -617.857143
+    C114 OBJROW 11           R116 3602.2857143
+    C114 R130 5363         R133 5138.1428571
+    C115 OBJROW 12           R5 5474.8571429
+    C115 R72  -980.285714 R78 5074.7142857
+    C115 R104 5916.7142857
+    C116 OBJROW 13           R43 837.57142857
+    C116 R53 950          R81 -533        
+    C116 R87 5386.2857143 R119 7932.2857143
+    C117 OBJROW 1            R1  -19.8571429
+    C117 R34 5529.1428571 R85 -2211       
+    C117 R108 5026.4285714 R128  -487.714286
+    C118 OBJROW 2            R7 8181.8571429
+    C118 R27 6504.7142857 R41 736.28571429
+    C118 R62 -1572        R133 7883.2857143
+    C118 R139 2714         R149 6645        
+    C119 OBJROW 3            R71 5841.1428571
+    C120 OBJROW 4            R2 -4922       
+    C120 R4  -1765.85714
+    C121 OBJROW 5            R7 1202.4285714
+    C121 R58  -4453.28571 R117 8216.5714286
+    C122 OBJROW 6            R33 3648.7142857
+    C122 R46  -1015.14286 R59  -3410.28571
+    C122 R135 2130.1428571
+    C123 OBJROW 7            R2 5962        
+    C123 R7 4431         R20  -13.2857143
+    C123 R49 7906.8571429 R66  -1784.85714
+    C124 OBJROW 8            R30 7446        
+    C124 R78 2999.8571429 R105 5149.8571429
+    C124 R119 2579.4285714 R128 3830.2857143
+    C124 R132 -4149       
+    C125 OBJROW 9            R41 7028.5714286
+    C125 R58  -2062.71429 R61  -4345.28571
+    C125 R75 7370.7142857 R96 5263.7142857
+    C125 R100 2348.1428571 R116 1787.7142857
+    C126 OBJROW 10           R59 8133.1428571
+    C127 OBJROW 11           R33  -449.857143
+    C127 R124 5274        
+    C128 OBJROW 12           R74 2399.5714286
+    C128 R82  -4170.28571 R122  -3731.57143
+    C129 OBJROW 13           R24 1944.5714286
+    C129 R40 150.14285714 R77 1272.2857143
+    C129 R138  -1087.85714
+    C130 OBJROW 1            R4  -3250.57143
+    C130 R19 1433.4285714 R63  -3584.14286
+    C130 R96 6871.5714286 R117 8448        
+    C131 OBJROW 2            R2 6976.8571429
+    C131 R15 5834.4285714 R52 3333        
+    C131 R67 -693         R108 3992        
+    C131 R132 4642.8571429
+    C132 OBJROW 3            R20  -2190.57143
+    C132 R27 820.28571429 R44 3353.8571429
+    C132 R89  -2981.14286 R108 8464.1428571
+    C132 R118 2410.1428571 R119 -1987       
+    C133 OBJROW 4            R6 5620.5714286
+    C134 OBJROW 5            R79 8546.1428571
+    C134 R144 4055.1428571
+    C135 OBJROW 6            R31 840.14285714
+    C135 R43  -2593.85714 R89 2738.8571429
+    C136 OBJROW 7            R30  -691.571429
+    C136 R32  -4047.14286 R37 5393.8571429
+    C136 R96  -1692.57143
+    C137 OBJROW 8            R21 6980.7142857
+    C137 R50 6349         R97 4402        
+    C137 R112 614.28571429 R119  -1205.42857
+    C138 OBJROW 9            R17 3529.8571429
+    C138 R18 8234.4285714 R27 3207.2857143
+    C138 R95  -943.714286 R120  -4941.71429
+    C139 OBJROW 10           R17 2740.7142857
+    C139 R48 4105.5714286 R102  -4576.85714
+    C139 R105 4554.2857143 R116  -744.142857
+    C139 R138 2565.4285714 R148 2159.5714286
+    C140 OBJROW 11           R64  -4709.14286
+    C141 OBJROW 12           R2 7530.7142857
+    C141 R21 587.14285714
+    C142 OBJROW 13           R15 3238.7142857
+    C142 R43  -335.285714 R48 4893.7142857
+    C143 OBJROW 1            R14 5230        
+    C143 R34 4725.8571429 R80  -1489.71429
+    C143 R144 6325        
+    C144 OBJROW 2            R96 7670.4285714
+    C144 R117  -4001.42857 R136 1818.1428571
+    C144 R137  -3989.42857 R147  -4869.71429
+    C145 OBJROW 3            R52 708.57142857
+    C145 R64 796.14285714 R92 4210.4285714
+    C145 R135 7492.2857143 R143  -2151.42857
+    C145 R149 8566.1428571
+    C146 OBJROW 4            R1  -159.571429
+    C146 R9 -1558        R33 5816.1428571
+    C146 R84 3362.5714286 R87  -765.142857
+    C146 R117  -4457.28571 R134 8129.8571429
+    C147 OBJROW 5            R43 9166.8571429
+    C148 OBJROW 6            R89 913.42857143
+    C148 R146 8243.2857143
+    C149 OBJROW 7            R47 3005.8571429
+    C149 R50 3576.4285714 R142 3880.5714286
+    C150 OBJROW 8            R29 1785.1428571
+    C150 R32 5199.8571429 R130 6622.4285714
+    C150 R149 4454.5714286
+    C151 OBJROW 9            R14  -1624.71429
+    C151 R51 2599.7142857 R101 7523.5714286
+    C151 R107 6482.5714286 R118 6094.2857143
+    C152 OBJROW 10           R6 2897        
+    C152 R13 2024         R24 7100.8571429
+    C152 R77 -1477        R78  -1456.57143
+    C152 R121 5732.7142857
+    C153 OBJROW 11           R25  -4054.14286
+    C153 R36  -2863.71429 R39 2490.7142857
+    C153 R40 1723.2857143 R91 5892.5714286
+    C153 R128  -1312.28571 R136 7530.4285714
+    C154 OBJROW 12           R10  -2909.14286
+    C155 OBJROW 13           R99  -108.857143
+    C155 R105 1019.8571429
+    C156 OBJROW 1            R56 1185        
+    C156 R75 4033.8571429 R142 3859.4285714
+    C157 OBJROW 2            R102 7539.8571429
+    C157 R130 7874.4285714 R131 6435.7142857
+    C157 R135 5782.2857143
+    C158 OBJROW 3            R2  -121.285714
+    C158 R38 4875.1428571 R83 2848.2857143
+    C158 R99 596.57142857 R109 830.42857143
+    C159 OBJROW 4            R5 1948        
+    C159 R20 2271.5714286 R90 3240.1428571
+    C159 R101 7843.1428571 R108 1827.4285714
+    C159 R138 1429        
+    C160 OBJROW 5            R10 9203.7142857
+    C160 R16 8984.5714286 R44  -4954.71429
+    C160 R78 1877.5714286 R119  -636.142857
+    C160 R128  -2075.57143
+    C161 OBJROW 6            R72 7812.5714286
+    C162 OBJROW 7            R80 7876.4285714
+    C162 R126 -386        
+    C163 OBJROW 8            R38  -1405.14286
+    C163 R61 8792.1428571 R91 7712.4285714
+    C164 OBJROW 9            R34 7365.4285714
+    C164 R40  -2841.57143 R66 8531.4285714
+    C164 R84 2327.8571429
+    C165 OBJROW 10           R22 4607.4285714
+    C165 R45 76.857142857 R49 5031        
+    C165 R74 3891.8571429 R106 6091.1428571
+    C166 OBJROW 11           R0 8267.2857143
+    C166 R18 8592         R38  -3475.85714
+    C166 R42 6857.4285714 R50 37.142857143
+    C166 R70 648.14285714
+    C167 OBJROW 12           R23 8902        
+    C167 R52  -568.714286 R67 2281.2857143
+    C167 R93  -874.714286 R130 7669.5714286
+    C167 R146 8597.4285714
+    C168 OBJROW 13           R111 3873.7142857
+    C169 OBJROW 1            R8 7986        
+    C169 R147 7021        
+    C170 OBJROW 2            R70  -1064.42857
+    C170 R84 6902.8571429 R108  -3209.28571
+    C171 OBJROW 3            R11 8793.7142857
+    C171 R43 4361.5714286 R105 -4674       
+    C171 R116 1093.8571429
+    C172 OBJROW 4            R6 2908.4285714
+    C172 R30 4579.7142857 R74 6871.7142857
+    C172 R91 6456.7142857 R99 581.71428571
+    C173 OBJROW 5            R40 235.14285714
+    C173 R63 7385.8571429 R88  -738.142857
+    C173 R102  -3986.85714 R119 2214.8571429
+    C173 R142 2269        
+    C174 OBJROW 6            R34 5973.4285714
+    C174 R48 1455.8571429 R78 3259        
+    C174 R92 3767.4285714 R97  -74.1428571
+    C174 R112  -1112.71429 R130 5947.7142857
+    C175 OBJROW 7            R79 8090.2857143
+    C176 OBJROW 8            R13 8979.7142857
+    C176 R14 574.71428571
+    C177 OBJROW 9            R68  -2512.57143
+    C177 R93 1050.7142857 R142  -4799.85714
+    C178 OBJROW 10           R3 3232.7142857
+    C178 R6  -3049.28571 R145 3076.2857143
+    C178 R147 1078.8571429
+    C179 OBJROW 11           R29 7854.1428571
+    C179 R37  -4088.85714 R53  -4634.14286
+    C179 R110 3486.2857143 R142 2944.8571429
+    C180 OBJROW 12           R56  -4318.85714
+    C180 R70  -4478.14286 R74 8142.7142857
+    C180 R79  -1291.28571 R81 945.71428571
+    C180 R92 433.42857143
+    C181 OBJROW 13           R34 5051.7142857
+    C181 R41 3728         R108  -3210.14286
+    C181 R110 3960.4285714 R116 633         
+    C181 R118 3687.5714286 R149  -4098.57143
+    C182 OBJROW 1            R135  -3359.42857
+    C183 OBJROW 2            R42 560.42857143
+    C183 R138 1191.7142857
+    C184 OBJROW 3            R36  -3223.28571
+    C184 R110 -3704        R139 8657        
+    C185 OBJROW 4            R37 -3507       
+    C185 R42 2482.4285714 R46 820         
+    C185 R95 8422        
+    C186 OBJROW 5            R6 955.28571429
+    C186 R9 6873.4285714 R41  -2340.85714
+    C186 R82 5773.7142857 R118 7671.5714286
+    C187 OBJROW 6            R37 494.14285714
+    C187 R46 5054.2857143 R64 8229.8571429
+    C187 R65  -3513.57143 R105  -4442.57143
+    C187 R132 5454.8571429
+    C188 OBJROW 7            R1 8532.2857143
+    C188 R10 1907.8571429 R15 2783.1428571
+    C188 R40 4715.5714286 R79 4522.1428571
+    C188 R107 2947         R147  -846.285714
+    C189 OBJROW 8            R2 4573.7142857
+    C190 OBJROW 9            R99 7908.8571429
+    C190 R122 5657        
+    C191 OBJROW 10           R45 2261.8571429
+    C191 R74 4338.8571429 R134  -527.571429
+    C192 OBJROW 11           R13 2449.1428571
+    C192 R63  -4956.85714 R89  -4251.85714
+    C192 R117 7742.7142857
+    C193 OBJROW 12           R19 2217.2857143
+    C193 R35 310.14285714 R69  -4987.71429
+    C193 R93  -2046.28571 R134 7356.8571429
+    C194 OBJROW 13           R11  -2982.28571
+    C194 R59 2089.8571429 R86 4316.7142857
+    C194 R120  -4013.71429 R134  -989.428571
+    C194 R138 8644.4285714
+    C195 OBJROW 1            R7 8419.7142857
+    C195 R43  -1242.28571 R49 2401        
+    C195 R83 7882         R121  -1917.57143
+    C195 R126 5350.4285714 R141  -3240.71429
+    C196 OBJROW 2            R46  -4325.14286
+    C197 OBJROW 3            R32 202.71428571
+    C197 R66 3275.1428571
+    C198 OBJROW 4            R82  -4944.14286
+    C198 R139 8770.2857143 R141 2901.2857143
+    C199 OBJROW 5            R51  -2431.71429
+    C199 R76 8885.8571429 R118 8263.2857143
+    C199 R132  -602.857143
+    C200 OBJROW 6            R11 1827.4285714
+    C200 R24 5375.5714286 R31 7116.2857143
+    C200 R71 6865         R102 6515.7142857
+    C201 OBJROW 7            R23  -3438.42857
+    C201 R24  -328.428571 R72 859.14285714
+    C201 R85  -2793.14286 R112 8823        
+    C201 R139 3201.7142857
+    C202 OBJROW 8            R43  -3194.14286
+    C202 R51 669.28571429 R80  -1472.14286
+    C202 R83 5385.5714286 R88 3877.4285714
+    C202 R105  -3555.71429
+    C203 OBJROW 9            R134 -2728       
+    C204 OBJROW 10           R7 5663.1428571
+    C204 R89  -2188.71429
+    C205 OBJROW 11           R7  -2793.71429
+    C205 R81  -1008.71429 R90 610.42857143
+    C206 OBJROW 12           R78 6799.8571429
+    C206 R115 3801.1428571 R122  -4747.71429
+    C206 R148 5676.1428571
+    C207 OBJROW 13           R9 587.85714286
+    C207 R65 933.14285714 R105 3415.1428571
+    C207 R113 72.142857143 R140  -303.142857
+    C208 OBJROW 1            R50  -1571.14286
+    C208 R74  -1246.28571 R95 1004.4285714
+    C208 R111  -3323.28571 R132 3038.8571429
+    C208 R141 8744.7142857
+    C209 OBJROW 2            R3 2686        
+    C209 R52  -800.285714 R64 4086.1428571
+    C209 R74 8827.2857143 R88 8970.4285714
+    C209 R101  -1507.85714 R105 9046.8571429
+    C210 OBJROW 3            R56 -3156       
+    C211 OBJROW 4            R32 3054.5714286
+    C211 R126 526.14285714
+    C212 OBJROW 5            R32 4078.8571429
+    C212 R67 5908.1428571 R109 5975.8571429
+    C213 OBJROW 6            R67  -4716.14286
+    C213 R129 2490.8571429 R132 3943        
+    C213 R138 2934        
+    C214 OBJROW 7            R23 5327.8571429
+    C214 R36  -3771.14286 R84  -3179.71429
+    C214 R86  -930.285714 R147  -1441.57143
+    C215 OBJROW 8            R30 -3640       
+    C215 R55  -3439.57143 R72 6339.1428571
+    C215 R90  -1564.42857 R119  -1183.42857
+    C215 R134 607.57142857
+    C216 OBJROW 9            R15  -4542.57143
+    C216 R35 6913.7142857 R44 5073.5714286
+    C216 R64  -3656.42857 R89 4332.4285714
+    C216 R136 5595.5714286 R147  -160.285714
+    C217 OBJROW 10           R52  -4105.14286
+    C218 OBJROW 11           R57  -3695.71429
+    C218 R145 3963.2857143
+    C219 OBJROW 12           R9 5740        
+    C219 R64 3063.2857143 R149 2748.7142857
+    C220 OBJROW 13           R44  -1214.14286
+    C220 R101 3388.5714286 R106  -1795.71429
+    C220 R141  -506.428571
+    C221 OBJROW 1            R36 2047.4285714
+    C221 R47  -2132.42857 R55 3554        
+    C221 R78  -4759.71429 R99 1373        
+    C222 OBJROW 2            R62 6672        
+    C222 R75 5177         R98  -2203.14286
+    C222 R110 6467         R122 1198.2857143
+    C222 R135 3171.5714286
+    C223 OBJROW 3            R11 7084.4285714
+    C223 R27 1842.4285714 R45 1128.7142857
+    C223 R71 1491.7142857 R97  -3946.28571
+    C223 R104  -1647.14286 R143 5611.8571429
+    C224 OBJROW 4            R131  -1095.42857
+    C225 OBJROW 5            R32 1667.8571429
+    C225 R87  -4196.85714
+    C226 OBJROW 6            R59  -4863.28571
+    C226 R65 -1815        R103  -3739.42857
+    C227 OBJROW 7            R32 8640.4285714
+    C227 R81 7367.4285714 R119  -2927.71429
+    C227 R128 7585.2857143
+    C228 OBJROW 8            R31 3937.1428571
+    C228 R65 4156.2857143 R69 6333.2857143
+    C228 R93 7799.8571429 R120 2362.5714286
+    C229 OBJROW 9            R33 2609.7142857
+    C229 R70 8770.4285714 R81 9449.8571429
+    C229 R95  -2425.85714 R147 3590.5714286
+    C230 OBJROW 10           R28 8625.8571429
+    C230 R45 997.14285714 R51  -4732.42857
+    C230 R93 4030.5714286 R95  -2081.85714
+    C230 R117  -4799.71429 R129 3956.4285714
+    C231 OBJROW 11           R138 2453.7142857
+    C232 OBJROW 12           R91 -271        
+    C232 R140 7009.4285714
+    C233 OBJROW 13           R24 -2377       
+    C233 R28  -190.285714 R104 7162.7142857
+    C234 OBJROW 1            R69 -3501       
+    C234 R71 8580.4285714 R87 6189.4285714
+    C234 R143 8489.1428571
+    C235 OBJROW 2            R3 5875.5714286
+    C235 R13 5098         R100  -2685.42857
+    C235 R106 4953.7142857 R132 7159.2857143
+    C236 OBJROW 3            R43 3690.1428571
+    C236 R53 4039         R68 4933.7142857
+    C236 R72 -4181        R97 2687.4285714
+    C236 R141 7039.1428571
+    C237 OBJROW 4            R25 6200.8571429
+    C237 R36 2036.5714286 R51  -2312.85714
+    C237 R58 6860.1428571 R75 6786.1428571
+    C237 R99  -1017.85714 R132 3720.1428571
+    C238 OBJROW 5            R21  -200.571429
+    C239 OBJROW 6            R63 -966        
+    C239 R135  -271.571429
+    C240 OBJROW 7            R6 6906.2857143
+    C240 R33 4241.8571429 R49  -3402.42857
+    C241 OBJROW 8            R32 8303.1428571
+    C241 R41 3128.5714286 R65 8498.4285714
+    C241 R66  -2336.71429
+    C242 OBJROW 9            R15  -2605.85714
+    C242 R52 4475.1428571 R74 2178.5714286
+    C242 R84 374.85714286 R114 1235        
+    C243 OBJROW 10           R15 7453.2857143
+    C243 R49 8686.5714286 R85 1541.7142857
+    C243 R93 5721.7142857 R134  -2934.42857
+    C243 R144  -277.571429
+    C244 OBJROW 11           R7  -2446.57143
+    C244 R24 8815.7142857 R51 7402.7142857
+    C244 R82 1675.5714286 R95 2510.7142857
+    C244 R110  -2222.28571 R127 3559.5714286
+    C245 OBJROW 12           R26 4093.7142857
+    C246 OBJROW 13           R51  -2544.14286
+    C246 R63  -973.428571
+    C247 OBJROW 1            R21  -1693.28571
+    C247 R81 1402.4285714 R96 8128.5714286
+    C248 OBJROW 2            R49 6394        
+    C248 R107 9087.5714286 R114 2371.2857143
+    C248 R125 844.57142857
+    C249 OBJROW 3            R16 7953.5714286
+    C249 R22  -2133.42857 R55 8692        
+    C249 R78 4498         R141 -4297       
+    LONGCOLUMNNAME250 OBJROW 4            R25 4489.1428571
+    LONGCOLUMNNAME250 R37 252.14285714 R79 6604        
+    LONGCOLUMNNAME250 R106 5735.1428571 R115 598.71428571
+    LONGCOLUMNNAME250 R129 6264.1428571
+    C251 OBJROW 5            R18 3461.4285714
+    C251 R20 2726.4285714 R28 -635        
+    C251 R43 8482.4285714 R57 7969.1428571
+    C251 R58  -3788.71429 R96 1516.8571429
+    C252 OBJROW 6            R104 8666.8571429
+    C253 OBJROW 7            R1 6950.1428571
+    C253 R140 1158.5714286
+    C254 OBJROW 8            R44 4757.2857143
+    C254 R111 4911.8571429 R113 3947.4285714
+    C255 OBJROW 9            R42 1138.5714286
+    C255 R110 4524.7142857 R117 7879.2857143
+    C255 R143  -2623.42857
+    C256 OBJROW 10           R66  -1665.28571
+    C256 R74 3199.5714286 R80 4899.4285714
+    C256 R87 -2362        R148  -3219.71429
+    C257 OBJROW 11           R8 4329.2857143
+    C257 R41 8297.1428571 R84 7804.1428571
+    C257 R112  -1237.14286 R114  -1627.71429
+    C257 R130 7327.2857143
+    C258 OBJROW 12           R19 862         
+    C258 R40  -4191.57143 R50 6103.7142857
+    C258 R75 6456.7142857 R79 5203.5714286
+    C258 R100 3586.8571429 R135 4534.7142857
+    C259 OBJROW 13           R42 5806.8571429
+    C260 OBJROW 1            R26 9228.8571429
+    C260 R80 334.71428571
+    C261 OBJROW 2            R104  -3567.85714
+    C261 R109 6904.4285714 R119 -4284       
+    C262 OBJROW 3            R72 4035        
+    C262 R119 8642         R123 3526.7142857
+    C262 R128 3796.5714286
+    C263 OBJROW 4            R8  -461.428571
+    C263 R57  -3466.14286 R69 3957        
+    C263 R79  -4598.28571 R94 -2694       
+    C264 OBJROW 5            R7 6582.4285714
+    C264 R39 6724.7142857 R46  -1020.71429
+    C264 R72  -2798.85714 R91 6799.1428571
+    C264 R104  -4821.14286
+    C265 OBJROW 6            R38 623         
+    C265 R39 2514.1428571 R62  -412.142857
+    C265 R99 7545.4285714 R116 2226.2857143
+    C265 R123  -593.571429 R131 8959.7142857
+    C266 OBJROW 7            R83 6265.7142857
+    C267 OBJROW 8            R32 320.42857143
+    C267 R34  -4780.85714
+    C268 OBJROW 9            R44 2927.5714286
+    C268 R79 632          R134 2085.5714286
+    C269 OBJROW 10           R14 8198.1428571
+    C269 R19 2128.1428571 R30 7190        
+    C269 R78 6660        
+    C270 OBJROW 11           R17 6383.7142857
+    C270 R21  -1456.14286 R36 2834.5714286
+    C270 R44  -1081.14286 R141 -637        
+    C271 OBJROW 12           R12 8240.4285714
+    C271 R27  -2721.42857 R50  -4860.42857
+    C271 R90 3108.1428571 R120 544.57142857
+    C271 R139 8437.7142857
+    C272 OBJROW 13           R42  -2989.57143
+    C272 R43 9032.4285714 R47  -3166.57143
+    C272 R109 8827.1428571 R110 7164.1428571
+    C272 R118 4474.1428571 R129 2479.4285714
+    C273 OBJROW 1            R88 7968        
+    C274 OBJROW 2            R22 6123.7142857
+    C274 R55 4703.8571429
+    C275 OBJROW 3            R17  -2545.85714
+    C275 R101 9004         R145 2026.4285714
+    C276 OBJROW 4            R89 7992        
+    C276 R125  -3487.14286 R132  -1754.42857
+    C276 R140 1835        
+    C277 OBJROW 5            R46  -1255.57143
+    C277 R59 248.85714286 R74  -4434.85714
+    C277 R91  -2670.57143 R125  -1227.28571
+    C278 OBJROW 6            R11  -3101.71429
+    C278 R20 7389.5714286 R45 8558        
+    C278 R72  -3816.57143 R106 7116.1428571
+    C278 R127 4245.8571429
+    C279 OBJROW 7            R3 2331        
+    C279 R34 7123.7142857 R41 9205.4285714
+    C279 R46 8117         R50 5877.5714286
+    C279 R63 3166.8571429 R91  -3707.28571
+    C280 OBJROW 8            R120  -1977.71429
+    C281 OBJROW 9            R79 8753.5714286
+    C281 R94 1558.5714286
+    C282 OBJROW 10           R60  -59.5714286
+    C282 R121  -3857.57143 R123 2377.1428571
+    C283 OBJROW 11           R43 3666.7142857
+    C283 R78  -3962.14286 R94  -628.285714
+    C283 R108  -4125.14286
+    C284 OBJROW 12           R12 933.71428571
+    C284 R15 6079.1428571 R53 372.14285714
+    C284 R92 4787.2857143 R93  -2385.42857
+    C285 OBJROW 13           R32  -3705.85714
+    C285 R33 8011.4285714 R42  -1721.42857
+    C285 R57  -1070.28571 R90  -4102.71429
+    C285 R91 5200.7142857
+    C286 OBJROW 1            R25  -2006.28571
+    C286 R60 8862.1428571 R74  -3639.28571
+    C286 R98 6932.4285714 R133 8105.4285714
+    C286 R134 -65          R139 7518.5714286
+    C287 OBJROW 2            R112  -1226.28571
+    C288 OBJROW 3            R88 6227.7142857
+    C288 R102 3555.2857143
+    C289 OBJROW 4            R60 192.14285714
+    C289 R62  -990.285714 R107 6353.5714286
+    C290 OBJROW 5            R10 3259.2857143
+    C290 R20 2281.8571429 R76  -1755.42857
+    C290 R78 1988.2857143
+    C291 OBJROW 6            R2 -4662       
+    C291 R76 3156.8571429 R82 -2196       
+    C291 R113 5774.1428571 R143 7676.7142857
+    C292 OBJROW 7            R26 7382.2857143
+    C292 R54  -2215.28571 R90  -538.428571
+    C292 R100  -4282.28571 R105 3871.1428571
+    C292 R119  -3494.71429
+    C293 OBJROW 8            R8  -458.714286
+    C293 R10 6568.1428571 R24 2640        
+    C293 R34  -4432.14286 R42 5578.7142857
+    C293 R88  -3595.71429 R120 1024.2857143
+    C294 OBJROW 9            R126 2016.5714286
+    C295 OBJROW 10           R6 9077.4285714
+    C295 R44 395.85714286
+    C296 OBJROW 11           R9 7931        
+    C296 R24 7450.1428571 R85 8058.2857143
+    C297 OBJROW 12           R7 2031.1428571
+    C297 R39 1357         R41 2473.2857143
+    C297 R81  -4537.71429
+    C298 OBJROW 13           R24 6651.4285714
+    C298 R44 8499         R112 8365.5714286
+    C298 R120  -1175.14286 R141 3042.5714286
+    C299 OBJROW 1            R1 1913.7142857
+    C299 R25 8961.1428571 R43  -4898.71429
+    C299 R47  -863.571429 R52 5839        
+    C299 R116  -4049.42857
+    C300 OBJROW 2            R6 2077.4285714
+    C300 R24 3109.5714286 R66 6685.8571429
+    C300 R82 195.71428571 R102 3327.4285714
+    C300 R106  -647.571429 R125 4853.2857143
+    C301 OBJROW 3            R5  -3554.28571
+    C302 OBJROW 4            R36  -1840.14286
+    C302 R140  -315.142857
+    C303 OBJROW 5            R58  -4801.85714
+    C303 R67 1457.2857143 R68 3346.8571429
+    C304 OBJROW 6            R20 4108.4285714
+    C304 R76  -4928.42857 R113 -3352       
+    C304 R126 -2662       
+    C305 OBJROW 7            R1  -2761.42857
+    C305 R29 7964.8571429 R36 7631.4285714
+    C305 R92  -4685.57143 R133 8570.7142857
+    C306 OBJROW 8            R50 4263.4285714
+    C306 R54 6591.8571429 R73  -2315.14286
+    C306 R113 -2573        R141 2916.5714286
+    C306 R145  -2183.85714
+    C307 OBJROW 9            R0  -4866.71429
+    C307 R4  -3927.71429 R35 7042.4285714
+    C307 R46 348.28571429 R48  -1379.57143
+    C307 R51  -2998.42857 R72 494.85714286
+    C308 OBJROW 10           R11 9014.2857143
+    C309 OBJROW 11           R16 3837        
+    C309 R125  -3376.28571
+    C310 OBJROW 12           R30 -1255       
+    C310 R53 8052.5714286 R128  -2346.71429
+    C311 OBJROW 13           R41  -3597.14286
+    C311 R50  -3963.14286 R128 5521.2857143
+    C311 R130 7.2857142857
+    C312 OBJROW 1            R5  -1272.14286
+    C312 R8 7981.2857143 R46 1955.4285714
+    C312 R110  -1546.57143 R139  -4254.57143
+    C313 OBJROW 2            R40 8019        
+    C313 R55  -3191.57143 R56 7223        
+    C313 R86  -1165.71429 R90  -4656.57143
+    C313 R95 -366        
+    C314 OBJROW 3            R18 6204.7142857
+    C314 R33 2744.7142857 R85  -3007.57143
+    C314 R94 4638.2857143 R104 1453.5714286
+    C314 R113  -1244.57143
+    C315 OBJROW 4            R124 6876.5714286
+    C316 OBJROW 5            R45 2737.4285714
+    C316 R75 2090.1428571
+    C317 OBJROW 6            R64 221.85714286
+    C317 R79 552.57142857 R124  -1008.71429
+    C318 OBJROW 7            R1 6132.2857143
+    C318 R11 5836.1428571 R120 8098.1428571
+    C318 R138 6576        
+    C319 OBJROW 8            R1 -4710       
+    C319 R17 9138.5714286 R46  -1713.71429
+    C319 R90 6206.1428571 R139 7185.2857143
+    C320 OBJROW 9            R24  -4894.57143
+    C320 R39 7977.2857143 R61 -2991       
+    C320 R63  -65.1428571 R81 8255.5714286
+    C320 R145 5798.2857143
+    C321 OBJROW 10           R61 5919.7142857
+    C321 R62 1406         R73 7516.1428571
+    C321 R78  -3061.57143 R94 3949.7142857
+    C321 R114 8109.5714286 R117 7309        
+    C322 OBJROW 11           R29 6818.8571429
+    C323 OBJROW 12           R7 5674        
+    C323 R109  -4068.14286
+    C324 OBJROW 13           R30 -3989       
+    C324 R51 2936         R121 5948.4285714
+    C325 OBJROW 1            R8  -446.428571
+    C325 R56 3240.5714286 R133 3999.1428571
+    C325 R141 6242.4285714
+    C326 OBJROW 2            R37 6411.4285714
+    C326 R71  -4801.57143 R87 9056.2857143
+    C326 R124  -2946.57143 R144 5780.4285714
+    C327 OBJROW 3            R25  -874.571429
+    C327 R26  -2879.42857 R43 140.57142857
+    C327 R74 4698.4285714 R86 7071.5714286
+    C327 R122 3838.1428571
+    C328 OBJROW 4            R14 8566.5714286
+    C328 R31  -4997.85714 R52 -1257       
+    C328 R82  -4150.14286 R103  -2800.57143
+    C328 R125  -3136.71429 R142 3407.1428571
+    C329 OBJROW 5            R9 2198.8571429
+    C330 OBJROW 6            R34 482.57142857
+    C330 R98 1700.4285714
+    C331 OBJROW 7            R3 -1083       
+    C331 R60 8967.4285714 R71  -1484.42857
+    C332 OBJROW 8            R11 7530.1428571
+    C332 R13 7594         R36 6716.5714286
+    C332 R77 6991.5714286
+    C333 OBJROW 9            R25 1178.8571429
+    C333 R27  -2640.71429 R54 5351        
+    C333 R93 -906         R94  -171.714286
+    C334 OBJROW 10           R13 7250.5714286
+    C334 R25 8384.5714286 R49 5958.8571429
+    C334 R63  -2670.71429 R70  -2178.42857
+    C334 R90 2412.1428571
+    C335 OBJROW 11           R0 2119.7142857
+    C335 R27 7775.5714286 R50 4600.2857143
+    C335 R66 3139.4285714 R87 2999        
+    C335 R95 1104.4285714 R131 3006.7142857
+    C336 OBJROW 12           R72  -3833.71429
+    C337 OBJROW 13           R12  -101.285714
+    C337 R110  -2450.57143
+    C338 OBJROW 1            R25 969.85714286
+    C338 R81 8512         R120 7195.2857143
+    C339 OBJROW 2            R20 6940.7142857
+    C339 R34 361.57142857 R47 3152.2857143
+    C339 R136 8569.7142857
+    C340 OBJROW 3            R26 8316.5714286
+    C340 R60 6478.5714286 R109  -538.428571
+    C340 R137  -1360.42857 R138 6819.7142857
+    C341 OBJROW 4            R12 9158.5714286
+    C341 R18  -3302.85714 R73 3757.1428571
+    C341 R75  -3160.42857 R79 65.571428571
+    C341 R126  -162.142857
+    C342 OBJROW 5            R9 8965.1428571
+    C342 R24 9047.1428571 R36 1480.7142857
+    C342 R46 5616.8571429 R83 6836.4285714
+    C342 R95 194.71428571 R146  -887.857143
+    C343 OBJROW 6            R42 4913.1428571
+    C344 OBJROW 7            R115  -1688.14286
+    C344 R121 7676.8571429
+    C345 OBJROW 8            R70 13434.857143
+    C345 R113  -2805.14286
+    C346 OBJROW 9            R41 2934.5714286
+    C346 R43  -338.428571 R52 2866.2857143
+    C346 R146 7685.2857143
+    C347 OBJROW 10           R7 4412.7142857
+    C347 R14 2154         R55 2165.1428571
+    C347 R101  -3915.14286 R118 7895.2857143
+    C348 OBJROW 11           R27 -4921       
+    C348 R36  -2763.85714 R89  -2078.85714
+    C348 R119  -1768.14286 R132 4529.4285714
+    C348 R144 2797.1428571
+    C349 OBJROW 12           R5 931.57142857
+    C349 R13 5538.1428571 R78  -648.857143
+    C349 R87  -2247.14286 R108  -3302.85714
+    C349 R136  -239.285714 R143 6982.1428571
+    C350 OBJROW 13           R94 3374.2857143
+    C351 OBJROW 1            R13 2229        
+    C351 R128 5859.1428571
+    C352 OBJROW 2            R9 40.714285714
+    C352 R83 6741.7142857 R95 5699.2857143
+    C353 OBJROW 3            R11  -1028.42857
+    C353 R55 1382.2857143 R117  -1397.42857
+    C353 R120 4200.4285714
+    C354 OBJROW 4            R7 4763.1428571
+    C354 R69 2672.2857143 R87 5846.8571429
+    C354 R129  -17.5714286 R141 -407        
+    C355 OBJROW 5            R47  -2128.42857
+    C355 R53 9198.8571429 R56 7123.5714286
+    C355 R89 4574.2857143 R115 8842        
+    C355 R126  -493.285714
+    C356 OBJROW 6            R17 7522        
+    C356 R37 -1341        R72 3692.8571429
+    C356 R81 1393.7142857 R98 8880.1428571
+    C356 R125 9071.2857143 R135 1335.8571429
+    C357 OBJROW 7            R61 7764.5714286
+    C358 OBJROW 8            R123 16528.142857
+    C359 OBJROW 9            R31 8707.5714286
+    C359 R89  -4822.28571 R125  -2356.14286
+    C360 OBJROW 10           R5 7326.7142857
+    C360 R104 7748.1428571 R123 3870.5714286
+    C360 R132 5320        
+    C361 OBJROW 11           R4 5005.8571429
+    C361 R28 8954.7142857 R45 8882        
+    C361 R50 1871.4285714 R114 2401.4285714
+    C362 OBJROW 12           R16 6928.2857143
+    C362 R31 8385.2857143 R75 7488        
+    C362 R79 9093.2857143 R92 6041.7142857
+    C362 R141 5883.2857143
+    C363 OBJROW 13           R2 9148.5714286
+    C363 R5 7091.1428571 R14  -356.142857
+    C363 R57  -3112.14286 R61  -4354.14286
+    C363 R72 -2581        R107 2367.1428571
+    C364 OBJROW 1            R15 4031.4285714
+    C365 OBJROW 2            R57 3503.2857143
+    C365 R71  -3431.14286
+    C366 OBJROW 3            R64  -577.571429
+    C366 R74 5826.2857143 R109 8943.8571429
+    C367 OBJROW 4            R13  -3121.71429
+    C367 R19  -3254.57143 R91  -4966.42857
+    C367 R104 5210.4285714
+    C368 OBJROW 5            R3 -399        
+    C368 R27 4917.4285714 R30 2641.1428571
+    C368 R60  -2558.57143 R125 -2565       
+    C369 OBJROW 6            R52 3881.8571429
+    C369 R64 9028.2857143 R85 7480.5714286
+    C369 R86 5594.7142857 R98 5458.2857143
+    C369 R109 964.71428571
+    C370 OBJROW 7            R4  -3924.28571
+    C370 R45 537.71428571 R71 919.71428571
+    C370 R81 5979.2857143 R109 4148.1428571
+    C370 R124 4833.7142857
+    C371 OBJROW 8            R113  -1091.42857
+    C372 OBJROW 9            R9 1537        
+    C372 R139  -247.714286
+    C373 OBJROW 10           R22 3252.7142857
+    C373 R49 7672.4285714 R116 2568.5714286
+    C374 OBJROW 11           R7 2713.8571429
+    C374 R68 7686.8571429 R90  -3399.14286
+    C374 R129  -4720.14286
+    C375 OBJROW 12           R18  -3866.85714
+    C375 R43  -3288.71429 R49 7203.5714286
+    C375 R51  -155.142857 R77 -4582       
+    C376 OBJROW 13           R37 6528.1428571
+    C376 R38 2791.8571429 R49 -4556       
+    C376 R84  -3523.14286 R87 1054.8571429
+    C376 R123 -3813       
+    C377 OBJROW 1            R14  -3556.85714
+    C377 R17 3643.2857143 R29 188.14285714
+    C377 R61  -4822.85714 R83 5839        
+    C377 R96 6307.8571429 R118 8345.4285714
+    C378 OBJROW 2            R5 583.42857143
+    C379 OBJROW 3            R28 8741.4285714
+    C379 R134  -1558.42857
+    C380 OBJROW 4            R70 4212.1428571
+    C380 R72 8266.1428571 R97 3603.4285714
+    C381 OBJROW 5            R5 3674.8571429
+    C381 R84 5535.1428571 R136 4808.5714286
+    C382 OBJROW 6            R59  -3618.42857
+    C382 R60 3971         R96 2427.7142857
+    C382 R106 8258         R141 -400        
+    C383 OBJROW 7            R26 3267.4285714
+    C383 R44  -640.428571 R66 -1313       
+    C383 R97 8862.1428571 R144 3948.2857143
+    C383 R147 8494.2857143
+    C384 OBJROW 8            R14 -3337       
+    C384 R17  -1150.57143 R28 8830.7142857
+    C384 R72 5320.4285714 R94 8627        
+    C384 R122 1528.5714286 R148  -2212.85714
+    C385 OBJROW 9            R75 3597.7142857
+    C386 OBJROW 10           R17 5476.4285714
+    C386 R35  -267.142857
+    C387 OBJROW 11           R1 1208.1428571
+    C387 R6 7136.4285714 R146  -1473.71429
+    C388 OBJROW 12           R27 5044.1428571
+    C388 R114 5349.5714286 R118  -3756.57143
+    C388 R128 5413.4285714
+    C389 OBJROW 13           R3  -3828.85714
+    C389 R16 1671         R73 6845        
+    C389 R87 717.14285714 R132  -3237.42857
+    C390 OBJROW 1            R21  -3633.71429
+    C390 R44 1312.2857143 R45  -2076.42857
+    C390 R71 6882.1428571 R72 7692.1428571
+    C390 R96  -916.571429
+    C391 OBJROW 2            R27 -4570       
+    C391 R36 -1944        R37 3358.1428571
+    C391 R46  -2620.85714 R69 6564.7142857
+    C391 R86 4670.7142857 R147  -4983.28571
+    C392 OBJROW 3            R66 6017.7142857
+    C393 OBJROW 4            R125 3711.7142857
+    C393 R138 7738.7142857
+    C394 OBJROW 5            R49  -3520.14286
+    C394 R112 3222.8571429 R119 -3597       
+    C395 OBJROW 6            R56  -3373.28571
+    C395 R92 2826.4285714 R99  -4349.14286
+    C395 R147  -4070.57143
+    C396 OBJROW 7            R68 5976.7142857
+    C396 R69 2666.2857143 R102  -576.857143
+    C396 R128  -4419.57143 R130  -584.285714
+    C397 OBJROW 8            R30 4783.2857143
+    C397 R76 2717.7142857 R78 6088.5714286
+    C397 R79 3267         R113 3394.4285714
+    C397 R141  -1424.28571
+    C398 OBJROW 9            R2 7874.7142857
+    C398 R4 6248.7142857 R10 6921.7142857
+    C398 R70  -243.285714 R108 1467.7142857
+    C398 R135 84.428571429 R147 8638.5714286
+    C399 OBJROW 10           R9 7797.7142857
+RHS
+    RHS R0 100          R1 100         
+    RHS R2 100          R3 100         
+    RHS R4 100          R5 100         
+    RHS R6 100          R7 100         
+    RHS R8 100          R9 100         
+    RHS R10 100          R11 100         
+    RHS R12 100          R13 100         
+    RHS R14 100          R15 100         
+    RHS R16 100          R17 100         
+    RHS R18 100          R19 100         
+    RHS R20 100          R21 100         
+    RHS R22 100          R23 100         
+    RHS R24 100          R25 100         
+    RHS R26 100          R27 100         
+    RHS R28 100          R29 100         
+    RHS R30 100          R31 100         
+    RHS R32 100          R33 100         
+    RHS R34 100          R35 100         
+    RHS R36 100          R37 100         
+    RHS R38 100          R39 100         
+    RHS R40 100          R41 100         
+    RHS R42 100          R43 100         
+    RHS R44 100          R45 100         
+    RHS R46 100          R47 100         
+    RHS R48 100          R49 100         
+    RHS R50 100          R51 100         
+    RHS R52 100          R53 100         
+    RHS R54 100          R55 100         
+    RHS R56 100          R57 100         
+    RHS R58 100          R59 100         
+    RHS R60 100          R61 100         
+    RHS R62 100          R63 100         
+    RHS R64 100          R65 100         
+    RHS R66 100          R67 100         
+    RHS R68 100          R69 100         
+    RHS R70 100          R71 100         
+    RHS R72 100          R73 100         
+    RHS R74 100          R75 100         
+    RHS R76 100          R77 100         
+    RHS R78 100          R79 100         
+    RHS R80 100          R81 100         
+    RHS R82 100          R83 100         
+    RHS R84 100          R85 100         
+    RHS R86 100          R87 100         
+    RHS R88 100          R89 100         
+    RHS R90 100          R91 100         
+    RHS R92 100          R93 100         
+    RHS R94 100          R95 100         
+    RHS R96 100          R97 100         
+    RHS R98 100          R99 100         
+    RHS R100 100          R101 100         
+    RHS R102 100          R103 100         
+    RHS R104 100          R105 100         
+    RHS R106 100          R107 100         
+    RHS R108 100          R109 100         
+    RHS R110 100          R111 100         
+    RHS R112 100          R113 100         
+    RHS R114 100          R115 100         
+    RHS R116 100          R117 100         
+    RHS R118 100          R119 100         
+    RHS R120 100          R121 100         
+    RHS R122 100          R123 100         
+    RHS R124 100          R125 100         
+    RHS R126 100          R127 100         
+    RHS R128 100          R129 100         
+    RHS R130 100          R131 100         
+    RHS R132 100          R133 100         
+    RHS R134 100          R135 100         
+    RHS R136 100          R137 100         
+    RHS R138 100          R139 100         
+    RHS R140 100          R141 100         
+    RHS R142 100          R143 100         
+    RHS R144 100          R145 100         
+    RHS R146 100          R147 100         
+    RHS R148 100          R149 100         
+RANGES
+    RANGE R0 101          R1 101         
+    RANGE R2 101          R3 101         
+    RANGE R4 101          R5 101         
+    RANGE R6 101          R7 101         
+    RANGE R8 101          R9 101         
+    RANGE R10 101          R11 101         
+    RANGE R12 101          R13 101         
+    RANGE R14 101          R15 101         
+    RANGE R16 101          R17 101         
+    RANGE R18 101          R19 101         
+    RANGE R20 101          R21 101         
+    RANGE R22 101          R23 101         
+    RANGE R24 101          R25 101         
+    RANGE R26 101          R27 101         
+    RANGE R28 101          R29 101         
+    RANGE R30 101          R31 101         
+    RANGE R32 101          R33 101         
+    RANGE R34 101          R35 101         
+    RANGE R36 101          R37 101         
+    RANGE R38 101          R39 101         
+    RANGE R40 101          R41 101         
+    RANGE R42 101          R43 101         
+    RANGE R44 101          R45 101         
+    RANGE R46 101          R47 101         
+    RANGE R48 101          R49 101         
+    RANGE R50 101          R51 101         
+    RANGE R52 101          R53 101         
+    RANGE R54 101          R55 101         
+    RANGE R56 101          R57 101         
+    RANGE R58 101          R59 101         
+    RANGE R60 101          R61 101         
+    RANGE R62 101          R63 101         
+    RANGE R64 101          R65 101         
+    RANGE R66 101          R67 101         
+    RANGE R68 101          R69 101         
+    RANGE R70 101          R71 101         
+    RANGE R72 101          R73 101         
+    RANGE R74 101          R75 101         
+    RANGE R76 101          R77 101         
+    RANGE R78 101          R79 101         
+    RANGE R80 101          R81 101         
+    RANGE R82 101          R83 101         
+    RANGE R84 101          R85 101         
+    RANGE R86 101          R87 101         
+    RANGE R88 101          R89 101         
+    RANGE R90 101          R91 101         
+    RANGE R92 101          R93 101         
+    RANGE R94 101          R95 101         
+    RANGE R96 101          R97 101         
+    RANGE R98 101          R99 101         
+    RANGE R100 101          R101 101         
+    RANGE R102 101          R103 101         
+    RANGE R104 101          R105 101         
+    RANGE R106 101          R107 101         
+    RANGE R108 101          R109 101         
+    RANGE R110 101          R111 101         
+    RANGE R112 101          R113 101         
+    RANGE R114 101          R115 101         
+    RANGE R116 101          R117 101         
+    RANGE R118 101          R119 101         
+    RANGE R120 101          R121 101         
+    RANGE R122 101          R123 101         
+    RANGE R124 101          R125 101         
+    RANGE R126 101          R127 101         
+    RANGE R128 101          R129 101         
+    RANGE R130 101          R131 101         
+    RANGE R132 101          R133 101         
+    RANGE R134 101          R135 101         
+    RANGE R136 101          R137 101         
+    RANGE R138 101          R139 101         
+    RANGE R140 101          R141 101         
+    RANGE R142 101          R143 101         
+    RANGE R144 101          R145 101         
+    RANGE R146 101          R147 101         
+    RANGE R148 101          R149 101         
+BOUNDS
+ UI BOUND C0 10          
+ UP BOUND C1 10          
+ UP BOUND C2 10          
+ UP BOUND C3 10          
+ UP BOUND C4 10          
+ UI BOUND C5 10          
+ UP BOUND C6 10          
+ UP BOUND C7 10          
+ UP BOUND C8 10          
+ UP BOUND C9 10          
+ UI BOUND C10 10          
+ UP BOUND C11 10          
+ UP BOUND C12 10          
+ UP BOUND C13 10          
+ UP BOUND C14 10          
+ UI BOUND C15 10          
+ UP BOUND C16 10          
+ UP BOUND C17 10          
+ UP BOUND C18 10          
+ UP BOUND C19 10          
+ UI BOUND C20 10          
+ UP BOUND C21 10          
+ UP BOUND C22 10          
+ UP BOUND C23 10          
+ UP BOUND C24 10          
+ UI BOUND C25 10          
+ UP BOUND C26 10          
+ UP BOUND C27 10          
+ UP BOUND C28 10          
+ UP BOUND C29 10          
+ UI BOUND C30 10          
+ UP BOUND C31 10          
+ UP BOUND C32 10          
+ UP BOUND C33 10          
+ UP BOUND C34 10          
+ UI BOUND C35 10          
+ UP BOUND C36 10          
+ UP BOUND C37 10          
+ UP BOUND C38 10          
+ UP BOUND C39 10          
+ UI BOUND C40 10          
+ UP BOUND C41 10          
+ UP BOUND C42 10          
+ UP BOUND C43 10          
+ UP BOUND C44 10          
+ UI BOUND C45 10          
+ UP BOUND C46 10          
+ UP BOUND C47 10          
+ UP BOUND C48 10          
+ UP BOUND C49 10          
+ UI BOUND C50 10          
+ UP BOUND C51 10          
+ UP BOUND C52 10          
+ UP BOUND C53 10          
+ UP BOUND C54 10          
+ UI BOUND C55 10          
+ UP BOUND C56 10          
+ UP BOUND C57 10          
+ UP BOUND C58 10          
+ UP BOUND C59 10          
+ UI BOUND C60 10          
+ UP BOUND C61 10          
+ UP BOUND C62 10          
+ UP BOUND C63 10          
+ UP BOUND C64 10          
+ UI BOUND C65 10          
+ UP BOUND C66 10          
+ UP BOUND C67 10          
+ UP BOUND C68 10          
+ UP BOUND C69 10          
+ UI BOUND C70 10          
+ UP BOUND C71 10          
+ UP BOUND C72 10          
+ UP BOUND C73 10          
+ UP BOUND C74 10          
+ UI BOUND C75 10          
+ UP BOUND C76 10          
+ UP BOUND C77 10          
+ UP BOUND C78 10          
+ UP BOUND C79 10          
+ UI BOUND C80 10          
+ UP BOUND C81 10          
+ UP BOUND C82 10          
+ UP BOUND C83 10          
+ UP BOUND C84 10          
+ UI BOUND C85 10          
+ UP BOUND C86 10          
+ UP BOUND C87 10          
+ UP BOUND C88 10          
+ UP BOUND C89 10          
+ UI BOUND C90 10          
+ UP BOUND C91 10          
+ UP BOUND C92 10          
+ UP BOUND C93 10          
+ UP BOUND C94 10          
+ UI BOUND C95 10          
+ UP BOUND C96 10          
+ UP BOUND C97 10          
+ UP BOUND C98 10          
+ UP BOUND C99 10          
+ UI BOUND C100 10          
+ UP BOUND C101 10          
+ UP BOUND C102 10          
+ UP BOUND C103 10          
+ UP BOUND C104 10          
+ UI BOUND C105 10          
+ UP BOUND C106 10          
+ UP BOUND C107 10          
+ UP BOUND C108 10          
+ UP BOUND C109 10          
+ UI BOUND C110 10          
+ UP BOUND C111 10          
+ UP BOUND C112 10          
+ UP BOUND C113 10          
+ UP BOUND C114 10          
+ UI BOUND C115 10          
+ UP BOUND C116 10          
+ UP BOUND C117 10          
+ UP BOUND C118 10          
+ UP BOUND C119 10          
+ UI BOUND C120 10          
+ UP BOUND C121 10          
+ UP BOUND C122 10          
+ UP BOUND C123 10          
+ UP BOUND C124 10          
+ UI BOUND C125 10          
+ UP BOUND C126 10          
+ UP BOUND C127 10          
+ UP BOUND C128 10          
+ UP BOUND C129 10          
+ UI BOUND C130 10          
+ UP BOUND C131 10          
+ UP BOUND C132 10          
+ UP BOUND C133 10          
+ UP BOUND C134 10          
+ UI BOUND C135 10          
+ UP BOUND C136 10          
+ UP BOUND C137 10          
+ UP BOUND C138 10          
+ UP BOUND C139 10          
+ UI BOUND C140 10          
+ UP BOUND C141 10          
+ UP BOUND C142 10          
+ UP BOUND C143 10          
+ UP BOUND C144 10          
+ UI BOUND C145 10          
+ UP BOUND C146 10          
+ UP BOUND C147 10          
+ UP BOUND C148 10          
+ UP BOUND C149 10          
+ UI BOUND C150 10          
+ UP BOUND C151 10          
+ UP BOUND C152 10          
+ UP BOUND C153 10          
+ UP BOUND C154 10          
+ UI BOUND C155 10          
+ UP BOUND C156 10          
+ UP BOUND C157 10          
+ UP BOUND C158 10          
+ UP BOUND C159 10          
+ UI BOUND C160 10          
+ UP BOUND C161 10          
+ UP BOUND C162 10          
+ UP BOUND C163 10          
+ UP BOUND C164 10          
+ UI BOUND C165 10          
+ UP BOUND C166 10          
+ UP BOUND C167 10          
+ UP BOUND C168 10          
+ UP BOUND C169 10          
+ UI BOUND C170 10          
+ UP BOUND C171 10          
+ UP BOUND C172 10          
+ UP BOUND C173 10          
+ UP BOUND C174 10          
+ UI BOUND C175 10          
+ UP BOUND C176 10          
+ UP BOUND C177 10          
+ UP BOUND C178 10          
+ UP BOUND C179 10          
+ UI BOUND C180 10          
+ UP BOUND C181 10          
+ UP BOUND C182 10          
+ UP BOUND C183 10          
+ UP BOUND C184 10          
+ UI BOUND C185 10          
+ UP BOUND C186 10          
+ UP BOUND C187 10          
+ UP BOUND C188 10          
+ UP BOUND C189 10          
+ UI BOUND C190 10          
+ UP BOUND C191 10          
+ UP BOUND C192 10          
+ UP BOUND C193 10          
+ UP BOUND C194 10          
+ UI BOUND C195 10          
+ UP BOUND C196 10          
+ UP BOUND C197 10          
+ UP BOUND C198 10          
+ UP BOUND C199 10          
+ UI BOUND C200 10          
+ UP BOUND C201 10          
+ UP BOUND C202 10          
+ UP BOUND C203 10          
+ UP BOUND C204 10          
+ UI BOUND C205 10          
+ UP BOUND C206 10          
+ UP BOUND C207 10          
+ UP BOUND C208 10          
+ UP BOUND C209 10          
+ UI BOUND C210 10          
+ UP BOUND C211 10          
+ UP BOUND C212 10          
+ UP BOUND C213 10          
+ UP BOUND C214 10          
+ UI BOUND C215 10          
+ UP BOUND C216 10          
+ UP BOUND C217 10          
+ UP BOUND C218 10          
+ UP BOUND C219 10          
+ UI BOUND C220 10          
+ UP BOUND C221 10          
+ UP BOUND C222 10          
+ UP BOUND C223 10          
+ UP BOUND C224 10          
+ UI BOUND C225 10          
+ UP BOUND C226 10          
+ UP BOUND C227 10          
+ UP BOUND C228 10          
+ UP BOUND C229 10          
+ UI BOUND C230 10          
+ UP BOUND C231 10          
+ UP BOUND C232 10          
+ UP BOUND C233 10          
+ UP BOUND C234 10          
+ UI BOUND C235 10          
+ UP BOUND C236 10          
+ UP BOUND C237 10          
+ UP BOUND C238 10          
+ UP BOUND C239 10          
+ UI BOUND C240 10          
+ UP BOUND C241 10          
+ UP BOUND C242 10          
+ UP BOUND C243 10          
+ UP BOUND C244 10          
+ UI BOUND C245 10          
+ UP BOUND C246 10          
+ UP BOUND C247 10          
+ UP BOUND C248 10          
+ UP BOUND C249 10          
+ UI BOUND LONGCOLUMNNAME250 10          
+ UP BOUND C251 10          
+ UP BOUND C252 10          
+ UP BOUND C253 10          
+ UP BOUND C254 10          
+ UI BOUND C255 10          
+ UP BOUND C256 10          
+ UP BOUND C257 10          
+ UP BOUND C258 10          
+ UP BOUND C259 10          
+ UI BOUND C260 10          
+ UP BOUND C261 10          
+ UP BOUND C262 10          
+ UP BOUND C263 10          
+ UP BOUND C264 10          
+ UI BOUND C265 10          
+ UP BOUND C266 10          
+ UP BOUND C267 10          
+ UP BOUND C268 10          
+ UP BOUND C269 10          
+ UI BOUND C270 10          
+ UP BOUND C271 10          
+ UP BOUND C272 10          
+ UP BOUND C273 10          
+ UP BOUND C274 10          
+ UI BOUND C275 10          
+ UP BOUND C276 10          
+ UP BOUND C277 10          
+ UP BOUND C278 10          
+ UP BOUND C279 10          
+ UI BOUND C280 10          
+ UP BOUND C281 10          
+ UP BOUND C282 10          
+ UP BOUND C283 10          
+ UP BOUND C284 10          
+ UI BOUND C285 10          
+ UP BOUND C286 10          
+ UP BOUND C287 10          
+ UP BOUND C288 10          
+ UP BOUND C289 10          
+ UI BOUND C290 10          
+ UP BOUND C291 10          
+ UP BOUND C292 10          
+ UP BOUND C293 10          
+ UP BOUND C294 10          
+ UI BOUND C295 10          
+ UP BOUND C296 10          
+ UP BOUND C297 10          
+ UP BOUND C298 10          
+ UP BOUND C299 10          
+ UI BOUND C300 10          
+ UP BOUND C301 10          
+ UP BOUND C302 10          
+ UP BOUND C303 10          
+ UP BOUND C304 10          
+ UI BOUND C305 10          
+ UP BOUND C306 10          
+ UP BOUND C307 10          
+ UP BOUND C308 10          
+ UP BOUND C309 10          
+ UI BOUND C310 10          
+ UP BOUND C311 10          
+ UP BOUND C312 10          
+ UP BOUND C313 10          
+ UP BOUND C314 10          
+ UI BOUND C315 10          
+ UP BOUND C316 10          
+ UP BOUND C317 10          
+ UP BOUND C318 10          
+ UP BOUND C319 10          
+ UI BOUND C320 10          
+ UP BOUND C321 10          
+ UP BOUND C322 10          
+ UP BOUND C323 10          
+ UP BOUND C324 10          
+ UI BOUND C325 10          
+ UP BOUND C326 10          
+ UP BOUND C327 10          
+ UP BOUND C328 10          
+ UP BOUND C329 10          
+ UI BOUND C330 10          
+ UP BOUND C331 10          
+ UP BOUND C332 10          
+ UP BOUND C333 10          
+ UP BOUND C334 10          
+ UI BOUND C335 10          
+ UP BOUND C336 10          
+ UP BOUND C337 10          
+ UP BOUND C338 10          
+ UP BOUND C339 10          
+ UI BOUND C340 10          
+ UP BOUND C341 10          
+ UP BOUND C342 10          
+ UP BOUND C343 10          
+ UP BOUND C344 10          
+ UI BOUND C345 10          
+ UP BOUND C346 10          
+ UP BOUND C347 10          
+ UP BOUND C348 10          
+ UP BOUND C349 10          
+ UI BOUND C350 10          
+ UP BOUND C351 10          
+ UP BOUND C352 10          
+ UP BOUND C353 10          
+ UP BOUND C354 10          
+ UI BOUND C355 10          
+ UP BOUND C356 10          
+ UP BOUND C357 10          
+ UP BOUND C358 10          
+ UP BOUND C359 10          
+ UI BOUND C360 10          
+ UP BOUND C361 10          
+ UP BOUND C362 10          
+ UP BOUND C363 10          
+ UP BOUND C364 10          
+ UI BOUND C365 10          
+ UP BOUND C366 10          
+ UP BOUND C367 10          
+ UP BOUND C368 10          
+ UP BOUND C369 10          
+ UI BOUND C370 10          
+ UP BOUND C371 10          
+ UP BOUND C372 10          
+ UP BOUND C373 10          
+ UP BOUND C374 10          
+ UI BOUND C375 10          
+ UP BOUND C376 10          
+ UP BOUND C377 10          
+ UP BOUND C378 10          
+ UP BOUND C379 10          
+ UI BOUND C380 10          
+ UP BOUND C381 10          
+ UP BOUND C382 10          
+ UP BOUND C383 10          
+ UP BOUND C384 10          
+ UI BOUND C385 10          
+ UP BOUND C386 10          
+ UP BOUND C387 10          
+ UP BOUND C388 10          
+ UP BOUND C389 10          
+ UI BOUND C390 10          
+ UP BOUND C391 10          
+ UP BOUND C392 10          
+ UP BOUND C393 10          
+ UP BOUND C394 10          
+ UI BOUND C395 10          
+ UP BOUND C396 10          
+ UP BOUND C397 10          
+ UP BOUND C398 10          
+ UP BOUND C399 10          
+ENDATA
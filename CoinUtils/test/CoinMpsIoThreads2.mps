@@ -0,0 +1,12 @@
+NAME          BAD
+ROWS
+ N  OBJ
+ L  R1
+COLUMNS
+    X1        OBJ                1.   R1                 1.
+* comment
+    X2        OBJ                1.   R9                 1.
+    X2        R1                 1.   R1                 2.
+RHS
+    RHS       R1                 1.
+ENDATA
@@ -0,0 +1,231 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+// Times CoinNameHash against the chained hash CoinMpsIO and CoinLpIO used
+// before (reproduced here).
+//
+// nameHashBench [file.mps ...]
+//
+// With no arguments synthetic name sets are timed - default style names
+// (R0000001), generated names with subscripts (x_12_345) and random
+// strings.  Each file argument is read with CoinMpsIO and its row and
+// column names are timed.  For each set the table is built and then every
+// name is looked up followed by the same number of missing names.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "CoinMpsIO.hpp"
+#include "CoinNameHash.hpp"
+#include "CoinTime.hpp"
+
+namespace {
+
+// The old hash (chained through spare slots of a table 4 times size)
+const int mmult[] = {
+  262139, 259459, 256889, 254291, 251701, 249133, 246709, 244247,
+  241667, 239179, 236609, 233983, 231289, 228859, 226357, 223829,
+  221281, 218849, 216319, 213721, 211093, 208673, 206263, 203773,
+  201233, 198637, 196159, 193603, 191161, 188701, 186149, 183761,
+  181303, 178873, 176389, 173897, 171469, 169049, 166471, 163871,
+  161387, 158941, 156437, 153949, 151531, 149159, 146749, 144299,
+  141709, 139369, 136889, 134591, 132169, 129641, 127343, 124853,
+  122477, 120163, 117757, 115361, 112979, 110567, 108179, 105727,
+  103387, 101021, 98639, 96179, 93911, 91583, 89317, 86939, 84521,
+  82183, 79939, 77587, 75307, 72959, 70793, 68447, 66103
+};
+
+int oldHash(const char *name, int maxsiz, int length)
+{
+  int n = 0;
+  for (int j = 0; j < length; ++j)
+    n += mmult[j % (sizeof(mmult) / sizeof(int))] * name[j];
+  return abs(n) % maxsiz;
+}
+
+typedef struct {
+  int index, next;
+} OldHashLink;
+
+class OldNameHash {
+public:
+  OldNameHash(const char *const *names, int number)
+    : names_(names)
+    , maxhash_(4 * number)
+    , links_(new OldHashLink[4 * number])
+  {
+    for (int i = 0; i < maxhash_; i++) {
+      links_[i].index = -1;
+      links_[i].next = -1;
+    }
+    for (int i = 0; i < number; ++i) {
+      int ipos = oldHash(names[i], maxhash_, static_cast< int >(strlen(names[i])));
+      if (links_[ipos].index == -1)
+        links_[ipos].index = i;
+    }
+    int iput = -1;
+    for (int i = 0; i < number; ++i) {
+      int ipos = oldHash(names[i], maxhash_, static_cast< int >(strlen(names[i])));
+      while (true) {
+        int j1 = links_[ipos].index;
+        if (j1 == i || !strcmp(names[i], names[j1]))
+          break;
+        int k = links_[ipos].next;
+        if (k == -1) {
+          while (links_[++iput].index != -1) {
+          }
+          links_[ipos].next = iput;
+          links_[iput].index = i;
+          break;
+        }
+        ipos = k;
+      }
+    }
+  }
+  ~OldNameHash()
+  {
+    delete[] links_;
+  }
+  int find(const char *name) const
+  {
+    if (!maxhash_)
+      return -1;
+    int ipos = oldHash(name, maxhash_, static_cast< int >(strlen(name)));
+    while (true) {
+      int j1 = links_[ipos].index;
+      if (j1 < 0)
+        return -1;
+      if (!strcmp(name, names_[j1]))
+        return j1;
+      ipos = links_[ipos].next;
+      if (ipos == -1)
+        return -1;
+    }
+  }
+
+private:
+  const char *const *names_;
+  int maxhash_;
+  OldHashLink *links_;
+};
+
+unsigned long long randomState = 12345;
+
+unsigned long long nextRandom()
+{
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 7;
+  randomState ^= randomState << 17;
+  return randomState;
+}
+
+void timeNames(const char *title, const std::vector< std::string > &nameSet)
+{
+  int number = static_cast< int >(nameSet.size());
+  if (!number)
+    return;
+  std::vector< const char * > names(number);
+  std::vector< std::string > missingSet(number);
+  std::vector< const char * > missing(number);
+  for (int i = 0; i < number; i++) {
+    names[i] = nameSet[i].c_str();
+    missingSet[i] = nameSet[i] + "#";
+    missing[i] = missingSet[i].c_str();
+  }
+  // shuffled order for lookups
+  std::vector< int > order(number);
+  for (int i = 0; i < number; i++)
+    order[i] = i;
+  for (int i = number - 1; i > 0; i--) {
+    int j = static_cast< int >(nextRandom() % (i + 1));
+    int temp = order[i];
+    order[i] = order[j];
+    order[j] = temp;
+  }
+  double time[2][2];
+  int found[2] = { 0, 0 };
+  for (int method = 0; method < 2; method++) {
+    double startTime = CoinCpuTime();
+    OldNameHash *oldTable = NULL;
+    CoinNameHash newTable;
+    if (method == 0)
+      oldTable = new OldNameHash(&names[0], number);
+    else
+      newTable.build(&names[0], number);
+    time[method][0] = CoinCpuTime() - startTime;
+    startTime = CoinCpuTime();
+    for (int i = 0; i < number; i++) {
+      const char *name = names[order[i]];
+      int index = method ? newTable.find(name) : oldTable->find(name);
+      found[method] += (index == order[i]);
+      name = missing[order[i]];
+      index = method ? newTable.find(name) : oldTable->find(name);
+      found[method] -= (index >= 0);
+    }
+    time[method][1] = CoinCpuTime() - startTime;
+    delete oldTable;
+  }
+  double perName = 1.0e9 / number;
+  printf("%-24s %9d names  build old %6.1f new %6.1f ns  find old %6.1f new %6.1f ns  speedup %.2f%s\n",
+    title, number, time[0][0] * perName, time[1][0] * perName,
+    0.5 * time[0][1] * perName, 0.5 * time[1][1] * perName,
+    time[1][1] > 0.0 ? time[0][1] / time[1][1] : 0.0,
+    (found[0] == number && found[1] == number) ? "" : "  (lookups wrong!)");
+}
+
+void synthetic()
+{
+  const int number = 1000000;
+  char buffer[100];
+  std::vector< std::string > defaults;
+  std::vector< std::string > subscripts;
+  std::vector< std::string > randomNames;
+  for (int i = 0; i < number; i++) {
+    sprintf(buffer, "R%7.7d", i);
+    defaults.push_back(buffer);
+    sprintf(buffer, "x_%d_%d", i / 1000, i % 1000);
+    subscripts.push_back(buffer);
+    int length = 4 + static_cast< int >(nextRandom() % 12);
+    for (int j = 0; j < length; j++)
+      buffer[j] = static_cast< char >('a' + nextRandom() % 26);
+    sprintf(buffer + length, "%d", i);
+    randomNames.push_back(buffer);
+  }
+  timeNames("R0000001", defaults);
+  timeNames("x_12_345", subscripts);
+  timeNames("random", randomNames);
+}
+
+void fromFile(const char *fileName)
+{
+  CoinMpsIO model;
+  model.messageHandler()->setLogLevel(0);
+  if (model.readMps(fileName, "")) {
+    printf("Unable to read %s\n", fileName);
+    return;
+  }
+  std::vector< std::string > rowNames;
+  std::vector< std::string > columnNames;
+  for (int i = 0; i < model.getNumRows(); i++)
+    rowNames.push_back(model.rowName(i));
+  for (int i = 0; i < model.getNumCols(); i++)
+    columnNames.push_back(model.columnName(i));
+  std::string title = std::string(fileName) + " rows";
+  timeNames(title.c_str(), rowNames);
+  title = std::string(fileName) + " columns";
+  timeNames(title.c_str(), columnNames);
+}
+} // end file-local namespace
+
+int main(int argc, const char *argv[])
+{
+  if (argc < 2)
+    synthetic();
+  for (int i = 1; i < argc; i++)
+    fromFile(argv[i]);
+  return 0;
+}
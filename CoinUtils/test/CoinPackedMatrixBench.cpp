@@ -0,0 +1,147 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+// Times CoinPackedMatrix::reverseOrderedCopyOf against the one pass
+// scatter it used before (reproduced here) and checks the copies are
+// exactly the same.
+//
+// matrixBench [-threads n] [elements ...]
+//
+// With no element counts random column ordered matrices of 1 and 10
+// million elements are used (try 100000000 with enough memory).  Each size
+// is done with a few shapes - many short columns, fewer longer columns
+// and only a thousand rows.  The copy is timed with one thread and with n
+// threads (default the number of processors).
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "CoinParallel.hpp"
+#include "CoinTime.hpp"
+
+namespace {
+
+unsigned long long seed = 1234567;
+
+unsigned long long nextRandom()
+{
+  seed = 6364136223846793005ULL * seed + 1442695040888963407ULL;
+  return seed >> 33;
+}
+
+/* Row copy of a column ordered matrix with no gaps as
+   reverseOrderedCopyOf did it - count, then one pass scattering each
+   column into place.
+*/
+void plainReverse(const CoinPackedMatrix &matrix, std::vector< CoinBigIndex > &start,
+  std::vector< int > &index, std::vector< double > &element)
+{
+  const int numberRows = matrix.getNumRows();
+  const int numberColumns = matrix.getNumCols();
+  const CoinBigIndex *columnStart = matrix.getVectorStarts();
+  const int *row = matrix.getIndices();
+  const double *value = matrix.getElements();
+  const CoinBigIndex numberElements = matrix.getNumElements();
+  start.assign(numberRows + 1, 0);
+  index.resize(numberElements);
+  element.resize(numberElements);
+  for (CoinBigIndex j = 0; j < numberElements; j++)
+    start[row[j] + 1]++;
+  for (int i = 0; i < numberRows; i++)
+    start[i + 1] += start[i];
+  for (int i = 0; i < numberColumns; i++) {
+    for (CoinBigIndex j = columnStart[i]; j < columnStart[i + 1]; j++) {
+      CoinBigIndex put = start[row[j]]++;
+      index[put] = i;
+      element[put] = value[j];
+    }
+  }
+  for (int i = numberRows; i > 0; i--)
+    start[i] = start[i - 1];
+  start[0] = 0;
+}
+
+bool sameCopy(const CoinPackedMatrix &copy, const std::vector< CoinBigIndex > &start,
+  const std::vector< int > &index, const std::vector< double > &element)
+{
+  const int numberRows = copy.getMajorDim();
+  const CoinBigIndex numberElements = copy.getNumElements();
+  return !memcmp(copy.getVectorStarts(), &start[0], (numberRows + 1) * sizeof(CoinBigIndex))
+    && !memcmp(copy.getIndices(), &index[0], numberElements * sizeof(int))
+    && !memcmp(copy.getElements(), &element[0], numberElements * sizeof(double));
+}
+
+// Times a random matrix with about numberElements elements
+void timeShape(CoinBigIndex numberElements, int numberRows, int perColumn,
+  int numberThreads)
+{
+  const int numberColumns = static_cast< int >(CoinMax(numberElements / perColumn, static_cast< CoinBigIndex >(1)));
+  numberElements = static_cast< CoinBigIndex >(perColumn) * numberColumns;
+  CoinBigIndex *start = new CoinBigIndex[numberColumns + 1];
+  int *row = new int[numberElements];
+  double *element = new double[numberElements];
+  start[0] = 0;
+  // columns in random rows (duplicates do not matter here)
+  for (int i = 0; i < numberColumns; i++) {
+    for (CoinBigIndex j = start[i]; j < start[i] + perColumn; j++) {
+      row[j] = static_cast< int >(nextRandom() % numberRows);
+      element[j] = static_cast< double >(j);
+    }
+    start[i + 1] = start[i] + perColumn;
+  }
+  // matrix takes over arrays
+  int *length = NULL;
+  CoinPackedMatrix matrix;
+  matrix.assignMatrix(true, numberRows, numberColumns, numberElements,
+    element, row, start, length);
+  std::vector< CoinBigIndex > plainStart;
+  std::vector< int > plainIndex;
+  std::vector< double > plainElement;
+  double startTime = CoinGetTimeOfDay();
+  plainReverse(matrix, plainStart, plainIndex, plainElement);
+  double plainTime = CoinGetTimeOfDay() - startTime;
+  printf("%11d elements %9d rows %9d columns  one pass %8.3f s",
+    static_cast< int >(numberElements), numberRows, numberColumns, plainTime);
+  int numberRuns = (numberThreads > 1 && CoinParallelAvailable()) ? 2 : 1;
+  for (int iRun = 0; iRun < numberRuns; iRun++) {
+    int threads = iRun ? numberThreads : 1;
+    CoinPackedMatrix copy;
+    startTime = CoinGetTimeOfDay();
+    copy.reverseOrderedCopyOf(matrix, threads);
+    double time = CoinGetTimeOfDay() - startTime;
+    printf("  %d thread%s %8.3f s (%.2f)%s", threads, threads > 1 ? "s" : "",
+      time, time > 0.0 ? plainTime / time : 0.0,
+      sameCopy(copy, plainStart, plainIndex, plainElement) ? "" : " (differs!)");
+  }
+  printf("\n");
+}
+} // end file-local namespace
+
+int main(int argc, const char *argv[])
+{
+  int numberThreads = CoinNumberProcessors();
+  std::vector< CoinBigIndex > sizes;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-threads") && i + 1 < argc)
+      numberThreads = atoi(argv[++i]);
+    else
+      sizes.push_back(static_cast< CoinBigIndex >(atof(argv[i])));
+  }
+  if (sizes.empty()) {
+    sizes.push_back(1000000);
+    sizes.push_back(10000000);
+  }
+  for (size_t k = 0; k < sizes.size(); k++) {
+    CoinBigIndex numberElements = sizes[k];
+    // many short columns, fewer longer columns, few rows
+    timeShape(numberElements, static_cast< int >(numberElements / 10), 5, numberThreads);
+    timeShape(numberElements, static_cast< int >(numberElements / 100), 50, numberThreads);
+    timeShape(numberElements, 1000, 200, numberThreads);
+  }
+  return 0;
+}
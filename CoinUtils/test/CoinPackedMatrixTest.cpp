@@ -12,13 +12,29 @@
 #endif
 
 #include <cassert>
+#include <cmath>
+#include <cstring>
 
+#include "CoinCompressedMatrix.hpp"
 #include "CoinFloatEqual.hpp"
+#include "CoinIndexedVector.hpp"
 #include "CoinPackedVector.hpp"
 #include "CoinPackedMatrix.hpp"
+#include "CoinPackedRowView.hpp"
 
 //#############################################################################
 
+// Whether row i of view is exactly row i of rowCopy
+static bool
+sameRow(CoinPackedRowView &view, const CoinPackedMatrix &rowCopy, int i)
+{
+  const int size = view.getRowSize(i);
+  const CoinBigIndex first = rowCopy.getVectorFirst(i);
+  return size == rowCopy.getVectorSize(i)
+    && !memcmp(view.getRowIndices(i), rowCopy.getIndices() + first, size * sizeof(int))
+    && !memcmp(view.getRowElements(i), rowCopy.getElements() + first, size * sizeof(double));
+}
+
 void
 CoinPackedMatrixUnitTest()
 {
@@ -628,7 +644,422 @@ CoinPackedMatrixUnitTest()
     
     delete globalP;
   }
-  
+
+  {
+    // Test threaded and sparse products on something big enough to split
+    const int numberRows = 3000;
+    const int numberColumns = 2000;
+    const int perColumn = 150;
+    const int ne = numberColumns * perColumn;
+    int *ri = new int[ne];
+    int *ci = new int[ne];
+    double *el = new double[ne];
+    unsigned int seed = 12345;
+    for (int j = 0; j < ne; j++) {
+      ci[j] = j / perColumn;
+      seed = 1664525 * seed + 1013904223;
+      ri[j] = static_cast< int >((seed >> 8) % numberRows);
+      el[j] = static_cast< double >(seed % 2001) * 0.001 - 1.0;
+    }
+    CoinPackedMatrix m(true, ri, ci, el, ne);
+    const CoinBigIndex *start = m.getVectorStarts();
+    const int *length = m.getVectorLengths();
+    const int *row = m.getIndices();
+    const double *element = m.getElements();
+    double *x = new double[numberColumns];
+    double *pi = new double[numberRows];
+    for (int i = 0; i < numberColumns; i++)
+      x[i] = (i % 3) ? 1.0 / (i + 1) : 0.0;
+    for (int i = 0; i < numberRows; i++)
+      pi[i] = (i % 4) ? (i % 5) - 2.0 + 1.0 / (i + 3) : 0.0;
+    // plain loops
+    double *ax = new double[numberRows];
+    double *piA = new double[numberColumns];
+    for (int i = 0; i < numberRows; i++)
+      ax[i] = 0.0;
+    for (int i = numberColumns - 1; i >= 0; i--) {
+      double sum = 0.0;
+      for (CoinBigIndex j = start[i]; j < start[i] + length[i]; j++) {
+        ax[row[j]] += x[i] * element[j];
+        sum += pi[row[j]] * element[j];
+      }
+      piA[i] = sum;
+    }
+    double *y = new double[numberRows];
+    double *z = new double[numberColumns];
+    for (int numberThreads = 1; numberThreads <= 4; numberThreads += 3) {
+      m.times(x, y, numberThreads);
+      for (int i = 0; i < numberRows; i++) {
+        if (numberThreads == 1)
+          assert(y[i] == ax[i]);
+        else
+          assert(fabs(y[i] - ax[i]) <= 1.0e-12 * (1.0 + fabs(ax[i])));
+      }
+      // dot products are always exact
+      m.transposeTimes(pi, z, numberThreads);
+      for (int i = 0; i < numberColumns; i++)
+        assert(z[i] == piA[i]);
+    }
+    // row copy swaps over
+    CoinPackedMatrix r;
+    r.reverseOrderedCopyOf(m);
+    r.times(x, y, 4);
+    r.transposeTimes(pi, z, 4);
+    for (int i = 0; i < numberRows; i++)
+      assert(fabs(y[i] - ax[i]) <= 1.0e-12 * (1.0 + fabs(ax[i])));
+    for (int i = 0; i < numberColumns; i++)
+      assert(fabs(z[i] - piA[i]) <= 1.0e-12 * (1.0 + fabs(piA[i])));
+    // indexed vectors - unpacked and packed
+    CoinIndexedVector sparse[4];
+    for (int k = 0; k < 4; k++) {
+      // x or pi, unpacked then packed
+      bool transpose = k >= 2;
+      int n = transpose ? numberRows : numberColumns;
+      const double *dense = transpose ? pi : x;
+      int *which = new int[n];
+      double *values = new double[n];
+      int number = 0;
+      // in decreasing order so not same order as dense
+      for (int i = n - 1; i >= 0; i--) {
+        if (dense[i]) {
+          which[number] = i;
+          values[number++] = dense[i];
+        }
+      }
+      sparse[k].reserve(n);
+      if (k & 1)
+        sparse[k].createPacked(number, which, values);
+      else
+        sparse[k].setVector(number, which, values);
+      delete[] values;
+      delete[] which;
+    }
+    for (int numberThreads = 1; numberThreads <= 4; numberThreads += 3) {
+      for (int k = 0; k < 2; k++) {
+        m.times(sparse[k], y, numberThreads);
+        for (int i = 0; i < numberRows; i++)
+          assert(fabs(y[i] - ax[i]) <= 1.0e-12 * (1.0 + fabs(ax[i])));
+        r.times(sparse[k], y, numberThreads);
+        for (int i = 0; i < numberRows; i++)
+          assert(fabs(y[i] - ax[i]) <= 1.0e-12 * (1.0 + fabs(ax[i])));
+        m.transposeTimes(sparse[k + 2], z, numberThreads);
+        for (int i = 0; i < numberColumns; i++)
+          assert(z[i] == piA[i]);
+        r.transposeTimes(sparse[k + 2], z, numberThreads);
+        for (int i = 0; i < numberColumns; i++)
+          assert(fabs(z[i] - piA[i]) <= 1.0e-12 * (1.0 + fabs(piA[i])));
+      }
+    }
+    delete[] z;
+    delete[] y;
+    delete[] piA;
+    delete[] ax;
+    delete[] pi;
+    delete[] x;
+    delete[] el;
+    delete[] ci;
+    delete[] ri;
+  }
+
+  {
+    // Test reverse ordered copy of a matrix big enough to be done in blocks
+    const int numberRows = 300000;
+    const int perColumn = 4;
+    const int numberColumns = 300000;
+    const CoinBigIndex ne = numberColumns * perColumn;
+    CoinBigIndex *start = new CoinBigIndex[numberColumns + 1];
+    int *ri = new int[ne];
+    double *el = new double[ne];
+    unsigned int seed = 54321;
+    start[0] = 0;
+    for (int i = 0; i < numberColumns; i++) {
+      // distinct rows in random order
+      int base = static_cast< int >((seed >> 4) % (numberRows - perColumn));
+      for (int k = 0; k < perColumn; k++) {
+        seed = 1664525 * seed + 1013904223;
+        ri[start[i] + k] = base + (k * 3 + i) % perColumn;
+        el[start[i] + k] = i + 0.25 * k;
+      }
+      start[i + 1] = start[i] + perColumn;
+    }
+    CoinPackedMatrix m(true, numberRows, numberColumns, ne, el, ri, start, NULL);
+    CoinPackedMatrix r1;
+    r1.reverseOrderedCopyOf(m);
+    assert(!r1.isColOrdered());
+    assert(r1.getNumElements() == ne);
+    // rows in column order so same as one pass through columns
+    for (int i = 0; i < numberRows; i++) {
+      const CoinBigIndex first = r1.getVectorFirst(i);
+      for (CoinBigIndex j = first + 1; j < r1.getVectorLast(i); j++)
+        assert(r1.getIndices()[j] > r1.getIndices()[j - 1]);
+    }
+    CoinPackedMatrix back;
+    back.reverseOrderedCopyOf(r1);
+    assert(back.isEquivalent(m));
+    // threads give exactly the same
+    CoinPackedMatrix r4;
+    r4.reverseOrderedCopyOf(m, 4);
+    assert(!memcmp(r1.getVectorStarts(), r4.getVectorStarts(), (numberRows + 1) * sizeof(CoinBigIndex)));
+    assert(!memcmp(r1.getIndices(), r4.getIndices(), ne * sizeof(int)));
+    assert(!memcmp(r1.getElements(), r4.getElements(), ne * sizeof(double)));
+    // and with gaps
+    CoinPackedMatrix gaps;
+    gaps.setExtraGap(0.5);
+    gaps.reverseOrderedCopyOf(m, 4);
+    assert(gaps.getVectorStarts()[numberRows] > ne);
+    for (int i = 0; i < numberRows; i++) {
+      assert(gaps.getVectorSize(i) == r1.getVectorSize(i));
+      const CoinBigIndex first = gaps.getVectorFirst(i);
+      const CoinBigIndex first1 = r1.getVectorFirst(i);
+      for (int k = 0; k < r1.getVectorSize(i); k++) {
+        assert(gaps.getIndices()[first + k] == r1.getIndices()[first1 + k]);
+        assert(gaps.getElements()[first + k] == r1.getElements()[first1 + k]);
+      }
+    }
+    // back again
+    back.reverseOrderedCopyOf(gaps, 4);
+    assert(back.isEquivalent(m));
+    delete[] el;
+    delete[] ri;
+    delete[] start;
+  }
+
+  {
+    // Test compressed copies give exactly the same products
+    const int numberRows = 2000;
+    const int numberColumns = 3000;
+    const int perColumn = 40;
+    const int ne = numberColumns * perColumn;
+    int *ri = new int[ne];
+    int *ci = new int[ne];
+    double *el = new double[ne];
+    double *x = new double[numberColumns];
+    double *pi = new double[numberRows];
+    double *y1 = new double[numberRows];
+    double *y2 = new double[numberRows];
+    double *z1 = new double[numberColumns];
+    double *z2 = new double[numberColumns];
+    for (int i = 0; i < numberColumns; i++)
+      x[i] = (i % 3) ? 1.0 / (i + 1) : 0.0;
+    for (int i = 0; i < numberRows; i++)
+      pi[i] = (i % 4) ? (i % 5) - 2.0 + 1.0 / (i + 3) : 0.0;
+    CoinIndexedVector sparseX;
+    sparseX.reserve(numberColumns);
+    for (int i = numberColumns - 1; i >= 0; i--) {
+      if (x[i])
+        sparseX.insert(i, x[i]);
+    }
+    // few values, a thousand values, too many values
+    const int numberDistinct[] = { 3, 1000, 100000 };
+    const int codeSize[] = { 1, 2, 0 };
+    for (int kind = 0; kind < 3; kind++) {
+      unsigned int seed = 2468;
+      for (int j = 0; j < ne; j++) {
+        ci[j] = j / perColumn;
+        seed = 1664525 * seed + 1013904223;
+        ri[j] = static_cast< int >((seed >> 8) % numberRows);
+        if (kind == 0)
+          el[j] = (seed & 1) ? 1.0 : ((seed & 2) ? -1.0 : 2.5);
+        else
+          el[j] = 0.001 * static_cast< int >(j % numberDistinct[kind]) - 1.0;
+      }
+      CoinPackedMatrix m(true, ri, ci, el, ne);
+      CoinPackedMatrix r;
+      r.setExtraGap(0.25);
+      r.reverseOrderedCopyOf(m);
+      for (int ordered = 0; ordered < 2; ordered++) {
+        const CoinPackedMatrix &matrix = ordered ? r : m;
+        CoinCompressedMatrix compressed(matrix);
+        assert(compressed.isColOrdered() == matrix.isColOrdered());
+        assert(compressed.getNumElements() == matrix.getNumElements());
+        assert(compressed.codeSize() == codeSize[kind]);
+        if (codeSize[kind])
+          assert(compressed.memoryUsed() < static_cast< size_t >(matrix.getNumElements()) * 7);
+        CoinPackedMatrix expanded;
+        compressed.expand(expanded);
+        assert(expanded.isEquivalent(matrix));
+        CoinCompressedMatrix copy;
+        copy = compressed;
+        for (int numberThreads = 1; numberThreads <= 4; numberThreads += 3) {
+          matrix.times(x, y1, numberThreads);
+          copy.times(x, y2, numberThreads);
+          assert(!memcmp(y1, y2, numberRows * sizeof(double)));
+          matrix.times(sparseX, y1, numberThreads);
+          copy.times(sparseX, y2, numberThreads);
+          assert(!memcmp(y1, y2, numberRows * sizeof(double)));
+          matrix.transposeTimes(pi, z1, numberThreads);
+          copy.transposeTimes(pi, z2, numberThreads);
+          assert(!memcmp(z1, z2, numberColumns * sizeof(double)));
+        }
+      }
+    }
+    delete[] z2;
+    delete[] z1;
+    delete[] y2;
+    delete[] y1;
+    delete[] pi;
+    delete[] x;
+    delete[] el;
+    delete[] ci;
+    delete[] ri;
+  }
+
+  {
+    // Test staged appends match appending one row at a time
+    const int numberColumns = 300;
+    const int numberRows = 100;
+    const int perRow = 10;
+    const int ne = numberRows * perRow;
+    int *ri = new int[ne];
+    int *ci = new int[ne];
+    double *el = new double[ne];
+    unsigned int seed = 13579;
+    for (int j = 0; j < ne; j++) {
+      ri[j] = j / perRow;
+      // columns of a row distinct
+      seed = 1664525 * seed + 1013904223;
+      ci[j] = (j % perRow) * (numberColumns / perRow) + static_cast< int >((seed >> 8) % (numberColumns / perRow));
+      el[j] = 1.0 + j;
+    }
+    CoinPackedMatrix staged(true, ri, ci, el, ne);
+    CoinPackedMatrix single(staged);
+    int numberMoves = 0;
+    const int numberRounds = 200;
+    for (int round = 0; round < numberRounds; round++) {
+      const double *oldElements = staged.getElements();
+      staged.beginMinorAppend();
+      for (int k = 0; k < 25; k++) {
+        int *index = ci;
+        double *element = el;
+        for (int j = 0; j < perRow; j++) {
+          seed = 1664525 * seed + 1013904223;
+          index[j] = j * (numberColumns / perRow) + static_cast< int >((seed >> 8) % (numberColumns / perRow));
+          element[j] = round + 0.5 * k - j;
+        }
+        const int size = (k % 5) ? perRow : 0;
+        staged.addMinorAppend(size, index, element);
+        single.appendRow(size, index, element);
+      }
+      assert(staged.numberMinorStaged() == 25);
+      staged.commitMinorAppend();
+      assert(!staged.numberMinorStaged());
+      if (staged.getElements() != oldElements)
+        numberMoves++;
+      assert(staged.getNumRows() == single.getNumRows());
+      assert(staged.getNumElements() == single.getNumElements());
+      for (int i = 0; i < numberColumns; i++) {
+        assert(staged.getVectorSize(i) == single.getVectorSize(i));
+        const CoinBigIndex first = staged.getVectorFirst(i);
+        const CoinBigIndex first1 = single.getVectorFirst(i);
+        for (int k = 0; k < single.getVectorSize(i); k++) {
+          assert(staged.getIndices()[first + k] == single.getIndices()[first1 + k]);
+          assert(staged.getElements()[first + k] == single.getElements()[first1 + k]);
+        }
+      }
+    }
+    // room grows geometrically so only a few rounds move the matrix
+    assert(numberMoves < numberRounds / 4);
+    // nothing staged does nothing
+    staged.commitMinorAppend();
+    assert(staged.isEquivalent(single));
+    // staged vectors are not copied and go with swap
+    int index[2] = { 3, 7 };
+    double element[2] = { 1.5, -2.5 };
+    staged.beginMinorAppend();
+    staged.addMinorAppend(2, index, element);
+    single.appendRow(2, index, element);
+    CoinPackedMatrix copy(staged);
+    assert(!copy.numberMinorStaged());
+    copy.swap(staged);
+    assert(copy.numberMinorStaged() == 1 && !staged.numberMinorStaged());
+    // operator= drops them
+    staged = copy;
+    assert(!staged.numberMinorStaged());
+    // reordering commits them first
+    copy.reverseOrdering();
+    assert(!copy.numberMinorStaged());
+    assert(copy.getNumRows() == single.getNumRows());
+    copy.reverseOrdering();
+    assert(copy.isEquivalent(single));
+    delete[] el;
+    delete[] ci;
+    delete[] ri;
+  }
+
+  {
+    // Test row views give the rows of a row copy
+    const int numberRows = 960;
+    const int numberColumns = 400;
+    const int perColumn = 12;
+    const int ne = numberColumns * perColumn;
+    int *ri = new int[ne];
+    int *ci = new int[ne];
+    double *el = new double[ne];
+    unsigned int seed = 97531;
+    for (int j = 0; j < ne; j++) {
+      ci[j] = j / perColumn;
+      // rows of a column distinct
+      seed = 1664525 * seed + 1013904223;
+      ri[j] = (j % perColumn) * (numberRows / perColumn) + static_cast< int >((seed >> 8) % (numberRows / perColumn));
+      el[j] = 0.5 + j;
+    }
+    CoinPackedMatrix m(true, ri, ci, el, ne);
+    CoinPackedRowView view(m, 64);
+    assert(view.getNumRows() == numberRows);
+    assert(view.getNumCols() == numberColumns);
+    assert(!view.numberChunksMade());
+    CoinPackedMatrix r;
+    r.reverseOrderedCopyOf(m);
+    for (int i = 100; i < 128; i++)
+      assert(sameRow(view, r, i));
+    assert(view.numberChunksMade() == 1);
+    assert(sameRow(view, r, 500));
+    assert(sameRow(view, r, 959));
+    assert(view.numberChunksMade() == 3);
+    // made rows follow the matrix
+    const int numDel = 5;
+    const int indDel[numDel] = { 0, 17, 18, 250, 399 };
+    m.deleteCols(numDel, indDel);
+    view.deleteCols(numDel, indDel);
+    assert(view.getNumCols() == numberColumns - numDel);
+    int *newRow = new int[2 * perColumn];
+    double *newElement = new double[2 * perColumn];
+    CoinBigIndex newStart[3] = { 0, perColumn, 2 * perColumn };
+    for (int k = 0; k < 2 * perColumn; k++) {
+      newRow[k] = (k % perColumn) * (numberRows / perColumn) + k / perColumn;
+      newElement[k] = -1.0 - k;
+    }
+    m.appendCols(2, newStart, newRow, newElement);
+    view.appendCols(2);
+    assert(view.getNumCols() == numberColumns - numDel + 2);
+    assert(view.numberChunksMade() == 3);
+    r.reverseOrderedCopyOf(m);
+    for (int i = 64; i < 128; i++)
+      assert(sameRow(view, r, i));
+    // a quarter made so the rest are made together
+    assert(sameRow(view, r, 0));
+    assert(view.numberChunksMade() == (numberRows + 63) / 64);
+    for (int i = 0; i < numberRows; i++)
+      assert(sameRow(view, r, i));
+    // any other change needs a reset
+    const int rowDel[2] = { 3, 700 };
+    m.deleteRows(2, rowDel);
+    view.reset();
+    assert(!view.numberChunksMade());
+    r.reverseOrderedCopyOf(m);
+    for (int i = 0; i < numberRows - 2; i++)
+      assert(sameRow(view, r, i));
+    // a row ordered matrix is its own view
+    CoinPackedRowView rowView(r);
+    for (int i = 0; i < numberRows - 2; i++)
+      assert(rowView.getRow(i).getIndices() == r.getIndices() + r.getVectorFirst(i));
+    delete[] newElement;
+    delete[] newRow;
+    delete[] el;
+    delete[] ci;
+    delete[] ri;
+  }
+
 #if 0
   {
     // test append
@@ -0,0 +1,224 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+// Times CoinFactorization with each level of vector kernels (CoinSimd.hpp)
+// and checks every level gives exactly the same solves as plain loops.
+//
+// simdBench [file.mps ...]
+//
+// With no arguments random sparse bases of a few sizes and densities are
+// used.  For each file argument the basis is made from the first
+// structural columns and any slacks needed to make it nonsingular.  For
+// each basis and level the factorization is done several times and then
+// dense and sparse right hand sides are solved (FTRAN and BTRAN).
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "CoinFactorization.hpp"
+#include "CoinIndexedVector.hpp"
+#include "CoinMpsIO.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "CoinSimd.hpp"
+#include "CoinTime.hpp"
+
+namespace {
+
+unsigned long long seed = 1234567;
+
+unsigned long long nextRandom()
+{
+  seed = 6364136223846793005ULL * seed + 1442695040888963407ULL;
+  return seed >> 33;
+}
+
+double randomValue()
+{
+  return static_cast< double >(nextRandom() % 1000000) / 1000000.0 - 0.5;
+}
+
+const char *levelName[] = { "scalar", "avx2", "avx512" };
+
+/* Factorizes with more space until there is enough (as a simplex code
+   would).  rowIsBasic and columnIsBasic are as after
+   CoinFactorization::factorize.
+*/
+int factorize(CoinFactorization &factorization, const CoinPackedMatrix &matrix,
+  std::vector< int > &rowIsBasic, std::vector< int > &columnIsBasic)
+{
+  const std::vector< int > saveRows(rowIsBasic);
+  const std::vector< int > saveColumns(columnIsBasic);
+  double areaFactor = 0.0;
+  int status;
+  while (true) {
+    rowIsBasic = saveRows;
+    columnIsBasic = saveColumns;
+    status = factorization.factorize(matrix, &rowIsBasic[0], &columnIsBasic[0],
+      areaFactor);
+    if (status != -99 || areaFactor > 100.0)
+      break;
+    areaFactor = areaFactor ? 2.0 * areaFactor : 2.0;
+  }
+  return status;
+}
+
+/* Times one basis.  rowIsBasic and columnIsBasic must give a nonsingular
+   basis.
+*/
+void timeBasis(const char *title, const CoinPackedMatrix &matrix,
+  const std::vector< int > &rowIsBasic, const std::vector< int > &columnIsBasic)
+{
+  const int numberRows = matrix.getNumRows();
+  const int numberFactorizations = 10;
+  const int numberSolves = 200;
+  // right hand sides - half dense and half with a few entries
+  std::vector< std::vector< int > > which(numberSolves);
+  std::vector< std::vector< double > > values(numberSolves);
+  for (int k = 0; k < numberSolves; k++) {
+    int number = (k & 1) ? 1 + numberRows / 100 : numberRows;
+    for (int i = 0; i < number; i++) {
+      int iRow = (number == numberRows) ? i : static_cast< int >(nextRandom() % numberRows);
+      which[k].push_back(iRow);
+      values[k].push_back(randomValue());
+    }
+  }
+  std::vector< double > first;
+  double firstTime[2] = { 0.0, 0.0 };
+  int saveLevel = CoinSimdCurrentLevel;
+  for (int level = COIN_SIMD_SCALAR; level <= CoinSimdAvailable(); level++) {
+    CoinSetSimdLevel(level);
+    CoinFactorization factorization;
+    double startTime = CoinCpuTime();
+    for (int k = 0; k < numberFactorizations; k++) {
+      std::vector< int > rows(rowIsBasic), columns(columnIsBasic);
+      if (factorize(factorization, matrix, rows, columns)) {
+        printf("%-24s factorization failed %d\n", title, factorization.status());
+        CoinSetSimdLevel(saveLevel);
+        return;
+      }
+    }
+    double factorTime = (CoinCpuTime() - startTime) / numberFactorizations;
+    CoinIndexedVector work(numberRows);
+    CoinIndexedVector vector(numberRows);
+    std::vector< double > result;
+    startTime = CoinCpuTime();
+    for (int k = 0; k < 2 * numberSolves; k++) {
+      int which2 = k >> 1;
+      const int number = static_cast< int >(which[which2].size());
+      for (int i = 0; i < number; i++)
+        vector.add(which[which2][i], values[which2][i]);
+      if (k & 1)
+        factorization.updateColumnTranspose(&work, &vector);
+      else
+        factorization.updateColumn(&work, &vector);
+      const double *dense = vector.denseVector();
+      result.insert(result.end(), dense, dense + numberRows);
+      vector.clear();
+    }
+    double solveTime = (CoinCpuTime() - startTime) / (2 * numberSolves);
+    bool same = true;
+    if (level == COIN_SIMD_SCALAR) {
+      first = result;
+      firstTime[0] = factorTime;
+      firstTime[1] = solveTime;
+    } else {
+      same = (result == first);
+    }
+    printf("%-24s %-6s %8d rows  factorize %9.3f ms (%.2f)  solve %8.2f us (%.2f)%s\n",
+      title, levelName[level], numberRows, 1.0e3 * factorTime,
+      factorTime > 0.0 ? firstTime[0] / factorTime : 0.0, 1.0e6 * solveTime,
+      solveTime > 0.0 ? firstTime[1] / solveTime : 0.0,
+      same ? "" : "  (results differ!)");
+  }
+  CoinSetSimdLevel(saveLevel);
+}
+
+/* Square matrix with a unit diagonal and numberPerColumn other entries in
+   each column, some columns much denser so U has a dense part.
+*/
+void synthetic(int numberRows, int numberPerColumn)
+{
+  std::vector< int > rows;
+  std::vector< int > columns;
+  std::vector< double > elements;
+  for (int iColumn = 0; iColumn < numberRows; iColumn++) {
+    rows.push_back(iColumn);
+    columns.push_back(iColumn);
+    elements.push_back(1.0 + randomValue());
+    int number = (iColumn % 50) ? numberPerColumn : 20 * numberPerColumn;
+    std::vector< char > used(numberRows, 0);
+    used[iColumn] = 1;
+    for (int k = 0; k < number; k++) {
+      int iRow = static_cast< int >(nextRandom() % numberRows);
+      if (used[iRow])
+        continue;
+      used[iRow] = 1;
+      rows.push_back(iRow);
+      columns.push_back(iColumn);
+      elements.push_back(0.1 * randomValue());
+    }
+  }
+  CoinPackedMatrix matrix(true, &rows[0], &columns[0], &elements[0],
+    static_cast< CoinBigIndex >(elements.size()));
+  std::vector< int > rowIsBasic(numberRows, -1);
+  std::vector< int > columnIsBasic(numberRows, 1);
+  char title[100];
+  sprintf(title, "random %d per column", numberPerColumn);
+  timeBasis(title, matrix, rowIsBasic, columnIsBasic);
+}
+
+void fromFile(const char *fileName)
+{
+  CoinMpsIO model;
+  model.messageHandler()->setLogLevel(0);
+  if (model.readMps(fileName, "")) {
+    printf("Unable to read %s\n", fileName);
+    return;
+  }
+  const CoinPackedMatrix &matrix = *model.getMatrixByCol();
+  const int numberRows = matrix.getNumRows();
+  const int numberColumns = matrix.getNumCols();
+  std::vector< int > rowIsBasic(numberRows, 1);
+  std::vector< int > columnIsBasic(numberColumns, -1);
+  // first structurals with slacks for the rest
+  for (int iColumn = 0; iColumn < CoinMin(numberRows, numberColumns); iColumn++) {
+    columnIsBasic[iColumn] = 1;
+    rowIsBasic[iColumn] = -1;
+  }
+  // drop dependent columns and put in slacks for rows not covered
+  for (int pass = 0; pass < 10; pass++) {
+    CoinFactorization factorization;
+    std::vector< int > rows(rowIsBasic), columns(columnIsBasic);
+    int status = factorize(factorization, matrix, rows, columns);
+    if (status != -1)
+      break;
+    const int *permute = factorization.permute();
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+      if (columns[iColumn] < 0)
+        columnIsBasic[iColumn] = -1;
+    }
+    for (int iRow = 0; iRow < numberRows; iRow++) {
+      if (rows[iRow] < 0)
+        rowIsBasic[iRow] = -1;
+      if (permute[iRow] < 0)
+        rowIsBasic[iRow] = 1;
+    }
+  }
+  timeBasis(fileName, matrix, rowIsBasic, columnIsBasic);
+}
+} // end file-local namespace
+
+int main(int argc, const char *argv[])
+{
+  if (argc < 2) {
+    synthetic(1000, 3);
+    synthetic(1000, 6);
+    synthetic(4000, 3);
+  }
+  for (int i = 1; i < argc; i++)
+    fromFile(argv[i]);
+  return 0;
+}
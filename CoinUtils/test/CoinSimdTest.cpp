@@ -0,0 +1,105 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#  pragma warning(disable:4786)
+#endif
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+
+#include <vector>
+
+#include "CoinFactorization.hpp"
+#include "CoinIndexedVector.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "CoinSimd.hpp"
+
+//--------------------------------------------------------------------------
+void
+CoinSimdUnitTest()
+{
+  int i;
+  // Vector kernels must give exactly what plain loops give
+  {
+    int saveLevel = CoinSimdCurrentLevel;
+    const int n = 300;
+    unsigned int seed = 12345;
+    std::vector<double> random(4 * n);
+    for (i = 0; i < 4 * n; i++) {
+      seed = 1664525u * seed + 1013904223u;
+      random[i] = static_cast<double>(seed >> 8) / 16777216.0 - 0.5;
+    }
+    std::vector<int> index(n), which(n);
+    for (i = 0; i < n; i++) {
+      index[i] = (7 * i + 3) % n;
+      which[i] = (11 * i + 5) % n;
+    }
+    for (int level = COIN_SIMD_AVX2; level <= CoinSimdAvailable(); level++) {
+      for (int number = 0; number < 40; number++) {
+        std::vector<double> plain(random.begin(), random.begin() + n);
+        std::vector<double> vector(plain);
+        double multiplier = random[n + number];
+        CoinSetSimdLevel(COIN_SIMD_SCALAR);
+        CoinSimdScatterSubtract(&plain[0], &index[0], &random[2 * n], number, multiplier);
+        CoinSimdScatterSubtractIndirect(&plain[0], &index[n - number], &which[0],
+          &random[3 * n], number, multiplier);
+        CoinSimdSubtract(&plain[1], &random[n], number, multiplier);
+        double plainSum = CoinSimdGatherSubtract(multiplier, &random[2 * n],
+          &index[0], &plain[0], number);
+        assert( CoinSetSimdLevel(level) == level );
+        CoinSimdScatterSubtract(&vector[0], &index[0], &random[2 * n], number, multiplier);
+        CoinSimdScatterSubtractIndirect(&vector[0], &index[n - number], &which[0],
+          &random[3 * n], number, multiplier);
+        CoinSimdSubtract(&vector[1], &random[n], number, multiplier);
+        double vectorSum = CoinSimdGatherSubtract(multiplier, &random[2 * n],
+          &index[0], &vector[0], number);
+        assert( plainSum == vectorSum );
+        for (i = 0; i < n; i++)
+          assert( plain[i] == vector[i] );
+      }
+    }
+    // and so a factorization and its solves must be the same
+    std::vector<int> rows, columns;
+    std::vector<double> elements;
+    for (int j = 0; j < n; j++) {
+      rows.push_back(j);
+      columns.push_back(j);
+      elements.push_back(4.0);
+      for (int k = 0; k < 30; k++) {
+        rows.push_back((j + 1 + 10 * k) % n);
+        columns.push_back(j);
+        elements.push_back(random[(30 * j + k) % (4 * n)]);
+      }
+    }
+    CoinPackedMatrix matrix(true, &rows[0], &columns[0], &elements[0],
+      static_cast<CoinBigIndex>(elements.size()));
+    std::vector<double> first(2 * n);
+    for (int level = COIN_SIMD_SCALAR; level <= CoinSimdAvailable(); level++) {
+      CoinSetSimdLevel(level);
+      CoinFactorization factorization;
+      std::vector<int> rowIsBasic(n, -1), columnIsBasic(n, 1);
+      assert( !factorization.factorize(matrix, &rowIsBasic[0], &columnIsBasic[0]) );
+      CoinIndexedVector work(n), vector(n);
+      for (i = 0; i < n; i++)
+        vector.insert(i, random[i]);
+      factorization.updateColumn(&work, &vector);
+      std::vector<double> result(vector.denseVector(), vector.denseVector() + n);
+      vector.clear();
+      for (i = 0; i < n; i += 3)
+        vector.insert(i, random[n + i]);
+      factorization.updateColumnTranspose(&work, &vector);
+      result.insert(result.end(), vector.denseVector(), vector.denseVector() + n);
+      if (level == COIN_SIMD_SCALAR)
+        first = result;
+      for (i = 0; i < 2 * n; i++)
+        assert( result[i] == first[i] );
+    }
+    CoinSetSimdLevel(saveLevel);
+  }
+}
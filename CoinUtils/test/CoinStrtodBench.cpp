@@ -0,0 +1,153 @@
+/* $Id$ */
+// Copyright (C) 2026, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+// Times CoinStrtod against strtod (and atof).
+//
+// strtodBench [file ...]
+//
+// With no arguments several synthetic distributions are timed - small
+// integers (the bulk of most matrices), short decimals, values written by
+// CoinMpsIO in 12 character fields and values printed with 17 digits.
+// Each file argument (e.g. an mps or lp file) is split into blank separated
+// tokens and all tokens which are complete numbers are timed as they come.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "CoinStrtod.hpp"
+#include "CoinTime.hpp"
+
+namespace {
+
+unsigned long long randomState = 12345;
+
+unsigned long long nextRandom()
+{
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 7;
+  randomState ^= randomState << 17;
+  return randomState;
+}
+
+double randomFraction()
+{
+  return static_cast< double >(nextRandom() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Strings laid end to end (with terminating nulls) and their starts
+typedef struct {
+  std::vector< char > text;
+  std::vector< size_t > start;
+} NumberList;
+
+void addNumber(NumberList &list, const char *number)
+{
+  list.start.push_back(list.text.size());
+  list.text.insert(list.text.end(), number, number + strlen(number) + 1);
+}
+
+void timeList(const char *name, const NumberList &list)
+{
+  int numberStrings = static_cast< int >(list.start.size());
+  if (!numberStrings)
+    return;
+  // enough passes for about 10 million conversions
+  int numberPasses = 10000000 / numberStrings + 1;
+  const char *text = &list.text[0];
+  double sum[3] = { 0.0, 0.0, 0.0 };
+  double time[3];
+  for (int method = 0; method < 3; method++) {
+    double startTime = CoinCpuTime();
+    for (int pass = 0; pass < numberPasses; pass++) {
+      for (int i = 0; i < numberStrings; i++) {
+        const char *number = text + list.start[i];
+        char *end;
+        if (method == 0)
+          sum[0] += CoinStrtod(number, &end);
+        else if (method == 1)
+          sum[1] += strtod(number, &end);
+        else
+          sum[2] += atof(number);
+      }
+    }
+    time[method] = CoinCpuTime() - startTime;
+  }
+  double perNumber = 1.0e9 / (static_cast< double >(numberPasses) * numberStrings);
+  printf("%-20s %9d numbers  CoinStrtod %6.1f ns  strtod %6.1f ns  atof %6.1f ns  speedup %.2f%s\n",
+    name, numberStrings, time[0] * perNumber, time[1] * perNumber,
+    time[2] * perNumber, time[0] > 0.0 ? time[1] / time[0] : 0.0,
+    sum[0] == sum[1] ? "" : "  (sums differ!)");
+}
+
+void synthetic()
+{
+  const int numberStrings = 100000;
+  char buffer[100];
+  NumberList integers;
+  NumberList decimals;
+  NumberList mpsFields;
+  NumberList fullPrecision;
+  NumberList mixed;
+  for (int i = 0; i < numberStrings; i++) {
+    unsigned long long random = nextRandom();
+    // mostly +-1 as in most matrices
+    int integer = (random & 3) ? 1 : static_cast< int >((random >> 8) % 1000);
+    sprintf(buffer, "%d", (random & 16) ? -integer : integer);
+    addNumber(integers, buffer);
+    if (random & 32)
+      addNumber(mixed, buffer);
+    sprintf(buffer, "%.*f", static_cast< int >((random >> 20) % 4) + 1,
+      randomFraction() * 100.0);
+    addNumber(decimals, buffer);
+    // as CoinConvertDouble - 12 characters
+    double value = randomFraction() * 1.0e6;
+    value = (random & 64) ? value * 1.0e-9 : value;
+    sprintf(buffer, "%.12g", value);
+    if (strlen(buffer) > 12)
+      sprintf(buffer, "%.6g", value);
+    addNumber(mpsFields, buffer);
+    if (!(random & 32))
+      addNumber(mixed, buffer);
+    sprintf(buffer, "%.17g", (randomFraction() - 0.5) * 1.0e3);
+    addNumber(fullPrecision, buffer);
+  }
+  timeList("integers", integers);
+  timeList("short decimals", decimals);
+  timeList("12 character fields", mpsFields);
+  timeList("17 digits", fullPrecision);
+  timeList("mixed", mixed);
+}
+
+void fromFile(const char *fileName)
+{
+  FILE *fp = fopen(fileName, "r");
+  if (!fp) {
+    printf("Unable to open %s\n", fileName);
+    return;
+  }
+  NumberList numbers;
+  char token[1000];
+  while (fscanf(fp, "%999s", token) == 1) {
+    char *end;
+    strtod(token, &end);
+    // only real numbers (not names, inf or nan)
+    if (end > token && !*end && (token[0] <= '9' || token[0] == '.'))
+      addNumber(numbers, token);
+  }
+  fclose(fp);
+  timeList(fileName, numbers);
+}
+} // end file-local namespace
+
+int main(int argc, const char *argv[])
+{
+  if (argc < 2)
+    synthetic();
+  for (int i = 1; i < argc; i++)
+    fromFile(argv[i]);
+  return 0;
+}
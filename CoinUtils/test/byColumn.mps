@@ -0,0 +1,34 @@
+NAME          BLANK   
+ROWS
+ N  OBJROW
+ G  R0000000
+ L  R0000001
+ E  R0000002
+ L  R0000003
+ L  R0000004
+COLUMNS
+    COL01     OBJROW    1              R0000000  3           
+    COL01     R0000004  5.6         
+    COL02     R0000000  1              R0000001  2           
+    COL03     R0000001  1.1            R0000002  1           
+    COL04     R0000000  -2             R0000003  2.8         
+    COL05     OBJROW    2              R0000000  -1          
+    COL05     R0000004  1           
+    COL06     R0000002  1           
+    COL07     R0000003  -1.2        
+    COL08     OBJROW    -1             R0000000  -1          
+    COL08     R0000004  1.9         
+RHS
+    RHS       R0000000  2.5            R0000001  2.1         
+    RHS       R0000002  4              R0000003  5           
+    RHS       R0000004  15          
+RANGES
+    RANGE     R0000003  3.2            R0000004  12          
+BOUNDS
+ LO BOUND     COL01     2.5         
+ UI BOUND     COL02     4.1         
+ BV BOUND     COL03     1           
+ LO BOUND     COL05     0.5         
+ UP BOUND     COL05     4           
+ UP BOUND     COL08     4.3         
+ENDATA
@@ -0,0 +1,34 @@
+NAME          BLANK   
+ROWS
+ N  OBJROW
+ G  ROW01
+ L  ROW02
+ E  ROW03
+ L  ROW04
+ L  ROW05
+COLUMNS
+    C0000000  OBJROW    1              ROW01     3           
+    C0000000  ROW05     5.6         
+    C0000001  ROW01     1              ROW02     2           
+    C0000002  ROW02     1.1            ROW03     1           
+    C0000003  ROW01     -2             ROW04     2.8         
+    C0000004  OBJROW    2              ROW01     -1          
+    C0000004  ROW05     1           
+    C0000005  ROW03     1           
+    C0000006  ROW04     -1.2        
+    C0000007  OBJROW    -1             ROW01     -1          
+    C0000007  ROW05     1.9         
+RHS
+    RHS       ROW01     2.5            ROW02     2.1         
+    RHS       ROW03     4              ROW04     5           
+    RHS       ROW05     15          
+RANGES
+    RANGE     ROW04     3.2            ROW05     12          
+BOUNDS
+ LO BOUND     C0000000  2.5         
+ UI BOUND     C0000001  4.1         
+ BV BOUND     C0000002  1           
+ LO BOUND     C0000004  0.5         
+ UP BOUND     C0000004  4           
+ UP BOUND     C0000007  4.3         
+ENDATA
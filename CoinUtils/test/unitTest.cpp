@@ -20,10 +20,13 @@
 #include "CoinPackedVector.hpp"
 #include "CoinDenseVector.hpp"
 #include "CoinIndexedVector.hpp"
+#include "CoinFactorization.hpp"
+#include "CoinOslFactorization.hpp"
 #include "CoinPackedMatrix.hpp"
 #include "CoinMpsIO.hpp"
 #include "CoinLpIO.hpp"
 #include "CoinMessageHandler.hpp"
+#include "CoinSimd.hpp"
 void CoinModelUnitTest(const std::string & mpsDir,
                        const std::string & netlibDir, const std::string & testModel);
 // Function Prototypes. Function definitions is in this file.
@@ -190,6 +193,15 @@ int main (int argc, const char *argv[])
   testingMessage( "Testing CoinPackedMatrix\n" );
   CoinPackedMatrixUnitTest();
 
+  testingMessage( "Testing CoinFactorization\n" );
+  CoinFactorizationUnitTest(mpsDir);
+
+  testingMessage( "Testing CoinOslFactorization\n" );
+  CoinOslFactorizationUnitTest(mpsDir);
+
+  testingMessage( "Testing CoinSimd\n" );
+  CoinSimdUnitTest();
+
 // At moment CoinDenseVector is not compiling with MS V C++ V6
 #if 1
   testingMessage( "Testing CoinDenseVector\n" );